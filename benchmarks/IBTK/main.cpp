@@ -0,0 +1,890 @@
+// Filename: main.cpp
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyCellDataOpsReal.h>
+#include <HierarchySideDataOpsReal.h>
+#include <LoadBalancer.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitStrategy.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/MemoryDatabase.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/CCPoissonPointRelaxationFACOperator.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/LinearSolver.h>
+#include <ibtk/PatchMathKernels.h>
+#include <ibtk/PatchMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+/*
+ * Forwards the hierarchy construction callbacks to the LDataManager, so that
+ * the synthetic hierarchy is refined about the Lagrangian point cloud and the
+ * Lagrangian data are initialized on the level that contains the structure.
+ */
+class LagrangianTagAndInitStrategy : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    LagrangianTagAndInitStrategy(LDataManager* l_data_manager) : d_l_data_manager(l_data_manager)
+    {
+        // intentionally blank
+        return;
+    } // LagrangianTagAndInitStrategy
+
+    void initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool can_be_refined,
+                             bool initial_time,
+                             Pointer<BasePatchLevel<NDIM> > old_level,
+                             bool allocate_data)
+    {
+        d_l_data_manager->setPatchHierarchy(hierarchy);
+        d_l_data_manager->setPatchLevels(0, hierarchy->getFinestLevelNumber());
+        d_l_data_manager->initializeLevelData(
+            hierarchy, level_number, init_data_time, can_be_refined, initial_time, old_level, allocate_data);
+        if (initial_time && d_l_data_manager->levelContainsLagrangianData(level_number))
+        {
+            d_l_data_manager->createLData("F", level_number, NDIM, /*manage_data*/ true);
+        }
+        return;
+    } // initializeLevelData
+
+    void resetHierarchyConfiguration(Pointer<BasePatchHierarchy<NDIM> > hierarchy, int coarsest_level, int finest_level)
+    {
+        d_l_data_manager->setPatchHierarchy(hierarchy);
+        d_l_data_manager->setPatchLevels(0, hierarchy->getFinestLevelNumber());
+        d_l_data_manager->resetHierarchyConfiguration(hierarchy, coarsest_level, finest_level);
+        return;
+    } // resetHierarchyConfiguration
+
+    void applyGradientDetector(Pointer<BasePatchHierarchy<NDIM> > hierarchy,
+                               int level_number,
+                               double error_data_time,
+                               int tag_index,
+                               bool initial_time,
+                               bool uses_richardson_extrapolation_too)
+    {
+        d_l_data_manager->applyGradientDetector(
+            hierarchy, level_number, error_data_time, tag_index, initial_time, uses_richardson_extrapolation_too);
+        return;
+    } // applyGradientDetector
+
+private:
+    LDataManager* const d_l_data_manager;
+};
+
+// Timing data for one benchmarked component.
+struct BenchmarkResult
+{
+    std::string name;
+    std::string variant;
+    int num_levels;
+    long num_cells;
+    long num_items;
+    int num_reps;
+    double total_time;
+};
+
+// The PatchMathOps stencil operations that are benchmarked.
+enum PatchOpType
+{
+    CC_LAPLACE,
+    SC_LAPLACE,
+    SC_TO_CC_DIV,
+    CC_TO_SC_GRAD,
+    SC_TO_CC_INTERP
+};
+
+// Function prototypes
+int write_structure(const std::string& structure_name,
+                    int num_lag_points,
+                    int num_spring_neighbors,
+                    double radius,
+                    double spring_stiffness,
+                    Pointer<CartesianGridGeometry<NDIM> > grid_geometry);
+
+void apply_patch_op(PatchOpType op_type,
+                    const PatchMathOps& patch_math_ops,
+                    Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                    int u_cc_idx,
+                    int f_cc_idx,
+                    int u_sc_idx,
+                    int f_sc_idx);
+
+void shift_lagrangian_points(LDataManager* l_data_manager, int finest_ln, double displacement);
+
+double start_timer();
+
+double stop_timer(double start_time);
+
+void record_result(std::vector<BenchmarkResult>& results,
+                   const std::string& name,
+                   const std::string& variant,
+                   int num_levels,
+                   long num_cells,
+                   long num_items,
+                   int num_reps,
+                   double local_time);
+
+void write_results(const std::vector<BenchmarkResult>& results, const std::string& output_basename);
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "benchmark.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Read the benchmark parameters.
+        Pointer<Database> bench_db = app_initializer->getComponentDatabase("Benchmark");
+        const int num_reps = bench_db->getIntegerWithDefault("num_reps", 10);
+        const int num_warmup_reps = bench_db->getIntegerWithDefault("num_warmup_reps", 1);
+        const int num_lag_points = bench_db->getInteger("num_lag_points");
+        const int num_spring_neighbors = bench_db->getIntegerWithDefault("num_spring_neighbors", 1);
+        const double radius = bench_db->getDouble("radius");
+        const double spring_stiffness = bench_db->getDoubleWithDefault("spring_stiffness", 1.0);
+        const double shift_fraction = bench_db->getDoubleWithDefault("redistribution_shift_fraction", 0.5);
+        const int tag_buffer = bench_db->getIntegerWithDefault("tag_buffer", 1);
+        const std::string output_basename = bench_db->getStringWithDefault("output_basename", "benchmark");
+        std::vector<std::string> kernel_fcns;
+        if (bench_db->keyExists("kernel_fcns"))
+        {
+            Array<std::string> kernel_fcns_arr = bench_db->getStringArray("kernel_fcns");
+            for (int k = 0; k < kernel_fcns_arr.getSize(); ++k) kernel_fcns.push_back(kernel_fcns_arr[k]);
+        }
+        else
+        {
+            kernel_fcns.push_back("IB_4");
+        }
+        int kernel_ghost_width = 1;
+        for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+        {
+            kernel_ghost_width = std::max(kernel_ghost_width, LEInteractor::getMinimumGhostWidth(kernel_fcns[k]));
+        }
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        LDataManager* l_data_manager = LDataManager::getManager("LDataManager",
+                                                                kernel_fcns.front(),
+                                                                kernel_fcns.front(),
+                                                                /*error_if_points_leave_domain*/ false,
+                                                                IntVector<NDIM>(kernel_ghost_width),
+                                                                /*register_for_restart*/ false);
+        Pointer<LagrangianTagAndInitStrategy> tag_and_init_strategy = new LagrangianTagAndInitStrategy(l_data_manager);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               tag_and_init_strategy,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Generate the synthetic Lagrangian structure and register it with the
+        // Lagrangian data manager.
+        Pointer<Database> ib_init_db = app_initializer->getComponentDatabase("IBStandardInitializer");
+        const std::string structure_name = ib_init_db->getStringArray("structure_names")[0];
+        const int num_springs = write_structure(
+            structure_name, num_lag_points, num_spring_neighbors, radius, spring_stiffness, grid_geometry);
+        Pointer<IBStandardInitializer> ib_initializer =
+            new IBStandardInitializer("IBStandardInitializer", ib_init_db);
+        l_data_manager->registerLInitStrategy(ib_initializer);
+
+        // Initialize the AMR patch hierarchy.  Finer levels are generated by
+        // tagging the cells that contain Lagrangian points.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        l_data_manager->freeLInitStrategy();
+        ib_initializer.setNull();
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        const int num_levels = finest_ln + 1;
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("benchmark");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(kernel_ghost_width));
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, IntVector<NDIM>(kernel_ghost_width));
+
+        // Allocate and initialize data on each level of the patch hierarchy.
+        long num_cells = 0;
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(u_sc_idx, 0.0);
+            level->allocatePatchData(f_sc_idx, 0.0);
+            const BoxArray<NDIM>& boxes = level->getBoxes();
+            for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+            {
+                num_cells += boxes[i].size();
+            }
+        }
+        HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(patch_hierarchy, 0, finest_ln);
+        HierarchySideDataOpsReal<NDIM, double> hier_sc_data_ops(patch_hierarchy, 0, finest_ln);
+        hier_cc_data_ops.setToScalar(u_cc_idx, 1.0, /*interior_only*/ false);
+        hier_cc_data_ops.setToScalar(f_cc_idx, 1.0, /*interior_only*/ false);
+        hier_sc_data_ops.setToScalar(u_sc_idx, 1.0, /*interior_only*/ false);
+        hier_sc_data_ops.setToScalar(f_sc_idx, 0.0, /*interior_only*/ false);
+
+        // Look up the Lagrangian data.
+        std::vector<Pointer<LData> > X_data(finest_ln + 1), U_data(finest_ln + 1), F_data(finest_ln + 1);
+        long num_lag_nodes = 0;
+        int ierr;
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+            X_data[ln] = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+            U_data[ln] = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, ln);
+            F_data[ln] = l_data_manager->getLData("F", ln);
+            ierr = VecSet(F_data[ln]->getVec(), 1.0);
+            IBTK_CHKERRQ(ierr);
+            num_lag_nodes += l_data_manager->getNumberOfNodes(ln);
+        }
+
+        pout << "Benchmark configuration:\n"
+             << "  NDIM = " << NDIM << ", processes = " << SAMRAI_MPI::getNodes() << "\n"
+             << "  levels = " << num_levels << ", cells = " << num_cells << "\n"
+             << "  Lagrangian nodes = " << num_lag_nodes << ", springs = " << num_springs << "\n"
+             << "  PatchMathKernels instruction set = " << PatchMathKernels::getInstructionSet() << "\n\n";
+
+        std::vector<BenchmarkResult> results;
+
+        // PatchMathOps stencils, using both the Fortran and the C++ kernels.
+        static const int NUM_PATCH_OPS = 5;
+        static const PatchOpType patch_op_types[NUM_PATCH_OPS] = {
+            CC_LAPLACE, SC_LAPLACE, SC_TO_CC_DIV, CC_TO_SC_GRAD, SC_TO_CC_INTERP
+        };
+        static const char* const patch_op_names[NUM_PATCH_OPS] = {
+            "patch_math_ops_cc_laplace",
+            "patch_math_ops_sc_laplace",
+            "patch_math_ops_sc_to_cc_div",
+            "patch_math_ops_cc_to_sc_grad",
+            "patch_math_ops_sc_to_cc_interp"
+        };
+        PatchMathOps patch_math_ops;
+        for (int variant = 0; variant < 2; ++variant)
+        {
+            const bool use_fortran_kernels = (variant == 0);
+            const std::string variant_name =
+                use_fortran_kernels ? "fortran" : std::string("cxx_") + PatchMathKernels::getInstructionSet();
+            patch_math_ops.setUseFortranKernels(use_fortran_kernels);
+            for (int k = 0; k < NUM_PATCH_OPS; ++k)
+            {
+                for (int rep = 0; rep < num_warmup_reps; ++rep)
+                {
+                    apply_patch_op(
+                        patch_op_types[k], patch_math_ops, patch_hierarchy, u_cc_idx, f_cc_idx, u_sc_idx, f_sc_idx);
+                }
+                const double start_time = start_timer();
+                for (int rep = 0; rep < num_reps; ++rep)
+                {
+                    apply_patch_op(
+                        patch_op_types[k], patch_math_ops, patch_hierarchy, u_cc_idx, f_cc_idx, u_sc_idx, f_sc_idx);
+                }
+                record_result(results,
+                              patch_op_names[k],
+                              variant_name,
+                              num_levels,
+                              num_cells,
+                              num_cells,
+                              num_reps,
+                              stop_timer(start_time));
+            }
+        }
+
+        // Ghost cell filling for cell-centered and side-centered data.
+        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        std::vector<RobinBcCoefStrategy<NDIM>*> u_sc_bc_coefs(NDIM, bc_coef);
+        InterpolationTransactionComponent u_cc_component(
+            u_cc_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false, bc_coef);
+        InterpolationTransactionComponent u_sc_component(
+            u_sc_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false, u_sc_bc_coefs);
+        HierarchyGhostCellInterpolation u_cc_fill_op, u_sc_fill_op;
+        u_cc_fill_op.initializeOperatorState(u_cc_component, patch_hierarchy);
+        u_sc_fill_op.initializeOperatorState(u_sc_component, patch_hierarchy);
+        for (int variant = 0; variant < 2; ++variant)
+        {
+            HierarchyGhostCellInterpolation& fill_op = (variant == 0 ? u_cc_fill_op : u_sc_fill_op);
+            for (int rep = 0; rep < num_warmup_reps; ++rep)
+            {
+                fill_op.fillData(0.0);
+            }
+            const double start_time = start_timer();
+            for (int rep = 0; rep < num_reps; ++rep)
+            {
+                fill_op.fillData(0.0);
+            }
+            record_result(results,
+                          "ghost_fill",
+                          variant == 0 ? "cc" : "sc",
+                          num_levels,
+                          num_cells,
+                          num_cells,
+                          num_reps,
+                          stop_timer(start_time));
+        }
+
+        // FAC V-cycles for the cell-centered Poisson problem, along with
+        // FGMRES solves that use a single FAC cycle as the preconditioner.
+        // Each is timed with smoothing performed in double and in single
+        // precision.  The domain is periodic, so the right-hand side must have
+        // mean zero, and the solvers are told that the constant vector spans the
+        // nullspace of the operator.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, finest_ln);
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        muParserCartGridFunction f_fcn(
+            "f_fcn", app_initializer->getComponentDatabase("SolverRightHandSide"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        Pointer<Database> fac_db = new MemoryDatabase("FACPreconditioner");
+        if (input_db->isDatabase("FACPreconditioner")) fac_db = input_db->getDatabase("FACPreconditioner");
+        Pointer<Database> krylov_db = new MemoryDatabase("krylov_db");
+        krylov_db->putString("ksp_type", "fgmres");
+        krylov_db->putDouble("rel_residual_tol", bench_db->getDoubleWithDefault("krylov_rel_residual_tol", 1.0e-8));
+        krylov_db->putInteger("max_iterations", 1000);
+        krylov_db->putBool("initial_guess_nonzero", false);
+        for (int variant = 0; variant < 2; ++variant)
+        {
+            const bool use_single_precision_smoother = (variant == 1);
+            const std::string variant_name =
+                std::string("cc_point_relaxation_") + (use_single_precision_smoother ? "single" : "double");
+            fac_db->putBool("use_single_precision_smoother", use_single_precision_smoother);
+            Pointer<PoissonSolver> fac_solver =
+                CCPoissonPointRelaxationFACOperator::allocate_solver("fac_solver", fac_db, "fac_");
+            fac_solver->setPoissonSpecifications(poisson_spec);
+            fac_solver->setPhysicalBcCoef(bc_coef);
+            LinearSolver* p_fac_solver = dynamic_cast<LinearSolver*>(fac_solver.getPointer());
+            if (p_fac_solver) p_fac_solver->setNullspace(true);
+            fac_solver->initializeSolverState(u_vec, f_vec);
+            for (int rep = 0; rep < num_warmup_reps; ++rep)
+            {
+                fac_solver->solveSystem(u_vec, f_vec);
+            }
+            {
+                const double start_time = start_timer();
+                for (int rep = 0; rep < num_reps; ++rep)
+                {
+                    fac_solver->solveSystem(u_vec, f_vec);
+                }
+                record_result(results,
+                              "fac_v_cycle",
+                              variant_name,
+                              num_levels,
+                              num_cells,
+                              num_cells,
+                              num_reps,
+                              stop_timer(start_time));
+            }
+            fac_solver->deallocateSolverState();
+
+            CCPoissonSolverManager* solver_manager = CCPoissonSolverManager::getManager();
+            Pointer<PoissonSolver> krylov_solver =
+                solver_manager->allocateSolver(CCPoissonSolverManager::PETSC_KRYLOV_SOLVER,
+                                               "krylov_solver",
+                                               krylov_db,
+                                               "krylov_",
+                                               CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER,
+                                               "krylov_pc",
+                                               fac_db,
+                                               "krylov_pc_");
+            krylov_solver->setPoissonSpecifications(poisson_spec);
+            krylov_solver->setPhysicalBcCoef(bc_coef);
+            LinearSolver* p_krylov_solver = dynamic_cast<LinearSolver*>(krylov_solver.getPointer());
+            if (p_krylov_solver) p_krylov_solver->setNullspace(true);
+            krylov_solver->initializeSolverState(u_vec, f_vec);
+            for (int rep = 0; rep < num_warmup_reps; ++rep)
+            {
+                krylov_solver->solveSystem(u_vec, f_vec);
+            }
+            {
+                int num_iterations = 0;
+                const double start_time = start_timer();
+                for (int rep = 0; rep < num_reps; ++rep)
+                {
+                    krylov_solver->solveSystem(u_vec, f_vec);
+                    num_iterations += krylov_solver->getNumIterations();
+                }
+                const double total_time = stop_timer(start_time);
+                pout << "fgmres_fac_solve " << variant_name << ": " << num_iterations / std::max(num_reps, 1)
+                     << " iterations per solve\n";
+                record_result(results,
+                              "fgmres_fac_solve",
+                              variant_name,
+                              num_levels,
+                              num_cells,
+                              num_iterations,
+                              num_reps,
+                              total_time);
+            }
+            krylov_solver->deallocateSolverState();
+        }
+
+        // Lagrangian-Eulerian interaction for each of the requested kernels.
+        u_sc_fill_op.fillData(0.0);
+        for (unsigned int k = 0; k < kernel_fcns.size(); ++k)
+        {
+            for (int rep = 0; rep < num_warmup_reps; ++rep)
+            {
+                l_data_manager->spread(f_sc_idx, F_data, X_data, kernel_fcns[k], NULL);
+                l_data_manager->interp(u_sc_idx, U_data, X_data, kernel_fcns[k]);
+            }
+            double start_time = start_timer();
+            for (int rep = 0; rep < num_reps; ++rep)
+            {
+                l_data_manager->spread(f_sc_idx, F_data, X_data, kernel_fcns[k], NULL);
+            }
+            record_result(results,
+                          "le_interactor_spread",
+                          kernel_fcns[k],
+                          num_levels,
+                          num_cells,
+                          num_lag_nodes,
+                          num_reps,
+                          stop_timer(start_time));
+            start_time = start_timer();
+            for (int rep = 0; rep < num_reps; ++rep)
+            {
+                l_data_manager->interp(u_sc_idx, U_data, X_data, kernel_fcns[k]);
+            }
+            record_result(results,
+                          "le_interactor_interp",
+                          kernel_fcns[k],
+                          num_levels,
+                          num_cells,
+                          num_lag_nodes,
+                          num_reps,
+                          stop_timer(start_time));
+        }
+
+        // Spring forces.
+        Pointer<IBStandardForceGen> force_gen = new IBStandardForceGen();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+            force_gen->initializeLevelData(patch_hierarchy, ln, 0.0, /*initial_time*/ true, l_data_manager);
+        }
+        {
+            double local_time = 0.0;
+            for (int rep = 0; rep < num_warmup_reps + num_reps; ++rep)
+            {
+                const double start_time = start_timer();
+                for (int ln = 0; ln <= finest_ln; ++ln)
+                {
+                    if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+                    force_gen->computeLagrangianForce(
+                        F_data[ln], X_data[ln], U_data[ln], patch_hierarchy, ln, 0.0, l_data_manager);
+                }
+                const double elapsed_time = stop_timer(start_time);
+                if (rep >= num_warmup_reps) local_time += elapsed_time;
+            }
+            record_result(results,
+                          "ib_standard_force_gen",
+                          "springs",
+                          num_levels,
+                          num_cells,
+                          num_springs,
+                          num_reps,
+                          local_time);
+        }
+
+        // Redistribution of the Lagrangian data.  The points are shifted back
+        // and forth by a fraction of the finest grid spacing before each
+        // redistribution, so that a fraction of the nodes change cells (and
+        // possibly patches) while the structure does not drift.
+        {
+            const double* const dx_coarsest = grid_geometry->getDx();
+            const IntVector<NDIM>& ratio = patch_hierarchy->getPatchLevel(finest_ln)->getRatio();
+            const double dx_finest = dx_coarsest[0] / static_cast<double>(ratio(0));
+            double local_time = 0.0;
+            for (int rep = 0; rep < num_warmup_reps + num_reps; ++rep)
+            {
+                shift_lagrangian_points(
+                    l_data_manager, finest_ln, (rep % 2 == 0 ? 1.0 : -1.0) * shift_fraction * dx_finest);
+                const double start_time = start_timer();
+                l_data_manager->beginDataRedistribution();
+                l_data_manager->endDataRedistribution();
+                const double elapsed_time = stop_timer(start_time);
+                if (rep >= num_warmup_reps) local_time += elapsed_time;
+            }
+            record_result(results,
+                          "ldata_manager_redistribution",
+                          "begin_end",
+                          num_levels,
+                          num_cells,
+                          num_lag_nodes,
+                          num_reps,
+                          local_time);
+        }
+
+        // Output the results.
+        write_results(results, output_basename);
+
+        // Deallocate the Eulerian data.
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(u_cc_idx);
+            level->deallocatePatchData(f_cc_idx);
+            level->deallocatePatchData(u_sc_idx);
+            level->deallocatePatchData(f_sc_idx);
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return 0;
+} // main
+
+int
+write_structure(const std::string& structure_name,
+                const int num_lag_points,
+                const int num_spring_neighbors,
+                const double radius,
+                const double spring_stiffness,
+                Pointer<CartesianGridGeometry<NDIM> > grid_geometry)
+{
+    static const double PI = 3.14159265358979323846;
+    const double* const x_lower = grid_geometry->getXLower();
+    const double* const x_upper = grid_geometry->getXUpper();
+    double x_center[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        x_center[d] = 0.5 * (x_lower[d] + x_upper[d]);
+    }
+
+    // The structure is a circle in 2D and a cylindrical shell whose axis is
+    // aligned with the z-axis in 3D.  Each node is connected by springs to its
+    // next num_spring_neighbors neighbors around the circumference, and in 3D
+    // also to the corresponding node on the next ring.
+#if (NDIM == 2)
+    const int num_rings = 1;
+    const int num_ring_nodes = std::max(num_lag_points, 3);
+    const double height = 0.0;
+#endif
+#if (NDIM == 3)
+    const double height = 0.5 * (x_upper[2] - x_lower[2]);
+    const int num_rings = std::max(
+        static_cast<int>(std::floor(std::sqrt(static_cast<double>(num_lag_points) * height / (2.0 * PI * radius)))),
+        1);
+    const int num_ring_nodes = std::max(num_lag_points / num_rings, 3);
+#endif
+    const int num_nodes = num_rings * num_ring_nodes;
+    const int num_neighbors = std::max(std::min(num_spring_neighbors, (num_ring_nodes - 1) / 2), 1);
+
+    std::vector<double> X(NDIM * num_nodes);
+    for (int r = 0; r < num_rings; ++r)
+    {
+        for (int j = 0; j < num_ring_nodes; ++j)
+        {
+            const int idx = r * num_ring_nodes + j;
+            const double theta = 2.0 * PI * static_cast<double>(j) / static_cast<double>(num_ring_nodes);
+            X[NDIM * idx] = x_center[0] + radius * std::cos(theta);
+            X[NDIM * idx + 1] = x_center[1] + radius * std::sin(theta);
+#if (NDIM == 3)
+            X[NDIM * idx + 2] = x_center[2] - 0.5 * height + height * (static_cast<double>(r) + 0.5) /
+                                                                 static_cast<double>(num_rings);
+#endif
+        }
+    }
+    NULL_USE(height);
+
+    std::vector<std::pair<int, int> > springs;
+    for (int r = 0; r < num_rings; ++r)
+    {
+        for (int j = 0; j < num_ring_nodes; ++j)
+        {
+            const int idx = r * num_ring_nodes + j;
+            for (int k = 1; k <= num_neighbors; ++k)
+            {
+                springs.push_back(std::make_pair(idx, r * num_ring_nodes + (j + k) % num_ring_nodes));
+            }
+            if (r + 1 < num_rings) springs.push_back(std::make_pair(idx, idx + num_ring_nodes));
+        }
+    }
+
+    if (SAMRAI_MPI::getRank() == 0)
+    {
+        std::ofstream vertex_stream((structure_name + ".vertex").c_str());
+        vertex_stream << num_nodes << "\n";
+        vertex_stream << std::setprecision(16);
+        for (int idx = 0; idx < num_nodes; ++idx)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                vertex_stream << X[NDIM * idx + d] << (d + 1 < NDIM ? " " : "\n");
+            }
+        }
+
+        std::ofstream spring_stream((structure_name + ".spring").c_str());
+        spring_stream << springs.size() << "\n";
+        spring_stream << std::setprecision(16);
+        for (unsigned int k = 0; k < springs.size(); ++k)
+        {
+            const int i = springs[k].first;
+            const int j = springs[k].second;
+            double rest_length_sq = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                rest_length_sq += (X[NDIM * j + d] - X[NDIM * i + d]) * (X[NDIM * j + d] - X[NDIM * i + d]);
+            }
+            spring_stream << i << " " << j << " " << spring_stiffness << " " << std::sqrt(rest_length_sq) << "\n";
+        }
+    }
+    SAMRAI_MPI::barrier();
+    return static_cast<int>(springs.size());
+} // write_structure
+
+void
+apply_patch_op(const PatchOpType op_type,
+               const PatchMathOps& patch_math_ops,
+               Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+               const int u_cc_idx,
+               const int f_cc_idx,
+               const int u_sc_idx,
+               const int f_sc_idx)
+{
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > u_cc_data = patch->getPatchData(u_cc_idx);
+            Pointer<CellData<NDIM, double> > f_cc_data = patch->getPatchData(f_cc_idx);
+            Pointer<SideData<NDIM, double> > u_sc_data = patch->getPatchData(u_sc_idx);
+            Pointer<SideData<NDIM, double> > f_sc_data = patch->getPatchData(f_sc_idx);
+            switch (op_type)
+            {
+            case CC_LAPLACE:
+                patch_math_ops.laplace(f_cc_data, 1.0, 0.0, u_cc_data, 0.0, Pointer<CellData<NDIM, double> >(), patch);
+                break;
+            case SC_LAPLACE:
+                patch_math_ops.laplace(f_sc_data, 1.0, 0.0, u_sc_data, 0.0, Pointer<SideData<NDIM, double> >(), patch);
+                break;
+            case SC_TO_CC_DIV:
+                patch_math_ops.div(f_cc_data, 1.0, u_sc_data, 0.0, Pointer<CellData<NDIM, double> >(), patch);
+                break;
+            case CC_TO_SC_GRAD:
+                patch_math_ops.grad(f_sc_data, 1.0, u_cc_data, 0.0, Pointer<SideData<NDIM, double> >(), patch);
+                break;
+            case SC_TO_CC_INTERP:
+                patch_math_ops.interp(f_cc_data, u_sc_data, patch);
+                break;
+            }
+        }
+    }
+    return;
+} // apply_patch_op
+
+void
+shift_lagrangian_points(LDataManager* const l_data_manager, const int finest_ln, const double displacement)
+{
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        for (int i = 0; i < static_cast<int>(X_data->getLocalNodeCount()); ++i)
+        {
+            X_array[i][0] += displacement;
+        }
+        X_data->restoreArrays();
+    }
+    return;
+} // shift_lagrangian_points
+
+double
+start_timer()
+{
+    SAMRAI_MPI::barrier();
+    return MPI_Wtime();
+} // start_timer
+
+double
+stop_timer(const double start_time)
+{
+    SAMRAI_MPI::barrier();
+    return MPI_Wtime() - start_time;
+} // stop_timer
+
+void
+record_result(std::vector<BenchmarkResult>& results,
+              const std::string& name,
+              const std::string& variant,
+              const int num_levels,
+              const long num_cells,
+              const long num_items,
+              const int num_reps,
+              const double local_time)
+{
+    BenchmarkResult result;
+    result.name = name;
+    result.variant = variant;
+    result.num_levels = num_levels;
+    result.num_cells = num_cells;
+    result.num_items = num_items;
+    result.num_reps = num_reps;
+    result.total_time = SAMRAI_MPI::maxReduction(local_time);
+    results.push_back(result);
+
+    const double time_per_rep = result.total_time / static_cast<double>(std::max(num_reps, 1));
+    pout << std::left << std::setw(34) << name << std::setw(22) << variant << std::right << std::scientific
+         << std::setprecision(4) << std::setw(14) << time_per_rep << " s/rep" << std::setw(14)
+         << time_per_rep / static_cast<double>(std::max(num_items, 1L)) << " s/item\n";
+    pout.unsetf(std::ios_base::floatfield);
+    return;
+} // record_result
+
+void
+write_results(const std::vector<BenchmarkResult>& results, const std::string& output_basename)
+{
+    if (SAMRAI_MPI::getRank() != 0) return;
+    const int num_procs = SAMRAI_MPI::getNodes();
+    const std::string instruction_set = PatchMathKernels::getInstructionSet();
+
+    std::ofstream json_stream((output_basename + ".json").c_str());
+    json_stream << std::setprecision(9);
+    json_stream << "{\n"
+                << "  \"dimension\": " << NDIM << ",\n"
+                << "  \"num_procs\": " << num_procs << ",\n"
+                << "  \"instruction_set\": \"" << instruction_set << "\",\n"
+                << "  \"results\": [\n";
+    for (unsigned int k = 0; k < results.size(); ++k)
+    {
+        const BenchmarkResult& r = results[k];
+        const double time_per_rep = r.total_time / static_cast<double>(std::max(r.num_reps, 1));
+        json_stream << "    {\"name\": \"" << r.name << "\", \"variant\": \"" << r.variant
+                    << "\", \"num_levels\": " << r.num_levels << ", \"num_cells\": " << r.num_cells
+                    << ", \"num_items\": " << r.num_items << ", \"num_reps\": " << r.num_reps
+                    << ", \"total_time\": " << r.total_time << ", \"time_per_rep\": " << time_per_rep
+                    << ", \"time_per_item\": " << time_per_rep / static_cast<double>(std::max(r.num_items, 1L))
+                    << "}" << (k + 1 < results.size() ? "," : "") << "\n";
+    }
+    json_stream << "  ]\n"
+                << "}\n";
+
+    std::ofstream csv_stream((output_basename + ".csv").c_str());
+    csv_stream << std::setprecision(9);
+    csv_stream << "name,variant,dimension,num_procs,num_levels,num_cells,num_items,num_reps,total_time,time_per_rep,"
+                  "time_per_item\n";
+    for (unsigned int k = 0; k < results.size(); ++k)
+    {
+        const BenchmarkResult& r = results[k];
+        const double time_per_rep = r.total_time / static_cast<double>(std::max(r.num_reps, 1));
+        csv_stream << r.name << "," << r.variant << "," << NDIM << "," << num_procs << "," << r.num_levels << ","
+                   << r.num_cells << "," << r.num_items << "," << r.num_reps << "," << r.total_time << ","
+                   << time_per_rep << "," << time_per_rep / static_cast<double>(std::max(r.num_items, 1L)) << "\n";
+    }
+    return;
+} // write_results
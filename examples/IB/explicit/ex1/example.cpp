@@ -228,6 +228,14 @@ run_example(int argc, char* argv[])
             ib_method_ops->registerLSiloDataWriter(silo_data_writer);
         }
 
+        // Read any Lagrangian data values that were written to separate
+        // restart files.
+        if (is_from_restart)
+        {
+            ib_method_ops->getLDataManager()->readLDataFromRestartFile(app_initializer->getRestartReadDirectory(),
+                                                                       app_initializer->getRestartRestoreNumber());
+        }
+
         // Initialize hierarchy configuration and data on all patches.
         time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
 
@@ -245,6 +253,7 @@ run_example(int argc, char* argv[])
         {
             pout << "\nWriting restart files...\n\n";
             RestartManager::getManager()->writeRestartFile(restart_dump_dirname, 0);
+            ib_method_ops->getLDataManager()->writeLDataToRestartFile(restart_dump_dirname, 0);
         }
 
         // Write out initial visualization data.
@@ -297,6 +306,7 @@ run_example(int argc, char* argv[])
             {
                 pout << "\nWriting restart files...\n\n";
                 RestartManager::getManager()->writeRestartFile(restart_dump_dirname, iteration_num);
+                ib_method_ops->getLDataManager()->writeLDataToRestartFile(restart_dump_dirname, iteration_num);
             }
             if (dump_timer_data && (iteration_num % timer_dump_interval == 0 || last_step))
             {
@@ -109,6 +109,9 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ ghost_cell_width = 1                         // ghost cell width of solver data
+ smoother_sweeps_per_exchange = 1             // smoothing sweeps between ghost cell fills (<= ghost_cell_width)
+ use_single_precision_smoother = FALSE        // PATCH_GAUSS_SEIDEL sweeps use single-precision data
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -116,6 +119,12 @@ namespace IBTK
     num_post_relax_steps = 2
  }
  \endverbatim
+ *
+ * \note With \p smoother_sweeps_per_exchange = S > 1, the sweeps performed
+ * between ghost cell fills read ghost cell values from neighboring patches on
+ * the same level that are up to S-1 sweeps out of date.  The smoothed error is
+ * therefore not the same as the one obtained with S = 1, and the convergence
+ * rate of the preconditioned solver may differ.
 */
 class CCPoissonPointRelaxationFACOperator : public PoissonFACPreconditionerStrategy
 {
@@ -157,6 +166,9 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV" (Jacobi-preconditioned Chebyshev polynomial smoother)
+     *
+     * \note The \c "CHEBYSHEV" smoother requires constant coefficients.
      */
     void setSmootherType(const std::string& smoother_type);
 
@@ -275,6 +287,14 @@ private:
      */
     std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bc_box_overlap;
     std::vector<std::vector<std::map<int, SAMRAI::hier::Box<NDIM> > > > d_patch_neighbor_overlap;
+
+    /*
+     * Single-precision copies of the error and residual on patches that are
+     * smoothed using single-precision data (NULL on all other patches).
+     */
+    std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, float> > > > d_patch_single_error_data;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, float> > > >
+        d_patch_single_residual_data;
 };
 } // namespace IBTK
 
@@ -79,9 +79,26 @@ public:
     /*!
      * \brief Set whether the class is filling homogeneous or inhomogeneous
      * boundary conditions.
+     *
+     * \note Callers that request homogeneous boundary conditions should reset
+     * this flag to false once the coefficients have been set, so that later
+     * callers that do not set the flag obtain the inhomogeneous coefficients.
      */
     virtual void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Indicates whether the boundary condition coefficients are
+     * independent of time.
+     *
+     * Coefficients that are independent of time, and that do not depend on the
+     * values of the target patch data, may be cached by the objects that set
+     * physical boundary conditions and reused until the patch hierarchy is
+     * regridded.
+     *
+     * \note A default implementation is provided that returns false.
+     */
+    virtual bool isTimeIndependent() const;
+
     //\}
 
 protected:
@@ -54,6 +54,7 @@
 #include "VariableContext.h"
 #include "boost/multi_array.hpp"
 #include "boost/unordered_map.hpp"
+#include "ibtk/WorkloadModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/elem.h"
@@ -544,9 +545,50 @@ public:
 
     /*!
      * \brief Update the cell workload estimate.
+     *
+     * The workload per cell is defined by
+     *
+     *    workload(i) += beta_work*qp_count(i)
+     *
+     * in which beta_work defaults to the value 1.  When workload calibration is
+     * enabled, beta_work is reset to the measured cost of a quadrature point
+     * relative to that of a cell whenever a full calibration window of timings
+     * is available, and the measured per-patch interaction overhead is added
+     * to the workload of each patch that contains quadrature points (see
+     * WorkloadModel::addPatchCostToWorkload()).
+     *
+     * \see setWorkloadCalibrationWindow
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Set the number of time steps over which spreading, interpolation,
+     * and fluid solver timings are accumulated to calibrate the workload
+     * estimates.  A window size of zero, which is the default, disables
+     * calibration.
+     */
+    void setWorkloadCalibrationWindow(int window_size);
+
+    /*!
+     * \brief Record the wall clock time spent solving the Eulerian equations
+     * during one time step.
+     *
+     * \note When workload calibration is enabled, this method must be called
+     * once per time step by all MPI processes.
+     */
+    void recordEulerianWorkloadSample(double wall_time);
+
+    /*!
+     * \brief Record wall clock time spent on Lagrangian work that is not
+     * accounted for by spread() or interp(), such as force evaluation.
+     */
+    void recordLagrangianWorkloadSample(double wall_time);
+
+    /*!
+     * \brief Get the model used to calibrate the workload estimates.
+     */
+    const WorkloadModel& getWorkloadModel() const;
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.  The level number indicates that of
@@ -776,6 +818,14 @@ private:
      */
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
+    double d_beta_work;
+    WorkloadModel d_workload_model;
+
+    /*
+     * The number of quadrature points assigned to this process by the most
+     * recent call to updateQuadPointCountData().
+     */
+    int d_num_local_qps;
 
     /*
      * The default kernel functions and quadrature rule used to mediate
@@ -294,8 +294,13 @@ public:
 
     /*!
      * \brief Write out object state to the given database.
+     *
+     * \note When \a put_values is false, only the layout of the data is
+     * written, and an LData object constructed from the database has zero
+     * values until the values are read back in by
+     * LDataManager::readLDataFromRestartFile().
      */
-    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+    void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db, bool put_values = true);
 
 private:
     /*!
@@ -61,6 +61,7 @@
 #include "ibtk/LNodeSetVariable.h"
 #include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ParallelSet.h"
+#include "ibtk/WorkloadModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscao.h"
 #include "petscvec.h"
@@ -72,6 +73,7 @@ namespace IBTK
 class LData;
 class LMesh;
 class LNode;
+class LNodeCSRData;
 class RobinPhysBdryPatchStrategy;
 } // namespace IBTK
 namespace SAMRAI
@@ -80,6 +82,8 @@ namespace hier
 {
 template <int DIM>
 class BasePatchHierarchy;
+template <int DIM>
+class Patch;
 } // namespace hier
 namespace tbox
 {
@@ -122,6 +126,12 @@ public:
      */
     static const std::string VEL_DATA_NAME;
 
+    /*!
+     * The name of the LData that specifies the reference positions used to
+     * measure the displacements of the curvilinear mesh nodes.
+     */
+    static const std::string DISP_REF_DATA_NAME;
+
     /*!
      * Return a pointer to the instance of the Lagrangian data manager
      * corresponding to the specified name.  Access to LDataManager objects is
@@ -568,6 +578,26 @@ public:
     SAMRAI::tbox::Pointer<LData>
     createLData(const std::string& quantity_name, int level_number, unsigned int depth = 1, bool maintain_data = false);
 
+    /*!
+     * \brief Reset the reference positions used to measure the displacements
+     * of the Lagrangian nodes to the present positions of the nodes.
+     *
+     * The reference positions are maintained as the patch hierarchy evolves.
+     */
+    void resetNodeDisplacements(int coarsest_ln = -1, int finest_ln = -1);
+
+    /*!
+     * \brief Compute the maximum displacement of any Lagrangian node from its
+     * reference position, measured in units of the grid spacing of the level
+     * of the patch hierarchy to which the node is assigned.
+     *
+     * \note Levels for which resetNodeDisplacements() has not been called are
+     * skipped.
+     *
+     * \note This method is collective.
+     */
+    double computeMaxNodeDisplacement(int coarsest_ln = -1, int finest_ln = -1) const;
+
     /*!
      * \brief Get the patch data descriptor index for the Lagrangian index data.
      */
@@ -754,6 +784,29 @@ public:
      */
     void scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const;
 
+    /*!
+     * \brief Set whether beginDataRedistribution() uses the flat binning
+     * algorithm.
+     *
+     * The flat algorithm computes the new cell index of each local node once
+     * per level and bins the nodes of each patch by radix sorting keys formed
+     * from the cell offset within the patch box and the Lagrangian index,
+     * instead of inserting nodes into per-cell node sets one at a time and
+     * then sorting each set.  Both algorithms produce the same node sets.
+     */
+    void setUseFlatDataRedistribution(bool use_flat_data_redistribution);
+
+    /*!
+     * \brief Set whether interp() and spread() use compressed sparse row (CSR)
+     * copies of the Lagrangian node index data.
+     *
+     * The CSR copy of the node index data of each patch is built the first time
+     * it is needed after the Lagrangian data are redistributed or the patch
+     * hierarchy is regridded.  Both code paths produce the same interpolated
+     * values; spread values agree up to floating-point roundoff.
+     */
+    void setUseCSRIndexData(bool use_csr_index_data);
+
     /*!
      * \brief Start the process of redistributing the Lagrangian data.
      *
@@ -765,6 +818,11 @@ public:
      * C*dx*|U| with C <= 1.  This restriction prevents nodes from moving more
      * than one cell width per timestep.
      *
+     * \note The patch hierarchy need not be regridded between the calls to
+     * beginDataRedistribution() and endDataRedistribution().  Calling the two
+     * methods in succession reassigns nodes to the patches of the present
+     * patch hierarchy configuration without modifying any Eulerian data.
+     *
      * \see endDataRedistribution
      */
     void beginDataRedistribution(int coarsest_ln = -1, int finest_ln = -1);
@@ -787,6 +845,19 @@ public:
      */
     void endDataRedistribution(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Get the number of LData objects and the number of bytes of
+     * Lagrangian data that were migrated to this process by the most recent
+     * call to endDataRedistribution().
+     *
+     * Only the values of the nodes that were owned by another process before
+     * the redistribution are counted.
+     *
+     * \note The time spent migrating the LData objects is reported by the
+     * timer "IBTK::LDataManager::endDataRedistribution()[migrate_lag_data]".
+     */
+    void getDataMigrationStatistics(int& num_fields, size_t& num_bytes) const;
+
     /*!
      * \brief Update the workload and count of nodes per cell.
      *
@@ -797,10 +868,53 @@ public:
      *
      *    workload(i) = 1 + beta_work*node_count(i)
      *
-     * in which alpha and beta are parameters that each default to the value 1.
+     * in which beta_work is a parameter that defaults to the value 1.
+     *
+     * When workload calibration is enabled, beta_work is reset to the measured
+     * cost of a node relative to that of a cell whenever a full calibration
+     * window of timings is available, and the measured per-patch interaction
+     * overhead is added to the workload of each patch that contains nodes (see
+     * WorkloadModel::addPatchCostToWorkload()).
+     *
+     * \see setWorkloadCalibrationWindow
      */
     void updateWorkloadEstimates(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \brief Set the number of time steps over which spreading, interpolation,
+     * force evaluation, and fluid solver timings are accumulated to calibrate
+     * the workload estimates.  A window size of zero, which is the default,
+     * disables calibration.
+     */
+    void setWorkloadCalibrationWindow(int window_size);
+
+    /*!
+     * \brief Record the wall clock time spent solving the Eulerian equations
+     * during one time step.
+     *
+     * \note When workload calibration is enabled, this method must be called
+     * once per time step by all MPI processes.
+     */
+    void recordEulerianWorkloadSample(double wall_time);
+
+    /*!
+     * \brief Record wall clock time spent on Lagrangian work that is not
+     * accounted for by spread() or interp(), such as force evaluation.
+     */
+    void recordLagrangianWorkloadSample(double wall_time);
+
+    /*!
+     * \brief Record the wall clock time spent spreading to or interpolating from
+     * a single patch with the specified number of local nodes by routines
+     * other than spread() or interp(), which record their own timings.
+     */
+    void recordInteractionWorkloadSample(int num_nodes, double wall_time);
+
+    /*!
+     * \brief Get the model used to calibrate the workload estimates.
+     */
+    const WorkloadModel& getWorkloadModel() const;
+
     /*!
      * \brief Update the count of nodes per cell.
      *
@@ -896,6 +1010,52 @@ public:
      */
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
+    /*!
+     * \brief Indicate whether the values of the Lagrangian data are to be
+     * written to separate restart files by writeLDataToRestartFile() instead
+     * of to the restart database.
+     *
+     * When this option is enabled, putToDatabase() writes only the layout of
+     * each LData object, and the values must be restored by a subsequent call
+     * to readLDataFromRestartFile().  This option is set from the
+     * use_collective_restart_io input key of IBAMR::IBMethod.
+     */
+    void setUseCollectiveRestartIO(bool use_collective_restart_io);
+
+    /*!
+     * \brief Write the values of all Lagrangian data to restart files in the
+     * specified directory.
+     *
+     * Each LData object is written collectively to a single PETSc binary file
+     * per level in which the nodes are stored in global Lagrangian order.
+     * Only locally owned nodes are written by each process, so that the file
+     * does not depend on the number of processes.
+     *
+     * \note This method does nothing unless collective restart I/O has been
+     * enabled by setUseCollectiveRestartIO(), so that it may be called
+     * unconditionally alongside SAMRAI::tbox::RestartManager::writeRestartFile().
+     *
+     * \note This method must be called by all MPI processes.
+     */
+    void writeLDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number);
+
+    /*!
+     * \brief Read the values of all Lagrangian data from restart files written
+     * by writeLDataToRestartFile().
+     *
+     * Values are distributed according to the present distribution of the
+     * Lagrangian nodes, which need not match the one in use when the files
+     * were written.
+     *
+     * \note This method does nothing unless the restart database indicates
+     * that the values were written by writeLDataToRestartFile().  In that case,
+     * it must be called before the patch hierarchy is initialized; otherwise,
+     * resetHierarchyConfiguration() aborts the run.
+     *
+     * \note This method must be called by all MPI processes.
+     */
+    void readLDataFromRestartFile(const std::string& restart_read_dirname, unsigned int restart_restore_number);
+
 protected:
     /*!
      * \brief Constructor.
@@ -965,6 +1125,13 @@ private:
      */
     void endNonlocalDataFill(int coarsest_ln = -1, int finest_ln = -1);
 
+    /*!
+     * \return The CSR copy of the Lagrangian node index data of the specified
+     * patch, building it if necessary.
+     */
+    SAMRAI::tbox::Pointer<LNodeCSRData> getCSRIndexData(int level_number,
+                                                        SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
     /*!
      * Determines the global Lagrangian and PETSc indices of the local and
      * nonlocal nodes associated with the processor as well as the local PETSc
@@ -1073,6 +1240,7 @@ private:
      * balancing.
      */
     double d_beta_work;
+    WorkloadModel d_workload_model;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_workload_var;
     int d_workload_idx;
     bool d_output_workload;
@@ -1098,6 +1266,38 @@ private:
      */
     bool d_error_if_points_leave_domain;
 
+    /*
+     * Whether to use the flat binning algorithm to redistribute Lagrangian
+     * nodes.
+     */
+    bool d_use_flat_data_redistribution;
+
+    /*
+     * Whether interp() and spread() use CSR copies of the Lagrangian node index
+     * data, and the cached copies for each patch of each level.
+     */
+    bool d_use_csr_index_data;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<LNodeCSRData> > > d_lag_node_csr_data;
+
+    /*
+     * Whether the values of the Lagrangian data are written to separate
+     * restart files instead of to the restart database.
+     */
+    bool d_use_collective_restart_io;
+
+    /*
+     * Whether the values of the Lagrangian data restored from the restart
+     * database still need to be read from separate restart files.
+     */
+    bool d_ldata_values_pending_restart_read;
+
+    /*
+     * The number of LData objects and the number of bytes of Lagrangian data
+     * migrated to this process by the most recent data redistribution.
+     */
+    int d_migrated_field_count;
+    size_t d_migrated_byte_count;
+
     /*
      * SAMRAI::hier::IntVector object that determines the ghost cell width of
      * the LNodeData SAMRAI::hier::PatchData objects.
@@ -57,6 +57,7 @@ namespace IBTK
 class LData;
 template <class T>
 class LIndexSetData;
+class LNodeCSRData;
 } // namespace IBTK
 namespace SAMRAI
 {
@@ -91,6 +92,9 @@ namespace IBTK
  * to interpolate data from Eulerian grid patches onto Lagrangian meshes and to
  * spread values (\em not densities) from Lagrangian meshes to Eulerian grid
  * patches.
+ *
+ * Indexing information for the Lagrangian nodes may be provided either by an
+ * LIndexSetData object (e.g., LNodeSetData) or by an LNodeCSRData object.
  */
 class LEInteractor
 {
@@ -155,6 +159,21 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh using
+     * the indexing data stored in an LNodeCSRData object.
+     *
+     * \see interpolate()
+     */
+    static void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                            SAMRAI::tbox::Pointer<LData> X_data,
+                            SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -180,6 +199,21 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh using
+     * the indexing data stored in an LNodeCSRData object.
+     *
+     * \see interpolate()
+     */
+    static void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                            SAMRAI::tbox::Pointer<LData> X_data,
+                            SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -205,6 +239,21 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh using
+     * the indexing data stored in an LNodeCSRData object.
+     *
+     * \see interpolate()
+     */
+    static void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                            SAMRAI::tbox::Pointer<LData> X_data,
+                            SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -230,6 +279,21 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh using
+     * the indexing data stored in an LNodeCSRData object.
+     *
+     * \see interpolate()
+     */
+    static void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                            SAMRAI::tbox::Pointer<LData> X_data,
+                            SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -257,6 +321,23 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh using
+     * the indexing data stored in an LNodeCSRData object.
+     *
+     * \see interpolate()
+     */
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -284,6 +365,23 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh using
+     * the indexing data stored in an LNodeCSRData object.
+     *
+     * \see interpolate()
+     */
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -311,6 +409,23 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh using
+     * the indexing data stored in an LNodeCSRData object.
+     *
+     * \see interpolate()
+     */
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -338,6 +453,23 @@ public:
                             const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                             const std::string& interp_fcn = "IB_4");
 
+    /*!
+     * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh using
+     * the indexing data stored in an LNodeCSRData object.
+     *
+     * \see interpolate()
+     */
+    static void interpolate(double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            int X_depth,
+                            SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                            const SAMRAI::hier::Box<NDIM>& interp_box,
+                            const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                            const std::string& interp_fcn = "IB_4");
+
     /*!
      * \brief Interpolate data from an Eulerian grid to a Lagrangian mesh.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -669,6 +801,21 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid using the
+     * indexing data stored in an LNodeCSRData object.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                       SAMRAI::tbox::Pointer<LData> Q_data,
+                       SAMRAI::tbox::Pointer<LData> X_data,
+                       SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -697,6 +844,21 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid using the
+     * indexing data stored in an LNodeCSRData object.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                       SAMRAI::tbox::Pointer<LData> Q_data,
+                       SAMRAI::tbox::Pointer<LData> X_data,
+                       SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -725,6 +887,21 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid using the
+     * indexing data stored in an LNodeCSRData object.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                       SAMRAI::tbox::Pointer<LData> Q_data,
+                       SAMRAI::tbox::Pointer<LData> X_data,
+                       SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -753,6 +930,21 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid using the
+     * indexing data stored in an LNodeCSRData object.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                       SAMRAI::tbox::Pointer<LData> Q_data,
+                       SAMRAI::tbox::Pointer<LData> X_data,
+                       SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -783,6 +975,23 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid using the
+     * indexing data stored in an LNodeCSRData object.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -813,6 +1022,23 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid using the
+     * indexing data stored in an LNodeCSRData object.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -843,6 +1069,23 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid using the
+     * indexing data stored in an LNodeCSRData object.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -873,6 +1116,23 @@ public:
                        const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                        const std::string& spread_fcn = "IB_4");
 
+    /*!
+     * \brief Spread data from a Lagrangian mesh to an Eulerian grid using the
+     * indexing data stored in an LNodeCSRData object.
+     *
+     * \see spread()
+     */
+    static void spread(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                       const double* Q_data,
+                       int Q_depth,
+                       const double* X_data,
+                       int X_depth,
+                       SAMRAI::tbox::Pointer<LNodeCSRData> idx_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                       const SAMRAI::hier::Box<NDIM>& spread_box,
+                       const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                       const std::string& spread_fcn = "IB_4");
+
     /*!
      * \brief Spread data from a Lagrangian mesh to an Eulerian grid.  The
      * positions of the nodes of the Lagrangian mesh are specified by X_data.
@@ -1288,6 +1548,246 @@ private:
                        const std::string& spread_fcn,
                        int axis = 0);
 
+    /*!
+     * \brief Implementation of interpolate() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void interpolateImpl(SAMRAI::tbox::Pointer<LData> Q_data,
+                                SAMRAI::tbox::Pointer<LData> X_data,
+                                SAMRAI::tbox::Pointer<IndexData> idx_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                const SAMRAI::hier::Box<NDIM>& interp_box,
+                                const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                const std::string& interp_fcn);
+
+    /*!
+     * \brief Implementation of interpolate() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void interpolateImpl(SAMRAI::tbox::Pointer<LData> Q_data,
+                                SAMRAI::tbox::Pointer<LData> X_data,
+                                SAMRAI::tbox::Pointer<IndexData> idx_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                const SAMRAI::hier::Box<NDIM>& interp_box,
+                                const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                const std::string& interp_fcn);
+
+    /*!
+     * \brief Implementation of interpolate() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void interpolateImpl(SAMRAI::tbox::Pointer<LData> Q_data,
+                                SAMRAI::tbox::Pointer<LData> X_data,
+                                SAMRAI::tbox::Pointer<IndexData> idx_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                const SAMRAI::hier::Box<NDIM>& interp_box,
+                                const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                const std::string& interp_fcn);
+
+    /*!
+     * \brief Implementation of interpolate() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void interpolateImpl(SAMRAI::tbox::Pointer<LData> Q_data,
+                                SAMRAI::tbox::Pointer<LData> X_data,
+                                SAMRAI::tbox::Pointer<IndexData> idx_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                const SAMRAI::hier::Box<NDIM>& interp_box,
+                                const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                const std::string& interp_fcn);
+
+    /*!
+     * \brief Implementation of interpolate() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void interpolateImpl(double* Q_data,
+                                int Q_depth,
+                                const double* X_data,
+                                int X_depth,
+                                SAMRAI::tbox::Pointer<IndexData> idx_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                const SAMRAI::hier::Box<NDIM>& interp_box,
+                                const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                const std::string& interp_fcn);
+
+    /*!
+     * \brief Implementation of interpolate() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void interpolateImpl(double* Q_data,
+                                int Q_depth,
+                                const double* X_data,
+                                int X_depth,
+                                SAMRAI::tbox::Pointer<IndexData> idx_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                const SAMRAI::hier::Box<NDIM>& interp_box,
+                                const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                const std::string& interp_fcn);
+
+    /*!
+     * \brief Implementation of interpolate() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void interpolateImpl(double* Q_data,
+                                int Q_depth,
+                                const double* X_data,
+                                int X_depth,
+                                SAMRAI::tbox::Pointer<IndexData> idx_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                const SAMRAI::hier::Box<NDIM>& interp_box,
+                                const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                const std::string& interp_fcn);
+
+    /*!
+     * \brief Implementation of interpolate() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void interpolateImpl(double* Q_data,
+                                int Q_depth,
+                                const double* X_data,
+                                int X_depth,
+                                SAMRAI::tbox::Pointer<IndexData> idx_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                const SAMRAI::hier::Box<NDIM>& interp_box,
+                                const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                const std::string& interp_fcn);
+
+    /*!
+     * \brief Implementation of spread() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void spreadImpl(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                           SAMRAI::tbox::Pointer<LData> Q_data,
+                           SAMRAI::tbox::Pointer<LData> X_data,
+                           SAMRAI::tbox::Pointer<IndexData> idx_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::Box<NDIM>& spread_box,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::string& spread_fcn);
+
+    /*!
+     * \brief Implementation of spread() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void spreadImpl(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                           SAMRAI::tbox::Pointer<LData> Q_data,
+                           SAMRAI::tbox::Pointer<LData> X_data,
+                           SAMRAI::tbox::Pointer<IndexData> idx_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::Box<NDIM>& spread_box,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::string& spread_fcn);
+
+    /*!
+     * \brief Implementation of spread() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void spreadImpl(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                           SAMRAI::tbox::Pointer<LData> Q_data,
+                           SAMRAI::tbox::Pointer<LData> X_data,
+                           SAMRAI::tbox::Pointer<IndexData> idx_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::Box<NDIM>& spread_box,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::string& spread_fcn);
+
+    /*!
+     * \brief Implementation of spread() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void spreadImpl(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                           SAMRAI::tbox::Pointer<LData> Q_data,
+                           SAMRAI::tbox::Pointer<LData> X_data,
+                           SAMRAI::tbox::Pointer<IndexData> idx_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::Box<NDIM>& spread_box,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::string& spread_fcn);
+
+    /*!
+     * \brief Implementation of spread() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void spreadImpl(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > q_data,
+                           const double* Q_data,
+                           int Q_depth,
+                           const double* X_data,
+                           int X_depth,
+                           SAMRAI::tbox::Pointer<IndexData> idx_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::Box<NDIM>& spread_box,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::string& spread_fcn);
+
+    /*!
+     * \brief Implementation of spread() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void spreadImpl(SAMRAI::tbox::Pointer<SAMRAI::pdat::NodeData<NDIM, double> > q_data,
+                           const double* Q_data,
+                           int Q_depth,
+                           const double* X_data,
+                           int X_depth,
+                           SAMRAI::tbox::Pointer<IndexData> idx_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::Box<NDIM>& spread_box,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::string& spread_fcn);
+
+    /*!
+     * \brief Implementation of spread() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void spreadImpl(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > q_data,
+                           const double* Q_data,
+                           int Q_depth,
+                           const double* X_data,
+                           int X_depth,
+                           SAMRAI::tbox::Pointer<IndexData> idx_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::Box<NDIM>& spread_box,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::string& spread_fcn);
+
+    /*!
+     * \brief Implementation of spread() for the supported types of
+     * Lagrangian index patch data.
+     */
+    template <class IndexData>
+    static void spreadImpl(SAMRAI::tbox::Pointer<SAMRAI::pdat::EdgeData<NDIM, double> > q_data,
+                           const double* Q_data,
+                           int Q_depth,
+                           const double* X_data,
+                           int X_depth,
+                           SAMRAI::tbox::Pointer<IndexData> idx_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::Box<NDIM>& spread_box,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                           const std::string& spread_fcn);
+
     /*!
      * \brief Compute the local PETSc indices located within the provided box
      * based on the LNodeIndexSetData values.
@@ -1300,6 +1800,17 @@ private:
                                   const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
                                   SAMRAI::tbox::Pointer<LIndexSetData<T> > idx_data);
 
+    /*!
+     * \brief Compute the local PETSc indices located within the provided box
+     * based on the LNodeCSRData values.
+     */
+    static void buildLocalIndices(std::vector<int>& local_indices,
+                                  std::vector<double>& periodic_shifts,
+                                  const SAMRAI::hier::Box<NDIM>& box,
+                                  SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                  const SAMRAI::hier::IntVector<NDIM>& periodic_shift,
+                                  SAMRAI::tbox::Pointer<LNodeCSRData> idx_data);
+
     /*!
      * \brief Compute the local PETSc indices located within the provided box
      * based on the positions of the Lagrangian mesh nodes.
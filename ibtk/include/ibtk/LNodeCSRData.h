@@ -0,0 +1,427 @@
+// Filename: LNodeCSRData.h
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LNodeCSRData
+#define included_IBTK_LNodeCSRData
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <vector>
+
+#include "Box.h"
+#include "CellIterator.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "PatchData.h"
+#include "ibtk/LNodeCSRDataIterator.h"
+#include "ibtk/ibtk_utilities.h"
+#include "tbox/Pointer.h"
+
+namespace IBTK
+{
+template <class T>
+class LSetData;
+} // namespace IBTK
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class BoxOverlap;
+template <int DIM>
+class Patch;
+} // namespace hier
+namespace tbox
+{
+class AbstractStream;
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LNodeCSRData is a SAMRAI::hier::PatchData object that stores the
+ * indexing information of the Lagrangian nodes that are embedded in a Cartesian
+ * grid patch in compressed sparse row (CSR) form.
+ *
+ * The nodes are sorted by the cell that contains them.  For each cell in the
+ * ghost box of the patch data object, a pair of cell offsets delimits the
+ * nodes in that cell within flat arrays of Lagrangian indices, global and
+ * local PETSc indices, periodic offsets, and periodic displacements.  Unlike
+ * LNodeSetData and LNodeIndexSetData, which store a reference-counted object
+ * per node and a vector of such objects per cell, no per-node or per-cell heap
+ * allocations are required, and data are packed into and unpacked from message
+ * streams as contiguous arrays.
+ *
+ * Class LNodeCSRData provides the same indexing interface as LIndexSetData, so
+ * that it may be used in place of LNodeIndexSetData, e.g., by LEInteractor.
+ * Additional Streamable data associated with the Lagrangian nodes are not
+ * stored.
+ *
+ * \see LIndexSetData
+ */
+class LNodeCSRData : public SAMRAI::hier::PatchData<NDIM>
+{
+public:
+    /*!
+     * This iterator iterates over the elements of a cell centered box geometry.
+     */
+    typedef SAMRAI::pdat::CellIterator<NDIM> CellIterator;
+
+    /*!
+     * This iterator iterates over the Lagrangian nodes located within a cell
+     * centered box geometry.
+     */
+    typedef LNodeCSRDataIterator DataIterator;
+
+    /*!
+     * Return an iterator to the first Lagrangian node in the specified region
+     * of index space.
+     */
+    DataIterator data_begin(const SAMRAI::hier::Box<NDIM>& box) const;
+
+    /*!
+     * Return an iterator pointing to the end of the collection of Lagrangian
+     * nodes associated with the patch data object.
+     */
+    DataIterator data_end() const;
+
+    /*!
+     * The constructor for an LNodeCSRData object.  The box describes the
+     * interior of the index space and the ghosts vector describes the ghost
+     * nodes in each coordinate direction.
+     */
+    LNodeCSRData(const SAMRAI::hier::Box<NDIM>& box, const SAMRAI::hier::IntVector<NDIM>& ghosts);
+
+    /*!
+     * The virtual destructor for an LNodeCSRData object.
+     */
+    virtual ~LNodeCSRData();
+
+    /*!
+     * \brief Reset the data stored in this object to correspond to the nodes
+     * stored in the provided LSetData object.
+     *
+     * \note Class T must provide the interface of class LNodeIndex.
+     */
+    template <class T>
+    void copyFromLSetData(const LSetData<T>& set_data);
+
+    /*!
+     * \brief Remove all nodes from the patch data object.
+     */
+    void removeAllItems();
+
+    /*!
+     * \return The total number of nodes stored in the patch data object
+     * (including the ghost cell region).
+     */
+    int getNumberOfNodes() const;
+
+    /*!
+     * \return The number of nodes located in the specified cell.
+     */
+    int getNumberOfNodes(const SAMRAI::hier::Index<NDIM>& i) const;
+
+    /*!
+     * \return A constant reference to the CSR cell offsets.  The nodes located
+     * in the cell with (column-major) offset k in the ghost box are the nodes
+     * with positions cell_offsets[k], ..., cell_offsets[k+1]-1 in the flat node
+     * arrays.
+     */
+    const std::vector<int>& getCellOffsets() const;
+
+    /*!
+     * \return The periodic offset of the node with position k in the flat node
+     * arrays.
+     */
+    SAMRAI::hier::IntVector<NDIM> getPeriodicOffset(int k) const;
+
+    /*!
+     * \return The periodic displacement of the node with position k in the flat
+     * node arrays.
+     */
+    Vector getPeriodicDisplacement(int k) const;
+
+    /*!
+     * \brief Update the cached indexing data.
+     */
+    void cacheLocalIndices(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+
+    /*!
+     * \return A constant reference to the set of Lagrangian data indices that
+     * lie in the patch (including the ghost cell region).
+     *
+     * \note These indices are stored in cell order.
+     */
+    const std::vector<int>& getLagrangianIndices() const;
+
+    /*!
+     * \return A constant reference to the set of Lagrangian data indices that
+     * lie in the patch interior.
+     */
+    const std::vector<int>& getInteriorLagrangianIndices() const;
+
+    /*!
+     * \return A constant reference to the set of Lagrangian data indices that
+     * lie in the ghost cell region of the patch data object.
+     */
+    const std::vector<int>& getGhostLagrangianIndices() const;
+
+    /*!
+     * \return A constant reference to the set of global PETSc data indices that
+     * lie in the patch (including the ghost cell region).
+     *
+     * \note These indices are stored in cell order.
+     */
+    const std::vector<int>& getGlobalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the set of global PETSc data indices that
+     * lie in the patch interior.
+     */
+    const std::vector<int>& getInteriorGlobalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the set of global PETSc data indices that
+     * lie in the ghost cell region of the patch data object.
+     */
+    const std::vector<int>& getGhostGlobalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the set of local PETSc data indices that
+     * lie in the patch (including the ghost cell region).
+     *
+     * \note These indices are stored in cell order.
+     */
+    const std::vector<int>& getLocalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the set of local PETSc data indices that
+     * lie in the patch interior.
+     */
+    const std::vector<int>& getInteriorLocalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the set of local PETSc data indices that
+     * lie in the ghost cell region of the patch data object.
+     */
+    const std::vector<int>& getGhostLocalPETScIndices() const;
+
+    /*!
+     * \return A constant reference to the periodic shifts for the indices that
+     * lie in the patch (including the ghost cell region).
+     */
+    const std::vector<double>& getPeriodicShifts() const;
+
+    /*!
+     * \return A constant reference to the periodic shifts for the indices that
+     * lie in the patch interior.
+     */
+    const std::vector<double>& getInteriorPeriodicShifts() const;
+
+    /*!
+     * \return A constant reference to the periodic shifts for the indices that
+     * lie in the ghost cell region of the patch data object.
+     */
+    const std::vector<double>& getGhostPeriodicShifts() const;
+
+    /*!
+     * \name Implementation of SAMRAI::hier::PatchData interface.
+     */
+    //\{
+
+    /*!
+     * \brief Copy data from the source into the destination where the two
+     * patch data objects intersect.
+     */
+    void copy(const SAMRAI::hier::PatchData<NDIM>& src);
+
+    /*!
+     * \brief Copy data from the source into the destination where the two
+     * patch data objects intersect.
+     */
+    void copy2(SAMRAI::hier::PatchData<NDIM>& dst) const;
+
+    /*!
+     * \brief Copy data from the source into the destination using the
+     * specified overlap descriptor.
+     */
+    void copy(const SAMRAI::hier::PatchData<NDIM>& src, const SAMRAI::hier::BoxOverlap<NDIM>& overlap);
+
+    /*!
+     * \brief Copy data from the source into the destination using the
+     * specified overlap descriptor.
+     */
+    void copy2(SAMRAI::hier::PatchData<NDIM>& dst, const SAMRAI::hier::BoxOverlap<NDIM>& overlap) const;
+
+    /*!
+     * \brief Return false since the size of the message stream depends on the
+     * number of nodes in the overlap region.
+     */
+    bool canEstimateStreamSizeFromBox() const;
+
+    /*!
+     * \brief Calculate the number of bytes needed to stream the data lying in
+     * the specified overlap region.
+     */
+    size_t getDataStreamSize(const SAMRAI::hier::BoxOverlap<NDIM>& overlap) const;
+
+    /*!
+     * \brief Pack data lying in the specified overlap region into the stream.
+     */
+    void packStream(SAMRAI::tbox::AbstractStream& stream, const SAMRAI::hier::BoxOverlap<NDIM>& overlap) const;
+
+    /*!
+     * \brief Unpack data from the stream into the specified overlap region.
+     */
+    void unpackStream(SAMRAI::tbox::AbstractStream& stream, const SAMRAI::hier::BoxOverlap<NDIM>& overlap);
+
+    /*!
+     * \brief Read the data specific to this class from the database.
+     */
+    void getSpecializedFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> database);
+
+    /*!
+     * \brief Write the data specific to this class to the database.
+     */
+    void putSpecializedToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> database);
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LNodeCSRData();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LNodeCSRData(const LNodeCSRData& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LNodeCSRData& operator=(const LNodeCSRData& that);
+
+    /*!
+     * \brief Unsorted node data used to (re)build the CSR representation.
+     */
+    struct NodeBuffer
+    {
+        std::vector<int> cell_nums;
+        std::vector<int> lag_indices, global_petsc_indices, local_petsc_indices;
+        std::vector<int> periodic_offsets;
+        std::vector<double> periodic_displacements;
+    };
+
+    /*!
+     * \brief Append the data for the node with position k in the flat node
+     * arrays to the buffer.
+     */
+    void appendNode(NodeBuffer& buf, int k, int cell_num) const;
+
+    /*!
+     * \brief Append to the buffer all nodes that do not lie in any of the
+     * specified cells.
+     */
+    void appendNodesOutsideCells(NodeBuffer& buf, const std::vector<bool>& excluded_cells) const;
+
+    /*!
+     * \brief Mark the cells of the ghost box that lie in the specified box.
+     */
+    void markCells(std::vector<bool>& cells, const SAMRAI::hier::Box<NDIM>& box) const;
+
+    /*!
+     * \brief Clear the cached indexing data.
+     */
+    void clearCachedIndices();
+
+    /*!
+     * \brief Rebuild the CSR representation from the (unsorted) node data in
+     * the buffer.
+     */
+    void buildFromNodeBuffer(const NodeBuffer& buf);
+
+    /*!
+     * \brief Replace the nodes in the region of index space described by the
+     * destination boxes by the nodes of the source patch data object.
+     */
+    void copyNodes(const LNodeCSRData& src,
+                   const std::vector<SAMRAI::hier::Box<NDIM> >& dst_boxes,
+                   const SAMRAI::hier::IntVector<NDIM>& src_offset);
+
+    /*!
+     * CSR representation of the nodes in the ghost box.
+     */
+    std::vector<int> d_cell_offsets;
+    std::vector<int> d_lag_indices, d_global_petsc_indices, d_local_petsc_indices;
+    std::vector<int> d_periodic_offsets;
+    std::vector<double> d_periodic_displacements;
+
+    /*!
+     * Cached indexing data.
+     */
+    std::vector<int> d_interior_lag_indices, d_ghost_lag_indices;
+    std::vector<int> d_interior_global_petsc_indices, d_ghost_global_petsc_indices;
+    std::vector<int> d_interior_local_petsc_indices, d_ghost_local_petsc_indices;
+    std::vector<double> d_periodic_shifts, d_interior_periodic_shifts, d_ghost_periodic_shifts;
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/LNodeCSRData-inl.h"         // IWYU pragma: keep
+#include "ibtk/private/LNodeCSRDataIterator-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LNodeCSRData
@@ -0,0 +1,165 @@
+// Filename: LNodeCSRDataIterator.h
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LNodeCSRDataIterator
+#define included_IBTK_LNodeCSRDataIterator
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "Box.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "ibtk/ibtk_utilities.h"
+
+/////////////////////////////// FORWARD DECLARATIONS /////////////////////////
+
+namespace IBTK
+{
+class LNodeCSRData;
+} // namespace IBTK
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LNodeCSRDataIterator is an iterator class which may be used to
+ * iterate through the Lagrangian nodes stored in an LNodeCSRData object that
+ * are associated with a specified box in cell-centered index space.
+ *
+ * Nodes are visited cell by cell, in the same (column-major) order used by
+ * SAMRAI::hier::Box::offset() for the ghost box of the patch data object.
+ */
+class LNodeCSRDataIterator
+{
+public:
+    friend class LNodeCSRData;
+
+    /*!
+     * \brief Class constructor.
+     */
+    LNodeCSRDataIterator();
+
+    /*!
+     * \brief Class constructor.
+     */
+    LNodeCSRDataIterator(const LNodeCSRDataIterator& that);
+
+    /*!
+     * \brief Class destructor.
+     */
+    ~LNodeCSRDataIterator();
+
+    /*!
+     * \brief Assignment operator.
+     */
+    LNodeCSRDataIterator& operator=(const LNodeCSRDataIterator& that);
+
+    /*!
+     * \brief Test two iterators for equality.
+     */
+    bool operator==(const LNodeCSRDataIterator& that) const;
+
+    /*!
+     * \brief Test two iterators for inequality.
+     */
+    bool operator!=(const LNodeCSRDataIterator& that) const;
+
+    /*!
+     * \brief Prefix increment operator.
+     */
+    LNodeCSRDataIterator& operator++();
+
+    /*!
+     * \brief Postfix increment operator.
+     */
+    LNodeCSRDataIterator operator++(int);
+
+    /*!
+     * \brief Return the position of the node referred to by the iterator in
+     * the flat arrays of the LNodeCSRData object.
+     */
+    int getNodeIndex() const;
+
+    /*!
+     * \brief Return a const reference to the cell index referred to by the
+     * iterator.
+     */
+    const SAMRAI::hier::Index<NDIM>& getCellIndex() const;
+
+    /*!
+     * \brief Return the Lagrangian index of the node referred to by the
+     * iterator.
+     */
+    int getLagrangianIndex() const;
+
+    /*!
+     * \brief Return the global PETSc index of the node referred to by the
+     * iterator.
+     */
+    int getGlobalPETScIndex() const;
+
+    /*!
+     * \brief Return the local PETSc index of the node referred to by the
+     * iterator.
+     */
+    int getLocalPETScIndex() const;
+
+    /*!
+     * \brief Return the periodic offset of the node referred to by the
+     * iterator.
+     */
+    SAMRAI::hier::IntVector<NDIM> getPeriodicOffset() const;
+
+    /*!
+     * \brief Return the periodic displacement of the node referred to by the
+     * iterator.
+     */
+    Vector getPeriodicDisplacement() const;
+
+private:
+    /*!
+     * \brief Advance the iterator to the first node of the next nonempty cell
+     * in the iteration box, or to the end state if there is no such cell.
+     */
+    void advanceToNextNonemptyCell();
+
+    const LNodeCSRData* d_data;
+    SAMRAI::hier::Box<NDIM> d_box;
+    SAMRAI::hier::Index<NDIM> d_cell_idx;
+    int d_node_idx, d_node_upper;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LNodeCSRDataIterator
@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <pthread.h>
 #include <map>
 #include <set>
 #include <string>
@@ -43,6 +44,7 @@
 
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "mpi.h"
 #include "petscao.h"
 #include "petscvec.h"
 #include "tbox/Pointer.h"
@@ -201,9 +203,53 @@ public:
 
     /*!
      * \brief Write the plot data to disk.
+     *
+     * \note When asynchronous writes are enabled, the local plot data are
+     * copied into a staging buffer and written to disk by a background thread.
+     * This method only blocks if the previous write has not yet finished.
      */
     void writePlotData(int time_step_number, double simulation_time);
 
+    /*!
+     * \brief Set whether plot data are written to disk asynchronously.
+     *
+     * Communication required to assemble the plot data is always performed
+     * synchronously.  Only the Silo file output is performed in the background.
+     */
+    void setUseAsynchronousWrites(bool use_async_writes);
+
+    /*!
+     * \brief Block until any plot data that are being written in the background
+     * have been written to disk.
+     */
+    void waitForPendingPlotData();
+
+    /*!
+     * \brief Acquire the lock that serializes calls to the Silo library.
+     *
+     * The Silo library is not thread safe, and plot data may be written by a
+     * background thread.  Other classes that write Silo files must hold this
+     * lock while calling the Silo library.
+     */
+    static void lockSiloLibrary();
+
+    /*!
+     * \brief Release the lock acquired by lockSiloLibrary().
+     */
+    static void unlockSiloLibrary();
+
+    /*!
+     * \brief Set the number of MPI processes that write Lagrangian plot data.
+     *
+     * By default (num_writers == 0), each MPI process writes its own Silo file.
+     * When 0 < num_writers < the number of MPI processes, the processes are
+     * partitioned into num_writers groups of contiguous ranks, the local plot
+     * data of each group are gathered onto the first process in the group, and
+     * that process writes a single Silo file containing one directory per
+     * process in the group.
+     */
+    void setNumberOfWriterProcesses(int num_writers);
+
     /*!
      * Write out object state to the given database.
      *
@@ -240,6 +286,63 @@ private:
      */
     LSiloDataWriter& operator=(const LSiloDataWriter& that);
 
+    /*!
+     * \brief Local plot data and metadata required to write the Silo files for
+     * a single time step.
+     */
+    struct PlotDataSnapshot;
+
+    /*!
+     * \brief The local plot data of a single MPI process.
+     */
+    struct LocalPlotData;
+
+    /*!
+     * \brief Copy the local values of a PETSc Vec into a buffer.
+     */
+    static void copyVecToBuffer(Vec v, std::vector<double>& buffer);
+
+    /*!
+     * \brief Entry point for the background I/O thread.
+     */
+    static void* writeSnapshotThread(void* writer);
+
+    /*!
+     * \brief Write the Silo files for the specified snapshot.
+     */
+    void writeSnapshot(PlotDataSnapshot& snapshot);
+
+    /*!
+     * \brief Gather the local plot data of each group of MPI processes onto
+     * the writer process of the group.
+     */
+    void aggregateLocalPlotData(PlotDataSnapshot& snapshot, int num_writers);
+
+    /*!
+     * \brief Serialize local plot data into integer and floating point
+     * buffers.
+     */
+    static void packLocalPlotData(const LocalPlotData& data,
+                                  std::vector<int>& int_data,
+                                  std::vector<double>& dbl_data,
+                                  int coarsest_ln,
+                                  int finest_ln);
+
+    /*!
+     * \brief Deserialize local plot data packed by packLocalPlotData().
+     */
+    static void unpackLocalPlotData(LocalPlotData& data,
+                                    const int* int_data,
+                                    const double* dbl_data,
+                                    int coarsest_ln,
+                                    int finest_ln);
+
+    /*!
+     * \brief Return the prefix of the path to the meshes and variables written
+     * by the specified MPI process, relative to the dump directory.
+     */
+    static std::string getMeshPathPrefix(int proc, int mpi_nodes, int num_writers);
+
     /*!
      * \brief Build the VecScatter objects required to communicate data for
      * plotting.
@@ -337,6 +440,23 @@ private:
     std::vector<bool> d_build_vec_scatters;
     std::vector<std::map<int, Vec> > d_src_vec, d_dst_vec;
     std::vector<std::map<int, VecScatter> > d_vec_scatter;
+
+    /*
+     * Data for writing plot data in the background.  Two snapshots are kept so
+     * that one may be filled while the other is being written.
+     */
+    bool d_use_async_writes;
+    bool d_async_write_pending;
+    pthread_t d_async_write_thread;
+    std::vector<PlotDataSnapshot*> d_snapshots;
+    int d_next_snapshot, d_pending_snapshot;
+
+    /*
+     * Data for aggregating plot data onto a subset of the MPI processes.
+     */
+    int d_num_writers;
+    MPI_Comm d_writer_comm;
+    int d_writer_comm_num_writers;
 };
 } // namespace IBTK
 
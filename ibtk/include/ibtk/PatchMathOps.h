@@ -86,6 +86,24 @@ public:
      */
     ~PatchMathOps();
 
+    /*!
+     * \brief Indicate whether to use the Fortran implementations of the stencil
+     * kernels that are also provided by class PatchMathKernels.
+     *
+     * By default, the Fortran kernels are used.  The C++ kernels may be
+     * enabled, e.g., for benchmarking; both implementations are compared by the
+     * regression test in ibtk/tests/PatchMathOps.
+     *
+     * \see PatchMathKernels
+     */
+    void setUseFortranKernels(bool use_fortran_kernels);
+
+    /*!
+     * \brief Return whether the Fortran implementations of the stencil kernels
+     * are being used.
+     */
+    bool getUseFortranKernels() const;
+
     /*!
      * \name Mathematical operations.
      */
@@ -682,6 +700,12 @@ private:
      * \return A reference to this object.
      */
     PatchMathOps& operator=(const PatchMathOps& that);
+
+    /*!
+     * \brief Whether to use the Fortran reference kernels in place of the C++
+     * kernels provided by class PatchMathKernels.
+     */
+    bool d_use_fortran_kernels;
 };
 } // namespace IBTK
 
@@ -64,6 +64,8 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
+class BoxList;
+template <int DIM>
 class Variable;
 } // namespace hier
 namespace math
@@ -108,7 +110,30 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 10            // see setCoarseSolverMaxIterations()
+ smoother_sweeps_per_exchange = 1             // number of local smoothing sweeps performed between ghost cell fills
+ use_single_precision_smoother = FALSE        // whether Gauss-Seidel sweeps use single-precision data
+ chebyshev_eig_lower_factor = 0.1             // Chebyshev interval lower bound (relative to max eigenvalue)
+ chebyshev_eig_upper_factor = 1.0             // Chebyshev interval upper bound (relative to max eigenvalue)
  \endverbatim
+ *
+ * When \p smoother_sweeps_per_exchange is larger than one, point relaxation
+ * smoothers (see classes CCPoissonPointRelaxationFACOperator and
+ * SCPoissonPointRelaxationFACOperator) perform that many sweeps between ghost
+ * cell fills.  Ghost cell data must be at least
+ * \p smoother_sweeps_per_exchange cells wide (see input entry \p
+ * ghost_cell_width), and patches in the interior of a level are smoothed
+ * redundantly on progressively smaller grown boxes so that only one halo
+ * exchange is required for each group of sweeps.
+ *
+ * When \p use_single_precision_smoother is TRUE, point relaxation smoothers of
+ * type PATCH_GAUSS_SEIDEL sweep over single-precision copies of the error and
+ * residual on patches that do not touch physical boundaries or coarse-fine
+ * interfaces.  The copies are made when smoothing begins, only ghost cell values
+ * and values near patch boundaries are converted at each ghost cell fill, and
+ * the smoothed error is converted back to double precision when smoothing ends.
+ * All other FAC operations are performed in double precision.  Because rounding
+ * makes the preconditioner (slightly) nonlinear, this option should be used with
+ * flexible outer Krylov methods (e.g., FGMRES).
 */
 class PoissonFACPreconditionerStrategy : public FACPreconditionerStrategy
 {
@@ -355,6 +380,12 @@ protected:
 
     //\}
 
+    /*!
+     * \brief Set physical boundary ghost cell values on the specified level
+     * without performing any communication.
+     */
+    void fillPhysicalBoundaryGhostCells(int dst_idx, int dst_ln);
+
     /*
      * Problem specification.
      */
@@ -406,6 +437,21 @@ protected:
     bool d_in_initialize_operator_state;
     int d_coarsest_reset_ln, d_finest_reset_ln;
 
+    /*
+     * Width by which each local patch may be grown when performing redundant
+     * smoothing sweeps between ghost cell fills, and the patch ghost cells that
+     * lie outside of the level (i.e., along coarse-fine interfaces or physical
+     * boundaries).
+     */
+    std::vector<std::vector<int> > d_patch_redundant_sweep_width;
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_patch_bdry_ghost_box_overlap;
+
+    /*
+     * Estimates of the largest eigenvalue of the Jacobi-preconditioned operator
+     * on each level, used by polynomial (Chebyshev) smoothers.
+     */
+    std::vector<double> d_level_jacobi_max_eig;
+
     //\}
 
     /*!
@@ -438,6 +484,22 @@ protected:
     double d_coarse_solver_abs_residual_tol;
     int d_coarse_solver_max_iterations;
 
+    /*
+     * The number of smoothing sweeps performed between ghost cell fills.
+     */
+    int d_smoother_sweeps_per_exchange;
+
+    /*
+     * Whether smoothing sweeps are performed using single-precision data.
+     */
+    bool d_use_single_precision_smoother;
+
+    /*
+     * The interval targeted by Chebyshev smoothers, relative to the estimated
+     * largest eigenvalue of the Jacobi-preconditioned operator.
+     */
+    double d_chebyshev_eig_lower_factor, d_chebyshev_eig_upper_factor;
+
     //\}
 
     /*!
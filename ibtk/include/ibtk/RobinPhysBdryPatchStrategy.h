@@ -35,20 +35,28 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <deque>
+#include <map>
 #include <set>
 #include <vector>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
 #include "RefinePatchStrategy.h"
+#include "tbox/Pointer.h"
 
 namespace SAMRAI
 {
 namespace hier
 {
 template <int DIM>
+class BoundaryBox;
+template <int DIM>
 class Patch;
+template <int DIM>
+class Variable;
 } // namespace hier
 namespace solv
 {
@@ -126,6 +134,18 @@ public:
      */
     bool getHomogeneousBc() const;
 
+    /*!
+     * \brief Clear the cached boundary condition coefficients.
+     *
+     * Coefficients provided by time-independent boundary condition objects are
+     * cached by boundary condition object, patch, and boundary box.  The
+     * cache holds a bounded number of entries; once it is full, the oldest
+     * entries are evicted first.  This method should be called when the patch hierarchy configuration is reset,
+     * or when the values returned by a time-independent boundary condition
+     * object are changed.
+     */
+    void clearBcCoefCache();
+
     /*!
      * \name Partial implementation of SAMRAI::xfer::RefinePatchStrategy
      * interface.
@@ -203,6 +223,30 @@ public:
                                                     const SAMRAI::hier::IntVector<NDIM>& ghost_width_to_fill);
 
 protected:
+    /*!
+     * \brief Set the Robin boundary condition coefficients for the specified
+     * patch data index and boundary condition object along a co-dimension one
+     * boundary box.
+     *
+     * Coefficients provided by boundary condition objects that are independent
+     * of time (see ExtendedRobinBcCoefStrategy::isTimeIndependent()) are
+     * computed once per patch, boundary box, and coefficient box, and are reused
+     * on subsequent calls.  Otherwise, the coefficients are recomputed in
+     * scratch arrays owned by this object.  In either case, the
+     * returned arrays must not be modified, and are only valid until the next
+     * call to this method.
+     */
+    void setBcCoefData(SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& acoef_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& bcoef_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> >& gcoef_data,
+                       int patch_data_idx,
+                       int bc_coef_idx,
+                       const SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> >& var,
+                       SAMRAI::hier::Patch<NDIM>& patch,
+                       const SAMRAI::hier::BoundaryBox<NDIM>& bdry_box,
+                       const SAMRAI::hier::Box<NDIM>& bc_coef_box,
+                       double fill_time);
+
     /*
      * The patch data indices corresponding to the "scratch" patch data that
      * requires extrapolation of ghost cell values at physical boundaries.
@@ -239,6 +283,42 @@ private:
      * \return A reference to this object.
      */
     RobinPhysBdryPatchStrategy& operator=(const RobinPhysBdryPatchStrategy& that);
+
+    /*
+     * Cached boundary condition coefficients, indexed by the patch data index,
+     * the boundary condition object, the refinement ratio of the patch level,
+     * the patch box, the boundary box, and whether homogeneous boundary
+     * conditions are used.
+     */
+    struct BcCoefCacheKey
+    {
+        int patch_data_idx;
+        const SAMRAI::solv::RobinBcCoefStrategy<NDIM>* bc_coef;
+        int location_index;
+        bool homogeneous_bc;
+        SAMRAI::hier::IntVector<NDIM> ratio;
+        SAMRAI::hier::Box<NDIM> patch_box, bc_coef_box;
+
+        bool operator<(const BcCoefCacheKey& that) const;
+    };
+
+    struct BcCoefCacheData
+    {
+        SAMRAI::tbox::Pointer<SAMRAI::pdat::ArrayData<NDIM, double> > acoef_data, bcoef_data, gcoef_data;
+    };
+
+    std::map<BcCoefCacheKey, BcCoefCacheData> d_bc_coef_cache;
+
+    /*
+     * Cache entries in the order in which they were inserted, used to evict
+     * the oldest entries once the cache is full.
+     */
+    std::deque<std::map<BcCoefCacheKey, BcCoefCacheData>::iterator> d_bc_coef_cache_queue;
+
+    /*
+     * Scratch arrays used to set coefficients that are not cached.
+     */
+    BcCoefCacheData d_bc_coef_scratch;
 };
 } // namespace IBTK
 
@@ -62,6 +62,11 @@ class Box;
 template <int DIM>
 class BoxList;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class SideData;
+} // namespace pdat
 namespace solv
 {
 template <int DIM, class TYPE>
@@ -106,9 +111,18 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ ghost_cell_width = 1                         // ghost cell width of solver data
+ smoother_sweeps_per_exchange = 1             // smoothing sweeps between ghost cell fills (<= ghost_cell_width)
+ use_single_precision_smoother = FALSE        // PATCH_GAUSS_SEIDEL sweeps use single-precision data
  coarse_solver_db = { ... }                   // SAMRAI::tbox::Database for initializing coarse
  level solver
  \endverbatim
+ *
+ * \note With \p smoother_sweeps_per_exchange = S > 1, the sweeps performed
+ * between ghost cell fills read ghost cell values from neighboring patches on
+ * the same level that are up to S-1 sweeps out of date.  The smoothed error is
+ * therefore not the same as the one obtained with S = 1, and the convergence
+ * rate of the preconditioned solver may differ.
 */
 class SCPoissonPointRelaxationFACOperator : public PoissonFACPreconditionerStrategy
 {
@@ -150,6 +164,9 @@ public:
      * - \c "PATCH_GAUSS_SEIDEL"
      * - \c "PROCESSOR_GAUSS_SEIDEL"
      * - \c "RED_BLACK_GAUSS_SEIDEL"
+     * - \c "CHEBYSHEV" (Jacobi-preconditioned Chebyshev polynomial smoother)
+     *
+     * \note The \c "CHEBYSHEV" smoother requires constant coefficients.
      */
     void setSmootherType(const std::string& smoother_type);
 
@@ -267,8 +284,17 @@ private:
      * Patch overlap data.
      */
     std::vector<std::vector<boost::array<SAMRAI::hier::BoxList<NDIM>, NDIM> > > d_patch_bc_box_overlap;
+    std::vector<std::vector<boost::array<SAMRAI::hier::BoxList<NDIM>, NDIM> > > d_patch_bdry_side_box_overlap;
     std::vector<std::vector<boost::array<std::map<int, SAMRAI::hier::Box<NDIM> >, NDIM> > > d_patch_neighbor_overlap;
 
+    /*
+     * Single-precision copies of the error and residual on patches that are
+     * smoothed using single-precision data (NULL on all other patches).
+     */
+    std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, float> > > > d_patch_single_error_data;
+    std::vector<std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, float> > > >
+        d_patch_single_residual_data;
+
     /*
      * Dirichlet boundary condition utilities.
      */
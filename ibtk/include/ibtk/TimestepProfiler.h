@@ -0,0 +1,308 @@
+// Filename: TimestepProfiler.h
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_TimestepProfiler
+#define included_IBTK_TimestepProfiler
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "ibtk/ibtk_enums.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class TimestepProfiler is a singleton class that records per-time
+ * step, per-process wall clock timings of the principal phases of an IB
+ * computation: spreading, interpolation, Lagrangian force evaluation, Stokes
+ * solves, regridding, ghost cell filling, and I/O.
+ *
+ * Each completed phase interval is stored as an event in a fixed-size ring
+ * buffer, and the total time spent in each phase is accumulated into a second
+ * ring buffer that holds one record per time step.  Recording an interval
+ * therefore costs two calls to MPI_Wtime() and a few stores, and the memory
+ * used by the profiler is bounded regardless of the length of the run; once a
+ * buffer is full, the oldest entries are overwritten.  When the profiler is
+ * disabled, startPhase() and stopPhase() return immediately.
+ *
+ * A time step extends from one call to beginTimestep() to the next (or to
+ * endTimestep()), so that output performed by the application between calls to
+ * HierarchyIntegrator::advanceHierarchy() is attributed to the time step that
+ * generated the data.  Nested intervals of the same phase are recorded once,
+ * but intervals of different phases may overlap (e.g., ghost cell filling
+ * performed during a Stokes solve), so that phase timings are inclusive.
+ *
+ * writeData() writes the events recorded on each process as a timeline in
+ * either Chrome trace event format (which can be viewed in chrome://tracing or
+ * Perfetto) or CSV format, and writes a load imbalance report that gives, for
+ * each phase and each retained time step, the maximum and average times over
+ * all processes.  A summary of the report is also written to plog.
+ *
+ * The profiler is disabled by default.  AppInitializer configures it from the
+ * optional "TimestepProfiler" section of the input database:
+ *
+ * \verbatim
+ TimestepProfiler {
+    enabled           = TRUE                  // default: FALSE
+    output_dirname    = "timestep_profile"    // default: "timestep_profile"
+    timeline_format   = "CHROME_TRACE_FORMAT" // or "CSV_FORMAT"
+    event_buffer_size = 65536                 // events retained per process
+    step_buffer_size  = 4096                  // time steps retained per process
+ }
+ \endverbatim
+ *
+ * If the profiler is enabled, writeData() is called automatically at shutdown.
+ *
+ * \note The profiler is not thread safe, and phases should only be started and
+ * stopped by the main thread of each MPI process.
+ */
+class TimestepProfiler
+{
+public:
+    /*!
+     * Return a pointer to the instance of the profiler.  All access to the
+     * singleton TimestepProfiler object is through the getProfiler() function.
+     *
+     * Note that when the profiler is accessed for the first time, the
+     * freeProfiler() static method is registered with the ShutdownRegistry
+     * class.  Consequently, the TimestepProfiler object is automatically
+     * deallocated, and any recorded data are written, during program
+     * shutdown.
+     */
+    static TimestepProfiler* getProfiler();
+
+    /*!
+     * Deallocate the TimestepProfiler instance.  If the profiler is enabled,
+     * the recorded data are written before the instance is deallocated.
+     *
+     * \note This method is collective on all MPI processes.
+     */
+    static void freeProfiler();
+
+    /*!
+     * Configure the profiler from the provided input database.
+     */
+    void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
+
+    /*!
+     * Enable or disable profiling.
+     */
+    void setEnabled(bool enabled);
+
+    /*!
+     * Return whether profiling is enabled.
+     */
+    bool isEnabled() const;
+
+    /*!
+     * Set the name of the directory to which profiling data are written.
+     */
+    void setOutputDirectory(const std::string& dirname);
+
+    /*!
+     * Set the format of the per-process timelines.
+     */
+    void setTimelineFormat(ProfilingTimelineFormat timeline_format);
+
+    /*!
+     * Set the number of events and time step records that are retained on each
+     * process.
+     *
+     * \note Resizing the buffers discards all previously recorded data.
+     */
+    void setBufferSizes(int event_buffer_size, int step_buffer_size);
+
+    /*!
+     * Indicate that a new time step has started.  Any time step that is still
+     * open is completed first.
+     */
+    void beginTimestep(int step_num, double sim_time);
+
+    /*!
+     * Indicate that the current time step has been completed.  Calling this
+     * function when no time step is open has no effect.
+     */
+    void endTimestep();
+
+    /*!
+     * Indicate that the specified phase has started.
+     */
+    void startPhase(ProfilingPhase phase);
+
+    /*!
+     * Indicate that the specified phase has ended.
+     */
+    void stopPhase(ProfilingPhase phase);
+
+    /*!
+     * Write the per-process timelines and the load imbalance report.
+     *
+     * \note This method is collective on all MPI processes.
+     */
+    void writeData();
+
+    /*!
+     * Discard all recorded data.
+     */
+    void reset();
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    TimestepProfiler();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~TimestepProfiler();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    TimestepProfiler(const TimestepProfiler& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    TimestepProfiler& operator=(const TimestepProfiler& that);
+
+    /*!
+     * A single timed interval of one phase.  Times are measured in seconds
+     * relative to the construction of the profiler.
+     */
+    struct Event
+    {
+        int step_num;
+        int phase;
+        double start_time;
+        double duration;
+    };
+
+    /*!
+     * The wall clock duration of a time step along with the total time spent in
+     * each phase during that time step.
+     */
+    struct StepRecord
+    {
+        int step_num;
+        double sim_time;
+        double start_time;
+        double duration;
+        double phase_time[NUM_PROFILING_PHASES];
+    };
+
+    /*!
+     * Record a completed interval of the specified phase.
+     */
+    void recordPhase(ProfilingPhase phase, double start_time, double stop_time);
+
+    /*!
+     * Write the events recorded on this process.
+     */
+    void writeTimeline(const std::string& dirname) const;
+
+    /*!
+     * Compute and write the load imbalance report.
+     */
+    void writeImbalanceReport(const std::string& dirname) const;
+
+    /*!
+     * Static data members used to control access to and destruction of
+     * singleton profiler instance.
+     */
+    static TimestepProfiler* s_profiler_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+
+    /*!
+     * Profiler configuration.
+     */
+    bool d_enabled;
+    std::string d_output_dirname;
+    ProfilingTimelineFormat d_timeline_format;
+
+    /*!
+     * Wall clock time at which the profiler was constructed.
+     */
+    double d_reference_time;
+
+    /*!
+     * Nesting depth and start time of each phase.
+     */
+    int d_phase_depth[NUM_PROFILING_PHASES];
+    double d_phase_start_time[NUM_PROFILING_PHASES];
+
+    /*!
+     * Ring buffer of recorded events.  The buffers are only allocated once
+     * profiling is enabled.
+     */
+    int d_event_buffer_size, d_step_buffer_size;
+    std::vector<Event> d_events;
+    unsigned int d_next_event, d_num_events;
+    unsigned long d_num_dropped_events;
+
+    /*!
+     * Ring buffer of completed time step records, along with the record of the
+     * time step currently in progress.
+     */
+    std::vector<StepRecord> d_steps;
+    unsigned int d_next_step, d_num_steps;
+    bool d_in_timestep;
+    StepRecord d_current_step;
+};
+} // namespace IBTK
+
+/////////////////////////////// INLINE ///////////////////////////////////////
+
+#include "ibtk/private/TimestepProfiler-inl.h" // IWYU pragma: keep
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_TimestepProfiler
@@ -0,0 +1,220 @@
+// Filename: WorkloadModel.h
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+#ifndef included_IBTK_WorkloadModel
+#define included_IBTK_WorkloadModel
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class PatchLevel;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class WorkloadModel is a utility class for calibrating the relative
+ * cost of Eulerian and Lagrangian work from measured wall clock times.
+ *
+ * The model assumes that the cost of one time step on each MPI process is
+ *
+ *    cost = cell_cost*num_cells + item_cost*num_items + patch_cost*num_patches
+ *
+ * in which "items" are the Lagrangian nodes or quadrature points that are
+ * assigned to that process.  Wall clock timings are accumulated over a window
+ * of time steps, and the collective method calibrate() fits the cost
+ * coefficients from the timings collected on all processes.  The per-patch
+ * overhead is obtained from a least-squares fit of the per-patch interaction
+ * timings against the number of items on each patch; the remainder of the
+ * Lagrangian time is attributed to the items.
+ *
+ * \note This class uses MPI_Wtime() to collect timings, and the timings are
+ * only collected when the calibration window size is positive.
+ */
+class WorkloadModel : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Default constructor.
+     *
+     * \param window_size The number of time steps over which timings are
+     * accumulated before the cost coefficients are recomputed.  Calibration is
+     * disabled when the window size is zero.
+     */
+    WorkloadModel(int window_size = 0);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~WorkloadModel();
+
+    /*!
+     * \brief Set the number of time steps over which timings are accumulated.
+     * Setting the window size to zero disables calibration.
+     */
+    void setWindowSize(int window_size);
+
+    /*!
+     * \brief Get the number of time steps over which timings are accumulated.
+     */
+    int getWindowSize() const;
+
+    /*!
+     * \brief Indicate whether timings are being collected.
+     */
+    bool isEnabled() const;
+
+    /*!
+     * \brief Record the time spent spreading to or interpolating from a
+     * single patch with the specified number of Lagrangian items.
+     *
+     * \note This method is not collective.
+     */
+    void recordInteractionSample(int num_items, double wall_time);
+
+    /*!
+     * \brief Record time spent on Lagrangian work that is not associated with
+     * a particular patch (e.g., force evaluation).
+     *
+     * \note This method is not collective.
+     */
+    void recordLagrangianSample(double wall_time);
+
+    /*!
+     * \brief Record the time spent solving the Eulerian equations during one
+     * time step, along with the number of local cells and Lagrangian items.
+     *
+     * \note This method is not collective, but it must be called the same
+     * number of times on each MPI process.
+     */
+    void recordEulerianSample(int num_cells, int num_items, double wall_time);
+
+    /*!
+     * \brief Recompute the cost coefficients if timings have been collected
+     * over a full window, and reset the accumulated timings.
+     *
+     * \return true if the cost coefficients were recomputed.
+     *
+     * \note This method is collective.
+     */
+    bool calibrate();
+
+    /*!
+     * \brief Reset the accumulated timings without modifying the cost
+     * coefficients.
+     */
+    void reset();
+
+    /*!
+     * \brief Get the estimated cost per cell per time step.
+     */
+    double getCellCost() const;
+
+    /*!
+     * \brief Get the estimated cost per Lagrangian item per time step.
+     */
+    double getItemCost() const;
+
+    /*!
+     * \brief Get the estimated per-patch overhead of Lagrangian-Eulerian
+     * interaction.
+     */
+    double getPatchCost() const;
+
+    /*!
+     * \brief Get the cost of a Lagrangian item relative to that of a cell,
+     * i.e., the weight to use for each item in a cell-based workload estimate.
+     */
+    double getRelativeItemCost() const;
+
+    /*!
+     * \brief Add the per-patch interaction overhead, relative to the cost of a
+     * cell, to the cell-based workload estimate of each local patch of the
+     * level that contains Lagrangian items.  The overhead of each patch is
+     * distributed uniformly over the cells of that patch.
+     *
+     * \param level The patch level.
+     * \param workload_idx Patch data index of the cell-centered workload data.
+     * \param item_count_idx Patch data index of the cell-centered data that
+     * stores the number of Lagrangian items in each cell.
+     */
+    void addPatchCostToWorkload(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                                int workload_idx,
+                                int item_count_idx) const;
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    WorkloadModel(const WorkloadModel& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    WorkloadModel& operator=(const WorkloadModel& that);
+
+    // The calibration window size.
+    int d_window_size;
+
+    // Accumulated per-patch interaction timings.
+    double d_num_interaction_samples, d_sum_items, d_sum_items_sq, d_sum_time, d_sum_items_time;
+
+    // Accumulated Lagrangian and Eulerian timings.
+    double d_lag_time, d_num_eul_samples, d_eul_cells, d_eul_items, d_eul_time;
+
+    // The fitted cost coefficients.
+    double d_cell_cost, d_item_cost, d_patch_cost;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_WorkloadModel
@@ -111,6 +111,26 @@ namespace IBTK
 #define PREFETCH_WRITE_NTA_NDIM_BLOCK(a)
 #endif
 
+#ifndef RESTRICT
+#if defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)
+#define RESTRICT __restrict__
+#else
+#define RESTRICT
+#endif
+#endif
+
+// Functions marked SIMD_TARGET_CLONES are compiled once per listed instruction
+// set and the variant to execute is selected by the dynamic loader based on the
+// capabilities of the host CPU.
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) && (__GNUC__ >= 6) &&                     \
+    defined(__x86_64__) && defined(__linux__)
+#define IBTK_HAVE_TARGET_CLONES 1
+#define SIMD_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define IBTK_HAVE_TARGET_CLONES 0
+#define SIMD_TARGET_CLONES
+#endif
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
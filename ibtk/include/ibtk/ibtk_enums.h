@@ -165,6 +165,80 @@ enum_to_string<VariableContextType>(VariableContextType val)
     return "UNKNOWN_VARIABLE_CONTEXT_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for the phases of a time step that are recorded by
+ * TimestepProfiler.
+ */
+enum ProfilingPhase
+{
+    PROFILE_SPREAD,
+    PROFILE_INTERP,
+    PROFILE_FORCE,
+    PROFILE_STOKES_SOLVE,
+    PROFILE_REGRID,
+    PROFILE_GHOST_FILL,
+    PROFILE_IO,
+    NUM_PROFILING_PHASES,
+    UNKNOWN_PROFILING_PHASE = -1
+};
+
+template <>
+inline ProfilingPhase
+string_to_enum<ProfilingPhase>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "PROFILE_SPREAD") == 0) return PROFILE_SPREAD;
+    if (strcasecmp(val.c_str(), "PROFILE_INTERP") == 0) return PROFILE_INTERP;
+    if (strcasecmp(val.c_str(), "PROFILE_FORCE") == 0) return PROFILE_FORCE;
+    if (strcasecmp(val.c_str(), "PROFILE_STOKES_SOLVE") == 0) return PROFILE_STOKES_SOLVE;
+    if (strcasecmp(val.c_str(), "PROFILE_REGRID") == 0) return PROFILE_REGRID;
+    if (strcasecmp(val.c_str(), "PROFILE_GHOST_FILL") == 0) return PROFILE_GHOST_FILL;
+    if (strcasecmp(val.c_str(), "PROFILE_IO") == 0) return PROFILE_IO;
+    return UNKNOWN_PROFILING_PHASE;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<ProfilingPhase>(ProfilingPhase val)
+{
+    if (val == PROFILE_SPREAD) return "PROFILE_SPREAD";
+    if (val == PROFILE_INTERP) return "PROFILE_INTERP";
+    if (val == PROFILE_FORCE) return "PROFILE_FORCE";
+    if (val == PROFILE_STOKES_SOLVE) return "PROFILE_STOKES_SOLVE";
+    if (val == PROFILE_REGRID) return "PROFILE_REGRID";
+    if (val == PROFILE_GHOST_FILL) return "PROFILE_GHOST_FILL";
+    if (val == PROFILE_IO) return "PROFILE_IO";
+    return "UNKNOWN_PROFILING_PHASE";
+} // enum_to_string
+
+/*!
+ * \brief Enumerated type for the per-process timeline formats written by
+ * TimestepProfiler.
+ */
+enum ProfilingTimelineFormat
+{
+    CHROME_TRACE_FORMAT,
+    CSV_FORMAT,
+    UNKNOWN_PROFILING_TIMELINE_FORMAT = -1
+};
+
+template <>
+inline ProfilingTimelineFormat
+string_to_enum<ProfilingTimelineFormat>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "CHROME_TRACE_FORMAT") == 0) return CHROME_TRACE_FORMAT;
+    if (strcasecmp(val.c_str(), "CSV_FORMAT") == 0) return CSV_FORMAT;
+    return UNKNOWN_PROFILING_TIMELINE_FORMAT;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<ProfilingTimelineFormat>(ProfilingTimelineFormat val)
+{
+    if (val == CHROME_TRACE_FORMAT) return "CHROME_TRACE_FORMAT";
+    if (val == CSV_FORMAT) return "CSV_FORMAT";
+    return "UNKNOWN_PROFILING_TIMELINE_FORMAT";
+} // enum_to_string
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
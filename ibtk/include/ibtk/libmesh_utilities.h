@@ -105,6 +105,30 @@ typedef void (*TensorMeshFcnPtr)(
     double data_time,
     void* ctx);
 
+/*!
+ * Function pointer type for evaluating a tensor-valued function at a block of
+ * n_qp quadrature points in a single call.  All arrays use structure-of-arrays
+ * storage in which the values of each component at the quadrature points are
+ * stored contiguously:
+ *
+ * - F and FF: component (i,j) at point qp is stored at [(i*NDIM+j)*n_qp+qp];
+ * - x and X: component i at point qp is stored at [i*n_qp+qp];
+ * - system_var_data[k]: variable v of the k-th system at point qp is stored at
+ *   [v*n_qp+qp];
+ * - system_grad_var_data[k]: component i of the gradient of variable v of the
+ *   k-th system at point qp is stored at [(v*NDIM+i)*n_qp+qp].
+ */
+typedef void (*TensorMeshBlockFcnPtr)(double* F,
+                                      const double* FF,
+                                      const double* x,
+                                      const double* X,
+                                      unsigned int n_qp,
+                                      libMesh::Elem* elem,
+                                      const std::vector<const double*>& system_var_data,
+                                      const std::vector<const double*>& system_grad_var_data,
+                                      double data_time,
+                                      void* ctx);
+
 typedef void (*ScalarSurfaceFcnPtr)(
     double& F,
     const libMesh::TensorValue<double>& FF,
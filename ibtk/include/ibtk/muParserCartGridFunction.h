@@ -53,10 +53,17 @@ namespace SAMRAI
 namespace hier
 {
 template <int DIM>
+class Box;
+template <int DIM>
 class Patch;
 template <int DIM>
 class Variable;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class ArrayData;
+} // namespace pdat
 namespace tbox
 {
 class Database;
@@ -99,8 +106,24 @@ public:
      */
     bool isTimeDependent() const;
 
+    /*!
+     * \brief Indicates whether at least one of the function strings refers to
+     * the time variable (T or t).
+     *
+     * \note isTimeDependent() always returns true, so that callers continue to
+     * re-evaluate the function at each time.  Callers that can safely reuse
+     * previously computed values, such as
+     * IBAMR::AdvDiffSemiImplicitHierarchyIntegrator, use this method to avoid
+     * re-evaluating functions that do not depend on time.
+     */
+    bool usesTimeVariable() const;
+
     /*!
      * \brief Virtual function to evaluate the function on the patch interior.
+     *
+     * \note The function is evaluated in bulk over each data box via
+     * mu::Parser::Eval(results, bulk_size).  Bulk evaluation is multithreaded
+     * when the muParser library is compiled with MUP_USE_OPENMP.
      */
     void setDataOnPatch(int data_idx,
                         SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
@@ -141,6 +164,27 @@ private:
      */
     muParserCartGridFunction& operator=(const muParserCartGridFunction& that);
 
+    /*!
+     * \brief Ensure that the time and position buffers can hold at least
+     * bulk_size values, re-binding the parser variables if necessary.
+     */
+    void resizeParserBuffers(int bulk_size);
+
+    /*!
+     * \brief Evaluate a single function in bulk at all of the indices of the
+     * specified box, in which index i is located at position
+     *
+     *    X(box_axis[c]) = x0[c] + h[c] * (i(c) - box.lower(c)).
+     */
+    void setDataOnBox(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                      int data_depth,
+                      int function_depth,
+                      const SAMRAI::hier::Box<NDIM>& box,
+                      const boost::array<int, NDIM>& box_axis,
+                      const boost::array<double, NDIM>& x0,
+                      const boost::array<double, NDIM>& h,
+                      double data_time);
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -164,10 +208,19 @@ private:
     std::vector<mu::Parser> d_parsers;
 
     /*!
-     * Time and position variables.
+     * Whether each function is independent of time and position, and whether
+     * any of the functions depend on time.
+     */
+    std::vector<bool> d_parser_is_constant;
+    bool d_is_time_dependent;
+
+    /*!
+     * Time and position variables, along with the function values, stored as
+     * arrays for bulk evaluation.
      */
-    double d_parser_time;
-    Point d_parser_posn;
+    std::vector<double> d_parser_time;
+    boost::array<std::vector<double>, NDIM> d_parser_posn;
+    std::vector<double> d_parser_vals;
 };
 } // namespace IBTK
 
@@ -42,7 +42,9 @@
 #include "CartesianGridGeometry.h"
 #include "IntVector.h"
 #include "RobinBcCoefStrategy.h"
+#include "boost/array.hpp"
 #include "muParser.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Pointer.h"
 
@@ -53,6 +55,8 @@ namespace hier
 template <int DIM>
 class BoundaryBox;
 template <int DIM>
+class Box;
+template <int DIM>
 class Patch;
 template <int DIM>
 class Variable;
@@ -74,15 +78,15 @@ namespace IBTK
 {
 /*!
  * \brief Class muParserRobinBcCoefs is an implementation of the strategy class
- * SAMRAI::solv::RobinBcCoefStrategy that allows for the run-time specification
- * of (possibly spatially- and temporally-varying) Robin boundary conditions.
+ * ExtendedRobinBcCoefStrategy that allows for the run-time specification of
+ * (possibly spatially- and temporally-varying) Robin boundary conditions.
  *
  * \warning Not all linear solvers in IBTK properly handle time-varying \em
  * homogeneous Robin boundary condition coefficients.  Note, however, that all
  * linear solvers in IBTK are presently designed to support spatially and
  * temporally varying \em inhomogeneous boundary coefficients.
  */
-class muParserRobinBcCoefs : public SAMRAI::solv::RobinBcCoefStrategy<NDIM>
+class muParserRobinBcCoefs : public ExtendedRobinBcCoefStrategy
 {
 public:
     /*!
@@ -157,6 +161,23 @@ public:
 
     //\}
 
+    /*!
+     * \name Implementation of ExtendedRobinBcCoefStrategy interface.
+     */
+    //\{
+
+    /*!
+     * \brief Indicates whether the boundary condition coefficients are
+     * independent of time.
+     *
+     * \note The coefficients are considered to be time-dependent if at least
+     * one of the coefficient function strings refers to the time variable (T or
+     * t).
+     */
+    bool isTimeIndependent() const;
+
+    //\}
+
 private:
     /*!
      * \brief Default constructor.
@@ -185,6 +206,22 @@ private:
      */
     muParserRobinBcCoefs& operator=(const muParserRobinBcCoefs& that);
 
+    /*!
+     * \brief Ensure that the time and position buffers can hold at least
+     * bulk_size values, re-binding the parser variables if necessary.
+     */
+    void resizeParserBuffers(int bulk_size) const;
+
+    /*!
+     * \brief Evaluate a single coefficient function in bulk at all of the
+     * indices of the specified box, using the positions currently stored in
+     * the parser buffers.
+     */
+    void setDataOnBox(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                      mu::Parser& parser,
+                      bool parser_is_constant,
+                      const SAMRAI::hier::Box<NDIM>& box) const;
+
     /*!
      * The Cartesian grid geometry object provides the extents of the
      * computational domain.
@@ -206,16 +243,33 @@ private:
 
     /*!
      * The mu::Parser objects which evaluate the data-setting functions.
+     *
+     * \note These objects are mutable because bulk evaluation is a non-const
+     * operation.
+     */
+    mutable std::vector<mu::Parser> d_acoef_parsers;
+    mutable std::vector<mu::Parser> d_bcoef_parsers;
+    mutable std::vector<mu::Parser> d_gcoef_parsers;
+
+    /*!
+     * Whether each coefficient function is independent of time and position.
+     */
+    std::vector<bool> d_acoef_is_constant;
+    std::vector<bool> d_bcoef_is_constant;
+    std::vector<bool> d_gcoef_is_constant;
+
+    /*!
+     * Whether any of the coefficient functions depend on time.
      */
-    std::vector<mu::Parser> d_acoef_parsers;
-    std::vector<mu::Parser> d_bcoef_parsers;
-    std::vector<mu::Parser> d_gcoef_parsers;
+    bool d_is_time_dependent;
 
     /*!
-     * Time and position variables.
+     * Time and position variables, along with the function values, stored as
+     * arrays for bulk evaluation.
      */
-    double* d_parser_time;
-    Point* d_parser_posn;
+    mutable std::vector<double> d_parser_time;
+    mutable boost::array<std::vector<double>, NDIM> d_parser_posn;
+    mutable std::vector<double> d_parser_vals;
 };
 } // namespace IBTK
 
@@ -136,6 +136,7 @@ LDataManager::getLData(const std::string& quantity_name, const int level_number)
     TBOX_ASSERT(level_number >= 0);
     TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
     TBOX_ASSERT(d_lag_mesh_data[level_number].count(quantity_name) > 0);
+    TBOX_ASSERT(!d_ldata_values_pending_restart_read);
 #endif
     return d_lag_mesh_data[level_number].find(quantity_name)->second;
 } // getLData
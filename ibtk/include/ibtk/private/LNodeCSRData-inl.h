@@ -0,0 +1,232 @@
+// Filename: LNodeCSRData-inl.h
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LNodeCSRData_inl_h
+#define included_IBTK_LNodeCSRData_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/LNodeCSRData.h"
+#include "ibtk/LSet.h"
+#include "ibtk/LSetData.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+inline LNodeCSRData::DataIterator
+LNodeCSRData::data_begin(const SAMRAI::hier::Box<NDIM>& box) const
+{
+    DataIterator it;
+    it.d_data = this;
+    it.d_box = box * getGhostBox();
+    it.d_cell_idx = it.d_box.lower();
+    it.d_node_idx = 0;
+    it.d_node_upper = 0;
+    if (it.d_box.empty() || d_lag_indices.empty())
+    {
+        it.d_data = NULL;
+        return it;
+    }
+    const int cell_num = getGhostBox().offset(it.d_cell_idx);
+    it.d_node_idx = d_cell_offsets[cell_num];
+    it.d_node_upper = d_cell_offsets[cell_num + 1];
+    if (it.d_node_idx == it.d_node_upper) it.advanceToNextNonemptyCell();
+    return it;
+} // data_begin
+
+inline LNodeCSRData::DataIterator
+LNodeCSRData::data_end() const
+{
+    return DataIterator();
+} // data_end
+
+template <class T>
+inline void
+LNodeCSRData::copyFromLSetData(const LSetData<T>& set_data)
+{
+    const SAMRAI::hier::Box<NDIM>& ghost_box = getGhostBox();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(set_data.getGhostBox() == ghost_box);
+#endif
+    NodeBuffer buf;
+    for (CellIterator b(ghost_box); b; b++)
+    {
+        const SAMRAI::hier::Index<NDIM>& i = b();
+        const LSet<T>* const node_set = set_data.getItem(i);
+        if (!node_set) continue;
+        const int cell_num = ghost_box.offset(i);
+        for (typename LSet<T>::const_iterator n = node_set->begin(); n != node_set->end(); ++n)
+        {
+            const typename LSet<T>::value_type& node_idx = *n;
+            const SAMRAI::hier::IntVector<NDIM>& periodic_offset = node_idx->getPeriodicOffset();
+            const Vector& periodic_displacement = node_idx->getPeriodicDisplacement();
+            buf.cell_nums.push_back(cell_num);
+            buf.lag_indices.push_back(node_idx->getLagrangianIndex());
+            buf.global_petsc_indices.push_back(node_idx->getGlobalPETScIndex());
+            buf.local_petsc_indices.push_back(node_idx->getLocalPETScIndex());
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                buf.periodic_offsets.push_back(periodic_offset(d));
+                buf.periodic_displacements.push_back(periodic_displacement[d]);
+            }
+        }
+    }
+    buildFromNodeBuffer(buf);
+    return;
+} // copyFromLSetData
+
+inline int
+LNodeCSRData::getNumberOfNodes() const
+{
+    return static_cast<int>(d_lag_indices.size());
+} // getNumberOfNodes
+
+inline int
+LNodeCSRData::getNumberOfNodes(const SAMRAI::hier::Index<NDIM>& i) const
+{
+    const SAMRAI::hier::Box<NDIM>& ghost_box = getGhostBox();
+    if (!ghost_box.contains(i)) return 0;
+    const int cell_num = ghost_box.offset(i);
+    return d_cell_offsets[cell_num + 1] - d_cell_offsets[cell_num];
+} // getNumberOfNodes
+
+inline const std::vector<int>&
+LNodeCSRData::getCellOffsets() const
+{
+    return d_cell_offsets;
+} // getCellOffsets
+
+inline SAMRAI::hier::IntVector<NDIM>
+LNodeCSRData::getPeriodicOffset(const int k) const
+{
+    SAMRAI::hier::IntVector<NDIM> periodic_offset;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        periodic_offset(d) = d_periodic_offsets[NDIM * k + d];
+    }
+    return periodic_offset;
+} // getPeriodicOffset
+
+inline Vector
+LNodeCSRData::getPeriodicDisplacement(const int k) const
+{
+    Vector periodic_displacement;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        periodic_displacement[d] = d_periodic_displacements[NDIM * k + d];
+    }
+    return periodic_displacement;
+} // getPeriodicDisplacement
+
+inline const std::vector<int>&
+LNodeCSRData::getLagrangianIndices() const
+{
+    return d_lag_indices;
+} // getLagrangianIndices
+
+inline const std::vector<int>&
+LNodeCSRData::getInteriorLagrangianIndices() const
+{
+    return d_interior_lag_indices;
+} // getInteriorLagrangianIndices
+
+inline const std::vector<int>&
+LNodeCSRData::getGhostLagrangianIndices() const
+{
+    return d_ghost_lag_indices;
+} // getGhostLagrangianIndices
+
+inline const std::vector<int>&
+LNodeCSRData::getGlobalPETScIndices() const
+{
+    return d_global_petsc_indices;
+} // getGlobalPETScIndices
+
+inline const std::vector<int>&
+LNodeCSRData::getInteriorGlobalPETScIndices() const
+{
+    return d_interior_global_petsc_indices;
+} // getInteriorGlobalPETScIndices
+
+inline const std::vector<int>&
+LNodeCSRData::getGhostGlobalPETScIndices() const
+{
+    return d_ghost_global_petsc_indices;
+} // getGhostGlobalPETScIndices
+
+inline const std::vector<int>&
+LNodeCSRData::getLocalPETScIndices() const
+{
+    return d_local_petsc_indices;
+} // getLocalPETScIndices
+
+inline const std::vector<int>&
+LNodeCSRData::getInteriorLocalPETScIndices() const
+{
+    return d_interior_local_petsc_indices;
+} // getInteriorLocalPETScIndices
+
+inline const std::vector<int>&
+LNodeCSRData::getGhostLocalPETScIndices() const
+{
+    return d_ghost_local_petsc_indices;
+} // getGhostLocalPETScIndices
+
+inline const std::vector<double>&
+LNodeCSRData::getPeriodicShifts() const
+{
+    return d_periodic_shifts;
+} // getPeriodicShifts
+
+inline const std::vector<double>&
+LNodeCSRData::getInteriorPeriodicShifts() const
+{
+    return d_interior_periodic_shifts;
+} // getInteriorPeriodicShifts
+
+inline const std::vector<double>&
+LNodeCSRData::getGhostPeriodicShifts() const
+{
+    return d_ghost_periodic_shifts;
+} // getGhostPeriodicShifts
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LNodeCSRData_inl_h
@@ -0,0 +1,212 @@
+// Filename: LNodeCSRDataIterator-inl.h
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LNodeCSRDataIterator_inl_h
+#define included_IBTK_LNodeCSRDataIterator_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/LNodeCSRData.h"
+#include "ibtk/LNodeCSRDataIterator.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+inline LNodeCSRDataIterator::LNodeCSRDataIterator()
+    : d_data(NULL), d_box(), d_cell_idx(), d_node_idx(0), d_node_upper(0)
+{
+    // intentionally blank
+    return;
+} // LNodeCSRDataIterator
+
+inline LNodeCSRDataIterator::LNodeCSRDataIterator(const LNodeCSRDataIterator& that)
+    : d_data(that.d_data),
+      d_box(that.d_box),
+      d_cell_idx(that.d_cell_idx),
+      d_node_idx(that.d_node_idx),
+      d_node_upper(that.d_node_upper)
+{
+    // intentionally blank
+    return;
+} // LNodeCSRDataIterator
+
+inline LNodeCSRDataIterator::~LNodeCSRDataIterator()
+{
+    // intentionally blank
+    return;
+} // ~LNodeCSRDataIterator
+
+inline LNodeCSRDataIterator& LNodeCSRDataIterator::operator=(const LNodeCSRDataIterator& that)
+{
+    if (this != &that)
+    {
+        d_data = that.d_data;
+        d_box = that.d_box;
+        d_cell_idx = that.d_cell_idx;
+        d_node_idx = that.d_node_idx;
+        d_node_upper = that.d_node_upper;
+    }
+    return *this;
+} // operator=
+
+inline bool LNodeCSRDataIterator::operator==(const LNodeCSRDataIterator& that) const
+{
+    return ((!d_data && !that.d_data) ||
+            (d_data == that.d_data && d_box == that.d_box && d_node_idx == that.d_node_idx));
+} // operator==
+
+inline bool LNodeCSRDataIterator::operator!=(const LNodeCSRDataIterator& that) const
+{
+    return !(*this == that);
+} // operator!=
+
+inline LNodeCSRDataIterator& LNodeCSRDataIterator::operator++()
+{
+    if (!d_data) return *this;
+    ++d_node_idx;
+    if (d_node_idx < d_node_upper) return *this;
+    advanceToNextNonemptyCell();
+    return *this;
+} // operator++
+
+inline LNodeCSRDataIterator LNodeCSRDataIterator::operator++(int)
+{
+    LNodeCSRDataIterator tmp(*this);
+    ++(*this);
+    return tmp;
+} // operator++
+
+inline int
+LNodeCSRDataIterator::getNodeIndex() const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data);
+#endif
+    return d_node_idx;
+} // getNodeIndex
+
+inline const SAMRAI::hier::Index<NDIM>&
+LNodeCSRDataIterator::getCellIndex() const
+{
+    return d_cell_idx;
+} // getCellIndex
+
+inline int
+LNodeCSRDataIterator::getLagrangianIndex() const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data);
+#endif
+    return d_data->getLagrangianIndices()[d_node_idx];
+} // getLagrangianIndex
+
+inline int
+LNodeCSRDataIterator::getGlobalPETScIndex() const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data);
+#endif
+    return d_data->getGlobalPETScIndices()[d_node_idx];
+} // getGlobalPETScIndex
+
+inline int
+LNodeCSRDataIterator::getLocalPETScIndex() const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data);
+#endif
+    return d_data->getLocalPETScIndices()[d_node_idx];
+} // getLocalPETScIndex
+
+inline SAMRAI::hier::IntVector<NDIM>
+LNodeCSRDataIterator::getPeriodicOffset() const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data);
+#endif
+    return d_data->getPeriodicOffset(d_node_idx);
+} // getPeriodicOffset
+
+inline Vector
+LNodeCSRDataIterator::getPeriodicDisplacement() const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_data);
+#endif
+    return d_data->getPeriodicDisplacement(d_node_idx);
+} // getPeriodicDisplacement
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+inline void
+LNodeCSRDataIterator::advanceToNextNonemptyCell()
+{
+    const SAMRAI::hier::Box<NDIM>& ghost_box = d_data->getGhostBox();
+    const std::vector<int>& cell_offsets = d_data->getCellOffsets();
+    while (true)
+    {
+        // Advance to the next cell in the iteration box, using the same
+        // (column-major) ordering as the CSR cell offsets.
+        unsigned int d = 0;
+        for (; d < NDIM; ++d)
+        {
+            if (d_cell_idx(d) < d_box.upper()(d))
+            {
+                ++d_cell_idx(d);
+                break;
+            }
+            d_cell_idx(d) = d_box.lower()(d);
+        }
+        if (d == NDIM)
+        {
+            d_data = NULL;
+            return;
+        }
+        const int cell_num = ghost_box.offset(d_cell_idx);
+        d_node_idx = cell_offsets[cell_num];
+        d_node_upper = cell_offsets[cell_num + 1];
+        if (d_node_idx < d_node_upper) return;
+    }
+    return;
+} // advanceToNextNonemptyCell
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LNodeCSRDataIterator_inl_h
@@ -0,0 +1,85 @@
+// Filename: TimestepProfiler-inl.h
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_TimestepProfiler_inl_h
+#define included_IBTK_TimestepProfiler_inl_h
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/TimestepProfiler.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+inline bool
+TimestepProfiler::isEnabled() const
+{
+    return d_enabled;
+} // isEnabled
+
+inline void
+TimestepProfiler::startPhase(const ProfilingPhase phase)
+{
+    if (!d_enabled) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(phase >= 0 && phase < NUM_PROFILING_PHASES);
+#endif
+    if (d_phase_depth[phase]++ == 0) d_phase_start_time[phase] = MPI_Wtime();
+    return;
+} // startPhase
+
+inline void
+TimestepProfiler::stopPhase(const ProfilingPhase phase)
+{
+    if (!d_enabled) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(phase >= 0 && phase < NUM_PROFILING_PHASES);
+#endif
+    // Phases that were already in progress when profiling was enabled are not
+    // recorded.
+    if (d_phase_depth[phase] == 0) return;
+    if (--d_phase_depth[phase] == 0) recordPhase(phase, d_phase_start_time[phase], MPI_Wtime());
+    return;
+} // stopPhase
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_TimestepProfiler_inl_h
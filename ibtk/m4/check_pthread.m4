@@ -0,0 +1,35 @@
+# -------------------------------------------------------------
+# -------------------------------------------------------------
+AC_DEFUN([CHECK_PTHREAD],[
+AC_MSG_CHECKING([for the flags needed to compile and link POSIX threads programs])
+pthread_flags=unknown
+for flag in -pthread -lpthread none ; do
+  check_pthread_save_CXXFLAGS="$CXXFLAGS"
+  check_pthread_save_LIBS="$LIBS"
+  case $flag in
+    none) ;;
+    -l*)  LIBS="$flag $LIBS" ;;
+    *)    CXXFLAGS="$CXXFLAGS $flag" ; LIBS="$flag $LIBS" ;;
+  esac
+  AC_LINK_IFELSE([AC_LANG_PROGRAM([[
+#include <pthread.h>
+static void* thread_fcn(void* arg) { return arg; }
+]], [[
+    pthread_t thread;
+    if (pthread_create(&thread, 0, thread_fcn, 0) != 0) return 1;
+    return pthread_join(thread, 0);
+]])],[pthread_flags="$flag"])
+  CXXFLAGS="$check_pthread_save_CXXFLAGS"
+  LIBS="$check_pthread_save_LIBS"
+  if test "$pthread_flags" != unknown ; then
+    break
+  fi
+done
+AC_MSG_RESULT($pthread_flags)
+case $pthread_flags in
+  unknown) AC_MSG_ERROR([could not determine how to compile and link POSIX threads programs]) ;;
+  none)    ;;
+  -l*)     LIBS="$pthread_flags $LIBS" ;;
+  *)       CXXFLAGS="$CXXFLAGS $pthread_flags" ; LIBS="$pthread_flags $LIBS" ;;
+esac
+])
@@ -69,6 +69,7 @@
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/TimestepProfiler.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Pointer.h"
@@ -581,6 +582,7 @@ void
 HierarchyGhostCellInterpolation::fillData(double fill_time)
 {
     IBTK_TIMER_START(t_fill_data);
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_GHOST_FILL);
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(d_is_initialized);
@@ -659,6 +661,7 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
     }
     IBTK_TIMER_STOP(t_fill_data_set_physical_bcs);
 
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_GHOST_FILL);
     IBTK_TIMER_STOP(t_fill_data);
     return;
 } // fillData
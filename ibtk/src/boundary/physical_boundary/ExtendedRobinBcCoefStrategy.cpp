@@ -82,6 +82,12 @@ ExtendedRobinBcCoefStrategy::setHomogeneousBc(bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+bool
+ExtendedRobinBcCoefStrategy::isTimeIndependent() const
+{
+    return false;
+} // isTimeIndependent
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -32,40 +32,50 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <deque>
+#include <functional>
+#include <map>
 #include <ostream>
 #include <set>
+#include <utility>
 #include <vector>
 
+#include "ArrayData.h"
+#include "BoundaryBox.h"
 #include "Box.h"
 #include "ComponentSelector.h"
 #include "IntVector.h"
+#include "Patch.h"
+#include "PatchGeometry.h"
+#include "RobinBcCoefStrategy.h"
+#include "Variable.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
-namespace SAMRAI
-{
-namespace hier
-{
-template <int DIM>
-class Patch;
-} // namespace hier
-namespace solv
-{
-template <int DIM>
-class RobinBcCoefStrategy;
-} // namespace solv
-} // namespace SAMRAI
-
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The maximum number of cached boundary condition coefficient arrays.
+static const unsigned int MAX_BC_COEF_CACHE_SIZE = 4096;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy() : d_patch_data_indices(), d_bc_coefs(), d_homogeneous_bc(false)
+RobinPhysBdryPatchStrategy::RobinPhysBdryPatchStrategy()
+    : d_patch_data_indices(),
+      d_bc_coefs(),
+      d_homogeneous_bc(false),
+      d_bc_coef_cache(),
+      d_bc_coef_cache_queue(),
+      d_bc_coef_scratch()
 {
     // intentionally blank
     return;
@@ -127,6 +137,7 @@ RobinPhysBdryPatchStrategy::setPhysicalBcCoefs(const std::vector<RobinBcCoefStra
     }
 #endif
     d_bc_coefs = bc_coefs;
+    clearBcCoefCache();
     return;
 } // setPhysicalBcCoefs
 
@@ -143,6 +154,14 @@ RobinPhysBdryPatchStrategy::getHomogeneousBc() const
     return d_homogeneous_bc;
 } // getHomogeneousBc
 
+void
+RobinPhysBdryPatchStrategy::clearBcCoefCache()
+{
+    d_bc_coef_cache.clear();
+    d_bc_coef_cache_queue.clear();
+    return;
+} // clearBcCoefCache
+
 void
 RobinPhysBdryPatchStrategy::preprocessRefine(Patch<NDIM>& /*fine*/,
                                              const Patch<NDIM>& /*coarse*/,
@@ -174,8 +193,98 @@ RobinPhysBdryPatchStrategy::accumulateFromPhysicalBoundaryData(Patch<NDIM>& /*pa
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
+void
+RobinPhysBdryPatchStrategy::setBcCoefData(Pointer<ArrayData<NDIM, double> >& acoef_data,
+                                          Pointer<ArrayData<NDIM, double> >& bcoef_data,
+                                          Pointer<ArrayData<NDIM, double> >& gcoef_data,
+                                          const int patch_data_idx,
+                                          const int bc_coef_idx,
+                                          const Pointer<Variable<NDIM> >& var,
+                                          Patch<NDIM>& patch,
+                                          const BoundaryBox<NDIM>& bdry_box,
+                                          const Box<NDIM>& bc_coef_box,
+                                          const double fill_time)
+{
+    RobinBcCoefStrategy<NDIM>* const bc_coef = d_bc_coefs[bc_coef_idx];
+    ExtendedRobinBcCoefStrategy* const extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coef);
+
+    // Look up the cached coefficients if the coefficients do not depend on
+    // time.  Otherwise, the coefficients are recomputed in the scratch arrays.
+    BcCoefCacheData* coef_data = &d_bc_coef_scratch;
+    bool compute_coefs = true;
+    if (extended_bc_coef && extended_bc_coef->isTimeIndependent())
+    {
+        BcCoefCacheKey key;
+        key.patch_data_idx = patch_data_idx;
+        key.bc_coef = bc_coef;
+        key.location_index = bdry_box.getLocationIndex();
+        key.homogeneous_bc = d_homogeneous_bc;
+        key.ratio = patch.getPatchGeometry()->getRatio();
+        key.patch_box = patch.getBox();
+        key.bc_coef_box = bc_coef_box;
+        std::pair<std::map<BcCoefCacheKey, BcCoefCacheData>::iterator, bool> it =
+            d_bc_coef_cache.insert(std::make_pair(key, BcCoefCacheData()));
+        coef_data = &it.first->second;
+        compute_coefs = it.second;
+        if (compute_coefs)
+        {
+            d_bc_coef_cache_queue.push_back(it.first);
+            if (d_bc_coef_cache_queue.size() > MAX_BC_COEF_CACHE_SIZE)
+            {
+                d_bc_coef_cache.erase(d_bc_coef_cache_queue.front());
+                d_bc_coef_cache_queue.pop_front();
+            }
+        }
+    }
+
+    if (compute_coefs)
+    {
+        if (!coef_data->acoef_data || coef_data->acoef_data->getBox() != bc_coef_box)
+        {
+            coef_data->acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            coef_data->bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            coef_data->gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+        }
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(patch_data_idx);
+            extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+        }
+        bc_coef->setBcCoefs(
+            coef_data->acoef_data, coef_data->bcoef_data, coef_data->gcoef_data, var, patch, bdry_box, fill_time);
+        if (d_homogeneous_bc && !extended_bc_coef) coef_data->gcoef_data->fillAll(0.0);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->clearTargetPatchDataIndex();
+            extended_bc_coef->setHomogeneousBc(false);
+        }
+    }
+    acoef_data = coef_data->acoef_data;
+    bcoef_data = coef_data->bcoef_data;
+    gcoef_data = coef_data->gcoef_data;
+    return;
+} // setBcCoefData
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+bool
+RobinPhysBdryPatchStrategy::BcCoefCacheKey::operator<(const BcCoefCacheKey& that) const
+{
+    if (patch_data_idx != that.patch_data_idx) return patch_data_idx < that.patch_data_idx;
+    if (bc_coef != that.bc_coef) return std::less<const RobinBcCoefStrategy<NDIM>*>()(bc_coef, that.bc_coef);
+    if (location_index != that.location_index) return location_index < that.location_index;
+    if (homogeneous_bc != that.homogeneous_bc) return homogeneous_bc < that.homogeneous_bc;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (ratio(d) != that.ratio(d)) return ratio(d) < that.ratio(d);
+        if (patch_box.lower(d) != that.patch_box.lower(d)) return patch_box.lower(d) < that.patch_box.lower(d);
+        if (patch_box.upper(d) != that.patch_box.upper(d)) return patch_box.upper(d) < that.patch_box.upper(d);
+        if (bc_coef_box.lower(d) != that.bc_coef_box.lower(d)) return bc_coef_box.lower(d) < that.bc_coef_box.lower(d);
+        if (bc_coef_box.upper(d) != that.bc_coef_box.upper(d)) return bc_coef_box.upper(d) < that.bc_coef_box.upper(d);
+    }
+    return false;
+} // operator<
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
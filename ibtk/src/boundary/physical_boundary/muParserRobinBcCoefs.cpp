@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
@@ -89,8 +90,13 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
       d_acoef_parsers(2 * NDIM),
       d_bcoef_parsers(2 * NDIM),
       d_gcoef_parsers(2 * NDIM),
-      d_parser_time(new double),
-      d_parser_posn(new Point)
+      d_acoef_is_constant(),
+      d_bcoef_is_constant(),
+      d_gcoef_is_constant(),
+      d_is_time_dependent(false),
+      d_parser_time(),
+      d_parser_posn(),
+      d_parser_vals()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -318,19 +324,47 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
         {
             (*cit)->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        (*cit)->DefineVar("T", d_parser_time);
-        (*cit)->DefineVar("t", d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.  The time and position variables are bound to arrays so that
+    // the parsers may be evaluated in bulk over entire boundary boxes.
+    resizeParserBuffers(1);
+
+    // Determine which coefficient functions depend on time and which do not
+    // depend on any variables at all.
+    d_acoef_is_constant.resize(2 * NDIM);
+    d_bcoef_is_constant.resize(2 * NDIM);
+    d_gcoef_is_constant.resize(2 * NDIM);
+    d_is_time_dependent = false;
+    for (int d = 0; d < 2 * NDIM; ++d)
+    {
+        try
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            (*cit)->DefineVar("X" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("X_" + postfix, &d_parser_posn->data()[d]);
-            (*cit)->DefineVar("x_" + postfix, &d_parser_posn->data()[d]);
+            const mu::Parser* const coef_parsers[3] = { &d_acoef_parsers[d], &d_bcoef_parsers[d], &d_gcoef_parsers[d] };
+            for (int k = 0; k < 3; ++k)
+            {
+                const mu::varmap_type& used_vars = coef_parsers[k]->GetUsedVar();
+                d_is_time_dependent =
+                    d_is_time_dependent || used_vars.count("T") > 0 || used_vars.count("t") > 0;
+            }
+            d_acoef_is_constant[d] = d_acoef_parsers[d].GetUsedVar().empty();
+            d_bcoef_is_constant[d] = d_bcoef_parsers[d].GetUsedVar().empty();
+            d_gcoef_is_constant[d] = d_gcoef_parsers[d].GetUsedVar().empty();
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserRobinBcCoefs::muParserRobinBcCoefs():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -338,8 +372,7 @@ muParserRobinBcCoefs::muParserRobinBcCoefs(const std::string& object_name,
 
 muParserRobinBcCoefs::~muParserRobinBcCoefs()
 {
-    delete d_parser_time;
-    delete d_parser_posn;
+    // intentionally blank
     return;
 } // ~muParserRobinBcCoefs
 
@@ -371,44 +404,50 @@ muParserRobinBcCoefs::setBcCoefs(Pointer<ArrayData<NDIM, double> >& acoef_data,
     TBOX_ASSERT(!gcoef_data || bc_coef_box == gcoef_data->getBox());
 #endif
 
-    const mu::Parser& acoef_parser = d_acoef_parsers[location_index];
-    const mu::Parser& bcoef_parser = d_bcoef_parsers[location_index];
-    const mu::Parser& gcoef_parser = d_gcoef_parsers[location_index];
-    *d_parser_time = fill_time;
-    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+    if (bc_coef_box.empty()) return;
+
+    // Set the time and position variables for all of the boundary points.
+    const int bulk_size = bc_coef_box.size();
+    resizeParserBuffers(bulk_size);
+    std::fill(d_parser_time.begin(), d_parser_time.begin() + bulk_size, fill_time);
+    int k = 0;
+    for (Box<NDIM>::Iterator b(bc_coef_box); b; b++, ++k)
     {
         const Index<NDIM>& i = b();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             if (d != bdry_normal_axis)
             {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
             }
             else
             {
-                (*d_parser_posn)[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
+                d_parser_posn[d][k] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
             }
         }
-        try
-        {
-            if (acoef_data) (*acoef_data)(i, 0) = acoef_parser.Eval();
-            if (bcoef_data) (*bcoef_data)(i, 0) = bcoef_parser.Eval();
-            if (gcoef_data) (*gcoef_data)(i, 0) = gcoef_parser.Eval();
-        }
-        catch (mu::ParserError& e)
+    }
+
+    // Evaluate the coefficients in bulk.
+    if (acoef_data)
+    {
+        setDataOnBox(
+            *acoef_data, d_acoef_parsers[location_index], d_acoef_is_constant[location_index], bc_coef_box);
+    }
+    if (bcoef_data)
+    {
+        setDataOnBox(
+            *bcoef_data, d_bcoef_parsers[location_index], d_bcoef_is_constant[location_index], bc_coef_box);
+    }
+    if (gcoef_data)
+    {
+        if (d_homogeneous_bc)
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  error: "
-                       << e.GetMsg()
-                       << "\n"
-                       << "  in:    "
-                       << e.GetExpr()
-                       << "\n");
+            gcoef_data->fillAll(0.0);
         }
-        catch (...)
+        else
         {
-            TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
-                       << "  unrecognized exception generated by muParser library.\n");
+            setDataOnBox(
+                *gcoef_data, d_gcoef_parsers[location_index], d_gcoef_is_constant[location_index], bc_coef_box);
         }
     }
     return;
@@ -420,10 +459,94 @@ muParserRobinBcCoefs::numberOfExtensionsFillable() const
     return EXTENSIONS_FILLABLE;
 } // numberOfExtensionsFillable
 
+bool
+muParserRobinBcCoefs::isTimeIndependent() const
+{
+    return !d_is_time_dependent;
+} // isTimeIndependent
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+muParserRobinBcCoefs::resizeParserBuffers(const int bulk_size) const
+{
+    if (static_cast<int>(d_parser_time.size()) >= bulk_size) return;
+
+    // Resizing the buffers may invalidate the addresses stored by the parsers,
+    // so the variables must be re-bound.
+    d_parser_time.resize(bulk_size);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_parser_posn[d].resize(bulk_size);
+    }
+    d_parser_vals.resize(bulk_size);
+    std::vector<mu::Parser*> all_parsers(3 * 2 * NDIM);
+    for (int d = 0; d < 2 * NDIM; ++d)
+    {
+        all_parsers[3 * d] = &d_acoef_parsers[d];
+        all_parsers[3 * d + 1] = &d_bcoef_parsers[d];
+        all_parsers[3 * d + 2] = &d_gcoef_parsers[d];
+    }
+    for (std::vector<mu::Parser*>::const_iterator cit = all_parsers.begin(); cit != all_parsers.end(); ++cit)
+    {
+        (*cit)->DefineVar("T", &d_parser_time[0]);
+        (*cit)->DefineVar("t", &d_parser_time[0]);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            std::ostringstream stream;
+            stream << d;
+            const std::string postfix = stream.str();
+            (*cit)->DefineVar("X" + postfix, &d_parser_posn[d][0]);
+            (*cit)->DefineVar("x" + postfix, &d_parser_posn[d][0]);
+            (*cit)->DefineVar("X_" + postfix, &d_parser_posn[d][0]);
+            (*cit)->DefineVar("x_" + postfix, &d_parser_posn[d][0]);
+        }
+    }
+    return;
+} // resizeParserBuffers
+
+void
+muParserRobinBcCoefs::setDataOnBox(ArrayData<NDIM, double>& data,
+                                   mu::Parser& parser,
+                                   const bool parser_is_constant,
+                                   const Box<NDIM>& box) const
+{
+    try
+    {
+        // Functions that do not depend on any variables need only be evaluated
+        // once.
+        if (parser_is_constant)
+        {
+            data.fill(parser.Eval(), box, 0);
+            return;
+        }
+        parser.Eval(&d_parser_vals[0], box.size());
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserRobinBcCoefs::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+    int k = 0;
+    for (Box<NDIM>::Iterator b(box); b; b++, ++k)
+    {
+        data(b(), 0) = d_parser_vals[k];
+    }
+    return;
+} // setDataOnBox
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -85,6 +85,8 @@
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/TimestepProfiler.h"
+#include "ibtk/WorkloadModel.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -510,6 +512,7 @@ FEDataManager::spread(const int f_data_idx,
                       const double fill_data_time)
 {
     IBTK_TIMER_START(t_spread);
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_SPREAD);
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -607,6 +610,7 @@ FEDataManager::spread(const int f_data_idx,
         const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
         const size_t num_active_patch_elems = patch_elems.size();
         if (!num_active_patch_elems) continue;
+        const double start_time = d_workload_model.isEnabled() ? MPI_Wtime() : 0.0;
 
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
@@ -706,6 +710,10 @@ FEDataManager::spread(const int f_data_idx,
             Pointer<SideData<NDIM, double> > f_sc_data = f_data;
             LEInteractor::spread(f_sc_data, F_JxW_qp, n_vars, X_qp, NDIM, patch, spread_box, spread_spec.kernel_fcn);
         }
+        if (d_workload_model.isEnabled())
+        {
+            d_workload_model.recordInteractionSample(static_cast<int>(n_qp_patch), MPI_Wtime() - start_time);
+        }
         if (f_phys_bdry_op)
         {
             f_phys_bdry_op->setPatchDataIndex(f_data_idx);
@@ -729,6 +737,7 @@ FEDataManager::spread(const int f_data_idx,
     VecRestoreArray(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_SPREAD);
     IBTK_TIMER_STOP(t_spread);
     return;
 } // spread
@@ -975,6 +984,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
                               const double fill_data_time)
 {
     IBTK_TIMER_START(t_interp_weighted);
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_INTERP);
 
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
 
@@ -1048,6 +1058,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
         const std::vector<Elem*>& patch_elems = d_active_patch_elem_map[local_patch_num];
         const size_t num_active_patch_elems = patch_elems.size();
         if (!num_active_patch_elems) continue;
+        const double start_time = d_workload_model.isEnabled() ? MPI_Wtime() : 0.0;
 
         const Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
@@ -1184,12 +1195,17 @@ FEDataManager::interpWeighted(const int f_data_idx,
             }
             qp_offset += n_qp;
         }
+        if (d_workload_model.isEnabled())
+        {
+            d_workload_model.recordInteractionSample(static_cast<int>(n_qp_patch), MPI_Wtime() - start_time);
+        }
     }
     F_vec.close();
 
     VecRestoreArray(X_local_vec, &X_local_soln);
     VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_INTERP);
     IBTK_TIMER_STOP(t_interp_weighted);
     return;
 } // interpWeighted
@@ -1216,6 +1232,7 @@ FEDataManager::interp(const int f_data_idx,
                       const double fill_data_time)
 {
     IBTK_TIMER_START(t_interp);
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_INTERP);
 
     // Interpolate quantity at quadrature points and filter it to nodal points.
     UniquePtr<NumericVector<double> > F_rhs_vec = F_vec.zero_clone();
@@ -1224,6 +1241,7 @@ FEDataManager::interp(const int f_data_idx,
     // Solve for the nodal values.
     computeL2Projection(F_vec, *F_rhs_vec, system_name, interp_spec.use_consistent_mass_matrix);
 
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_INTERP);
     IBTK_TIMER_STOP(t_interp);
     return;
 } // interp
@@ -1833,6 +1851,11 @@ FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int fines
     TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
     TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
 
+    if (d_workload_model.calibrate())
+    {
+        d_beta_work = d_workload_model.getRelativeItemCost();
+    }
+
     // Workload estimates are computed only on the level to which the FE mesh
     // has been assigned.
     const int ln = d_level_number;
@@ -1840,13 +1863,52 @@ FEDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int fines
     {
         updateQuadPointCountData(ln, ln);
         HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, ln, ln);
-        hier_cc_data_ops.add(d_workload_idx, d_qp_count_idx, d_workload_idx);
+        hier_cc_data_ops.axpy(d_workload_idx, d_beta_work, d_qp_count_idx, d_workload_idx);
+        d_workload_model.addPatchCostToWorkload(d_hierarchy->getPatchLevel(ln), d_workload_idx, d_qp_count_idx);
     }
 
     IBTK_TIMER_STOP(t_update_workload_estimates);
     return;
 } // updateWorkloadEstimates
 
+void
+FEDataManager::setWorkloadCalibrationWindow(const int window_size)
+{
+    d_workload_model.setWindowSize(window_size);
+    return;
+} // setWorkloadCalibrationWindow
+
+void
+FEDataManager::recordEulerianWorkloadSample(const double wall_time)
+{
+    if (!d_workload_model.isEnabled()) return;
+    int num_local_cells = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            num_local_cells += level->getPatch(p())->getBox().size();
+        }
+    }
+    d_workload_model.recordEulerianSample(num_local_cells, d_num_local_qps, wall_time);
+    return;
+} // recordEulerianWorkloadSample
+
+void
+FEDataManager::recordLagrangianWorkloadSample(const double wall_time)
+{
+    if (!d_workload_model.isEnabled()) return;
+    d_workload_model.recordLagrangianSample(wall_time);
+    return;
+} // recordLagrangianWorkloadSample
+
+const WorkloadModel&
+FEDataManager::getWorkloadModel() const
+{
+    return d_workload_model;
+} // getWorkloadModel
+
 void
 FEDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hierarchy,
                                    const int level_number,
@@ -2047,6 +2109,7 @@ FEDataManager::putToDatabase(Pointer<Database> db)
     db->putInteger("FE_DATA_MANAGER_VERSION", FE_DATA_MANAGER_VERSION);
     db->putInteger("d_coarsest_ln", d_coarsest_ln);
     db->putInteger("d_finest_ln", d_finest_ln);
+    db->putDouble("d_beta_work", d_beta_work);
 
     IBTK_TIMER_STOP(t_put_to_database);
     return;
@@ -2066,6 +2129,9 @@ FEDataManager::FEDataManager(const std::string& object_name,
       d_hierarchy(NULL),
       d_coarsest_ln(-1),
       d_finest_ln(-1),
+      d_beta_work(1.0),
+      d_workload_model(),
+      d_num_local_qps(0),
       d_default_interp_spec(default_interp_spec),
       d_default_spread_spec(default_spread_spec),
       d_ghost_width(ghost_width),
@@ -2160,6 +2226,7 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
 {
     // Set the node count data on the specified range of levels of the
     // hierarchy.
+    if (coarsest_ln <= d_level_number && d_level_number <= finest_ln) d_num_local_qps = 0;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -2237,7 +2304,11 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
                 {
                     interpolate(&X_qp[0], qp, X_node, phi);
                     const Index<NDIM> i = IndexUtilities::getCellIndex(X_qp, grid_geom, ratio);
-                    if (patch_box.contains(i)) (*qp_count_data)(i) += 1.0;
+                    if (patch_box.contains(i))
+                    {
+                        (*qp_count_data)(i) += 1.0;
+                        ++d_num_local_qps;
+                    }
                 }
             }
         }
@@ -2629,6 +2700,7 @@ FEDataManager::getFromRestart()
 
     d_coarsest_ln = db->getInteger("d_coarsest_ln");
     d_finest_ln = db->getInteger("d_finest_ln");
+    if (db->keyExists("d_beta_work")) d_beta_work = db->getDouble("d_beta_work");
     return;
 } // getFromRestart
 
@@ -226,7 +226,13 @@ LData::LData(Pointer<Database> db)
     d_local_node_count = num_local_nodes;
     d_ghost_node_count = static_cast<int>(d_nonlocal_petsc_indices.size());
 
-    // Extract the values from the database.
+    // Extract the values from the database.  The values are omitted only when
+    // they are written separately, in which case they must be read back in by
+    // LDataManager::readLDataFromRestartFile() before the data are used.
+    if (db->keyExists("vals_written_separately") && db->getBool("vals_written_separately"))
+    {
+        return;
+    }
     double* ghosted_local_vec_array = getGhostedLocalFormVecArray()->data();
     if (num_local_nodes + num_ghost_nodes > 0)
     {
@@ -291,7 +297,7 @@ LData::resetData(Vec vec, const std::vector<int>& nonlocal_petsc_indices, const
 } // resetData
 
 void
-LData::putToDatabase(Pointer<Database> db)
+LData::putToDatabase(Pointer<Database> db, const bool put_values)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(db);
@@ -306,6 +312,11 @@ LData::putToDatabase(Pointer<Database> db)
     {
         db->putIntegerArray("d_nonlocal_petsc_indices", &d_nonlocal_petsc_indices[0], num_ghost_nodes);
     }
+    db->putBool("vals_written_separately", !put_values);
+    if (!put_values)
+    {
+        return;
+    }
     const double* const ghosted_local_vec_array = getGhostedLocalFormVecArray()->data();
     if (num_local_nodes + num_ghost_nodes > 0)
     {
@@ -34,12 +34,15 @@
 
 #include <math.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <algorithm>
+#include <iomanip>
 #include <limits>
 #include <map>
 #include <numeric>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -97,6 +100,7 @@
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/LNodeCSRData.h"
 #include "ibtk/LNodeIndex.h"
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetData.h"
@@ -109,6 +113,8 @@
 #include "ibtk/LTransaction.h"
 #include "ibtk/ParallelSet.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/TimestepProfiler.h"
+#include "ibtk/WorkloadModel.h"
 #include "ibtk/compiler_hints.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -116,6 +122,7 @@
 #include "petscis.h"
 #include "petscsys.h"
 #include "petscvec.h"
+#include "petscviewer.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
@@ -153,12 +160,15 @@ static Timer* t_map_lagrangian_to_petsc;
 static Timer* t_map_petsc_to_lagrangian;
 static Timer* t_begin_data_redistribution;
 static Timer* t_end_data_redistribution;
+static Timer* t_migrate_lag_data;
 static Timer* t_update_workload_estimates;
 static Timer* t_update_node_count_data;
 static Timer* t_initialize_level_data;
 static Timer* t_reset_hierarchy_configuration;
 static Timer* t_apply_gradient_detector;
 static Timer* t_put_to_database;
+static Timer* t_write_ldata_to_restart_file;
+static Timer* t_read_ldata_from_restart_file;
 static Timer* t_begin_nonlocal_data_fill;
 static Timer* t_end_nonlocal_data_fill;
 static Timer* t_compute_node_distribution;
@@ -172,11 +182,62 @@ static const double TOL = sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
+
+// A sort key together with the position of the corresponding node in a list of
+// nodes.
+struct NodeSortKey
+{
+    uint64_t key;
+    int pos;
+};
+
+// Sort the keys in ascending order by a least-significant-digit radix sort.
+// Passes in which all keys share the same digit are skipped, so that the cost
+// is proportional to the number of significant bits in the keys.
+inline void
+radix_sort_keys(std::vector<NodeSortKey>& keys, std::vector<NodeSortKey>& scratch)
+{
+    static const int RADIX_BITS = 8;
+    static const int RADIX = 1 << RADIX_BITS;
+    const size_t n = keys.size();
+    if (n <= 1) return;
+    scratch.resize(n);
+    for (int shift = 0; shift < 64; shift += RADIX_BITS)
+    {
+        size_t count[RADIX + 1];
+        std::fill(count, count + RADIX + 1, 0);
+        for (size_t k = 0; k < n; ++k)
+        {
+            ++count[((keys[k].key >> shift) & (RADIX - 1)) + 1];
+        }
+        if (count[((keys[0].key >> shift) & (RADIX - 1)) + 1] == n) continue;
+        std::partial_sum(count, count + RADIX + 1, count);
+        for (size_t k = 0; k < n; ++k)
+        {
+            scratch[count[(keys[k].key >> shift) & (RADIX - 1)]++] = keys[k];
+        }
+        keys.swap(scratch);
+    }
+    return;
+} // radix_sort_keys
+
+std::string
+ldata_restart_file_name(const std::string& restart_dirname,
+                        const std::string& ldata_name,
+                        int level_number,
+                        unsigned int time_step_number)
+{
+    std::ostringstream file_name;
+    file_name << restart_dirname << "/ldata_" << ldata_name << "_level_" << level_number << "." << std::setw(6)
+              << std::setfill('0') << std::right << time_step_number << ".petsc";
+    return file_name.str();
+} // ldata_restart_file_name
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
 const std::string LDataManager::INIT_POSN_DATA_NAME = "X0";
 const std::string LDataManager::VEL_DATA_NAME = "U";
+const std::string LDataManager::DISP_REF_DATA_NAME = "X_disp_ref";
 std::map<std::string, LDataManager*> LDataManager::s_data_manager_instances;
 bool LDataManager::s_registered_callback = false;
 unsigned char LDataManager::s_shutdown_priority = 200;
@@ -424,6 +485,7 @@ LDataManager::spread(const int f_data_idx,
                      const int finest_ln_in)
 {
     IBTK_TIMER_START(t_spread);
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_SPREAD);
 
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
@@ -467,6 +529,7 @@ LDataManager::spread(const int f_data_idx,
         ds_data[ln]->restoreArrays();
     }
 
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_SPREAD);
     IBTK_TIMER_STOP(t_spread);
 
     // Spread data from the Lagrangian mesh to the Eulerian grid.
@@ -583,6 +646,7 @@ LDataManager::spread(const int f_data_idx,
                      const int finest_ln_in)
 {
     IBTK_TIMER_START(t_spread);
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_SPREAD);
 
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
@@ -646,29 +710,69 @@ LDataManager::spread(const int f_data_idx,
             Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
             const Box<NDIM>& box = idx_data->getGhostBox();
+            Pointer<LNodeCSRData> csr_data;
+            if (d_use_csr_index_data) csr_data = getCSRIndexData(ln, patch);
+            const double start_time = d_workload_model.isEnabled() ? MPI_Wtime() : 0.0;
             if (cc_data)
             {
                 Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::spread(
-                    f_cc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                if (csr_data)
+                {
+                    LEInteractor::spread(
+                        f_cc_data, F_data[ln], X_data[ln], csr_data, patch, box, periodic_shift, spread_kernel_fcn);
+                }
+                else
+                {
+                    LEInteractor::spread(
+                        f_cc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                }
             }
             if (ec_data)
             {
                 Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
-                LEInteractor::spread(
-                    f_ec_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                if (csr_data)
+                {
+                    LEInteractor::spread(
+                        f_ec_data, F_data[ln], X_data[ln], csr_data, patch, box, periodic_shift, spread_kernel_fcn);
+                }
+                else
+                {
+                    LEInteractor::spread(
+                        f_ec_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                }
             }
             if (nc_data)
             {
                 Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
-                LEInteractor::spread(
-                    f_nc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                if (csr_data)
+                {
+                    LEInteractor::spread(
+                        f_nc_data, F_data[ln], X_data[ln], csr_data, patch, box, periodic_shift, spread_kernel_fcn);
+                }
+                else
+                {
+                    LEInteractor::spread(
+                        f_nc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                }
             }
             if (sc_data)
             {
                 Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::spread(
-                    f_sc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                if (csr_data)
+                {
+                    LEInteractor::spread(
+                        f_sc_data, F_data[ln], X_data[ln], csr_data, patch, box, periodic_shift, spread_kernel_fcn);
+                }
+                else
+                {
+                    LEInteractor::spread(
+                        f_sc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+                }
+            }
+            if (d_workload_model.isEnabled())
+            {
+                d_workload_model.recordInteractionSample(static_cast<int>(idx_data->getLocalPETScIndices().size()),
+                                                         MPI_Wtime() - start_time);
             }
             if (f_phys_bdry_op)
             {
@@ -688,6 +792,7 @@ LDataManager::spread(const int f_data_idx,
     }
     var_db->removePatchDataIndex(f_copy_data_idx);
 
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_SPREAD);
     IBTK_TIMER_STOP(t_spread);
     return;
 } // spread
@@ -732,6 +837,7 @@ LDataManager::interp(const int f_data_idx,
                      const int finest_ln_in)
 {
     IBTK_TIMER_START(t_interp);
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_INTERP);
 
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
@@ -777,53 +883,117 @@ LDataManager::interp(const int f_data_idx,
             Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
             const Box<NDIM>& box = idx_data->getBox();
+            Pointer<LNodeCSRData> csr_data;
+            if (d_use_csr_index_data) csr_data = getCSRIndexData(ln, patch);
+            const double start_time = d_workload_model.isEnabled() ? MPI_Wtime() : 0.0;
             if (cc_data)
             {
                 Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_cc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                if (csr_data)
+                {
+                    LEInteractor::interpolate(F_data[ln],
+                                              X_data[ln],
+                                              csr_data,
+                                              f_cc_data,
+                                              patch,
+                                              box,
+                                              periodic_shift,
+                                              d_default_interp_kernel_fcn);
+                }
+                else
+                {
+                    LEInteractor::interpolate(F_data[ln],
+                                              X_data[ln],
+                                              idx_data,
+                                              f_cc_data,
+                                              patch,
+                                              box,
+                                              periodic_shift,
+                                              d_default_interp_kernel_fcn);
+                }
             }
             if (ec_data)
             {
                 Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_ec_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                if (csr_data)
+                {
+                    LEInteractor::interpolate(F_data[ln],
+                                              X_data[ln],
+                                              csr_data,
+                                              f_ec_data,
+                                              patch,
+                                              box,
+                                              periodic_shift,
+                                              d_default_interp_kernel_fcn);
+                }
+                else
+                {
+                    LEInteractor::interpolate(F_data[ln],
+                                              X_data[ln],
+                                              idx_data,
+                                              f_ec_data,
+                                              patch,
+                                              box,
+                                              periodic_shift,
+                                              d_default_interp_kernel_fcn);
+                }
             }
             if (nc_data)
             {
                 Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_nc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                if (csr_data)
+                {
+                    LEInteractor::interpolate(F_data[ln],
+                                              X_data[ln],
+                                              csr_data,
+                                              f_nc_data,
+                                              patch,
+                                              box,
+                                              periodic_shift,
+                                              d_default_interp_kernel_fcn);
+                }
+                else
+                {
+                    LEInteractor::interpolate(F_data[ln],
+                                              X_data[ln],
+                                              idx_data,
+                                              f_nc_data,
+                                              patch,
+                                              box,
+                                              periodic_shift,
+                                              d_default_interp_kernel_fcn);
+                }
             }
             if (sc_data)
             {
                 Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_sc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
+                if (csr_data)
+                {
+                    LEInteractor::interpolate(F_data[ln],
+                                              X_data[ln],
+                                              csr_data,
+                                              f_sc_data,
+                                              patch,
+                                              box,
+                                              periodic_shift,
+                                              d_default_interp_kernel_fcn);
+                }
+                else
+                {
+                    LEInteractor::interpolate(F_data[ln],
+                                              X_data[ln],
+                                              idx_data,
+                                              f_sc_data,
+                                              patch,
+                                              box,
+                                              periodic_shift,
+                                              d_default_interp_kernel_fcn);
+                }
+            }
+            if (d_workload_model.isEnabled())
+            {
+                d_workload_model.recordInteractionSample(
+                    static_cast<int>(idx_data->getInteriorLocalPETScIndices().size()), MPI_Wtime() - start_time);
             }
         }
     }
@@ -834,6 +1004,7 @@ LDataManager::interp(const int f_data_idx,
         zeroInactivatedComponents(F_data[ln], ln);
     }
 
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_INTERP);
     IBTK_TIMER_STOP(t_interp);
     return;
 } // interp
@@ -922,6 +1093,89 @@ LDataManager::createLData(const std::string& quantity_name,
     return ret_val;
 } // createLData
 
+void
+LDataManager::resetNodeDisplacements(const int coarsest_ln_in, const int finest_ln_in)
+{
+    const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
+    const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
+    TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
+#endif
+    int ierr;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_level_contains_lag_data[ln]) continue;
+        if (d_lag_mesh_data[ln].find(DISP_REF_DATA_NAME) == d_lag_mesh_data[ln].end())
+        {
+            createLData(DISP_REF_DATA_NAME, ln, NDIM, /*maintain_data*/ true);
+        }
+        Vec X_vec = d_lag_mesh_data[ln][POSN_DATA_NAME]->getVec();
+        Vec X_ref_vec = d_lag_mesh_data[ln][DISP_REF_DATA_NAME]->getVec();
+        ierr = VecCopy(X_vec, X_ref_vec);
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // resetNodeDisplacements
+
+double
+LDataManager::computeMaxNodeDisplacement(const int coarsest_ln_in, const int finest_ln_in) const
+{
+    const int coarsest_ln = (coarsest_ln_in == -1) ? d_coarsest_ln : coarsest_ln_in;
+    const int finest_ln = (finest_ln_in == -1) ? d_finest_ln : finest_ln_in;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(coarsest_ln >= d_coarsest_ln && coarsest_ln <= d_finest_ln);
+    TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
+#endif
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const double* const domain_x_lower = grid_geom->getXLower();
+    const double* const domain_x_upper = grid_geom->getXUpper();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
+    double max_displacement = 0.0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_level_contains_lag_data[ln]) continue;
+        std::map<std::string, Pointer<LData> >::const_iterator ref_it = d_lag_mesh_data[ln].find(DISP_REF_DATA_NAME);
+        if (ref_it == d_lag_mesh_data[ln].end()) continue;
+
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        double dx_min = std::numeric_limits<double>::max();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            dx_min = std::min(dx_min, dx_coarsest[d] / static_cast<double>(ratio(d)));
+        }
+
+        Pointer<LData> X_data = d_lag_mesh_data[ln].find(POSN_DATA_NAME)->second;
+        Pointer<LData> X_ref_data = ref_it->second;
+        const boost::multi_array_ref<double, 2>& X_array = *X_data->getVecArray();
+        const boost::multi_array_ref<double, 2>& X_ref_array = *X_ref_data->getVecArray();
+        const unsigned int num_local_nodes = getNumberOfLocalNodes(ln);
+        double max_disp_sq = 0.0;
+        for (unsigned int i = 0; i < num_local_nodes; ++i)
+        {
+            double disp_sq = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                // NOTE: Nodes are shifted back into the domain when they cross
+                // periodic boundaries, so we use the minimum image distance.
+                double disp = X_array[i][d] - X_ref_array[i][d];
+                if (periodic_shift[d])
+                {
+                    const double domain_length = domain_x_upper[d] - domain_x_lower[d];
+                    disp -= domain_length * boost::math::round(disp / domain_length);
+                }
+                disp_sq += disp * disp;
+            }
+            max_disp_sq = std::max(max_disp_sq, disp_sq);
+        }
+        X_data->restoreArrays();
+        X_ref_data->restoreArrays();
+        max_displacement = std::max(max_displacement, sqrt(max_disp_sq) / dx_min);
+    }
+    return SAMRAI_MPI::maxReduction(max_displacement);
+} // computeMaxNodeDisplacement
+
 Point
 LDataManager::computeLagrangianStructureCenterOfMass(const int structure_id, const int level_number)
 {
@@ -1370,6 +1624,20 @@ LDataManager::scatterToZero(Vec& parallel_vec, Vec& sequential_vec) const
     return;
 } // scatterToZero
 
+void
+LDataManager::setUseFlatDataRedistribution(const bool use_flat_data_redistribution)
+{
+    d_use_flat_data_redistribution = use_flat_data_redistribution;
+    return;
+} // setUseFlatDataRedistribution
+
+void
+LDataManager::setUseCSRIndexData(const bool use_csr_index_data)
+{
+    d_use_csr_index_data = use_csr_index_data;
+    return;
+} // setUseCSRIndexData
+
 void
 LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -1399,8 +1667,8 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
     const double* const domain_x_lower = d_grid_geom->getXLower();
     const double* const domain_x_upper = d_grid_geom->getXUpper();
     const double* const domain_dx = d_grid_geom->getDx();
-    std::vector<std::map<int, IntVector<NDIM> > > periodic_offset_data(finest_ln + 1);
-    std::vector<std::map<int, Vector> > periodic_displacement_data(finest_ln + 1);
+    std::vector<std::vector<IntVector<NDIM> > > periodic_offset_data(finest_ln + 1);
+    std::vector<std::vector<double> > periodic_displacement_data(finest_ln + 1);
     for (int level_number = coarsest_ln; level_number <= finest_ln; ++level_number)
     {
         if (!d_level_contains_lag_data[level_number]) continue;
@@ -1415,6 +1683,8 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
         boost::multi_array_ref<double, 2>& X_data =
             *d_lag_mesh_data[level_number][POSN_DATA_NAME]->getGhostedLocalFormVecArray();
         const size_t num_nodes = X_data.shape()[0];
+        periodic_offset_data[level_number].resize(num_nodes, IntVector<NDIM>(0));
+        periodic_displacement_data[level_number].resize(NDIM * num_nodes, 0.0);
         const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(level_number)->getRatio();
         const IntVector<NDIM>& periodic_shift = d_grid_geom->getPeriodicShift();
         double level_dx[NDIM];
@@ -1454,7 +1724,10 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
             if (periodic_offset != IntVector<NDIM>(0))
             {
                 periodic_offset_data[level_number][local_idx] = periodic_offset;
-                periodic_displacement_data[level_number][local_idx] = periodic_displacement;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    periodic_displacement_data[level_number][NDIM * local_idx + d] = periodic_displacement[d];
+                }
             }
         }
         d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
@@ -1478,63 +1751,181 @@ LDataManager::beginDataRedistribution(const int coarsest_ln_in, const int finest
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
         const Pointer<CartesianGridGeometry<NDIM> > grid_geom = level->getGridGeometry();
         const IntVector<NDIM>& ratio = level->getRatio();
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<LNodeSetData> current_idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            Pointer<LNodeSetData> new_idx_data =
-                new LNodeSetData(current_idx_data->getBox(), current_idx_data->getGhostCellWidth());
-            const Box<NDIM>& patch_box = patch->getBox();
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            std::set<int> registered_periodic_idx;
-            for (LNodeSetData::CellIterator it(Box<NDIM>::grow(patch_box, IntVector<NDIM>(CFL_WIDTH))); it; it++)
+        if (d_use_flat_data_redistribution)
+        {
+            // Determine the new cell index of each local and ghost node once,
+            // rather than once per patch that contains a copy of the node.  The
+            // cell indices are stored contiguously, NDIM entries per node.
+            const int num_nodes = static_cast<int>(X_data.shape()[0]);
+            const std::vector<IntVector<NDIM> >& periodic_offsets = periodic_offset_data[level_number];
+            std::vector<int> new_cell_idx_data(NDIM * num_nodes);
+            std::vector<char> is_periodic_node(num_nodes);
+#if defined(_OPENMP)
+#pragma omp parallel for
+#endif
+            for (int local_idx = 0; local_idx < num_nodes; ++local_idx)
             {
-                const Index<NDIM>& old_cell_idx = *it;
-                LNodeSet* const old_node_set = current_idx_data->getItem(old_cell_idx);
-                if (old_node_set)
+                const Index<NDIM> new_cell_idx = IndexUtilities::getCellIndex(&X_data[local_idx][0], grid_geom, ratio);
+                int* const new_cell_idx_ptr = &new_cell_idx_data[NDIM * local_idx];
+                for (unsigned int d = 0; d < NDIM; ++d) new_cell_idx_ptr[d] = new_cell_idx(d);
+                is_periodic_node[local_idx] = periodic_offsets[local_idx] != IntVector<NDIM>(0);
+            }
+
+            // Bin the nodes that each patch will own by sorting (cell, Lagrangian
+            // index) keys, in which cells are numbered contiguously within the
+            // patch box.  Only the node sets stored in the patch data are
+            // visited, rather than every cell of the grown patch box.  Periodic
+            // nodes are registered at most once per patch;
+            // registered_periodic_patch_num records the last patch on which each
+            // periodic node was registered.
+            std::vector<int> registered_periodic_patch_num(num_nodes, -1);
+            std::vector<LNodeSet::value_type> nodes;
+            std::vector<NodeSortKey> keys, scratch_keys;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                const int patch_num = p();
+                Pointer<Patch<NDIM> > patch = level->getPatch(patch_num);
+                Pointer<LNodeSetData> current_idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+                Pointer<LNodeSetData> new_idx_data =
+                    new LNodeSetData(current_idx_data->getBox(), current_idx_data->getGhostCellWidth());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const Box<NDIM> search_box = Box<NDIM>::grow(patch_box, IntVector<NDIM>(CFL_WIDTH));
+                const Index<NDIM>& patch_lower = patch_box.lower();
+                const Index<NDIM>& patch_upper = patch_box.upper();
+                const IntVector<NDIM> patch_dims = patch_box.numberCells();
+                int lower[NDIM], upper[NDIM], dims[NDIM];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    lower[d] = patch_lower(d);
+                    upper[d] = patch_upper(d);
+                    dims[d] = patch_dims(d);
+                }
+                nodes.clear();
+                keys.clear();
+                for (LNodeSetData::SetIterator it(*current_idx_data); it; it++)
                 {
-                    for (LNodeSet::iterator n = old_node_set->begin(); n != old_node_set->end(); ++n)
+                    if (!search_box.contains(it.getIndex())) continue;
+                    LNodeSet::DataSet& old_node_set = (*it).getDataSet();
+                    const size_t num_set_nodes = old_node_set.size();
+                    if (num_set_nodes == 0) continue;
+                    LNodeSet::value_type* const old_nodes = &old_node_set[0];
+                    for (size_t j = 0; j < num_set_nodes; ++j)
                     {
-                        LNodeSet::value_type& node_idx = *n;
+                        LNodeSet::value_type& node_idx = old_nodes[j];
                         const int local_idx = node_idx->getLocalPETScIndex();
-                        double* const X = &X_data[local_idx][0];
-                        const CellIndex<NDIM> new_cell_idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
-                        if (patch_box.contains(new_cell_idx))
+                        const int* const new_cell_idx_ptr = &new_cell_idx_data[NDIM * local_idx];
+                        bool in_patch = true;
+                        uint64_t cell_offset = 0;
+                        for (int d = NDIM - 1; d >= 0; --d)
                         {
-                            std::map<int, IntVector<NDIM> >::const_iterator it_offset =
-                                periodic_offset_data[level_number].find(local_idx);
-                            const bool periodic_node = it_offset != periodic_offset_data[level_number].end();
-                            const bool unregistered_periodic_node =
-                                periodic_node &&
-                                registered_periodic_idx.find(local_idx) == registered_periodic_idx.end();
-                            if (!periodic_node || unregistered_periodic_node)
+                            const int i = new_cell_idx_ptr[d];
+                            in_patch = in_patch && i >= lower[d] && i <= upper[d];
+                            cell_offset = cell_offset * dims[d] + (i - lower[d]);
+                        }
+                        if (!in_patch) continue;
+                        if (is_periodic_node[local_idx])
+                        {
+                            if (registered_periodic_patch_num[local_idx] == patch_num) continue;
+                            const Vector periodic_displacement = Eigen::Map<const Vector>(
+                                &periodic_displacement_data[level_number][NDIM * local_idx], NDIM);
+                            node_idx->registerPeriodicShift(periodic_offsets[local_idx], periodic_displacement);
+                            registered_periodic_patch_num[local_idx] = patch_num;
+                        }
+                        NodeSortKey key;
+                        key.key = (cell_offset << 32) | static_cast<uint32_t>(node_idx->getLagrangianIndex());
+                        key.pos = static_cast<int>(nodes.size());
+                        keys.push_back(key);
+                        nodes.push_back(node_idx);
+                    }
+                }
+                radix_sort_keys(keys, scratch_keys);
+
+                // Each contiguous range of keys with the same cell offset gives
+                // the (sorted) node set of one cell.  Copies of the same node
+                // have identical keys and are only added once.
+                size_t k = 0;
+                while (k < keys.size())
+                {
+                    const uint64_t cell_offset = keys[k].key >> 32;
+                    size_t k_end = k + 1;
+                    while (k_end < keys.size() && (keys[k_end].key >> 32) == cell_offset) ++k_end;
+                    Index<NDIM> new_cell_idx;
+                    uint64_t r = cell_offset;
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        new_cell_idx(d) = lower[d] + static_cast<int>(r % dims[d]);
+                        r /= dims[d];
+                    }
+                    LNodeSet* const new_node_set = new LNodeSet();
+                    LNodeSet::DataSet& node_set = new_node_set->getDataSet();
+                    node_set.reserve(k_end - k);
+                    for (size_t j = k; j < k_end; ++j)
+                    {
+                        if (j == k || keys[j].key != keys[j - 1].key) node_set.push_back(nodes[keys[j].pos]);
+                    }
+                    new_idx_data->appendItemPointer(new_cell_idx, new_node_set);
+                    k = k_end;
+                }
+                patch->setPatchData(d_lag_node_index_current_idx, new_idx_data);
+            }
+        }
+        else
+        {
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<LNodeSetData> current_idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+                Pointer<LNodeSetData> new_idx_data =
+                    new LNodeSetData(current_idx_data->getBox(), current_idx_data->getGhostCellWidth());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+                std::set<int> registered_periodic_idx;
+                for (LNodeSetData::CellIterator it(Box<NDIM>::grow(patch_box, IntVector<NDIM>(CFL_WIDTH))); it; it++)
+                {
+                    const Index<NDIM>& old_cell_idx = *it;
+                    LNodeSet* const old_node_set = current_idx_data->getItem(old_cell_idx);
+                    if (old_node_set)
+                    {
+                        for (LNodeSet::iterator n = old_node_set->begin(); n != old_node_set->end(); ++n)
+                        {
+                            LNodeSet::value_type& node_idx = *n;
+                            const int local_idx = node_idx->getLocalPETScIndex();
+                            double* const X = &X_data[local_idx][0];
+                            const CellIndex<NDIM> new_cell_idx = IndexUtilities::getCellIndex(X, grid_geom, ratio);
+                            if (patch_box.contains(new_cell_idx))
                             {
-                                if (unregistered_periodic_node)
+                                const IntVector<NDIM>& periodic_offset = periodic_offset_data[level_number][local_idx];
+                                const bool periodic_node = periodic_offset != IntVector<NDIM>(0);
+                                const bool unregistered_periodic_node =
+                                    periodic_node &&
+                                    registered_periodic_idx.find(local_idx) == registered_periodic_idx.end();
+                                if (!periodic_node || unregistered_periodic_node)
                                 {
-                                    const IntVector<NDIM>& periodic_offset = it_offset->second;
-                                    std::map<int, Vector>::const_iterator it_displacement =
-                                        periodic_displacement_data[level_number].find(local_idx);
-                                    const Vector& periodic_displacement = it_displacement->second;
-                                    node_idx->registerPeriodicShift(periodic_offset, periodic_displacement);
-                                    registered_periodic_idx.insert(local_idx);
+                                    if (unregistered_periodic_node)
+                                    {
+                                        const Vector periodic_displacement = Eigen::Map<const Vector>(
+                                            &periodic_displacement_data[level_number][NDIM * local_idx], NDIM);
+                                        node_idx->registerPeriodicShift(periodic_offset, periodic_displacement);
+                                        registered_periodic_idx.insert(local_idx);
+                                    }
+                                    if (!new_idx_data->isElement(new_cell_idx))
+                                        new_idx_data->appendItemPointer(new_cell_idx, new LNodeSet());
+                                    LNodeSet* const new_node_set = new_idx_data->getItem(new_cell_idx);
+                                    new_node_set->push_back(node_idx);
                                 }
-                                if (!new_idx_data->isElement(new_cell_idx))
-                                    new_idx_data->appendItemPointer(new_cell_idx, new LNodeSet());
-                                LNodeSet* const new_node_set = new_idx_data->getItem(new_cell_idx);
-                                new_node_set->push_back(node_idx);
                             }
                         }
                     }
                 }
+                for (LNodeSetData::SetIterator it(*new_idx_data); it; it++)
+                {
+                    LNodeSet::DataSet& node_set = (*it).getDataSet();
+                    std::sort(node_set.begin(), node_set.end(), LNodeIndexLagrangianIndexComp());
+                    node_set.erase(std::unique(node_set.begin(), node_set.end(), LNodeIndexLagrangianIndexEqual()),
+                                   node_set.end());
+                }
+                patch->setPatchData(d_lag_node_index_current_idx, new_idx_data);
             }
-            for (LNodeSetData::SetIterator it(*new_idx_data); it; it++)
-            {
-                LNodeSet::DataSet& node_set = (*it).getDataSet();
-                std::sort(node_set.begin(), node_set.end(), LNodeIndexLagrangianIndexComp());
-                node_set.erase(std::unique(node_set.begin(), node_set.end(), LNodeIndexLagrangianIndexEqual()),
-                               node_set.end());
-            }
-            patch->setPatchData(d_lag_node_index_current_idx, new_idx_data);
         }
         d_lag_mesh_data[level_number][POSN_DATA_NAME]->restoreArrays();
         d_needs_synch[level_number] = true;
@@ -1715,12 +2106,21 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
 
     std::vector<AO> new_ao(finest_ln + 1);
 
-    std::vector<std::vector<Vec> > src_vec(finest_ln + 1);
+    // NOTE: All of the LData objects on a level are migrated together.  The
+    // local values of each LData object are interleaved node-by-node into a
+    // single packed Vec, so that the values associated with each node are
+    // communicated by one VecScatter regardless of the number of LData
+    // objects, and the migrated values are then unpacked directly into the
+    // new (ghosted) Vec objects.
     std::vector<std::vector<Vec> > dst_vec(finest_ln + 1);
-    std::vector<std::vector<VecScatter> > scatter(finest_ln + 1);
-    std::vector<std::map<int, IS> > src_IS(finest_ln + 1);
-    std::vector<std::map<int, IS> > dst_IS(finest_ln + 1);
-    std::vector<std::map<int, VecScatter> > scatter_template(finest_ln + 1);
+    std::vector<int> packed_depth(finest_ln + 1, 0);
+    std::vector<Vec> packed_src_vec(finest_ln + 1, static_cast<Vec>(NULL));
+    std::vector<Vec> packed_dst_vec(finest_ln + 1, static_cast<Vec>(NULL));
+    std::vector<VecScatter> packed_scatter(finest_ln + 1, static_cast<VecScatter>(NULL));
+    std::vector<IS> src_IS(finest_ln + 1, static_cast<IS>(NULL));
+    std::vector<IS> dst_IS(finest_ln + 1, static_cast<IS>(NULL));
+    d_migrated_field_count = 0;
+    d_migrated_byte_count = 0;
 
     // The number of all local (e.g., on processor) and ghost (e.g., off
     // processor) nodes.
@@ -1759,9 +2159,12 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
 
         std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
         const std::vector<int>::size_type num_data = level_data.size();
-        src_vec[level_number].resize(num_data);
         dst_vec[level_number].resize(num_data);
-        scatter[level_number].resize(num_data);
+
+        // Keep the range of PETSc indices owned by this process in the old
+        // distribution, so that the nodes whose owner changes can be counted.
+        const int old_node_offset = static_cast<int>(d_node_offset[level_number]);
+        const int old_num_local_nodes = static_cast<int>(d_local_lag_indices[level_number].size());
 
         // Get the new distribution of nodes for the level.
         //
@@ -1798,76 +2201,109 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
             (num_local_nodes[level_number] > 0 ? &dst_inds[0] : &s_ao_dummy[0]));
         IBTK_CHKERRQ(ierr);
 
-        // Setup VecScatter objects for each LData object and start scattering
-        // data.
+        // Count the new local nodes that were owned by another process.
+        int num_migrated_nodes = 0;
+        for (int k = 0; k < num_local_nodes[level_number]; ++k)
+        {
+            if (dst_inds[k] < old_node_offset || dst_inds[k] >= old_node_offset + old_num_local_nodes)
+            {
+                ++num_migrated_nodes;
+            }
+        }
+
+        if (num_data == 0) continue;
+        IBTK_TIMER_START(t_migrate_lag_data);
+
+        // Determine the layout of the packed data and create the new Vec
+        // objects for each LData object.
         std::map<std::string, Pointer<LData> >::iterator it;
         int i;
+        std::vector<int> depth(num_data), packed_offset(num_data);
+        int num_old_local_nodes = 0;
         for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
         {
             Pointer<LData> data = it->second;
 #if !defined(NDEBUG)
             TBOX_ASSERT(data);
+            TBOX_ASSERT(i == 0 || static_cast<int>(data->getLocalNodeCount()) == num_old_local_nodes);
 #endif
-            const int depth = data->getDepth();
-
-            // Determine the PETSc indices of the source nodes for use when
-            // scattering values from the old configuration to the new
-            // configuration.  Notice that a different IS object must be used
-            // for each unique data depth.
-            if (src_IS[level_number].find(depth) == src_IS[level_number].end())
-            {
-                ierr = ISCreateBlock(PETSC_COMM_WORLD,
-                                     depth,
-                                     num_local_nodes[level_number],
-                                     num_local_nodes[level_number] > 0 ? &src_inds[0] : NULL,
-                                     PETSC_COPY_VALUES,
-                                     &src_IS[level_number][depth]);
-                IBTK_CHKERRQ(ierr);
-            }
-
-            // Determine the PETSc indices of the destination nodes for use when
-            // scattering values from the old configuration to the new
-            // configuration.  Notice that a different IS object must be used
-            // for each unique data depth.
-            if (dst_IS[level_number].find(depth) == dst_IS[level_number].end())
-            {
-                ierr = ISCreateBlock(PETSC_COMM_WORLD,
-                                     depth,
-                                     num_local_nodes[level_number],
-                                     num_local_nodes[level_number] > 0 ? &dst_inds[0] : NULL,
-                                     PETSC_COPY_VALUES,
-                                     &dst_IS[level_number][depth]);
-                IBTK_CHKERRQ(ierr);
-            }
-
-            // Create the destination Vec.
-            src_vec[level_number][i] = data->getVec();
+            num_old_local_nodes = static_cast<int>(data->getLocalNodeCount());
+            depth[i] = static_cast<int>(data->getDepth());
+            packed_offset[i] = packed_depth[level_number];
+            packed_depth[level_number] += depth[i];
             ierr = VecCreateGhostBlock(
                 PETSC_COMM_WORLD,
-                depth,
-                depth * num_local_nodes[level_number],
+                depth[i],
+                depth[i] * num_local_nodes[level_number],
                 PETSC_DECIDE,
                 num_nonlocal_nodes[level_number],
                 num_nonlocal_nodes[level_number] > 0 ? &d_nonlocal_petsc_indices[level_number][0] : NULL,
                 &dst_vec[level_number][i]);
             IBTK_CHKERRQ(ierr);
+        }
+        const int packed_data_depth = packed_depth[level_number];
 
-            // Create the VecScatter.
-            ierr = VecScatterCreate(src_vec[level_number][i],
-                                    src_IS[level_number][depth],
-                                    dst_vec[level_number][i],
-                                    dst_IS[level_number][depth],
-                                    &scatter[level_number][i]);
-            IBTK_CHKERRQ(ierr);
-
-            // Begin scattering data.
-            ierr = VecScatterBegin(scatter[level_number][i],
-                                   src_vec[level_number][i],
-                                   dst_vec[level_number][i],
-                                   INSERT_VALUES,
-                                   SCATTER_FORWARD);
-            IBTK_CHKERRQ(ierr);
+        // Pack the local values of all of the LData objects into a single Vec.
+        ierr = VecCreateMPI(
+            PETSC_COMM_WORLD, packed_data_depth * num_old_local_nodes, PETSC_DETERMINE, &packed_src_vec[level_number]);
+        IBTK_CHKERRQ(ierr);
+        double* packed_src_arr;
+        ierr = VecGetArray(packed_src_vec[level_number], &packed_src_arr);
+        IBTK_CHKERRQ(ierr);
+        for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
+        {
+            Pointer<LData> data = it->second;
+            const double* const src_arr = data->getArray()->data();
+            const int data_depth = depth[i];
+            const int offset = packed_offset[i];
+            for (int k = 0; k < num_old_local_nodes; ++k)
+            {
+                for (int d = 0; d < data_depth; ++d)
+                {
+                    packed_src_arr[packed_data_depth * k + offset + d] = src_arr[data_depth * k + d];
+                }
+            }
+            data->restoreArrays();
         }
+        ierr = VecRestoreArray(packed_src_vec[level_number], &packed_src_arr);
+        IBTK_CHKERRQ(ierr);
+
+        // Create the packed destination Vec, and set up and begin the
+        // VecScatter from the old configuration to the new configuration.
+        ierr = VecCreateMPI(PETSC_COMM_WORLD,
+                            packed_data_depth * num_local_nodes[level_number],
+                            PETSC_DETERMINE,
+                            &packed_dst_vec[level_number]);
+        IBTK_CHKERRQ(ierr);
+        ierr = ISCreateBlock(PETSC_COMM_WORLD,
+                             packed_data_depth,
+                             num_local_nodes[level_number],
+                             num_local_nodes[level_number] > 0 ? &src_inds[0] : NULL,
+                             PETSC_COPY_VALUES,
+                             &src_IS[level_number]);
+        IBTK_CHKERRQ(ierr);
+        ierr = ISCreateBlock(PETSC_COMM_WORLD,
+                             packed_data_depth,
+                             num_local_nodes[level_number],
+                             num_local_nodes[level_number] > 0 ? &dst_inds[0] : NULL,
+                             PETSC_COPY_VALUES,
+                             &dst_IS[level_number]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterCreate(packed_src_vec[level_number],
+                                src_IS[level_number],
+                                packed_dst_vec[level_number],
+                                dst_IS[level_number],
+                                &packed_scatter[level_number]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterBegin(packed_scatter[level_number],
+                               packed_src_vec[level_number],
+                               packed_dst_vec[level_number],
+                               INSERT_VALUES,
+                               SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        d_migrated_field_count += static_cast<int>(num_data);
+        d_migrated_byte_count += sizeof(double) * packed_data_depth * num_migrated_nodes;
+        IBTK_TIMER_STOP(t_migrate_lag_data);
     }
 
     // Update cached indexing information on each grid patch and setup new LMesh
@@ -1933,21 +2369,52 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         if (!d_level_contains_lag_data[level_number]) continue;
 
         std::map<std::string, Pointer<LData> >& level_data = d_lag_mesh_data[level_number];
+        if (level_data.empty()) continue;
+        IBTK_TIMER_START(t_migrate_lag_data);
+        ierr = VecScatterEnd(packed_scatter[level_number],
+                             packed_src_vec[level_number],
+                             packed_dst_vec[level_number],
+                             INSERT_VALUES,
+                             SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterDestroy(&packed_scatter[level_number]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&packed_src_vec[level_number]);
+        IBTK_CHKERRQ(ierr);
+
+        // Unpack the migrated values directly into the new Vec objects.
+        const int packed_data_depth = packed_depth[level_number];
+        const int n_local = num_local_nodes[level_number];
+        const double* packed_dst_arr;
+        ierr = VecGetArrayRead(packed_dst_vec[level_number], &packed_dst_arr);
+        IBTK_CHKERRQ(ierr);
         std::map<std::string, Pointer<LData> >::iterator it;
         int i;
+        int offset = 0;
         for (it = level_data.begin(), i = 0; it != level_data.end(); ++it, ++i)
         {
-            ierr = VecScatterEnd(scatter[level_number][i],
-                                 src_vec[level_number][i],
-                                 dst_vec[level_number][i],
-                                 INSERT_VALUES,
-                                 SCATTER_FORWARD);
+            Pointer<LData> data = it->second;
+            const int depth = static_cast<int>(data->getDepth());
+            double* dst_arr;
+            ierr = VecGetArray(dst_vec[level_number][i], &dst_arr);
             IBTK_CHKERRQ(ierr);
-            ierr = VecScatterDestroy(&scatter[level_number][i]);
+            for (int k = 0; k < n_local; ++k)
+            {
+                for (int d = 0; d < depth; ++d)
+                {
+                    dst_arr[depth * k + d] = packed_dst_arr[packed_data_depth * k + offset + d];
+                }
+            }
+            ierr = VecRestoreArray(dst_vec[level_number][i], &dst_arr);
             IBTK_CHKERRQ(ierr);
-            Pointer<LData> data = it->second;
+            offset += depth;
             data->resetData(dst_vec[level_number][i], d_nonlocal_petsc_indices[level_number]);
         }
+        ierr = VecRestoreArrayRead(packed_dst_vec[level_number], &packed_dst_arr);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&packed_dst_vec[level_number]);
+        IBTK_CHKERRQ(ierr);
+        IBTK_TIMER_STOP(t_migrate_lag_data);
     }
 
     // Distribute nonlocal data to the new configuration.
@@ -1967,15 +2434,15 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         }
         d_ao[level_number] = new_ao[level_number];
 
-        for (std::map<int, IS>::iterator it = src_IS[level_number].begin(); it != src_IS[level_number].end(); ++it)
+        if (src_IS[level_number])
         {
-            ierr = ISDestroy(&it->second);
+            ierr = ISDestroy(&src_IS[level_number]);
             IBTK_CHKERRQ(ierr);
         }
 
-        for (std::map<int, IS>::iterator it = dst_IS[level_number].begin(); it != dst_IS[level_number].end(); ++it)
+        if (dst_IS[level_number])
         {
-            ierr = ISDestroy(&it->second);
+            ierr = ISDestroy(&dst_IS[level_number]);
             IBTK_CHKERRQ(ierr);
         }
     }
@@ -1987,10 +2454,21 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
         d_silo_writer->registerLagrangianAO(d_ao, coarsest_ln, finest_ln);
     }
 
+    // The CSR copies of the node index data are now out of date.
+    d_lag_node_csr_data.clear();
+
     IBTK_TIMER_STOP(t_end_data_redistribution);
     return;
 } // endDataRedistribution
 
+void
+LDataManager::getDataMigrationStatistics(int& num_fields, size_t& num_bytes) const
+{
+    num_fields = d_migrated_field_count;
+    num_bytes = d_migrated_byte_count;
+    return;
+} // getDataMigrationStatistics
+
 void
 LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2006,14 +2484,80 @@ LDataManager::updateWorkloadEstimates(const int coarsest_ln_in, const int finest
     TBOX_ASSERT(finest_ln >= d_coarsest_ln && finest_ln <= d_finest_ln);
 #endif
 
+    if (d_workload_model.calibrate())
+    {
+        d_beta_work = d_workload_model.getRelativeItemCost();
+        if (d_output_workload)
+        {
+            plog << d_object_name << "::updateWorkloadEstimates(): calibrated workload model:\n"
+                 << "  cost per cell = " << d_workload_model.getCellCost() << "\n"
+                 << "  cost per node = " << d_workload_model.getItemCost() << "\n"
+                 << "  interaction overhead per patch = " << d_workload_model.getPatchCost() << "\n"
+                 << "  beta_work = " << d_beta_work << "\n";
+        }
+    }
+
     updateNodeCountData(coarsest_ln, finest_ln);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_ln, finest_ln);
     hier_cc_data_ops.axpy(d_workload_idx, d_beta_work, d_node_count_idx, d_workload_idx);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_level_contains_lag_data[ln]) continue;
+        d_workload_model.addPatchCostToWorkload(d_hierarchy->getPatchLevel(ln), d_workload_idx, d_node_count_idx);
+    }
 
     IBTK_TIMER_STOP(t_update_workload_estimates);
     return;
 } // updateWorkloadEstimates
 
+void
+LDataManager::setWorkloadCalibrationWindow(const int window_size)
+{
+    d_workload_model.setWindowSize(window_size);
+    return;
+} // setWorkloadCalibrationWindow
+
+void
+LDataManager::recordEulerianWorkloadSample(const double wall_time)
+{
+    if (!d_workload_model.isEnabled()) return;
+    int num_local_cells = 0;
+    int num_local_nodes = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            num_local_cells += level->getPatch(p())->getBox().size();
+        }
+        if (d_level_contains_lag_data[ln]) num_local_nodes += getNumberOfLocalNodes(ln);
+    }
+    d_workload_model.recordEulerianSample(num_local_cells, num_local_nodes, wall_time);
+    return;
+} // recordEulerianWorkloadSample
+
+void
+LDataManager::recordLagrangianWorkloadSample(const double wall_time)
+{
+    if (!d_workload_model.isEnabled()) return;
+    d_workload_model.recordLagrangianSample(wall_time);
+    return;
+} // recordLagrangianWorkloadSample
+
+void
+LDataManager::recordInteractionWorkloadSample(const int num_nodes, const double wall_time)
+{
+    if (!d_workload_model.isEnabled()) return;
+    d_workload_model.recordInteractionSample(num_nodes, wall_time);
+    return;
+} // recordInteractionWorkloadSample
+
+const WorkloadModel&
+LDataManager::getWorkloadModel() const
+{
+    return d_workload_model;
+} // getWorkloadModel
+
 void
 LDataManager::updateNodeCountData(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -2121,6 +2665,9 @@ LDataManager::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > hiera
     }
 #endif
 
+    // The CSR copies of the node index data are now out of date.
+    d_lag_node_csr_data.clear();
+
     // Allocate storage needed to initialize the level and fill data from
     // coarser levels in AMR hierarchy, if any.
     //
@@ -2386,10 +2933,23 @@ LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM>
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // The values of the Lagrangian data must have been read from the restart
+    // files before the data are used.
+    if (d_ldata_values_pending_restart_read)
+    {
+        TBOX_ERROR(d_object_name << "::resetHierarchyConfiguration():\n"
+                                 << "  Lagrangian data values were written to separate restart files.\n"
+                                 << "  readLDataFromRestartFile() must be called before the patch hierarchy is "
+                                    "initialized.\n");
+    }
+
     // Reset the patch hierarchy and levels.
     setPatchHierarchy(hierarchy);
     setPatchLevels(0, finest_hier_level);
 
+    // The CSR copies of the node index data are now out of date.
+    d_lag_node_csr_data.clear();
+
     // Reset the Silo data writer.
     if (d_silo_writer)
     {
@@ -2545,6 +3105,7 @@ LDataManager::putToDatabase(Pointer<Database> db)
     db->putInteger("d_coarsest_ln", d_coarsest_ln);
     db->putInteger("d_finest_ln", d_finest_ln);
     db->putDouble("d_beta_work", d_beta_work);
+    db->putBool("d_use_collective_restart_io", d_use_collective_restart_io);
 
     // Write out data that is stored on a level-by-level basis.
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
@@ -2594,7 +3155,7 @@ LDataManager::putToDatabase(Pointer<Database> db)
              ++it)
         {
             ldata_names.push_back(it->first);
-            it->second->putToDatabase(level_db->putDatabase(ldata_names.back()));
+            it->second->putToDatabase(level_db->putDatabase(ldata_names.back()), !d_use_collective_restart_io);
         }
         level_db->putInteger("n_ldata_names", static_cast<int>(ldata_names.size()));
         if (!ldata_names.empty())
@@ -2643,6 +3204,121 @@ LDataManager::putToDatabase(Pointer<Database> db)
     return;
 } // putToDatabase
 
+void
+LDataManager::setUseCollectiveRestartIO(const bool use_collective_restart_io)
+{
+    d_use_collective_restart_io = use_collective_restart_io;
+    return;
+} // setUseCollectiveRestartIO
+
+void
+LDataManager::writeLDataToRestartFile(const std::string& restart_dump_dirname, const unsigned int time_step_number)
+{
+    if (!d_use_collective_restart_io) return;
+
+    IBTK_TIMER_START(t_write_ldata_to_restart_file);
+
+    Utilities::recursiveMkdir(restart_dump_dirname);
+    int ierr;
+    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        for (std::map<std::string, Pointer<LData> >::iterator it = d_lag_mesh_data[level_number].begin();
+             it != d_lag_mesh_data[level_number].end();
+             ++it)
+        {
+            // Permute the locally owned values into global Lagrangian order.
+            Vec petsc_vec = it->second->getVec();
+            Vec lag_vec;
+            ierr = VecDuplicate(petsc_vec, &lag_vec);
+            IBTK_CHKERRQ(ierr);
+            scatterPETScToLagrangian(petsc_vec, lag_vec, level_number);
+
+            // Write the values to a single file using MPI-IO.
+            const std::string file_name =
+                ldata_restart_file_name(restart_dump_dirname, it->first, level_number, time_step_number);
+            PetscViewer viewer;
+            ierr = PetscViewerCreate(PETSC_COMM_WORLD, &viewer);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerSetType(viewer, PETSCVIEWERBINARY);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerFileSetMode(viewer, FILE_MODE_WRITE);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerBinarySetUseMPIIO(viewer, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerBinarySetSkipInfo(viewer, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerFileSetName(viewer, file_name.c_str());
+            IBTK_CHKERRQ(ierr);
+            ierr = VecView(lag_vec, viewer);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerDestroy(&viewer);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecDestroy(&lag_vec);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+
+    IBTK_TIMER_STOP(t_write_ldata_to_restart_file);
+    return;
+} // writeLDataToRestartFile
+
+void
+LDataManager::readLDataFromRestartFile(const std::string& restart_read_dirname,
+                                       const unsigned int restart_restore_number)
+{
+    if (!d_ldata_values_pending_restart_read) return;
+
+    IBTK_TIMER_START(t_read_ldata_from_restart_file);
+
+    int ierr;
+    for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
+    {
+        if (!d_level_contains_lag_data[level_number]) continue;
+        for (std::map<std::string, Pointer<LData> >::iterator it = d_lag_mesh_data[level_number].begin();
+             it != d_lag_mesh_data[level_number].end();
+             ++it)
+        {
+            // Read the values in global Lagrangian order using MPI-IO.
+            const std::string file_name =
+                ldata_restart_file_name(restart_read_dirname, it->first, level_number, restart_restore_number);
+            Vec petsc_vec = it->second->getVec();
+            Vec lag_vec;
+            ierr = VecDuplicate(petsc_vec, &lag_vec);
+            IBTK_CHKERRQ(ierr);
+            PetscViewer viewer;
+            ierr = PetscViewerCreate(PETSC_COMM_WORLD, &viewer);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerSetType(viewer, PETSCVIEWERBINARY);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerFileSetMode(viewer, FILE_MODE_READ);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerBinarySetUseMPIIO(viewer, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerBinarySetSkipInfo(viewer, PETSC_TRUE);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerFileSetName(viewer, file_name.c_str());
+            IBTK_CHKERRQ(ierr);
+            ierr = VecLoad(lag_vec, viewer);
+            IBTK_CHKERRQ(ierr);
+            ierr = PetscViewerDestroy(&viewer);
+            IBTK_CHKERRQ(ierr);
+
+            // Permute the values into the present PETSc ordering and refill
+            // ghost values.
+            scatterLagrangianToPETSc(lag_vec, petsc_vec, level_number);
+            ierr = VecDestroy(&lag_vec);
+            IBTK_CHKERRQ(ierr);
+            it->second->beginGhostUpdate();
+            it->second->endGhostUpdate();
+        }
+    }
+    d_ldata_values_pending_restart_read = false;
+
+    IBTK_TIMER_STOP(t_read_ldata_from_restart_file);
+    return;
+} // readLDataFromRestartFile
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 LDataManager::LDataManager(const std::string& object_name,
@@ -2666,6 +3342,7 @@ LDataManager::LDataManager(const std::string& object_name,
       d_lag_node_index_current_idx(-1),
       d_lag_node_index_scratch_idx(-1),
       d_beta_work(1.0),
+      d_workload_model(),
       d_workload_var(NULL),
       d_workload_idx(-1),
       d_output_workload(false),
@@ -2675,6 +3352,13 @@ LDataManager::LDataManager(const std::string& object_name,
       d_default_interp_kernel_fcn(default_interp_kernel_fcn),
       d_default_spread_kernel_fcn(default_spread_kernel_fcn),
       d_error_if_points_leave_domain(error_if_points_leave_domain),
+      d_use_flat_data_redistribution(false),
+      d_use_csr_index_data(false),
+      d_lag_node_csr_data(),
+      d_use_collective_restart_io(false),
+      d_ldata_values_pending_restart_read(false),
+      d_migrated_field_count(0),
+      d_migrated_byte_count(0),
       d_ghost_width(ghost_width),
       d_lag_node_index_bdry_fill_alg(NULL),
       d_lag_node_index_bdry_fill_scheds(),
@@ -2766,6 +3450,8 @@ LDataManager::LDataManager(const std::string& object_name,
         t_begin_data_redistribution =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::beginDataRedistribution()");
         t_end_data_redistribution = TimerManager::getManager()->getTimer("IBTK::LDataManager::endDataRedistribution()");
+        t_migrate_lag_data =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::endDataRedistribution()[migrate_lag_data]");
         t_update_workload_estimates =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::updateWorkloadEstimates()");
         t_update_node_count_data = TimerManager::getManager()->getTimer("IBTK::LDataManager::updateNodeCountData()");
@@ -2774,6 +3460,10 @@ LDataManager::LDataManager(const std::string& object_name,
             TimerManager::getManager()->getTimer("IBTK::LDataManager::resetHierarchyConfiguration()");
         t_apply_gradient_detector = TimerManager::getManager()->getTimer("IBTK::LDataManager::applyGradientDetector()");
         t_put_to_database = TimerManager::getManager()->getTimer("IBTK::LDataManager::putToDatabase()");
+        t_write_ldata_to_restart_file =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::writeLDataToRestartFile()");
+        t_read_ldata_from_restart_file =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::readLDataFromRestartFile()");
         t_begin_nonlocal_data_fill =
             TimerManager::getManager()->getTimer("IBTK::LDataManager::beginNonlocalDataFill()");
         t_end_nonlocal_data_fill = TimerManager::getManager()->getTimer("IBTK::LDataManager::endNonlocalDataFill()");
@@ -2785,6 +3475,12 @@ LDataManager::LDataManager(const std::string& object_name,
 
 LDataManager::~LDataManager()
 {
+    if (d_registered_for_restart)
+    {
+        RestartManager::getManager()->unregisterRestartItem(d_object_name);
+        d_registered_for_restart = false;
+    }
+
     // Destroy any remaining AO objects.
     int ierr;
     for (int level_number = d_coarsest_ln; level_number <= d_finest_ln; ++level_number)
@@ -2924,6 +3620,32 @@ LDataManager::endNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_
     return;
 } // endNonlocalDataFill
 
+Pointer<LNodeCSRData>
+LDataManager::getCSRIndexData(const int level_number, const Pointer<Patch<NDIM> > patch)
+{
+    if (static_cast<int>(d_lag_node_csr_data.size()) <= level_number)
+    {
+        d_lag_node_csr_data.resize(level_number + 1);
+    }
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_number);
+    std::vector<Pointer<LNodeCSRData> >& level_csr_data = d_lag_node_csr_data[level_number];
+    if (static_cast<int>(level_csr_data.size()) != level->getNumberOfPatches())
+    {
+        level_csr_data.resize(level->getNumberOfPatches());
+    }
+    Pointer<LNodeCSRData>& csr_data = level_csr_data[patch->getPatchNumber()];
+    if (!csr_data)
+    {
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        csr_data = new LNodeCSRData(idx_data->getBox(), idx_data->getGhostCellWidth());
+        csr_data->copyFromLSetData(*idx_data);
+        csr_data->cacheLocalIndices(patch, periodic_shift);
+    }
+    return csr_data;
+} // getCSRIndexData
+
 void
 LDataManager::computeNodeDistribution(AO& ao,
                                       std::vector<int>& local_lag_indices,
@@ -3166,6 +3888,11 @@ LDataManager::getFromRestart()
     d_coarsest_ln = db->getInteger("d_coarsest_ln");
     d_finest_ln = db->getInteger("d_finest_ln");
     d_beta_work = db->getDouble("d_beta_work");
+    if (db->keyExists("d_use_collective_restart_io"))
+    {
+        d_use_collective_restart_io = db->getBool("d_use_collective_restart_io");
+    }
+    d_ldata_values_pending_restart_read = d_use_collective_restart_io;
 
     // Resize some arrays.
     d_level_contains_lag_data.resize(d_finest_ln + 1, false);
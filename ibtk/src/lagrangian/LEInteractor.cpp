@@ -59,6 +59,7 @@
 #include "ibtk/LData.h"
 #include "ibtk/LEInteractor.h"
 #include "ibtk/LIndexSetData.h"
+#include "ibtk/LNodeCSRData.h"
 #include "ibtk/LSet.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
@@ -1385,27 +1386,21 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(Q_data);
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(X_data);
-    TBOX_ASSERT(idx_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
-    TBOX_ASSERT(X_data->getDepth() == NDIM);
-#endif
-    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
-                Q_data->getDepth(),
-                X_data->getGhostedLocalFormVecArray()->data(),
-                X_data->getDepth(),
-                idx_data,
-                q_data,
-                patch,
-                interp_box,
-                periodic_shift,
-                interp_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+    interpolateImpl(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
+    return;
+}
+
+void
+LEInteractor::interpolate(Pointer<LData> Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LNodeCSRData> idx_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolateImpl(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
     return;
 }
 
@@ -1420,27 +1415,21 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(Q_data);
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(X_data);
-    TBOX_ASSERT(idx_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
-    TBOX_ASSERT(X_data->getDepth() == NDIM);
-#endif
-    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
-                Q_data->getDepth(),
-                X_data->getGhostedLocalFormVecArray()->data(),
-                X_data->getDepth(),
-                idx_data,
-                q_data,
-                patch,
-                interp_box,
-                periodic_shift,
-                interp_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+    interpolateImpl(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
+    return;
+}
+
+void
+LEInteractor::interpolate(Pointer<LData> Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LNodeCSRData> idx_data,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolateImpl(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
     return;
 }
 
@@ -1455,33 +1444,21 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-    if (Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  side-centered interpolation requires vector-valued data.\n");
-    }
-#if !defined(NDEBUG)
-    TBOX_ASSERT(Q_data);
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(X_data);
-    TBOX_ASSERT(idx_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_data->getDepth() == NDIM);
-    TBOX_ASSERT(X_data->getDepth() == NDIM);
-    TBOX_ASSERT(q_data->getDepth() == 1);
-#endif
-    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
-                Q_data->getDepth(),
-                X_data->getGhostedLocalFormVecArray()->data(),
-                X_data->getDepth(),
-                idx_data,
-                q_data,
-                patch,
-                interp_box,
-                periodic_shift,
-                interp_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+    interpolateImpl(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
+    return;
+}
+
+void
+LEInteractor::interpolate(Pointer<LData> Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LNodeCSRData> idx_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolateImpl(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
     return;
 }
 
@@ -1496,33 +1473,21 @@ LEInteractor::interpolate(Pointer<LData> Q_data,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-    if (NDIM != 3 || Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
-    }
-#if !defined(NDEBUG)
-    TBOX_ASSERT(Q_data);
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(X_data);
-    TBOX_ASSERT(idx_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_data->getDepth() == NDIM);
-    TBOX_ASSERT(X_data->getDepth() == NDIM);
-    TBOX_ASSERT(q_data->getDepth() == 1);
-#endif
-    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
-                Q_data->getDepth(),
-                X_data->getGhostedLocalFormVecArray()->data(),
-                X_data->getDepth(),
-                idx_data,
-                q_data,
-                patch,
-                interp_box,
-                periodic_shift,
-                interp_fcn);
-    Q_data->restoreArrays();
-    X_data->restoreArrays();
+    interpolateImpl(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
+    return;
+}
+
+void
+LEInteractor::interpolate(Pointer<LData> Q_data,
+                          const Pointer<LData> X_data,
+                          const Pointer<LNodeCSRData> idx_data,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolateImpl(Q_data, X_data, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
     return;
 }
 
@@ -1539,124 +1504,23 @@ LEInteractor::interpolate(double* const Q_data,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(idx_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_depth == q_data->getDepth());
-    TBOX_ASSERT(X_depth == NDIM);
-#else
-    NULL_USE(X_depth);
-#endif
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
-
-    // Interpolate.
-    if (!local_indices.empty())
-    {
-        interpolate(Q_data,
-                    Q_depth,
-                    X_data,
-                    q_data->getPointer(),
-                    q_data->getBox(),
-                    q_data->getGhostCellWidth(),
-                    q_data->getDepth(),
-                    x_lower,
-                    x_upper,
-                    dx,
-                    patch_touches_lower_physical_bdry,
-                    patch_touches_upper_physical_bdry,
-                    local_indices,
-                    periodic_shifts,
-                    interp_fcn);
-    }
+    interpolateImpl(Q_data, Q_depth, X_data, X_depth, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
     return;
 }
 
-template <class T>
 void
 LEInteractor::interpolate(double* const Q_data,
                           const int Q_depth,
                           const double* const X_data,
                           const int X_depth,
-                          const Pointer<LIndexSetData<T> > idx_data,
-                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<LNodeCSRData> idx_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(idx_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_depth == q_data->getDepth());
-    TBOX_ASSERT(X_depth == NDIM);
-#else
-    NULL_USE(X_depth);
-#endif
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
-
-    // Interpolate.
-    if (!local_indices.empty())
-    {
-        boost::array<double, NDIM> x_lower_node, x_upper_node;
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            x_lower_node[d] = x_lower[d] - 0.5 * dx[d];
-            x_upper_node[d] = x_upper[d] + 0.5 * dx[d];
-        }
-        interpolate(Q_data,
-                    Q_depth,
-                    X_data,
-                    q_data->getPointer(),
-                    NodeGeometry<NDIM>::toNodeBox(q_data->getBox()),
-                    q_data->getGhostCellWidth(),
-                    q_data->getDepth(),
-                    x_lower_node.data(),
-                    x_upper_node.data(),
-                    dx,
-                    patch_touches_lower_physical_bdry,
-                    patch_touches_upper_physical_bdry,
-                    local_indices,
-                    periodic_shifts,
-                    interp_fcn);
-    }
+    interpolateImpl(Q_data, Q_depth, X_data, X_depth, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
     return;
 }
 
@@ -1667,85 +1531,62 @@ LEInteractor::interpolate(double* const Q_data,
                           const double* const X_data,
                           const int X_depth,
                           const Pointer<LIndexSetData<T> > idx_data,
-                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<NodeData<NDIM, double> > q_data,
                           const Pointer<Patch<NDIM> > patch,
                           const Box<NDIM>& interp_box,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(idx_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_depth == NDIM);
-    TBOX_ASSERT(X_depth == NDIM);
-    TBOX_ASSERT(q_data->getDepth() == 1);
-#else
-    NULL_USE(X_depth);
-#endif
-    if (Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  side-centered interpolation requires vector-valued data.\n");
-    }
+    interpolateImpl(Q_data, Q_depth, X_data, X_depth, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
+    return;
+}
 
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_depth,
+                          const Pointer<LNodeCSRData> idx_data,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolateImpl(Q_data, Q_depth, X_data, X_depth, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
+    return;
+}
 
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+template <class T>
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_depth,
+                          const Pointer<LIndexSetData<T> > idx_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolateImpl(Q_data, Q_depth, X_data, X_depth, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
+    return;
+}
 
-    // Interpolate.
-    if (!local_indices.empty())
-    {
-        boost::array<double, NDIM> x_lower_axis, x_upper_axis;
-        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
-        std::vector<double> Q_data_axis(local_sz);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                x_lower_axis[d] = x_lower[d];
-                x_upper_axis[d] = x_upper[d];
-            }
-            x_lower_axis[axis] -= 0.5 * dx[axis];
-            x_upper_axis[axis] += 0.5 * dx[axis];
-            interpolate(&Q_data_axis[0],
-                        /*Q_depth*/ 1,
-                        X_data,
-                        q_data->getPointer(axis),
-                        SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
-                        q_data->getGhostCellWidth(),
-                        /*q_depth*/ 1,
-                        x_lower_axis.data(),
-                        x_upper_axis.data(),
-                        dx,
-                        patch_touches_lower_physical_bdry,
-                        patch_touches_upper_physical_bdry,
-                        local_indices,
-                        periodic_shifts,
-                        interp_fcn,
-                        axis);
-            for (unsigned int k = 0; k < local_indices.size(); ++k)
-            {
-                Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
-            }
-        }
-    }
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_depth,
+                          const Pointer<LNodeCSRData> idx_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolateImpl(Q_data, Q_depth, X_data, X_depth, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
     return;
 }
 
@@ -1762,82 +1603,23 @@ LEInteractor::interpolate(double* const Q_data,
                           const IntVector<NDIM>& periodic_shift,
                           const std::string& interp_fcn)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(idx_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_depth == NDIM);
-    TBOX_ASSERT(X_depth == NDIM);
-    TBOX_ASSERT(q_data->getDepth() == 1);
-#else
-    NULL_USE(X_depth);
-#endif
-    if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
-    }
-
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
-    // Generate a list of local indices which lie in the specified box.
-    std::vector<int> local_indices;
-    std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
+    interpolateImpl(Q_data, Q_depth, X_data, X_depth, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
+    return;
+}
 
-    // Interpolate.
-    if (!local_indices.empty())
-    {
-        boost::array<double, NDIM> x_lower_axis, x_upper_axis;
-        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
-        std::vector<double> Q_data_axis(local_sz);
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (unsigned int d = 0; d < NDIM; ++d)
-            {
-                x_lower_axis[d] = x_lower[d];
-                x_upper_axis[d] = x_upper[d];
-                if (d != axis)
-                {
-                    x_lower_axis[d] -= 0.5 * dx[d];
-                    x_upper_axis[d] += 0.5 * dx[d];
-                }
-            }
-            interpolate(&Q_data_axis[0],
-                        /*Q_depth*/ 1,
-                        X_data,
-                        q_data->getPointer(axis),
-                        EdgeGeometry<NDIM>::toEdgeBox(q_data->getBox(), axis),
-                        q_data->getGhostCellWidth(),
-                        /*q_depth*/ 1,
-                        x_lower_axis.data(),
-                        x_upper_axis.data(),
-                        dx,
-                        patch_touches_lower_physical_bdry,
-                        patch_touches_upper_physical_bdry,
-                        local_indices,
-                        periodic_shifts,
-                        interp_fcn,
-                        axis);
-            for (unsigned int k = 0; k < local_indices.size(); ++k)
-            {
-                Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
-            }
-        }
-    }
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_depth,
+                          const Pointer<LNodeCSRData> idx_data,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const IntVector<NDIM>& periodic_shift,
+                          const std::string& interp_fcn)
+{
+    interpolateImpl(Q_data, Q_depth, X_data, X_depth, idx_data, q_data, patch, interp_box, periodic_shift, interp_fcn);
     return;
 }
 
@@ -1890,110 +1672,1087 @@ LEInteractor::interpolate(std::vector<double>& Q_data,
 }
 
 void
-LEInteractor::interpolate(std::vector<double>& Q_data,
-                          const int Q_depth,
-                          const std::vector<double>& X_data,
-                          const int X_depth,
-                          const Pointer<NodeData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+    if (Q_data.empty()) return;
+    interpolate(&Q_data[0],
+                static_cast<int>(Q_data.size()),
+                Q_depth,
+                &X_data[0],
+                static_cast<int>(X_data.size()),
+                X_depth,
+                q_data,
+                patch,
+                interp_box,
+                interp_fcn);
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+    if (Q_data.empty()) return;
+    interpolate(&Q_data[0],
+                static_cast<int>(Q_data.size()),
+                Q_depth,
+                &X_data[0],
+                static_cast<int>(X_data.size()),
+                X_depth,
+                q_data,
+                patch,
+                interp_box,
+                interp_fcn);
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<SideData<NDIM, double> > mask_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+    if (Q_data.empty()) return;
+    interpolate(&Q_data[0],
+                static_cast<int>(Q_data.size()),
+                Q_depth,
+                &X_data[0],
+                static_cast<int>(X_data.size()),
+                X_depth,
+                mask_data,
+                q_data,
+                patch,
+                interp_box,
+                interp_fcn);
+}
+
+void
+LEInteractor::interpolate(std::vector<double>& Q_data,
+                          const int Q_depth,
+                          const std::vector<double>& X_data,
+                          const int X_depth,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+    if (Q_data.empty()) return;
+    interpolate(&Q_data[0],
+                static_cast<int>(Q_data.size()),
+                Q_depth,
+                &X_data[0],
+                static_cast<int>(X_data.size()),
+                X_depth,
+                q_data,
+                patch,
+                interp_box,
+                interp_fcn);
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<CellData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(Q_depth == q_data->getDepth());
+    TBOX_ASSERT(X_depth == NDIM);
+    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
+#else
+    NULL_USE(Q_size);
+#endif
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const x_upper = pgeom->getXUpper();
+    const double* const dx = pgeom->getDx();
+    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
+    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        static const int lower = 0;
+        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
+        static const int upper = 1;
+        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
+    }
+
+    // Generate a list of local indices which lie in the specified box and set
+    // all periodic offsets to zero.
+    std::vector<int> local_indices;
+    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+
+    // Interpolate.
+    if (!local_indices.empty())
+    {
+        interpolate(Q_data,
+                    Q_depth,
+                    X_data,
+                    q_data->getPointer(),
+                    q_data->getBox(),
+                    q_data->getGhostCellWidth(),
+                    q_data->getDepth(),
+                    x_lower,
+                    x_upper,
+                    dx,
+                    patch_touches_lower_physical_bdry,
+                    patch_touches_upper_physical_bdry,
+                    local_indices,
+                    periodic_shifts,
+                    interp_fcn);
+    }
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<CellData<NDIM, double> > mask_data,
+                          const Pointer<CellData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(Q_depth == q_data->getDepth());
+    TBOX_ASSERT(X_depth == NDIM);
+    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
+    TBOX_ASSERT(mask_data);
+    TBOX_ASSERT(mask_data->getDepth() == 1);
+#else
+    NULL_USE(Q_size);
+#endif
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    const Box<NDIM>& patch_box = patch->getBox();
+    const IntVector<NDIM>& ilower = patch_box.lower();
+    const IntVector<NDIM>& iupper = patch_box.upper();
+
+    // Get ghost cell width info.
+    const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
+    const IntVector<NDIM>& mask_gcw = q_data->getGhostCellWidth();
+    const int stencil_size = getStencilSize(interp_fcn);
+    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
+    const int q_gcw_min = q_gcw.min();
+    const int mask_gcw_min = mask_gcw.min();
+    if (q_gcw_min < min_ghosts)
+    {
+        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:\n"
+                   << "  kernel function          = "
+                   << interp_fcn
+                   << "\n"
+                   << "  kernel stencil size      = "
+                   << stencil_size
+                   << "\n"
+                   << "  minimum ghost cell width = "
+                   << min_ghosts
+                   << "\n"
+                   << "  ghost cell width         = "
+                   << q_gcw_min
+                   << "\n");
+    }
+    if (mask_gcw_min < stencil_size)
+    {
+        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:\n"
+                   << "  kernel function          = "
+                   << interp_fcn
+                   << "\n"
+                   << "  kernel stencil size      = "
+                   << stencil_size
+                   << "\n"
+                   << "  minimum ghost cell width = "
+                   << stencil_size
+                   << "\n"
+                   << "  ghost cell width         = "
+                   << mask_gcw_min
+                   << "\n");
+    }
+    const IntVector<NDIM> ig_lower = ilower - q_gcw;
+    const IntVector<NDIM> ig_upper = iupper + q_gcw;
+
+    // Get boundary info.
+    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
+    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        static const int lower = 0;
+        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
+        static const int upper = 1;
+        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
+    }
+
+    // Generate a list of local indices which lie in the specified box and set
+    // all periodic offsets to zero.
+    std::vector<int> local_indices;
+    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+
+    // Interpolate.
+    const int nindices = static_cast<int>(local_indices.size());
+    if (nindices)
+    {
+        IntVector<NDIM> stencil_lower, stencil_upper;
+        for (int k = 0; k < nindices; ++k)
+        {
+            int s = local_indices[k];
+            MLSWeight Psi;
+            const int stencil_sz = LEInteractor::getStencilSize(interp_fcn);
+            get_mls_weights(interp_fcn,
+                            &X_data[s * NDIM],
+                            &periodic_shifts[k * NDIM],
+                            dx,
+                            x_lower,
+                            ilower,
+                            mask_data->getArrayData(),
+                            stencil_lower,
+                            stencil_upper,
+                            Psi);
+
+            for (int comp = 0; comp < Q_depth; ++comp)
+            {
+                interpolate_data(stencil_sz,
+                                 ig_lower,
+                                 ig_upper,
+                                 stencil_lower,
+                                 stencil_upper,
+                                 q_data->getArrayData(),
+                                 comp,
+                                 Psi,
+                                 Q_data[s * Q_depth + comp]);
+            }
+        }
+    }
+
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<NodeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(Q_depth == q_data->getDepth());
+    TBOX_ASSERT(X_depth == NDIM);
+    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
+#else
+    NULL_USE(Q_size);
+#endif
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const x_upper = pgeom->getXUpper();
+    const double* const dx = pgeom->getDx();
+    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
+    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        static const int lower = 0;
+        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
+        static const int upper = 1;
+        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
+    }
+
+    // Generate a list of local indices which lie in the specified box and set
+    // all periodic offsets to zero.
+    std::vector<int> local_indices;
+    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+
+    // Interpolate.
+    if (!local_indices.empty())
+    {
+        boost::array<double, NDIM> x_lower_node, x_upper_node;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            x_lower_node[d] = x_lower[d] - 0.5 * dx[d];
+            x_upper_node[d] = x_upper[d] + 0.5 * dx[d];
+        }
+        interpolate(Q_data,
+                    Q_depth,
+                    X_data,
+                    q_data->getPointer(),
+                    NodeGeometry<NDIM>::toNodeBox(q_data->getBox()),
+                    q_data->getGhostCellWidth(),
+                    q_data->getDepth(),
+                    x_lower_node.data(),
+                    x_upper_node.data(),
+                    dx,
+                    patch_touches_lower_physical_bdry,
+                    patch_touches_upper_physical_bdry,
+                    local_indices,
+                    periodic_shifts,
+                    interp_fcn);
+    }
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(Q_depth == NDIM);
+    TBOX_ASSERT(X_depth == NDIM);
+    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
+    TBOX_ASSERT(q_data->getDepth() == 1);
+#else
+    NULL_USE(Q_size);
+#endif
+    if (Q_depth != NDIM || q_data->getDepth() != 1)
+    {
+        TBOX_ERROR("LEInteractor::interpolate():\n"
+                   << "  side-centered interpolation requires vector-valued data.\n");
+    }
+
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const x_upper = pgeom->getXUpper();
+    const double* const dx = pgeom->getDx();
+    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
+    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        static const int lower = 0;
+        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
+        static const int upper = 1;
+        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
+    }
+
+    // Generate a list of local indices which lie in the specified box and set
+    // all periodic offsets to zero.
+    std::vector<int> local_indices;
+    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+
+    // Interpolate.
+    if (!local_indices.empty())
+    {
+        boost::array<double, NDIM> x_lower_axis, x_upper_axis;
+        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
+        std::vector<double> Q_data_axis(local_sz);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                x_lower_axis[d] = x_lower[d];
+                x_upper_axis[d] = x_upper[d];
+            }
+            x_lower_axis[axis] -= 0.5 * dx[axis];
+            x_upper_axis[axis] += 0.5 * dx[axis];
+            interpolate(&Q_data_axis[0],
+                        /*Q_depth*/ 1,
+                        X_data,
+                        q_data->getPointer(axis),
+                        SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
+                        q_data->getGhostCellWidth(),
+                        /*q_depth*/ 1,
+                        x_lower_axis.data(),
+                        x_upper_axis.data(),
+                        dx,
+                        patch_touches_lower_physical_bdry,
+                        patch_touches_upper_physical_bdry,
+                        local_indices,
+                        periodic_shifts,
+                        interp_fcn,
+                        axis);
+            for (unsigned int k = 0; k < local_indices.size(); ++k)
+            {
+                Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
+            }
+        }
+    }
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<SideData<NDIM, double> > mask_data,
+                          const Pointer<SideData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(Q_depth == NDIM);
+    TBOX_ASSERT(X_depth == NDIM);
+    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
+    TBOX_ASSERT(q_data->getDepth() == 1);
+    TBOX_ASSERT(mask_data);
+    TBOX_ASSERT(mask_data->getDepth() == 1);
+#else
+    NULL_USE(Q_size);
+#endif
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const x_upper = pgeom->getXUpper();
+    const double* const dx = pgeom->getDx();
+    const Box<NDIM>& patch_box = patch->getBox();
+    const IntVector<NDIM>& ilower = patch_box.lower();
+
+    // Get ghost cell width info.
+    const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
+    const IntVector<NDIM>& mask_gcw = mask_data->getGhostCellWidth();
+    const int stencil_size = getStencilSize(interp_fcn);
+    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
+    const int q_gcw_min = q_gcw.min();
+    const int mask_gcw_min = mask_gcw.min();
+    if (q_gcw_min < min_ghosts)
+    {
+        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:\n"
+                   << "  kernel function          = "
+                   << interp_fcn
+                   << "\n"
+                   << "  kernel stencil size      = "
+                   << stencil_size
+                   << "\n"
+                   << "  minimum ghost cell width = "
+                   << min_ghosts
+                   << "\n"
+                   << "  ghost cell width         = "
+                   << q_gcw_min
+                   << "\n");
+    }
+    if (mask_gcw_min < stencil_size)
+    {
+        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:\n"
+                   << "  kernel function          = "
+                   << interp_fcn
+                   << "\n"
+                   << "  kernel stencil size      = "
+                   << stencil_size
+                   << "\n"
+                   << "  minimum ghost cell width = "
+                   << stencil_size
+                   << "\n"
+                   << "  ghost cell width         = "
+                   << mask_gcw_min
+                   << "\n");
+    }
+
+    // Get boundary info.
+    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
+    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        static const int lower = 0;
+        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
+        static const int upper = 1;
+        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
+    }
+
+    // Generate a list of local indices which lie in the specified box and set
+    // all periodic offsets to zero.
+    std::vector<int> local_indices;
+    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+
+    // Interpolate.
+    const int nindices = static_cast<int>(local_indices.size());
+    if (nindices)
+    {
+        boost::array<double, NDIM> x_lower_axis, x_upper_axis;
+        IntVector<NDIM> stencil_lower, stencil_upper;
+
+        for (int axis = 0; axis < NDIM; ++axis)
+        {
+            Box<NDIM> data_box = SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis);
+            const IntVector<NDIM> ig_lower = data_box.lower() - q_gcw;
+            const IntVector<NDIM> ig_upper = data_box.upper() + q_gcw;
+
+            for (int d = 0; d < NDIM; ++d)
+            {
+                x_lower_axis[d] = x_lower[d];
+                x_upper_axis[d] = x_upper[d];
+            }
+            x_lower_axis[axis] -= 0.5 * dx[axis];
+            x_upper_axis[axis] += 0.5 * dx[axis];
+
+            for (int k = 0; k < nindices; ++k)
+            {
+                int s = local_indices[k];
+                MLSWeight Psi;
+                const int stencil_sz = LEInteractor::getStencilSize(interp_fcn);
+                get_mls_weights(interp_fcn,
+                                &X_data[s * NDIM],
+                                &periodic_shifts[k * NDIM],
+                                dx,
+                                x_lower_axis.data(),
+                                ilower,
+                                mask_data->getArrayData(axis),
+                                stencil_lower,
+                                stencil_upper,
+                                Psi);
+                interpolate_data(stencil_sz,
+                                 ig_lower,
+                                 ig_upper,
+                                 stencil_lower,
+                                 stencil_upper,
+                                 q_data->getArrayData(axis),
+                                 0,
+                                 Psi,
+                                 Q_data[s * Q_depth + axis]);
+            }
+        }
+    }
+
+    return;
+}
+
+void
+LEInteractor::interpolate(double* const Q_data,
+                          const int Q_size,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const int X_size,
+                          const int X_depth,
+                          const Pointer<EdgeData<NDIM, double> > q_data,
+                          const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& interp_box,
+                          const std::string& interp_fcn)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(Q_depth == NDIM);
+    TBOX_ASSERT(X_depth == NDIM);
+    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
+    TBOX_ASSERT(q_data->getDepth() == 1);
+#else
+    NULL_USE(Q_size);
+#endif
+    if (Q_depth != NDIM || q_data->getDepth() != 1)
+    {
+        TBOX_ERROR("LEInteractor::interpolate():\n"
+                   << "  side-centered interpolation requires vector-valued data.\n");
+    }
+
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const x_upper = pgeom->getXUpper();
+    const double* const dx = pgeom->getDx();
+    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
+    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        static const int lower = 0;
+        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
+        static const int upper = 1;
+        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
+    }
+
+    // Generate a list of local indices which lie in the specified box and set
+    // all periodic offsets to zero.
+    std::vector<int> local_indices;
+    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+
+    // Interpolate.
+    if (!local_indices.empty())
+    {
+        boost::array<double, NDIM> x_lower_axis, x_upper_axis;
+        const int local_sz = (*std::max_element(local_indices.begin(), local_indices.end())) + 1;
+        std::vector<double> Q_data_axis(local_sz);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                x_lower_axis[d] = x_lower[d];
+                x_upper_axis[d] = x_upper[d];
+                if (d != axis)
+                {
+                    x_lower_axis[d] -= 0.5 * dx[d];
+                    x_upper_axis[d] += 0.5 * dx[d];
+                }
+            }
+            interpolate(&Q_data_axis[0],
+                        /*Q_depth*/ 1,
+                        X_data,
+                        q_data->getPointer(axis),
+                        EdgeGeometry<NDIM>::toEdgeBox(q_data->getBox(), axis),
+                        q_data->getGhostCellWidth(),
+                        /*q_depth*/ 1,
+                        x_lower_axis.data(),
+                        x_upper_axis.data(),
+                        dx,
+                        patch_touches_lower_physical_bdry,
+                        patch_touches_upper_physical_bdry,
+                        local_indices,
+                        periodic_shifts,
+                        interp_fcn,
+                        axis);
+            for (unsigned int k = 0; k < local_indices.size(); ++k)
+            {
+                Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
+            }
+        }
+    }
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LNodeCSRData> idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LNodeCSRData> idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LNodeCSRData> idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const Pointer<LData> Q_data,
+                     const Pointer<LData> X_data,
+                     const Pointer<LNodeCSRData> idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, X_data, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, Q_depth, X_data, X_depth, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LNodeCSRData> idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, Q_depth, X_data, X_depth, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, Q_depth, X_data, X_depth, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LNodeCSRData> idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, Q_depth, X_data, X_depth, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, Q_depth, X_data, X_depth, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LNodeCSRData> idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, Q_depth, X_data, X_depth, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+template <class T>
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LIndexSetData<T> > idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, Q_depth, X_data, X_depth, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_depth,
+                     const Pointer<LNodeCSRData> idx_data,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const IntVector<NDIM>& periodic_shift,
+                     const std::string& spread_fcn)
+{
+    spreadImpl(q_data, Q_data, Q_depth, X_data, X_depth, idx_data, patch, spread_box, periodic_shift, spread_fcn);
+    return;
+}
+
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    if (Q_data.empty()) return;
+    spread(q_data,
+           &Q_data[0],
+           static_cast<int>(Q_data.size()),
+           Q_depth,
+           &X_data[0],
+           static_cast<int>(X_data.size()),
+           X_depth,
+           patch,
+           spread_box,
+           spread_fcn);
+}
+
+void
+LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
+                     Pointer<CellData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
+{
+    if (Q_data.empty()) return;
+    spread(mask_data,
+           q_data,
+           &Q_data[0],
+           static_cast<int>(Q_data.size()),
+           Q_depth,
+           &X_data[0],
+           static_cast<int>(X_data.size()),
+           X_depth,
+           patch,
+           spread_box,
+           spread_fcn);
+}
+
+void
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
     if (Q_data.empty()) return;
-    interpolate(&Q_data[0],
-                static_cast<int>(Q_data.size()),
-                Q_depth,
-                &X_data[0],
-                static_cast<int>(X_data.size()),
-                X_depth,
-                q_data,
-                patch,
-                interp_box,
-                interp_fcn);
+    spread(q_data,
+           &Q_data[0],
+           static_cast<int>(Q_data.size()),
+           Q_depth,
+           &X_data[0],
+           static_cast<int>(X_data.size()),
+           X_depth,
+           patch,
+           spread_box,
+           spread_fcn);
 }
 
 void
-LEInteractor::interpolate(std::vector<double>& Q_data,
-                          const int Q_depth,
-                          const std::vector<double>& X_data,
-                          const int X_depth,
-                          const Pointer<SideData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
     if (Q_data.empty()) return;
-    interpolate(&Q_data[0],
-                static_cast<int>(Q_data.size()),
-                Q_depth,
-                &X_data[0],
-                static_cast<int>(X_data.size()),
-                X_depth,
-                q_data,
-                patch,
-                interp_box,
-                interp_fcn);
+    spread(q_data,
+           &Q_data[0],
+           static_cast<int>(Q_data.size()),
+           Q_depth,
+           &X_data[0],
+           static_cast<int>(X_data.size()),
+           X_depth,
+           patch,
+           spread_box,
+           spread_fcn);
 }
 
 void
-LEInteractor::interpolate(std::vector<double>& Q_data,
-                          const int Q_depth,
-                          const std::vector<double>& X_data,
-                          const int X_depth,
-                          const Pointer<SideData<NDIM, double> > mask_data,
-                          const Pointer<SideData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
+                     Pointer<SideData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
     if (Q_data.empty()) return;
-    interpolate(&Q_data[0],
-                static_cast<int>(Q_data.size()),
-                Q_depth,
-                &X_data[0],
-                static_cast<int>(X_data.size()),
-                X_depth,
-                mask_data,
-                q_data,
-                patch,
-                interp_box,
-                interp_fcn);
+    spread(mask_data,
+           q_data,
+           &Q_data[0],
+           static_cast<int>(Q_data.size()),
+           Q_depth,
+           &X_data[0],
+           static_cast<int>(X_data.size()),
+           X_depth,
+           patch,
+           spread_box,
+           spread_fcn);
 }
 
 void
-LEInteractor::interpolate(std::vector<double>& Q_data,
-                          const int Q_depth,
-                          const std::vector<double>& X_data,
-                          const int X_depth,
-                          const Pointer<EdgeData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const std::vector<double>& Q_data,
+                     const int Q_depth,
+                     const std::vector<double>& X_data,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
     if (Q_data.empty()) return;
-    interpolate(&Q_data[0],
-                static_cast<int>(Q_data.size()),
-                Q_depth,
-                &X_data[0],
-                static_cast<int>(X_data.size()),
-                X_depth,
-                q_data,
-                patch,
-                interp_box,
-                interp_fcn);
+    spread(q_data,
+           &Q_data[0],
+           static_cast<int>(Q_data.size()),
+           Q_depth,
+           &X_data[0],
+           static_cast<int>(X_data.size()),
+           X_depth,
+           patch,
+           spread_box,
+           spread_fcn);
 }
 
 void
-LEInteractor::interpolate(double* const Q_data,
-                          const int Q_size,
-                          const int Q_depth,
-                          const double* const X_data,
-                          const int X_size,
-                          const int X_depth,
-                          const Pointer<CellData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2022,43 +2781,43 @@ LEInteractor::interpolate(double* const Q_data,
     // Generate a list of local indices which lie in the specified box and set
     // all periodic offsets to zero.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
     std::vector<double> periodic_shifts(NDIM * local_indices.size());
 
-    // Interpolate.
+    // Spread.
     if (!local_indices.empty())
     {
-        interpolate(Q_data,
-                    Q_depth,
-                    X_data,
-                    q_data->getPointer(),
-                    q_data->getBox(),
-                    q_data->getGhostCellWidth(),
-                    q_data->getDepth(),
-                    x_lower,
-                    x_upper,
-                    dx,
-                    patch_touches_lower_physical_bdry,
-                    patch_touches_upper_physical_bdry,
-                    local_indices,
-                    periodic_shifts,
-                    interp_fcn);
+        spread(q_data->getPointer(),
+               q_data->getBox(),
+               q_data->getGhostCellWidth(),
+               q_data->getDepth(),
+               Q_data,
+               Q_depth,
+               X_data,
+               x_lower,
+               x_upper,
+               dx,
+               patch_touches_lower_physical_bdry,
+               patch_touches_upper_physical_bdry,
+               local_indices,
+               periodic_shifts,
+               spread_fcn);
     }
     return;
 }
 
 void
-LEInteractor::interpolate(double* const Q_data,
-                          const int Q_size,
-                          const int Q_depth,
-                          const double* const X_data,
-                          const int X_size,
-                          const int X_depth,
-                          const Pointer<CellData<NDIM, double> > mask_data,
-                          const Pointer<CellData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
+                     Pointer<CellData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2081,16 +2840,16 @@ LEInteractor::interpolate(double* const Q_data,
 
     // Get ghost cell width info.
     const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
-    const IntVector<NDIM>& mask_gcw = q_data->getGhostCellWidth();
-    const int stencil_size = getStencilSize(interp_fcn);
-    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
+    const IntVector<NDIM>& mask_gcw = mask_data->getGhostCellWidth();
+    const int stencil_size = getStencilSize(spread_fcn);
+    const int min_ghosts = getMinimumGhostWidth(spread_fcn);
     const int q_gcw_min = q_gcw.min();
     const int mask_gcw_min = mask_gcw.min();
     if (q_gcw_min < min_ghosts)
     {
-        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:\n"
+        TBOX_ERROR("LEInteractor::spread(): insufficient ghost cells for Eulerian field data:\n"
                    << "  kernel function          = "
-                   << interp_fcn
+                   << spread_fcn
                    << "\n"
                    << "  kernel stencil size      = "
                    << stencil_size
@@ -2104,9 +2863,9 @@ LEInteractor::interpolate(double* const Q_data,
     }
     if (mask_gcw_min < stencil_size)
     {
-        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:\n"
+        TBOX_ERROR("LEInteractor::spread(): insufficient ghost cells for Eulerian mask data:\n"
                    << "  kernel function          = "
-                   << interp_fcn
+                   << spread_fcn
                    << "\n"
                    << "  kernel stencil size      = "
                    << stencil_size
@@ -2135,10 +2894,10 @@ LEInteractor::interpolate(double* const Q_data,
     // Generate a list of local indices which lie in the specified box and set
     // all periodic offsets to zero.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
     std::vector<double> periodic_shifts(NDIM * local_indices.size());
 
-    // Interpolate.
+    // Spread.
     const int nindices = static_cast<int>(local_indices.size());
     if (nindices)
     {
@@ -2147,8 +2906,8 @@ LEInteractor::interpolate(double* const Q_data,
         {
             int s = local_indices[k];
             MLSWeight Psi;
-            const int stencil_sz = LEInteractor::getStencilSize(interp_fcn);
-            get_mls_weights(interp_fcn,
+            const int stencil_sz = LEInteractor::getStencilSize(spread_fcn);
+            get_mls_weights(spread_fcn,
                             &X_data[s * NDIM],
                             &periodic_shifts[k * NDIM],
                             dx,
@@ -2161,15 +2920,16 @@ LEInteractor::interpolate(double* const Q_data,
 
             for (int comp = 0; comp < Q_depth; ++comp)
             {
-                interpolate_data(stencil_sz,
-                                 ig_lower,
-                                 ig_upper,
-                                 stencil_lower,
-                                 stencil_upper,
-                                 q_data->getArrayData(),
-                                 comp,
-                                 Psi,
-                                 Q_data[s * Q_depth + comp]);
+                spread_data(stencil_sz,
+                            ig_lower,
+                            ig_upper,
+                            stencil_lower,
+                            stencil_upper,
+                            dx,
+                            q_data->getArrayData(),
+                            comp,
+                            Psi,
+                            Q_data[s * Q_depth + comp]);
             }
         }
     }
@@ -2178,16 +2938,16 @@ LEInteractor::interpolate(double* const Q_data,
 }
 
 void
-LEInteractor::interpolate(double* const Q_data,
-                          const int Q_size,
-                          const int Q_depth,
-                          const double* const X_data,
-                          const int X_size,
-                          const int X_depth,
-                          const Pointer<NodeData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2216,10 +2976,10 @@ LEInteractor::interpolate(double* const Q_data,
     // Generate a list of local indices which lie in the specified box and set
     // all periodic offsets to zero.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
     std::vector<double> periodic_shifts(NDIM * local_indices.size());
 
-    // Interpolate.
+    // Spread.
     if (!local_indices.empty())
     {
         boost::array<double, NDIM> x_lower_node, x_upper_node;
@@ -2228,53 +2988,48 @@ LEInteractor::interpolate(double* const Q_data,
             x_lower_node[d] = x_lower[d] - 0.5 * dx[d];
             x_upper_node[d] = x_upper[d] + 0.5 * dx[d];
         }
-        interpolate(Q_data,
-                    Q_depth,
-                    X_data,
-                    q_data->getPointer(),
-                    NodeGeometry<NDIM>::toNodeBox(q_data->getBox()),
-                    q_data->getGhostCellWidth(),
-                    q_data->getDepth(),
-                    x_lower_node.data(),
-                    x_upper_node.data(),
-                    dx,
-                    patch_touches_lower_physical_bdry,
-                    patch_touches_upper_physical_bdry,
-                    local_indices,
-                    periodic_shifts,
-                    interp_fcn);
+        spread(q_data->getPointer(),
+               NodeGeometry<NDIM>::toNodeBox(q_data->getBox()),
+               q_data->getGhostCellWidth(),
+               q_data->getDepth(),
+               Q_data,
+               Q_depth,
+               X_data,
+               x_lower_node.data(),
+               x_upper_node.data(),
+               dx,
+               patch_touches_lower_physical_bdry,
+               patch_touches_upper_physical_bdry,
+               local_indices,
+               periodic_shifts,
+               spread_fcn);
     }
     return;
 }
 
 void
-LEInteractor::interpolate(double* const Q_data,
-                          const int Q_size,
-                          const int Q_depth,
-                          const double* const X_data,
-                          const int X_size,
-                          const int X_depth,
-                          const Pointer<SideData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int /*Q_size*/,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
+    if (Q_depth != NDIM || q_data->getDepth() != 1)
+    {
+        TBOX_ERROR("LEInteractor::spread():\n"
+                   << "  side-centered spreading requires vector-valued data.\n");
+    }
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
     TBOX_ASSERT(patch);
     TBOX_ASSERT(Q_depth == NDIM);
     TBOX_ASSERT(X_depth == NDIM);
-    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
-    TBOX_ASSERT(q_data->getDepth() == 1);
-#else
-    NULL_USE(Q_size);
 #endif
-    if (Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  side-centered interpolation requires vector-valued data.\n");
-    }
-
     // Determine the patch geometry.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const x_lower = pgeom->getXLower();
@@ -2293,10 +3048,10 @@ LEInteractor::interpolate(double* const Q_data,
     // Generate a list of local indices which lie in the specified box and set
     // all periodic offsets to zero.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
     std::vector<double> periodic_shifts(NDIM * local_indices.size());
 
-    // Interpolate.
+    // Spread.
     if (!local_indices.empty())
     {
         boost::array<double, NDIM> x_lower_axis, x_upper_axis;
@@ -2311,43 +3066,43 @@ LEInteractor::interpolate(double* const Q_data,
             }
             x_lower_axis[axis] -= 0.5 * dx[axis];
             x_upper_axis[axis] += 0.5 * dx[axis];
-            interpolate(&Q_data_axis[0],
-                        /*Q_depth*/ 1,
-                        X_data,
-                        q_data->getPointer(axis),
-                        SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
-                        q_data->getGhostCellWidth(),
-                        /*q_depth*/ 1,
-                        x_lower_axis.data(),
-                        x_upper_axis.data(),
-                        dx,
-                        patch_touches_lower_physical_bdry,
-                        patch_touches_upper_physical_bdry,
-                        local_indices,
-                        periodic_shifts,
-                        interp_fcn,
-                        axis);
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
-                Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
+                Q_data_axis[local_indices[k]] = Q_data[NDIM * local_indices[k] + axis];
             }
+            spread(q_data->getPointer(axis),
+                   SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
+                   q_data->getGhostCellWidth(),
+                   /*q_depth*/ 1,
+                   &Q_data_axis[0],
+                   /*Q_depth*/ 1,
+                   X_data,
+                   x_lower_axis.data(),
+                   x_upper_axis.data(),
+                   dx,
+                   patch_touches_lower_physical_bdry,
+                   patch_touches_upper_physical_bdry,
+                   local_indices,
+                   periodic_shifts,
+                   spread_fcn,
+                   axis);
         }
     }
     return;
 }
 
 void
-LEInteractor::interpolate(double* const Q_data,
-                          const int Q_size,
-                          const int Q_depth,
-                          const double* const X_data,
-                          const int X_size,
-                          const int X_depth,
-                          const Pointer<SideData<NDIM, double> > mask_data,
-                          const Pointer<SideData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
+                     Pointer<SideData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int Q_size,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2357,7 +3112,6 @@ LEInteractor::interpolate(double* const Q_data,
     TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
     TBOX_ASSERT(q_data->getDepth() == 1);
     TBOX_ASSERT(mask_data);
-    TBOX_ASSERT(mask_data->getDepth() == 1);
 #else
     NULL_USE(Q_size);
 #endif
@@ -2372,15 +3126,15 @@ LEInteractor::interpolate(double* const Q_data,
     // Get ghost cell width info.
     const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
     const IntVector<NDIM>& mask_gcw = mask_data->getGhostCellWidth();
-    const int stencil_size = getStencilSize(interp_fcn);
-    const int min_ghosts = getMinimumGhostWidth(interp_fcn);
+    const int stencil_size = getStencilSize(spread_fcn);
+    const int min_ghosts = getMinimumGhostWidth(spread_fcn);
     const int q_gcw_min = q_gcw.min();
     const int mask_gcw_min = mask_gcw.min();
     if (q_gcw_min < min_ghosts)
     {
-        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:\n"
+        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:"
                    << "  kernel function          = "
-                   << interp_fcn
+                   << spread_fcn
                    << "\n"
                    << "  kernel stencil size      = "
                    << stencil_size
@@ -2394,9 +3148,9 @@ LEInteractor::interpolate(double* const Q_data,
     }
     if (mask_gcw_min < stencil_size)
     {
-        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:\n"
+        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:"
                    << "  kernel function          = "
-                   << interp_fcn
+                   << spread_fcn
                    << "\n"
                    << "  kernel stencil size      = "
                    << stencil_size
@@ -2409,7 +3163,7 @@ LEInteractor::interpolate(double* const Q_data,
                    << "\n");
     }
 
-    // Get boundary info.
+    // Determine the boundary info.
     boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
     boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
     for (unsigned int axis = 0; axis < NDIM; ++axis)
@@ -2423,16 +3177,15 @@ LEInteractor::interpolate(double* const Q_data,
     // Generate a list of local indices which lie in the specified box and set
     // all periodic offsets to zero.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
     std::vector<double> periodic_shifts(NDIM * local_indices.size());
 
-    // Interpolate.
+    // Spread.
     const int nindices = static_cast<int>(local_indices.size());
     if (nindices)
     {
         boost::array<double, NDIM> x_lower_axis, x_upper_axis;
         IntVector<NDIM> stencil_lower, stencil_upper;
-
         for (int axis = 0; axis < NDIM; ++axis)
         {
             Box<NDIM> data_box = SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis);
@@ -2451,8 +3204,8 @@ LEInteractor::interpolate(double* const Q_data,
             {
                 int s = local_indices[k];
                 MLSWeight Psi;
-                const int stencil_sz = LEInteractor::getStencilSize(interp_fcn);
-                get_mls_weights(interp_fcn,
+                const int stencil_sz = LEInteractor::getStencilSize(spread_fcn);
+                get_mls_weights(spread_fcn,
                                 &X_data[s * NDIM],
                                 &periodic_shifts[k * NDIM],
                                 dx,
@@ -2462,50 +3215,45 @@ LEInteractor::interpolate(double* const Q_data,
                                 stencil_lower,
                                 stencil_upper,
                                 Psi);
-                interpolate_data(stencil_sz,
-                                 ig_lower,
-                                 ig_upper,
-                                 stencil_lower,
-                                 stencil_upper,
-                                 q_data->getArrayData(axis),
-                                 0,
-                                 Psi,
-                                 Q_data[s * Q_depth + axis]);
+                spread_data(stencil_sz,
+                            ig_lower,
+                            ig_upper,
+                            stencil_lower,
+                            stencil_upper,
+                            dx,
+                            q_data->getArrayData(axis),
+                            0,
+                            Psi,
+                            Q_data[s * Q_depth + axis]);
             }
         }
     }
-
     return;
 }
 
 void
-LEInteractor::interpolate(double* const Q_data,
-                          const int Q_size,
-                          const int Q_depth,
-                          const double* const X_data,
-                          const int X_size,
-                          const int X_depth,
-                          const Pointer<EdgeData<NDIM, double> > q_data,
-                          const Pointer<Patch<NDIM> > patch,
-                          const Box<NDIM>& interp_box,
-                          const std::string& interp_fcn)
+LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
+                     const double* const Q_data,
+                     const int /*Q_size*/,
+                     const int Q_depth,
+                     const double* const X_data,
+                     const int X_size,
+                     const int X_depth,
+                     const Pointer<Patch<NDIM> > patch,
+                     const Box<NDIM>& spread_box,
+                     const std::string& spread_fcn)
 {
+    if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
+    {
+        TBOX_ERROR("LEInteractor::spread():\n"
+                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
+    }
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
     TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_depth == NDIM);
-    TBOX_ASSERT(X_depth == NDIM);
-    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
-    TBOX_ASSERT(q_data->getDepth() == 1);
-#else
-    NULL_USE(Q_size);
-#endif
-    if (Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::interpolate():\n"
-                   << "  side-centered interpolation requires vector-valued data.\n");
-    }
-
+    TBOX_ASSERT(Q_depth == NDIM);
+    TBOX_ASSERT(X_depth == NDIM);
+#endif
     // Determine the patch geometry.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const x_lower = pgeom->getXLower();
@@ -2524,10 +3272,10 @@ LEInteractor::interpolate(double* const Q_data,
     // Generate a list of local indices which lie in the specified box and set
     // all periodic offsets to zero.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, interp_box, patch, X_data, X_size, X_depth);
+    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
     std::vector<double> periodic_shifts(NDIM * local_indices.size());
 
-    // Interpolate.
+    // Spread.
     if (!local_indices.empty())
     {
         boost::array<double, NDIM> x_lower_axis, x_upper_axis;
@@ -2541,45 +3289,49 @@ LEInteractor::interpolate(double* const Q_data,
                 x_upper_axis[d] = x_upper[d];
                 if (d != axis)
                 {
-                    x_lower_axis[d] -= 0.5 * dx[d];
-                    x_upper_axis[d] += 0.5 * dx[d];
+                    x_lower_axis[axis] -= 0.5 * dx[axis];
+                    x_upper_axis[axis] += 0.5 * dx[axis];
                 }
             }
-            interpolate(&Q_data_axis[0],
-                        /*Q_depth*/ 1,
-                        X_data,
-                        q_data->getPointer(axis),
-                        EdgeGeometry<NDIM>::toEdgeBox(q_data->getBox(), axis),
-                        q_data->getGhostCellWidth(),
-                        /*q_depth*/ 1,
-                        x_lower_axis.data(),
-                        x_upper_axis.data(),
-                        dx,
-                        patch_touches_lower_physical_bdry,
-                        patch_touches_upper_physical_bdry,
-                        local_indices,
-                        periodic_shifts,
-                        interp_fcn,
-                        axis);
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
-                Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
+                Q_data_axis[local_indices[k]] = Q_data[NDIM * local_indices[k] + axis];
             }
+            spread(q_data->getPointer(axis),
+                   EdgeGeometry<NDIM>::toEdgeBox(q_data->getBox(), axis),
+                   q_data->getGhostCellWidth(),
+                   /*q_depth*/ 1,
+                   &Q_data_axis[0],
+                   /*Q_depth*/ 1,
+                   X_data,
+                   x_lower_axis.data(),
+                   x_upper_axis.data(),
+                   dx,
+                   patch_touches_lower_physical_bdry,
+                   patch_touches_upper_physical_bdry,
+                   local_indices,
+                   periodic_shifts,
+                   spread_fcn,
+                   axis);
         }
     }
     return;
 }
 
-template <class T>
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
-                     const Pointer<LData> Q_data,
-                     const Pointer<LData> X_data,
-                     const Pointer<LIndexSetData<T> > idx_data,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+LEInteractor::interpolateImpl(Pointer<LData> Q_data,
+                              const Pointer<LData> X_data,
+                              const Pointer<IndexData> idx_data,
+                              const Pointer<CellData<NDIM, double> > q_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& interp_box,
+                              const IntVector<NDIM>& periodic_shift,
+                              const std::string& interp_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -2590,31 +3342,31 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
-    spread(q_data,
-           Q_data->getGhostedLocalFormVecArray()->data(),
-           Q_data->getDepth(),
-           X_data->getGhostedLocalFormVecArray()->data(),
-           X_data->getDepth(),
-           idx_data,
-           patch,
-           spread_box,
-           periodic_shift,
-           spread_fcn);
+    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
+                Q_data->getDepth(),
+                X_data->getGhostedLocalFormVecArray()->data(),
+                X_data->getDepth(),
+                idx_data,
+                q_data,
+                patch,
+                interp_box,
+                periodic_shift,
+                interp_fcn);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
 }
 
-template <class T>
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
-                     const Pointer<LData> Q_data,
-                     const Pointer<LData> X_data,
-                     const Pointer<LIndexSetData<T> > idx_data,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+LEInteractor::interpolateImpl(Pointer<LData> Q_data,
+                              const Pointer<LData> X_data,
+                              const Pointer<IndexData> idx_data,
+                              const Pointer<NodeData<NDIM, double> > q_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& interp_box,
+                              const IntVector<NDIM>& periodic_shift,
+                              const std::string& interp_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -2625,36 +3377,36 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
     TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
     TBOX_ASSERT(X_data->getDepth() == NDIM);
 #endif
-    spread(q_data,
-           Q_data->getGhostedLocalFormVecArray()->data(),
-           Q_data->getDepth(),
-           X_data->getGhostedLocalFormVecArray()->data(),
-           X_data->getDepth(),
-           idx_data,
-           patch,
-           spread_box,
-           periodic_shift,
-           spread_fcn);
+    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
+                Q_data->getDepth(),
+                X_data->getGhostedLocalFormVecArray()->data(),
+                X_data->getDepth(),
+                idx_data,
+                q_data,
+                patch,
+                interp_box,
+                periodic_shift,
+                interp_fcn);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
 }
 
-template <class T>
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
-                     const Pointer<LData> Q_data,
-                     const Pointer<LData> X_data,
-                     const Pointer<LIndexSetData<T> > idx_data,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+LEInteractor::interpolateImpl(Pointer<LData> Q_data,
+                              const Pointer<LData> X_data,
+                              const Pointer<IndexData> idx_data,
+                              const Pointer<SideData<NDIM, double> > q_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& interp_box,
+                              const IntVector<NDIM>& periodic_shift,
+                              const std::string& interp_fcn)
 {
     if (Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
-        TBOX_ERROR("LEInteractor::spread():\n"
-                   << "  side-centered spreading requires vector-valued data.\n");
+        TBOX_ERROR("LEInteractor::interpolate():\n"
+                   << "  side-centered interpolation requires vector-valued data.\n");
     }
 #if !defined(NDEBUG)
     TBOX_ASSERT(Q_data);
@@ -2662,39 +3414,39 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     TBOX_ASSERT(X_data);
     TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
-    TBOX_ASSERT(q_data->getDepth() == 1);
     TBOX_ASSERT(Q_data->getDepth() == NDIM);
     TBOX_ASSERT(X_data->getDepth() == NDIM);
+    TBOX_ASSERT(q_data->getDepth() == 1);
 #endif
-    spread(q_data,
-           Q_data->getGhostedLocalFormVecArray()->data(),
-           Q_data->getDepth(),
-           X_data->getGhostedLocalFormVecArray()->data(),
-           X_data->getDepth(),
-           idx_data,
-           patch,
-           spread_box,
-           periodic_shift,
-           spread_fcn);
+    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
+                Q_data->getDepth(),
+                X_data->getGhostedLocalFormVecArray()->data(),
+                X_data->getDepth(),
+                idx_data,
+                q_data,
+                patch,
+                interp_box,
+                periodic_shift,
+                interp_fcn);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
 }
 
-template <class T>
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
-                     const Pointer<LData> Q_data,
-                     const Pointer<LData> X_data,
-                     const Pointer<LIndexSetData<T> > idx_data,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+LEInteractor::interpolateImpl(Pointer<LData> Q_data,
+                              const Pointer<LData> X_data,
+                              const Pointer<IndexData> idx_data,
+                              const Pointer<EdgeData<NDIM, double> > q_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& interp_box,
+                              const IntVector<NDIM>& periodic_shift,
+                              const std::string& interp_fcn)
 {
     if (NDIM != 3 || Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
     {
-        TBOX_ERROR("LEInteractor::spread():\n"
+        TBOX_ERROR("LEInteractor::interpolate():\n"
                    << "  edge-centered interpolation requires 3D vector-valued data.\n");
     }
 #if !defined(NDEBUG)
@@ -2703,37 +3455,37 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
     TBOX_ASSERT(X_data);
     TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
-    TBOX_ASSERT(q_data->getDepth() == 1);
     TBOX_ASSERT(Q_data->getDepth() == NDIM);
     TBOX_ASSERT(X_data->getDepth() == NDIM);
+    TBOX_ASSERT(q_data->getDepth() == 1);
 #endif
-    spread(q_data,
-           Q_data->getGhostedLocalFormVecArray()->data(),
-           Q_data->getDepth(),
-           X_data->getGhostedLocalFormVecArray()->data(),
-           X_data->getDepth(),
-           idx_data,
-           patch,
-           spread_box,
-           periodic_shift,
-           spread_fcn);
+    interpolate(Q_data->getGhostedLocalFormVecArray()->data(),
+                Q_data->getDepth(),
+                X_data->getGhostedLocalFormVecArray()->data(),
+                X_data->getDepth(),
+                idx_data,
+                q_data,
+                patch,
+                interp_box,
+                periodic_shift,
+                interp_fcn);
     Q_data->restoreArrays();
     X_data->restoreArrays();
     return;
 }
 
-template <class T>
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_depth,
-                     const Pointer<LIndexSetData<T> > idx_data,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+LEInteractor::interpolateImpl(double* const Q_data,
+                              const int Q_depth,
+                              const double* const X_data,
+                              const int X_depth,
+                              const Pointer<IndexData> idx_data,
+                              const Pointer<CellData<NDIM, double> > q_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& interp_box,
+                              const IntVector<NDIM>& periodic_shift,
+                              const std::string& interp_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2762,42 +3514,42 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
 
-    // Spread.
+    // Interpolate.
     if (!local_indices.empty())
     {
-        spread(q_data->getPointer(),
-               q_data->getBox(),
-               q_data->getGhostCellWidth(),
-               q_data->getDepth(),
-               Q_data,
-               Q_depth,
-               X_data,
-               x_lower,
-               x_upper,
-               dx,
-               patch_touches_lower_physical_bdry,
-               patch_touches_upper_physical_bdry,
-               local_indices,
-               periodic_shifts,
-               spread_fcn);
+        interpolate(Q_data,
+                    Q_depth,
+                    X_data,
+                    q_data->getPointer(),
+                    q_data->getBox(),
+                    q_data->getGhostCellWidth(),
+                    q_data->getDepth(),
+                    x_lower,
+                    x_upper,
+                    dx,
+                    patch_touches_lower_physical_bdry,
+                    patch_touches_upper_physical_bdry,
+                    local_indices,
+                    periodic_shifts,
+                    interp_fcn);
     }
     return;
 }
 
-template <class T>
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_depth,
-                     const Pointer<LIndexSetData<T> > idx_data,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+LEInteractor::interpolateImpl(double* const Q_data,
+                              const int Q_depth,
+                              const double* const X_data,
+                              const int X_depth,
+                              const Pointer<IndexData> idx_data,
+                              const Pointer<NodeData<NDIM, double> > q_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& interp_box,
+                              const IntVector<NDIM>& periodic_shift,
+                              const std::string& interp_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
@@ -2826,9 +3578,9 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
 
-    // Spread.
+    // Interpolate.
     if (!local_indices.empty())
     {
         boost::array<double, NDIM> x_lower_node, x_upper_node;
@@ -2837,52 +3589,52 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
             x_lower_node[d] = x_lower[d] - 0.5 * dx[d];
             x_upper_node[d] = x_upper[d] + 0.5 * dx[d];
         }
-        spread(q_data->getPointer(),
-               NodeGeometry<NDIM>::toNodeBox(q_data->getBox()),
-               q_data->getGhostCellWidth(),
-               q_data->getDepth(),
-               Q_data,
-               Q_depth,
-               X_data,
-               x_lower_node.data(),
-               x_upper_node.data(),
-               dx,
-               patch_touches_lower_physical_bdry,
-               patch_touches_upper_physical_bdry,
-               local_indices,
-               periodic_shifts,
-               spread_fcn);
+        interpolate(Q_data,
+                    Q_depth,
+                    X_data,
+                    q_data->getPointer(),
+                    NodeGeometry<NDIM>::toNodeBox(q_data->getBox()),
+                    q_data->getGhostCellWidth(),
+                    q_data->getDepth(),
+                    x_lower_node.data(),
+                    x_upper_node.data(),
+                    dx,
+                    patch_touches_lower_physical_bdry,
+                    patch_touches_upper_physical_bdry,
+                    local_indices,
+                    periodic_shifts,
+                    interp_fcn);
     }
     return;
 }
 
-template <class T>
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_depth,
-                     const Pointer<LIndexSetData<T> > idx_data,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+LEInteractor::interpolateImpl(double* const Q_data,
+                              const int Q_depth,
+                              const double* const X_data,
+                              const int X_depth,
+                              const Pointer<IndexData> idx_data,
+                              const Pointer<SideData<NDIM, double> > q_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& interp_box,
+                              const IntVector<NDIM>& periodic_shift,
+                              const std::string& interp_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
     TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
-    TBOX_ASSERT(q_data->getDepth() == 1);
     TBOX_ASSERT(Q_depth == NDIM);
     TBOX_ASSERT(X_depth == NDIM);
+    TBOX_ASSERT(q_data->getDepth() == 1);
 #else
     NULL_USE(X_depth);
 #endif
     if (Q_depth != NDIM || q_data->getDepth() != 1)
     {
-        TBOX_ERROR("LEInteractor::spread():\n"
-                   << "  side-centered spreading requires vector-valued data.\n");
+        TBOX_ERROR("LEInteractor::interpolate():\n"
+                   << "  side-centered interpolation requires vector-valued data.\n");
     }
 
     // Determine the patch geometry.
@@ -2903,9 +3655,9 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
 
-    // Spread.
+    // Interpolate.
     if (!local_indices.empty())
     {
         boost::array<double, NDIM> x_lower_axis, x_upper_axis;
@@ -2920,57 +3672,57 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
             }
             x_lower_axis[axis] -= 0.5 * dx[axis];
             x_upper_axis[axis] += 0.5 * dx[axis];
+            interpolate(&Q_data_axis[0],
+                        /*Q_depth*/ 1,
+                        X_data,
+                        q_data->getPointer(axis),
+                        SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
+                        q_data->getGhostCellWidth(),
+                        /*q_depth*/ 1,
+                        x_lower_axis.data(),
+                        x_upper_axis.data(),
+                        dx,
+                        patch_touches_lower_physical_bdry,
+                        patch_touches_upper_physical_bdry,
+                        local_indices,
+                        periodic_shifts,
+                        interp_fcn,
+                        axis);
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
-                Q_data_axis[local_indices[k]] = Q_data[NDIM * local_indices[k] + axis];
+                Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
             }
-            spread(q_data->getPointer(axis),
-                   SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis),
-                   q_data->getGhostCellWidth(),
-                   /*q_depth*/ 1,
-                   &Q_data_axis[0],
-                   /*Q_depth*/ 1,
-                   X_data,
-                   x_lower_axis.data(),
-                   x_upper_axis.data(),
-                   dx,
-                   patch_touches_lower_physical_bdry,
-                   patch_touches_upper_physical_bdry,
-                   local_indices,
-                   periodic_shifts,
-                   spread_fcn,
-                   axis);
         }
     }
     return;
 }
 
-template <class T>
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_depth,
-                     const Pointer<LIndexSetData<T> > idx_data,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const IntVector<NDIM>& periodic_shift,
-                     const std::string& spread_fcn)
+LEInteractor::interpolateImpl(double* const Q_data,
+                              const int Q_depth,
+                              const double* const X_data,
+                              const int X_depth,
+                              const Pointer<IndexData> idx_data,
+                              const Pointer<EdgeData<NDIM, double> > q_data,
+                              const Pointer<Patch<NDIM> > patch,
+                              const Box<NDIM>& interp_box,
+                              const IntVector<NDIM>& periodic_shift,
+                              const std::string& interp_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
     TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
-    TBOX_ASSERT(q_data->getDepth() == 1);
     TBOX_ASSERT(Q_depth == NDIM);
     TBOX_ASSERT(X_depth == NDIM);
+    TBOX_ASSERT(q_data->getDepth() == 1);
 #else
     NULL_USE(X_depth);
 #endif
     if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
     {
-        TBOX_ERROR("LEInteractor::spread():\n"
+        TBOX_ERROR("LEInteractor::interpolate():\n"
                    << "  edge-centered interpolation requires 3D vector-valued data.\n");
     }
 
@@ -2992,9 +3744,9 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
     // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
     std::vector<double> periodic_shifts;
-    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
+    buildLocalIndices(local_indices, periodic_shifts, interp_box, patch, periodic_shift, idx_data);
 
-    // Spread.
+    // Interpolate.
     if (!local_indices.empty())
     {
         boost::array<double, NDIM> x_lower_axis, x_upper_axis;
@@ -3012,193 +3764,204 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                     x_upper_axis[d] += 0.5 * dx[d];
                 }
             }
+            interpolate(&Q_data_axis[0],
+                        /*Q_depth*/ 1,
+                        X_data,
+                        q_data->getPointer(axis),
+                        EdgeGeometry<NDIM>::toEdgeBox(q_data->getBox(), axis),
+                        q_data->getGhostCellWidth(),
+                        /*q_depth*/ 1,
+                        x_lower_axis.data(),
+                        x_upper_axis.data(),
+                        dx,
+                        patch_touches_lower_physical_bdry,
+                        patch_touches_upper_physical_bdry,
+                        local_indices,
+                        periodic_shifts,
+                        interp_fcn,
+                        axis);
             for (unsigned int k = 0; k < local_indices.size(); ++k)
             {
-                Q_data_axis[local_indices[k]] = Q_data[NDIM * local_indices[k] + axis];
+                Q_data[NDIM * local_indices[k] + axis] = Q_data_axis[local_indices[k]];
             }
-            spread(q_data->getPointer(axis),
-                   EdgeGeometry<NDIM>::toEdgeBox(q_data->getBox(), axis),
-                   q_data->getGhostCellWidth(),
-                   /*q_depth*/ 1,
-                   &Q_data_axis[0],
-                   /*Q_depth*/ 1,
-                   X_data,
-                   x_lower_axis.data(),
-                   x_upper_axis.data(),
-                   dx,
-                   patch_touches_lower_physical_bdry,
-                   patch_touches_upper_physical_bdry,
-                   local_indices,
-                   periodic_shifts,
-                   spread_fcn,
-                   axis);
         }
     }
     return;
 }
 
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
-                     const std::vector<double>& Q_data,
-                     const int Q_depth,
-                     const std::vector<double>& X_data,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
-{
-    if (Q_data.empty()) return;
-    spread(q_data,
-           &Q_data[0],
-           static_cast<int>(Q_data.size()),
-           Q_depth,
-           &X_data[0],
-           static_cast<int>(X_data.size()),
-           X_depth,
-           patch,
-           spread_box,
-           spread_fcn);
-}
-
-void
-LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
-                     Pointer<CellData<NDIM, double> > q_data,
-                     const std::vector<double>& Q_data,
-                     const int Q_depth,
-                     const std::vector<double>& X_data,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
-{
-    if (Q_data.empty()) return;
-    spread(mask_data,
-           q_data,
-           &Q_data[0],
-           static_cast<int>(Q_data.size()),
-           Q_depth,
-           &X_data[0],
-           static_cast<int>(X_data.size()),
-           X_depth,
-           patch,
-           spread_box,
-           spread_fcn);
-}
-
-void
-LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
-                     const std::vector<double>& Q_data,
-                     const int Q_depth,
-                     const std::vector<double>& X_data,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+LEInteractor::spreadImpl(Pointer<CellData<NDIM, double> > q_data,
+                         const Pointer<LData> Q_data,
+                         const Pointer<LData> X_data,
+                         const Pointer<IndexData> idx_data,
+                         const Pointer<Patch<NDIM> > patch,
+                         const Box<NDIM>& spread_box,
+                         const IntVector<NDIM>& periodic_shift,
+                         const std::string& spread_fcn)
 {
-    if (Q_data.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_data);
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
+    TBOX_ASSERT(X_data->getDepth() == NDIM);
+#endif
     spread(q_data,
-           &Q_data[0],
-           static_cast<int>(Q_data.size()),
-           Q_depth,
-           &X_data[0],
-           static_cast<int>(X_data.size()),
-           X_depth,
+           Q_data->getGhostedLocalFormVecArray()->data(),
+           Q_data->getDepth(),
+           X_data->getGhostedLocalFormVecArray()->data(),
+           X_data->getDepth(),
+           idx_data,
            patch,
            spread_box,
+           periodic_shift,
            spread_fcn);
+    Q_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
 }
 
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
-                     const std::vector<double>& Q_data,
-                     const int Q_depth,
-                     const std::vector<double>& X_data,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+LEInteractor::spreadImpl(Pointer<NodeData<NDIM, double> > q_data,
+                         const Pointer<LData> Q_data,
+                         const Pointer<LData> X_data,
+                         const Pointer<IndexData> idx_data,
+                         const Pointer<Patch<NDIM> > patch,
+                         const Box<NDIM>& spread_box,
+                         const IntVector<NDIM>& periodic_shift,
+                         const std::string& spread_fcn)
 {
-    if (Q_data.empty()) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_data);
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(Q_data->getDepth() == static_cast<unsigned int>(q_data->getDepth()));
+    TBOX_ASSERT(X_data->getDepth() == NDIM);
+#endif
     spread(q_data,
-           &Q_data[0],
-           static_cast<int>(Q_data.size()),
-           Q_depth,
-           &X_data[0],
-           static_cast<int>(X_data.size()),
-           X_depth,
+           Q_data->getGhostedLocalFormVecArray()->data(),
+           Q_data->getDepth(),
+           X_data->getGhostedLocalFormVecArray()->data(),
+           X_data->getDepth(),
+           idx_data,
            patch,
            spread_box,
+           periodic_shift,
            spread_fcn);
+    Q_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
 }
 
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
-                     Pointer<SideData<NDIM, double> > q_data,
-                     const std::vector<double>& Q_data,
-                     const int Q_depth,
-                     const std::vector<double>& X_data,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+LEInteractor::spreadImpl(Pointer<SideData<NDIM, double> > q_data,
+                         const Pointer<LData> Q_data,
+                         const Pointer<LData> X_data,
+                         const Pointer<IndexData> idx_data,
+                         const Pointer<Patch<NDIM> > patch,
+                         const Box<NDIM>& spread_box,
+                         const IntVector<NDIM>& periodic_shift,
+                         const std::string& spread_fcn)
 {
-    if (Q_data.empty()) return;
-    spread(mask_data,
-           q_data,
-           &Q_data[0],
-           static_cast<int>(Q_data.size()),
-           Q_depth,
-           &X_data[0],
-           static_cast<int>(X_data.size()),
-           X_depth,
+    if (Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
+    {
+        TBOX_ERROR("LEInteractor::spread():\n"
+                   << "  side-centered spreading requires vector-valued data.\n");
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_data);
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(q_data->getDepth() == 1);
+    TBOX_ASSERT(Q_data->getDepth() == NDIM);
+    TBOX_ASSERT(X_data->getDepth() == NDIM);
+#endif
+    spread(q_data,
+           Q_data->getGhostedLocalFormVecArray()->data(),
+           Q_data->getDepth(),
+           X_data->getGhostedLocalFormVecArray()->data(),
+           X_data->getDepth(),
+           idx_data,
            patch,
            spread_box,
+           periodic_shift,
            spread_fcn);
+    Q_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
 }
 
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
-                     const std::vector<double>& Q_data,
-                     const int Q_depth,
-                     const std::vector<double>& X_data,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+LEInteractor::spreadImpl(Pointer<EdgeData<NDIM, double> > q_data,
+                         const Pointer<LData> Q_data,
+                         const Pointer<LData> X_data,
+                         const Pointer<IndexData> idx_data,
+                         const Pointer<Patch<NDIM> > patch,
+                         const Box<NDIM>& spread_box,
+                         const IntVector<NDIM>& periodic_shift,
+                         const std::string& spread_fcn)
 {
-    if (Q_data.empty()) return;
+    if (NDIM != 3 || Q_data->getDepth() != NDIM || q_data->getDepth() != 1)
+    {
+        TBOX_ERROR("LEInteractor::spread():\n"
+                   << "  edge-centered interpolation requires 3D vector-valued data.\n");
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_data);
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
+    TBOX_ASSERT(patch);
+    TBOX_ASSERT(q_data->getDepth() == 1);
+    TBOX_ASSERT(Q_data->getDepth() == NDIM);
+    TBOX_ASSERT(X_data->getDepth() == NDIM);
+#endif
     spread(q_data,
-           &Q_data[0],
-           static_cast<int>(Q_data.size()),
-           Q_depth,
-           &X_data[0],
-           static_cast<int>(X_data.size()),
-           X_depth,
+           Q_data->getGhostedLocalFormVecArray()->data(),
+           Q_data->getDepth(),
+           X_data->getGhostedLocalFormVecArray()->data(),
+           X_data->getDepth(),
+           idx_data,
            patch,
            spread_box,
+           periodic_shift,
            spread_fcn);
+    Q_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
 }
 
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int Q_size,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_size,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+LEInteractor::spreadImpl(Pointer<CellData<NDIM, double> > q_data,
+                         const double* const Q_data,
+                         const int Q_depth,
+                         const double* const X_data,
+                         const int X_depth,
+                         const Pointer<IndexData> idx_data,
+                         const Pointer<Patch<NDIM> > patch,
+                         const Box<NDIM>& spread_box,
+                         const IntVector<NDIM>& periodic_shift,
+                         const std::string& spread_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
+    TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
     TBOX_ASSERT(Q_depth == q_data->getDepth());
     TBOX_ASSERT(X_depth == NDIM);
-    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
 #else
-    NULL_USE(Q_size);
+    NULL_USE(X_depth);
 #endif
     // Determine the patch geometry.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -3215,11 +3978,10 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box and set
-    // all periodic offsets to zero.
+    // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
-    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+    std::vector<double> periodic_shifts;
+    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
 
     // Spread.
     if (!local_indices.empty())
@@ -3243,157 +4005,27 @@ LEInteractor::spread(Pointer<CellData<NDIM, double> > q_data,
     return;
 }
 
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<CellData<NDIM, double> > mask_data,
-                     Pointer<CellData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int Q_size,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_size,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
-{
-#if !defined(NDEBUG)
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_depth == q_data->getDepth());
-    TBOX_ASSERT(X_depth == NDIM);
-    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
-    TBOX_ASSERT(mask_data);
-    TBOX_ASSERT(mask_data->getDepth() == 1);
-#else
-    NULL_USE(Q_size);
-#endif
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const dx = pgeom->getDx();
-    const Box<NDIM>& patch_box = patch->getBox();
-    const IntVector<NDIM>& ilower = patch_box.lower();
-    const IntVector<NDIM>& iupper = patch_box.upper();
-
-    // Get ghost cell width info.
-    const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
-    const IntVector<NDIM>& mask_gcw = mask_data->getGhostCellWidth();
-    const int stencil_size = getStencilSize(spread_fcn);
-    const int min_ghosts = getMinimumGhostWidth(spread_fcn);
-    const int q_gcw_min = q_gcw.min();
-    const int mask_gcw_min = mask_gcw.min();
-    if (q_gcw_min < min_ghosts)
-    {
-        TBOX_ERROR("LEInteractor::spread(): insufficient ghost cells for Eulerian field data:\n"
-                   << "  kernel function          = "
-                   << spread_fcn
-                   << "\n"
-                   << "  kernel stencil size      = "
-                   << stencil_size
-                   << "\n"
-                   << "  minimum ghost cell width = "
-                   << min_ghosts
-                   << "\n"
-                   << "  ghost cell width         = "
-                   << q_gcw_min
-                   << "\n");
-    }
-    if (mask_gcw_min < stencil_size)
-    {
-        TBOX_ERROR("LEInteractor::spread(): insufficient ghost cells for Eulerian mask data:\n"
-                   << "  kernel function          = "
-                   << spread_fcn
-                   << "\n"
-                   << "  kernel stencil size      = "
-                   << stencil_size
-                   << "\n"
-                   << "  minimum ghost cell width = "
-                   << stencil_size
-                   << "\n"
-                   << "  ghost cell width         = "
-                   << mask_gcw_min
-                   << "\n");
-    }
-    const IntVector<NDIM> ig_lower = ilower - q_gcw;
-    const IntVector<NDIM> ig_upper = iupper + q_gcw;
-
-    // Get boundary info.
-    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
-    // Generate a list of local indices which lie in the specified box and set
-    // all periodic offsets to zero.
-    std::vector<int> local_indices;
-    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
-    std::vector<double> periodic_shifts(NDIM * local_indices.size());
-
-    // Spread.
-    const int nindices = static_cast<int>(local_indices.size());
-    if (nindices)
-    {
-        IntVector<NDIM> stencil_lower, stencil_upper;
-        for (int k = 0; k < nindices; ++k)
-        {
-            int s = local_indices[k];
-            MLSWeight Psi;
-            const int stencil_sz = LEInteractor::getStencilSize(spread_fcn);
-            get_mls_weights(spread_fcn,
-                            &X_data[s * NDIM],
-                            &periodic_shifts[k * NDIM],
-                            dx,
-                            x_lower,
-                            ilower,
-                            mask_data->getArrayData(),
-                            stencil_lower,
-                            stencil_upper,
-                            Psi);
-
-            for (int comp = 0; comp < Q_depth; ++comp)
-            {
-                spread_data(stencil_sz,
-                            ig_lower,
-                            ig_upper,
-                            stencil_lower,
-                            stencil_upper,
-                            dx,
-                            q_data->getArrayData(),
-                            comp,
-                            Psi,
-                            Q_data[s * Q_depth + comp]);
-            }
-        }
-    }
-
-    return;
-}
-
-void
-LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int Q_size,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_size,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+LEInteractor::spreadImpl(Pointer<NodeData<NDIM, double> > q_data,
+                         const double* const Q_data,
+                         const int Q_depth,
+                         const double* const X_data,
+                         const int X_depth,
+                         const Pointer<IndexData> idx_data,
+                         const Pointer<Patch<NDIM> > patch,
+                         const Box<NDIM>& spread_box,
+                         const IntVector<NDIM>& periodic_shift,
+                         const std::string& spread_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
+    TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
     TBOX_ASSERT(Q_depth == q_data->getDepth());
     TBOX_ASSERT(X_depth == NDIM);
-    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
 #else
-    NULL_USE(Q_size);
+    NULL_USE(X_depth);
 #endif
     // Determine the patch geometry.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
@@ -3410,11 +4042,10 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box and set
-    // all periodic offsets to zero.
+    // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
-    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+    std::vector<double> periodic_shifts;
+    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
 
     // Spread.
     if (!local_indices.empty())
@@ -3434,39 +4065,45 @@ LEInteractor::spread(Pointer<NodeData<NDIM, double> > q_data,
                X_data,
                x_lower_node.data(),
                x_upper_node.data(),
-               dx,
-               patch_touches_lower_physical_bdry,
-               patch_touches_upper_physical_bdry,
-               local_indices,
-               periodic_shifts,
-               spread_fcn);
-    }
-    return;
-}
-
-void
-LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int /*Q_size*/,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_size,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
-{
-    if (Q_depth != NDIM || q_data->getDepth() != 1)
-    {
-        TBOX_ERROR("LEInteractor::spread():\n"
-                   << "  side-centered spreading requires vector-valued data.\n");
+               dx,
+               patch_touches_lower_physical_bdry,
+               patch_touches_upper_physical_bdry,
+               local_indices,
+               periodic_shifts,
+               spread_fcn);
     }
+    return;
+}
+
+template <class IndexData>
+void
+LEInteractor::spreadImpl(Pointer<SideData<NDIM, double> > q_data,
+                         const double* const Q_data,
+                         const int Q_depth,
+                         const double* const X_data,
+                         const int X_depth,
+                         const Pointer<IndexData> idx_data,
+                         const Pointer<Patch<NDIM> > patch,
+                         const Box<NDIM>& spread_box,
+                         const IntVector<NDIM>& periodic_shift,
+                         const std::string& spread_fcn)
+{
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
+    TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
+    TBOX_ASSERT(q_data->getDepth() == 1);
     TBOX_ASSERT(Q_depth == NDIM);
     TBOX_ASSERT(X_depth == NDIM);
+#else
+    NULL_USE(X_depth);
 #endif
+    if (Q_depth != NDIM || q_data->getDepth() != 1)
+    {
+        TBOX_ERROR("LEInteractor::spread():\n"
+                   << "  side-centered spreading requires vector-valued data.\n");
+    }
+
     // Determine the patch geometry.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const x_lower = pgeom->getXLower();
@@ -3482,11 +4119,10 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box and set
-    // all periodic offsets to zero.
+    // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
-    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+    std::vector<double> periodic_shifts;
+    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
 
     // Spread.
     if (!local_indices.empty())
@@ -3528,169 +4164,35 @@ LEInteractor::spread(Pointer<SideData<NDIM, double> > q_data,
     return;
 }
 
+template <class IndexData>
 void
-LEInteractor::spread(Pointer<SideData<NDIM, double> > mask_data,
-                     Pointer<SideData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int Q_size,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_size,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
+LEInteractor::spreadImpl(Pointer<EdgeData<NDIM, double> > q_data,
+                         const double* const Q_data,
+                         const int Q_depth,
+                         const double* const X_data,
+                         const int X_depth,
+                         const Pointer<IndexData> idx_data,
+                         const Pointer<Patch<NDIM> > patch,
+                         const Box<NDIM>& spread_box,
+                         const IntVector<NDIM>& periodic_shift,
+                         const std::string& spread_fcn)
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(q_data);
+    TBOX_ASSERT(idx_data);
     TBOX_ASSERT(patch);
+    TBOX_ASSERT(q_data->getDepth() == 1);
     TBOX_ASSERT(Q_depth == NDIM);
     TBOX_ASSERT(X_depth == NDIM);
-    TBOX_ASSERT(Q_size / Q_depth == X_size / X_depth);
-    TBOX_ASSERT(q_data->getDepth() == 1);
-    TBOX_ASSERT(mask_data);
 #else
-    NULL_USE(Q_size);
+    NULL_USE(X_depth);
 #endif
-    // Determine the patch geometry.
-    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const double* const x_lower = pgeom->getXLower();
-    const double* const x_upper = pgeom->getXUpper();
-    const double* const dx = pgeom->getDx();
-    const Box<NDIM>& patch_box = patch->getBox();
-    const IntVector<NDIM>& ilower = patch_box.lower();
-
-    // Get ghost cell width info.
-    const IntVector<NDIM>& q_gcw = q_data->getGhostCellWidth();
-    const IntVector<NDIM>& mask_gcw = mask_data->getGhostCellWidth();
-    const int stencil_size = getStencilSize(spread_fcn);
-    const int min_ghosts = getMinimumGhostWidth(spread_fcn);
-    const int q_gcw_min = q_gcw.min();
-    const int mask_gcw_min = mask_gcw.min();
-    if (q_gcw_min < min_ghosts)
-    {
-        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian field data:"
-                   << "  kernel function          = "
-                   << spread_fcn
-                   << "\n"
-                   << "  kernel stencil size      = "
-                   << stencil_size
-                   << "\n"
-                   << "  minimum ghost cell width = "
-                   << min_ghosts
-                   << "\n"
-                   << "  ghost cell width         = "
-                   << q_gcw_min
-                   << "\n");
-    }
-    if (mask_gcw_min < stencil_size)
-    {
-        TBOX_ERROR("LEInteractor::interpolate(): insufficient ghost cells for Eulerian mask data:"
-                   << "  kernel function          = "
-                   << spread_fcn
-                   << "\n"
-                   << "  kernel stencil size      = "
-                   << stencil_size
-                   << "\n"
-                   << "  minimum ghost cell width = "
-                   << stencil_size
-                   << "\n"
-                   << "  ghost cell width         = "
-                   << mask_gcw_min
-                   << "\n");
-    }
-
-    // Determine the boundary info.
-    boost::array<int, NDIM> patch_touches_lower_physical_bdry(array_zero<int, NDIM>());
-    boost::array<int, NDIM> patch_touches_upper_physical_bdry(array_zero<int, NDIM>());
-    for (unsigned int axis = 0; axis < NDIM; ++axis)
-    {
-        static const int lower = 0;
-        patch_touches_lower_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, lower);
-        static const int upper = 1;
-        patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
-    }
-
-    // Generate a list of local indices which lie in the specified box and set
-    // all periodic offsets to zero.
-    std::vector<int> local_indices;
-    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
-    std::vector<double> periodic_shifts(NDIM * local_indices.size());
-
-    // Spread.
-    const int nindices = static_cast<int>(local_indices.size());
-    if (nindices)
-    {
-        boost::array<double, NDIM> x_lower_axis, x_upper_axis;
-        IntVector<NDIM> stencil_lower, stencil_upper;
-        for (int axis = 0; axis < NDIM; ++axis)
-        {
-            Box<NDIM> data_box = SideGeometry<NDIM>::toSideBox(q_data->getBox(), axis);
-            const IntVector<NDIM> ig_lower = data_box.lower() - q_gcw;
-            const IntVector<NDIM> ig_upper = data_box.upper() + q_gcw;
-
-            for (int d = 0; d < NDIM; ++d)
-            {
-                x_lower_axis[d] = x_lower[d];
-                x_upper_axis[d] = x_upper[d];
-            }
-            x_lower_axis[axis] -= 0.5 * dx[axis];
-            x_upper_axis[axis] += 0.5 * dx[axis];
-
-            for (int k = 0; k < nindices; ++k)
-            {
-                int s = local_indices[k];
-                MLSWeight Psi;
-                const int stencil_sz = LEInteractor::getStencilSize(spread_fcn);
-                get_mls_weights(spread_fcn,
-                                &X_data[s * NDIM],
-                                &periodic_shifts[k * NDIM],
-                                dx,
-                                x_lower_axis.data(),
-                                ilower,
-                                mask_data->getArrayData(axis),
-                                stencil_lower,
-                                stencil_upper,
-                                Psi);
-                spread_data(stencil_sz,
-                            ig_lower,
-                            ig_upper,
-                            stencil_lower,
-                            stencil_upper,
-                            dx,
-                            q_data->getArrayData(axis),
-                            0,
-                            Psi,
-                            Q_data[s * Q_depth + axis]);
-            }
-        }
-    }
-    return;
-}
-
-void
-LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
-                     const double* const Q_data,
-                     const int /*Q_size*/,
-                     const int Q_depth,
-                     const double* const X_data,
-                     const int X_size,
-                     const int X_depth,
-                     const Pointer<Patch<NDIM> > patch,
-                     const Box<NDIM>& spread_box,
-                     const std::string& spread_fcn)
-{
     if (NDIM != 3 || Q_depth != NDIM || q_data->getDepth() != 1)
     {
         TBOX_ERROR("LEInteractor::spread():\n"
                    << "  edge-centered interpolation requires 3D vector-valued data.\n");
     }
-#if !defined(NDEBUG)
-    TBOX_ASSERT(q_data);
-    TBOX_ASSERT(patch);
-    TBOX_ASSERT(Q_depth == NDIM);
-    TBOX_ASSERT(X_depth == NDIM);
-#endif
+
     // Determine the patch geometry.
     const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
     const double* const x_lower = pgeom->getXLower();
@@ -3706,11 +4208,10 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
         patch_touches_upper_physical_bdry[axis] = pgeom->getTouchesRegularBoundary(axis, upper);
     }
 
-    // Generate a list of local indices which lie in the specified box and set
-    // all periodic offsets to zero.
+    // Generate a list of local indices which lie in the specified box.
     std::vector<int> local_indices;
-    buildLocalIndices(local_indices, spread_box, patch, X_data, X_size, X_depth);
-    std::vector<double> periodic_shifts(NDIM * local_indices.size());
+    std::vector<double> periodic_shifts;
+    buildLocalIndices(local_indices, periodic_shifts, spread_box, patch, periodic_shift, idx_data);
 
     // Spread.
     if (!local_indices.empty())
@@ -3726,8 +4227,8 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
                 x_upper_axis[d] = x_upper[d];
                 if (d != axis)
                 {
-                    x_lower_axis[axis] -= 0.5 * dx[axis];
-                    x_upper_axis[axis] += 0.5 * dx[axis];
+                    x_lower_axis[d] -= 0.5 * dx[d];
+                    x_upper_axis[d] += 0.5 * dx[d];
                 }
             }
             for (unsigned int k = 0; k < local_indices.size(); ++k)
@@ -3755,10 +4256,6 @@ LEInteractor::spread(Pointer<EdgeData<NDIM, double> > q_data,
     return;
 }
 
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
-
 void
 LEInteractor::interpolate(double* const Q_data,
                           const int Q_depth,
@@ -4813,6 +5310,89 @@ LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
     return;
 }
 
+void
+LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
+                                std::vector<double>& periodic_shifts,
+                                const Box<NDIM>& box,
+                                const Pointer<Patch<NDIM> > patch,
+                                const IntVector<NDIM>& periodic_shift,
+                                const Pointer<LNodeCSRData> idx_data)
+{
+    local_indices.clear();
+    periodic_shifts.clear();
+    const size_t upper_bound = idx_data->getLocalPETScIndices().size();
+    if (upper_bound == 0) return;
+
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Box<NDIM>& ghost_box = idx_data->getGhostBox();
+    if (box == patch_box)
+    {
+        local_indices = idx_data->getInteriorLocalPETScIndices();
+        periodic_shifts = idx_data->getInteriorPeriodicShifts();
+        return;
+    }
+    else if (box == ghost_box)
+    {
+        local_indices = idx_data->getLocalPETScIndices();
+        periodic_shifts = idx_data->getPeriodicShifts();
+        return;
+    }
+
+    local_indices.reserve(upper_bound);
+    periodic_shifts.reserve(NDIM * upper_bound);
+
+    const Index<NDIM>& ilower = patch_box.lower();
+    const Index<NDIM>& iupper = patch_box.upper();
+
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    boost::array<bool, NDIM> patch_touches_lower_periodic_bdry, patch_touches_upper_periodic_bdry;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        patch_touches_lower_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 0);
+        patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
+    }
+
+    // The nodes in each cell are stored contiguously, so that only the cell
+    // offsets need to be examined for cells in the box.
+    const std::vector<int>& cell_offsets = idx_data->getCellOffsets();
+    const std::vector<int>& all_local_indices = idx_data->getLocalPETScIndices();
+    for (Box<NDIM>::Iterator b(box * ghost_box); b; b++)
+    {
+        const Index<NDIM>& i = b();
+        const int cell_num = ghost_box.offset(i);
+        const int node_lower = cell_offsets[cell_num];
+        const int node_upper = cell_offsets[cell_num + 1];
+        if (node_lower == node_upper) continue;
+
+        boost::array<int, NDIM> offset;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            if (patch_touches_lower_periodic_bdry[d] && i(d) < ilower(d))
+            {
+                offset[d] = -periodic_shift(d); // X is ABOVE the top    of the patch --- need to shift DOWN
+            }
+            else if (patch_touches_upper_periodic_bdry[d] && i(d) > iupper(d))
+            {
+                offset[d] = +periodic_shift(d); // X is BELOW the bottom of the patch --- need to shift UP
+            }
+            else
+            {
+                offset[d] = 0;
+            }
+        }
+        for (int k = node_lower; k < node_upper; ++k)
+        {
+            local_indices.push_back(all_local_indices[k]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                periodic_shifts.push_back(static_cast<double>(offset[d]) * dx[d]);
+            }
+        }
+    }
+    return;
+}
+
 void
 LEInteractor::buildLocalIndices(std::vector<int>& local_indices,
                                 const Box<NDIM>& box,
@@ -0,0 +1,598 @@
+// Filename: LNodeCSRData.cpp
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ostream>
+#include <vector>
+
+#include "Box.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
+#include "CartesianPatchGeometry.h"
+#include "CellOverlap.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "boost/array.hpp"
+#include "ibtk/LNodeCSRData.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/AbstractStream.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Version of LNodeCSRData restart file data.
+static const int LNODE_CSR_DATA_VERSION = 1;
+
+// Number of integer and double values streamed per node.
+static const int NUM_INTS_PER_NODE = 3 + 2 * NDIM;
+static const int NUM_DOUBLES_PER_NODE = NDIM;
+
+inline const CellOverlap<NDIM>&
+get_cell_overlap(const BoxOverlap<NDIM>& overlap)
+{
+    const CellOverlap<NDIM>* const t_overlap = dynamic_cast<const CellOverlap<NDIM>*>(&overlap);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(t_overlap);
+#endif
+    return *t_overlap;
+} // get_cell_overlap
+
+inline void
+get_destination_boxes(std::vector<Box<NDIM> >& dst_boxes, const CellOverlap<NDIM>& overlap)
+{
+    dst_boxes.clear();
+    const BoxList<NDIM>& dst_box_list = overlap.getDestinationBoxes();
+    for (BoxList<NDIM>::Iterator bl(dst_box_list); bl; bl++)
+    {
+        dst_boxes.push_back(bl());
+    }
+    return;
+} // get_destination_boxes
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LNodeCSRData::LNodeCSRData(const Box<NDIM>& box, const IntVector<NDIM>& ghosts)
+    : PatchData<NDIM>(box, ghosts),
+      d_cell_offsets(getGhostBox().size() + 1, 0),
+      d_lag_indices(),
+      d_global_petsc_indices(),
+      d_local_petsc_indices(),
+      d_periodic_offsets(),
+      d_periodic_displacements(),
+      d_interior_lag_indices(),
+      d_ghost_lag_indices(),
+      d_interior_global_petsc_indices(),
+      d_ghost_global_petsc_indices(),
+      d_interior_local_petsc_indices(),
+      d_ghost_local_petsc_indices(),
+      d_periodic_shifts(),
+      d_interior_periodic_shifts(),
+      d_ghost_periodic_shifts()
+{
+    // intentionally blank
+    return;
+} // LNodeCSRData
+
+LNodeCSRData::~LNodeCSRData()
+{
+    // intentionally blank
+    return;
+} // ~LNodeCSRData
+
+void
+LNodeCSRData::removeAllItems()
+{
+    buildFromNodeBuffer(NodeBuffer());
+    return;
+} // removeAllItems
+
+void
+LNodeCSRData::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector<NDIM>& periodic_shift)
+{
+    clearCachedIndices();
+
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Index<NDIM>& ilower = patch_box.lower();
+    const Index<NDIM>& iupper = patch_box.upper();
+    const Box<NDIM>& ghost_box = getGhostBox();
+
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    boost::array<bool, NDIM> patch_touches_lower_periodic_bdry, patch_touches_upper_periodic_bdry;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        patch_touches_lower_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 0);
+        patch_touches_upper_periodic_bdry[axis] = pgeom->getTouchesPeriodicBoundary(axis, 1);
+    }
+
+    const int num_nodes = getNumberOfNodes();
+    d_periodic_shifts.resize(NDIM * num_nodes);
+    if (num_nodes == 0) return;
+    for (Box<NDIM>::Iterator b(ghost_box); b; b++)
+    {
+        const Index<NDIM>& i = b();
+        const int cell_num = ghost_box.offset(i);
+        const int node_lower = d_cell_offsets[cell_num];
+        const int node_upper = d_cell_offsets[cell_num + 1];
+        if (node_lower == node_upper) continue;
+        boost::array<double, NDIM> shift;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            int offset = 0;
+            if (patch_touches_lower_periodic_bdry[d] && i(d) < ilower(d))
+            {
+                offset = -periodic_shift(d); // X is ABOVE the top    of the patch --- need to shift DOWN
+            }
+            else if (patch_touches_upper_periodic_bdry[d] && i(d) > iupper(d))
+            {
+                offset = +periodic_shift(d); // X is BELOW the bottom of the patch --- need to shift UP
+            }
+            shift[d] = static_cast<double>(offset) * dx[d];
+        }
+        const bool patch_owns_cell = patch_box.contains(i);
+        for (int k = node_lower; k < node_upper; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_periodic_shifts[NDIM * k + d] = shift[d];
+            }
+            if (patch_owns_cell)
+            {
+                d_interior_lag_indices.push_back(d_lag_indices[k]);
+                d_interior_global_petsc_indices.push_back(d_global_petsc_indices[k]);
+                d_interior_local_petsc_indices.push_back(d_local_petsc_indices[k]);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_interior_periodic_shifts.push_back(shift[d]);
+                }
+            }
+            else
+            {
+                d_ghost_lag_indices.push_back(d_lag_indices[k]);
+                d_ghost_global_petsc_indices.push_back(d_global_petsc_indices[k]);
+                d_ghost_local_petsc_indices.push_back(d_local_petsc_indices[k]);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    d_ghost_periodic_shifts.push_back(shift[d]);
+                }
+            }
+        }
+    }
+    return;
+} // cacheLocalIndices
+
+void
+LNodeCSRData::copy(const PatchData<NDIM>& src)
+{
+    const LNodeCSRData* const t_src = dynamic_cast<const LNodeCSRData*>(&src);
+    if (!t_src)
+    {
+        src.copy2(*this);
+        return;
+    }
+    const std::vector<Box<NDIM> > dst_boxes(1, getGhostBox() * t_src->getGhostBox());
+    copyNodes(*t_src, dst_boxes, IntVector<NDIM>(0));
+    return;
+} // copy
+
+void
+LNodeCSRData::copy2(PatchData<NDIM>& dst) const
+{
+    LNodeCSRData* const t_dst = dynamic_cast<LNodeCSRData*>(&dst);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(t_dst);
+#endif
+    t_dst->copy(*this);
+    return;
+} // copy2
+
+void
+LNodeCSRData::copy(const PatchData<NDIM>& src, const BoxOverlap<NDIM>& overlap)
+{
+    const LNodeCSRData* const t_src = dynamic_cast<const LNodeCSRData*>(&src);
+    if (!t_src)
+    {
+        src.copy2(*this, overlap);
+        return;
+    }
+    const CellOverlap<NDIM>& t_overlap = get_cell_overlap(overlap);
+    std::vector<Box<NDIM> > dst_boxes;
+    get_destination_boxes(dst_boxes, t_overlap);
+    copyNodes(*t_src, dst_boxes, t_overlap.getSourceOffset());
+    return;
+} // copy
+
+void
+LNodeCSRData::copy2(PatchData<NDIM>& dst, const BoxOverlap<NDIM>& overlap) const
+{
+    LNodeCSRData* const t_dst = dynamic_cast<LNodeCSRData*>(&dst);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(t_dst);
+#endif
+    t_dst->copy(*this, overlap);
+    return;
+} // copy2
+
+bool
+LNodeCSRData::canEstimateStreamSizeFromBox() const
+{
+    return false;
+} // canEstimateStreamSizeFromBox
+
+size_t
+LNodeCSRData::getDataStreamSize(const BoxOverlap<NDIM>& overlap) const
+{
+    const CellOverlap<NDIM>& t_overlap = get_cell_overlap(overlap);
+    std::vector<Box<NDIM> > dst_boxes;
+    get_destination_boxes(dst_boxes, t_overlap);
+    const IntVector<NDIM>& src_offset = t_overlap.getSourceOffset();
+    const Box<NDIM>& ghost_box = getGhostBox();
+    size_t size = 0;
+    for (std::vector<Box<NDIM> >::const_iterator it = dst_boxes.begin(); it != dst_boxes.end(); ++it)
+    {
+        Box<NDIM> src_box(*it);
+        src_box.shift(-src_offset);
+        int num_nodes = 0;
+        for (Box<NDIM>::Iterator b(src_box * ghost_box); b; b++)
+        {
+            num_nodes += getNumberOfNodes(b());
+        }
+        size += AbstractStream::sizeofInt();
+        if (num_nodes > 0)
+        {
+            size += AbstractStream::sizeofInt(NUM_INTS_PER_NODE * num_nodes);
+            size += AbstractStream::sizeofDouble(NUM_DOUBLES_PER_NODE * num_nodes);
+        }
+    }
+    return size;
+} // getDataStreamSize
+
+void
+LNodeCSRData::packStream(AbstractStream& stream, const BoxOverlap<NDIM>& overlap) const
+{
+    const CellOverlap<NDIM>& t_overlap = get_cell_overlap(overlap);
+    std::vector<Box<NDIM> > dst_boxes;
+    get_destination_boxes(dst_boxes, t_overlap);
+    const IntVector<NDIM>& src_offset = t_overlap.getSourceOffset();
+    const Box<NDIM>& ghost_box = getGhostBox();
+    std::vector<int> int_buf;
+    std::vector<double> double_buf;
+    for (std::vector<Box<NDIM> >::const_iterator it = dst_boxes.begin(); it != dst_boxes.end(); ++it)
+    {
+        Box<NDIM> src_box(*it);
+        src_box.shift(-src_offset);
+        int_buf.clear();
+        double_buf.clear();
+        for (Box<NDIM>::Iterator b(src_box * ghost_box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            const int cell_num = ghost_box.offset(i);
+            for (int k = d_cell_offsets[cell_num]; k < d_cell_offsets[cell_num + 1]; ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    int_buf.push_back(i(d));
+                }
+                int_buf.push_back(d_lag_indices[k]);
+                int_buf.push_back(d_global_petsc_indices[k]);
+                int_buf.push_back(d_local_petsc_indices[k]);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    int_buf.push_back(d_periodic_offsets[NDIM * k + d]);
+                    double_buf.push_back(d_periodic_displacements[NDIM * k + d]);
+                }
+            }
+        }
+        const int num_nodes = static_cast<int>(int_buf.size()) / NUM_INTS_PER_NODE;
+        stream.pack(&num_nodes, 1);
+        if (num_nodes > 0)
+        {
+            stream.pack(&int_buf[0], NUM_INTS_PER_NODE * num_nodes);
+            stream.pack(&double_buf[0], NUM_DOUBLES_PER_NODE * num_nodes);
+        }
+    }
+    return;
+} // packStream
+
+void
+LNodeCSRData::unpackStream(AbstractStream& stream, const BoxOverlap<NDIM>& overlap)
+{
+    const CellOverlap<NDIM>& t_overlap = get_cell_overlap(overlap);
+    std::vector<Box<NDIM> > dst_boxes;
+    get_destination_boxes(dst_boxes, t_overlap);
+    const IntVector<NDIM>& src_offset = t_overlap.getSourceOffset();
+    const Box<NDIM>& ghost_box = getGhostBox();
+
+    // Keep the nodes that lie outside of the destination boxes.
+    std::vector<bool> dst_cells(ghost_box.size(), false);
+    for (std::vector<Box<NDIM> >::const_iterator it = dst_boxes.begin(); it != dst_boxes.end(); ++it)
+    {
+        markCells(dst_cells, *it);
+    }
+    NodeBuffer buf;
+    appendNodesOutsideCells(buf, dst_cells);
+
+    // Unpack the nodes that lie in the destination boxes.  Cells that appear in
+    // more than one destination box are filled only once.
+    std::vector<int> int_buf;
+    std::vector<double> double_buf;
+    for (std::vector<Box<NDIM> >::const_iterator it = dst_boxes.begin(); it != dst_boxes.end(); ++it)
+    {
+        int num_nodes;
+        stream.unpack(&num_nodes, 1);
+        if (num_nodes > 0)
+        {
+            int_buf.resize(NUM_INTS_PER_NODE * num_nodes);
+            double_buf.resize(NUM_DOUBLES_PER_NODE * num_nodes);
+            stream.unpack(&int_buf[0], NUM_INTS_PER_NODE * num_nodes);
+            stream.unpack(&double_buf[0], NUM_DOUBLES_PER_NODE * num_nodes);
+        }
+        for (int n = 0; n < num_nodes; ++n)
+        {
+            const int* const node_ints = &int_buf[NUM_INTS_PER_NODE * n];
+            const double* const node_doubles = &double_buf[NUM_DOUBLES_PER_NODE * n];
+            Index<NDIM> i;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                i(d) = node_ints[d] + src_offset(d);
+            }
+            if (!ghost_box.contains(i)) continue;
+            const int cell_num = ghost_box.offset(i);
+            if (!dst_cells[cell_num]) continue;
+            buf.cell_nums.push_back(cell_num);
+            buf.lag_indices.push_back(node_ints[NDIM]);
+            buf.global_petsc_indices.push_back(node_ints[NDIM + 1]);
+            buf.local_petsc_indices.push_back(node_ints[NDIM + 2]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                buf.periodic_offsets.push_back(node_ints[NDIM + 3 + d]);
+                buf.periodic_displacements.push_back(node_doubles[d]);
+            }
+        }
+        for (Box<NDIM>::Iterator b(*it * ghost_box); b; b++)
+        {
+            dst_cells[ghost_box.offset(b())] = false;
+        }
+    }
+    buildFromNodeBuffer(buf);
+    return;
+} // unpackStream
+
+void
+LNodeCSRData::getSpecializedFromDatabase(Pointer<Database> database)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(database);
+#endif
+    const int ver = database->getInteger("LNODE_CSR_DATA_VERSION");
+    if (ver != LNODE_CSR_DATA_VERSION)
+    {
+        TBOX_ERROR("LNodeCSRData::getSpecializedFromDatabase():\n"
+                   << "  restart file version different than class version."
+                   << std::endl);
+    }
+    const int num_cells = getGhostBox().size();
+    const int num_nodes = database->getInteger("num_nodes");
+    d_cell_offsets.resize(num_cells + 1);
+    database->getIntegerArray("d_cell_offsets", &d_cell_offsets[0], num_cells + 1);
+    d_lag_indices.resize(num_nodes);
+    d_global_petsc_indices.resize(num_nodes);
+    d_local_petsc_indices.resize(num_nodes);
+    d_periodic_offsets.resize(NDIM * num_nodes);
+    d_periodic_displacements.resize(NDIM * num_nodes);
+    if (num_nodes > 0)
+    {
+        database->getIntegerArray("d_lag_indices", &d_lag_indices[0], num_nodes);
+        database->getIntegerArray("d_global_petsc_indices", &d_global_petsc_indices[0], num_nodes);
+        database->getIntegerArray("d_local_petsc_indices", &d_local_petsc_indices[0], num_nodes);
+        database->getIntegerArray("d_periodic_offsets", &d_periodic_offsets[0], NDIM * num_nodes);
+        database->getDoubleArray("d_periodic_displacements", &d_periodic_displacements[0], NDIM * num_nodes);
+    }
+    clearCachedIndices();
+    return;
+} // getSpecializedFromDatabase
+
+void
+LNodeCSRData::putSpecializedToDatabase(Pointer<Database> database)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(database);
+#endif
+    const int num_nodes = getNumberOfNodes();
+    database->putInteger("LNODE_CSR_DATA_VERSION", LNODE_CSR_DATA_VERSION);
+    database->putInteger("num_nodes", num_nodes);
+    database->putIntegerArray("d_cell_offsets", &d_cell_offsets[0], static_cast<int>(d_cell_offsets.size()));
+    if (num_nodes > 0)
+    {
+        database->putIntegerArray("d_lag_indices", &d_lag_indices[0], num_nodes);
+        database->putIntegerArray("d_global_petsc_indices", &d_global_petsc_indices[0], num_nodes);
+        database->putIntegerArray("d_local_petsc_indices", &d_local_petsc_indices[0], num_nodes);
+        database->putIntegerArray("d_periodic_offsets", &d_periodic_offsets[0], NDIM * num_nodes);
+        database->putDoubleArray("d_periodic_displacements", &d_periodic_displacements[0], NDIM * num_nodes);
+    }
+    return;
+} // putSpecializedToDatabase
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+LNodeCSRData::appendNode(NodeBuffer& buf, const int k, const int cell_num) const
+{
+    buf.cell_nums.push_back(cell_num);
+    buf.lag_indices.push_back(d_lag_indices[k]);
+    buf.global_petsc_indices.push_back(d_global_petsc_indices[k]);
+    buf.local_petsc_indices.push_back(d_local_petsc_indices[k]);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        buf.periodic_offsets.push_back(d_periodic_offsets[NDIM * k + d]);
+        buf.periodic_displacements.push_back(d_periodic_displacements[NDIM * k + d]);
+    }
+    return;
+} // appendNode
+
+void
+LNodeCSRData::appendNodesOutsideCells(NodeBuffer& buf, const std::vector<bool>& excluded_cells) const
+{
+    const int num_cells = static_cast<int>(d_cell_offsets.size()) - 1;
+    for (int cell_num = 0; cell_num < num_cells; ++cell_num)
+    {
+        if (excluded_cells[cell_num]) continue;
+        for (int k = d_cell_offsets[cell_num]; k < d_cell_offsets[cell_num + 1]; ++k)
+        {
+            appendNode(buf, k, cell_num);
+        }
+    }
+    return;
+} // appendNodesOutsideCells
+
+void
+LNodeCSRData::markCells(std::vector<bool>& cells, const Box<NDIM>& box) const
+{
+    const Box<NDIM>& ghost_box = getGhostBox();
+    for (Box<NDIM>::Iterator b(box * ghost_box); b; b++)
+    {
+        cells[ghost_box.offset(b())] = true;
+    }
+    return;
+} // markCells
+
+void
+LNodeCSRData::clearCachedIndices()
+{
+    d_interior_lag_indices.clear();
+    d_ghost_lag_indices.clear();
+    d_interior_global_petsc_indices.clear();
+    d_ghost_global_petsc_indices.clear();
+    d_interior_local_petsc_indices.clear();
+    d_ghost_local_petsc_indices.clear();
+    d_periodic_shifts.clear();
+    d_interior_periodic_shifts.clear();
+    d_ghost_periodic_shifts.clear();
+    return;
+} // clearCachedIndices
+
+void
+LNodeCSRData::buildFromNodeBuffer(const NodeBuffer& buf)
+{
+    // Bucket the nodes by cell via a (stable) counting sort.
+    const int num_cells = getGhostBox().size();
+    const int num_nodes = static_cast<int>(buf.cell_nums.size());
+    d_cell_offsets.assign(num_cells + 1, 0);
+    for (int n = 0; n < num_nodes; ++n)
+    {
+        ++d_cell_offsets[buf.cell_nums[n] + 1];
+    }
+    for (int cell_num = 0; cell_num < num_cells; ++cell_num)
+    {
+        d_cell_offsets[cell_num + 1] += d_cell_offsets[cell_num];
+    }
+    std::vector<int> next_node(d_cell_offsets.begin(), d_cell_offsets.end() - 1);
+    d_lag_indices.resize(num_nodes);
+    d_global_petsc_indices.resize(num_nodes);
+    d_local_petsc_indices.resize(num_nodes);
+    d_periodic_offsets.resize(NDIM * num_nodes);
+    d_periodic_displacements.resize(NDIM * num_nodes);
+    for (int n = 0; n < num_nodes; ++n)
+    {
+        const int k = next_node[buf.cell_nums[n]]++;
+        d_lag_indices[k] = buf.lag_indices[n];
+        d_global_petsc_indices[k] = buf.global_petsc_indices[n];
+        d_local_petsc_indices[k] = buf.local_petsc_indices[n];
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            d_periodic_offsets[NDIM * k + d] = buf.periodic_offsets[NDIM * n + d];
+            d_periodic_displacements[NDIM * k + d] = buf.periodic_displacements[NDIM * n + d];
+        }
+    }
+    clearCachedIndices();
+    return;
+} // buildFromNodeBuffer
+
+void
+LNodeCSRData::copyNodes(const LNodeCSRData& src,
+                        const std::vector<Box<NDIM> >& dst_boxes,
+                        const IntVector<NDIM>& src_offset)
+{
+    const Box<NDIM>& ghost_box = getGhostBox();
+    const Box<NDIM>& src_ghost_box = src.getGhostBox();
+    Box<NDIM> shifted_src_ghost_box(src_ghost_box);
+    shifted_src_ghost_box.shift(src_offset);
+
+    // Keep the nodes that lie outside of the destination boxes.
+    std::vector<bool> dst_cells(ghost_box.size(), false);
+    for (std::vector<Box<NDIM> >::const_iterator it = dst_boxes.begin(); it != dst_boxes.end(); ++it)
+    {
+        markCells(dst_cells, *it);
+    }
+    NodeBuffer buf;
+    appendNodesOutsideCells(buf, dst_cells);
+
+    // Copy the source nodes that lie in the destination boxes.  Cells that
+    // appear in more than one destination box are filled only once.
+    for (std::vector<Box<NDIM> >::const_iterator it = dst_boxes.begin(); it != dst_boxes.end(); ++it)
+    {
+        for (Box<NDIM>::Iterator b(*it * ghost_box * shifted_src_ghost_box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            const int cell_num = ghost_box.offset(i);
+            if (!dst_cells[cell_num]) continue;
+            dst_cells[cell_num] = false;
+            const int src_cell_num = src_ghost_box.offset(i - src_offset);
+            for (int k = src.d_cell_offsets[src_cell_num]; k < src.d_cell_offsets[src_cell_num + 1]; ++k)
+            {
+                src.appendNode(buf, k, cell_num);
+            }
+        }
+    }
+    buildFromNodeBuffer(buf);
+    return;
+} // copyNodes
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
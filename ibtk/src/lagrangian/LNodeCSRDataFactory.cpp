@@ -0,0 +1,133 @@
+// Filename: LNodeCSRDataFactory.cpp
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+
+#include "Box.h"
+#include "BoxGeometry.h"
+#include "CellGeometry.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "ibtk/LNodeCSRData.h"
+#include "ibtk/LNodeCSRDataFactory.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Arena.h"
+#include "tbox/ArenaManager.h"
+#include "tbox/Pointer.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LNodeCSRDataFactory::LNodeCSRDataFactory(const IntVector<NDIM>& ghosts) : PatchDataFactory<NDIM>(ghosts)
+{
+    // intentionally blank
+    return;
+} // LNodeCSRDataFactory
+
+LNodeCSRDataFactory::~LNodeCSRDataFactory()
+{
+    // intentionally blank
+    return;
+} // ~LNodeCSRDataFactory
+
+Pointer<PatchDataFactory<NDIM> >
+LNodeCSRDataFactory::cloneFactory(const IntVector<NDIM>& ghosts)
+{
+    return new LNodeCSRDataFactory(ghosts);
+} // cloneFactory
+
+Pointer<PatchData<NDIM> >
+LNodeCSRDataFactory::allocate(const Box<NDIM>& box, Pointer<Arena> pool) const
+{
+    if (!pool)
+    {
+        pool = ArenaManager::getManager()->getStandardAllocator();
+    }
+    PatchData<NDIM>* pd = new (pool) LNodeCSRData(box, getGhostCellWidth());
+    return Pointer<PatchData<NDIM> >(pd, pool);
+} // allocate
+
+Pointer<PatchData<NDIM> >
+LNodeCSRDataFactory::allocate(const Patch<NDIM>& patch, Pointer<Arena> pool) const
+{
+    return allocate(patch.getBox(), pool);
+} // allocate
+
+Pointer<BoxGeometry<NDIM> >
+LNodeCSRDataFactory::getBoxGeometry(const Box<NDIM>& box) const
+{
+    return new CellGeometry<NDIM>(box, getGhostCellWidth());
+} // getBoxGeometry
+
+size_t
+LNodeCSRDataFactory::getSizeOfMemory(const Box<NDIM>& /*box*/) const
+{
+    return Arena::align(sizeof(LNodeCSRData));
+} // getSizeOfMemory
+
+bool
+LNodeCSRDataFactory::fineBoundaryRepresentsVariable() const
+{
+    return true;
+} // fineBoundaryRepresentsVariable
+
+bool
+LNodeCSRDataFactory::dataLivesOnPatchBorder() const
+{
+    return false;
+} // dataLivesOnPatchBorder
+
+bool
+LNodeCSRDataFactory::validCopyTo(const Pointer<PatchDataFactory<NDIM> >& dst_pdf) const
+{
+    const Pointer<LNodeCSRDataFactory> lncsrdf = dst_pdf;
+    return lncsrdf;
+} // validCopyTo
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <pthread.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -51,6 +52,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LData.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/TimestepProfiler.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
 #include "petscao.h"
@@ -93,6 +95,24 @@ static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
 // Version of LSiloDataWriter restart file data.
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
 
+// Mutex used to serialize calls to the Silo library.
+static pthread_mutex_t s_silo_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// When plot data are aggregated, MPI processes are partitioned into groups of
+// contiguous ranks, and the first process in each group writes the data for
+// the entire group.
+inline int
+get_writer_group(const int proc, const int mpi_nodes, const int num_writers)
+{
+    return static_cast<int>((static_cast<long>(proc) * num_writers) / mpi_nodes);
+} // get_writer_group
+
+inline int
+get_group_writer(const int group, const int mpi_nodes, const int num_writers)
+{
+    return static_cast<int>((static_cast<long>(group) * mpi_nodes + num_writers - 1) / num_writers);
+} // get_group_writer
+
 #if defined(IBTK_HAVE_SILO)
 /*!
  * \brief Build a local mesh database entry corresponding to a cloud of marker
@@ -639,6 +659,47 @@ build_local_ucd_mesh(DBfile* dbfile,
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
+struct LSiloDataWriter::LocalPlotData
+{
+    // The layout of the local marker clouds, blocks, multiblocks, and
+    // unstructured meshes on each level.
+    std::vector<int> has_coords_data;
+    std::vector<std::vector<int> > cloud_nmarks;
+    std::vector<std::vector<IntVector<NDIM> > > block_nelems, block_periodic;
+    std::vector<std::vector<std::vector<IntVector<NDIM> > > > mb_nelems, mb_periodic;
+    std::vector<std::vector<std::set<int> > > ucd_mesh_vertices;
+    std::vector<std::vector<std::multimap<int, std::pair<int, int> > > > ucd_mesh_edge_maps;
+
+    // The local coordinate and variable data on each level.
+    std::vector<std::vector<double> > X_data;
+    std::vector<std::vector<std::vector<double> > > var_data;
+};
+
+struct LSiloDataWriter::PlotDataSnapshot
+{
+    // The time step data and output directories.
+    int time_step_number;
+    double simulation_time;
+    int mpi_rank, mpi_nodes;
+    std::string dump_dirname, current_dump_directory_name;
+
+    // The number of processes writing plot data (zero if each process writes
+    // its own data), the number of the file written by this process, and the
+    // local plot data of each process whose data are written by this process.
+    int num_writers;
+    int file_number;
+    std::vector<int> local_data_ranks;
+    std::vector<LocalPlotData> local_data;
+
+    // Data required by the root MPI process to create the multimesh and
+    // multivar objects.
+    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
+    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
+    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
+        ucd_mesh_names_per_proc;
+};
+
 LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
                                  const std::string& dump_directory_name,
                                  bool register_for_restart)
@@ -679,8 +740,19 @@ LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
       d_build_vec_scatters(d_finest_ln + 1),
       d_src_vec(d_finest_ln + 1),
       d_dst_vec(d_finest_ln + 1),
-      d_vec_scatter(d_finest_ln + 1)
+      d_vec_scatter(d_finest_ln + 1),
+      d_use_async_writes(false),
+      d_async_write_pending(false),
+      d_async_write_thread(),
+      d_snapshots(2),
+      d_next_snapshot(0),
+      d_pending_snapshot(-1),
+      d_num_writers(0),
+      d_writer_comm(MPI_COMM_NULL),
+      d_writer_comm_num_writers(0)
 {
+    d_snapshots[0] = new PlotDataSnapshot();
+    d_snapshots[1] = new PlotDataSnapshot();
 #if defined(IBTK_HAVE_SILO)
 // intentionally blank
 #else
@@ -702,6 +774,16 @@ LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
 
 LSiloDataWriter::~LSiloDataWriter()
 {
+    // Finish writing any data that is still being written in the background.
+    waitForPendingPlotData();
+    delete d_snapshots[0];
+    delete d_snapshots[1];
+
+    // Free the communicator used to aggregate plot data.
+    int mpi_finalized = 0;
+    MPI_Finalized(&mpi_finalized);
+    if (d_writer_comm != MPI_COMM_NULL && !mpi_finalized) MPI_Comm_free(&d_writer_comm);
+
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
@@ -755,6 +837,7 @@ LSiloDataWriter::resetLevels(const int coarsest_ln, const int finest_ln)
         TBOX_ASSERT(finest_ln <= d_hierarchy->getFinestLevelNumber());
     }
 #endif
+    waitForPendingPlotData();
     // Destroy any unneeded PETSc objects.
     int ierr;
     for (int ln = std::max(d_coarsest_ln, 0); (ln <= d_finest_ln) && (ln < coarsest_ln); ++ln)
@@ -851,6 +934,7 @@ LSiloDataWriter::registerMarkerCloud(const std::string& name,
                                      const int first_lag_idx,
                                      const int level_number)
 {
+    waitForPendingPlotData();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -917,6 +1001,7 @@ LSiloDataWriter::registerLogicallyCartesianBlock(const std::string& name,
                                                  const int first_lag_idx,
                                                  const int level_number)
 {
+    waitForPendingPlotData();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -989,6 +1074,7 @@ LSiloDataWriter::registerLogicallyCartesianMultiblock(const std::string& name,
                                                       const std::vector<int>& first_lag_idx,
                                                       const int level_number)
 {
+    waitForPendingPlotData();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1068,6 +1154,7 @@ LSiloDataWriter::registerUnstructuredMesh(const std::string& name,
                                           const std::multimap<int, std::pair<int, int> >& edge_map,
                                           const int level_number)
 {
+    waitForPendingPlotData();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1139,6 +1226,7 @@ LSiloDataWriter::registerUnstructuredMesh(const std::string& name,
 void
 LSiloDataWriter::registerCoordsData(Pointer<LData> coords_data, const int level_number)
 {
+    waitForPendingPlotData();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1155,6 +1243,7 @@ LSiloDataWriter::registerCoordsData(Pointer<LData> coords_data, const int level_
 void
 LSiloDataWriter::registerVariableData(const std::string& var_name, Pointer<LData> var_data, const int level_number)
 {
+    waitForPendingPlotData();
     const int start_depth = 0;
     const int var_depth = var_data->getDepth();
     registerVariableData(var_name, var_data, start_depth, var_depth, level_number);
@@ -1168,6 +1257,7 @@ LSiloDataWriter::registerVariableData(const std::string& var_name,
                                       const int var_depth,
                                       const int level_number)
 {
+    waitForPendingPlotData();
     if (level_number < d_coarsest_ln || level_number > d_finest_ln)
     {
         resetLevels(std::min(level_number, d_coarsest_ln), std::max(level_number, d_finest_ln));
@@ -1270,10 +1360,11 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                                  << std::endl);
     }
 
+    TimestepProfiler* profiler = TimestepProfiler::getProfiler();
+    profiler->startPhase(PROFILE_IO);
+
     int ierr;
     char temp_buf[SILO_NAME_BUFSIZE];
-    std::string current_file_name;
-    DBfile* dbfile;
     const int mpi_rank = SAMRAI_MPI::getRank();
     const int mpi_nodes = SAMRAI_MPI::getNodes();
 
@@ -1294,267 +1385,95 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    sprintf(temp_buf, "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+    // Stage the data in the snapshot that is not currently being written.
+    PlotDataSnapshot& snapshot = *d_snapshots[d_next_snapshot];
+    snapshot.time_step_number = time_step_number;
+    snapshot.simulation_time = simulation_time;
+    snapshot.mpi_rank = mpi_rank;
+    snapshot.mpi_nodes = mpi_nodes;
+    snapshot.dump_dirname = dump_dirname;
+    snapshot.current_dump_directory_name = current_dump_directory_name;
+    snapshot.num_writers = 0;
+    snapshot.file_number = mpi_rank;
+    snapshot.local_data_ranks.assign(1, mpi_rank);
+    snapshot.local_data.resize(1);
+    LocalPlotData& local_data = snapshot.local_data[0];
+    local_data.has_coords_data.assign(d_finest_ln + 1, 0);
+    local_data.cloud_nmarks = d_cloud_nmarks;
+    local_data.block_nelems = d_block_nelems;
+    local_data.block_periodic = d_block_periodic;
+    local_data.mb_nelems = d_mb_nelems;
+    local_data.mb_periodic = d_mb_periodic;
+    local_data.ucd_mesh_vertices = d_ucd_mesh_vertices;
+    local_data.ucd_mesh_edge_maps = d_ucd_mesh_edge_maps;
+    local_data.X_data.resize(d_finest_ln + 1);
+    local_data.var_data.resize(d_finest_ln + 1);
+
+    // Scatter the data from "global" to "local" form and copy it into the
+    // staging buffers of the snapshot.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named "
-                                 << current_file_name
-                                 << std::endl);
-    }
+        if (!d_coords_data[ln]) continue;
+        local_data.has_coords_data[ln] = 1;
 
-    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
-    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
+        Vec local_X_vec;
+        ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
+        IBTK_CHKERRQ(ierr);
 
-    // Set the local data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        if (d_coords_data[ln])
+        Vec global_X_vec = d_coords_data[ln]->getVec();
+        ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+        IBTK_CHKERRQ(ierr);
+        copyVecToBuffer(local_X_vec, local_data.X_data[ln]);
+        ierr = VecDestroy(&local_X_vec);
+        IBTK_CHKERRQ(ierr);
+
+        local_data.var_data[ln].resize(d_nvars[ln]);
+        for (int v = 0; v < d_nvars[ln]; ++v)
         {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
+            const int var_depth = d_var_depths[ln][v];
+            Vec local_v_vec;
+            ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
             IBTK_CHKERRQ(ierr);
 
-            Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            Vec global_v_vec = d_var_data[ln][v]->getVec();
+            ierr = VecScatterBegin(
+                d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            ierr =
+                VecScatterEnd(d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
+            copyVecToBuffer(local_v_vec, local_data.var_data[ln][v]);
+            ierr = VecDestroy(&local_v_vec);
             IBTK_CHKERRQ(ierr);
+        }
+    }
 
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
-
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
-
-                Vec global_v_vec = d_var_data[ln][v]->getVec();
-                ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
-
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
-            }
-
-            // Keep track of the current offset in the local Vec data.
-            int offset = 0;
-
-            // Add the local clouds to the local DBfile.
-            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-            {
-                const int nmarks = d_cloud_nmarks[ln][cloud];
-
-                std::ostringstream stream;
-                stream << "level_" << ln << "_cloud_" << cloud;
-                std::string dirname = stream.str();
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
-
-                offset += nmarks;
-            }
-
-            // Add the local blocks to the local DBfile.
-            for (int block = 0; block < d_nblocks[ln]; ++block)
-            {
-                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
-                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
-                const int ntot = nelem.getProduct();
-
-                std::ostringstream stream;
-                stream << "level_" << ln << "_block_" << block;
-                std::string dirname = stream.str();
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
-                meshtype[ln].push_back(DB_QUAD_CURV);
-                vartype[ln].push_back(DB_QUADVAR);
-
-                offset += ntot;
-            }
-
-            // Add the local multiblocks to the local DBfile.
-            multimeshtype[ln].resize(d_nmbs[ln]);
-            multivartype[ln].resize(d_nmbs[ln]);
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-            {
-                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
-                {
-                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
-                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
-                    const int ntot = nelem.getProduct();
-
-                    std::ostringstream stream;
-                    stream << "level_" << ln << "_mb_" << mb << "_block_" << block;
-                    std::string dirname = stream.str();
-
-                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << dirname
-                                                 << std::endl);
-                    }
-
-                    const double* const X = local_X_arr + NDIM * offset;
-                    std::vector<const double*> var_vals(d_nvars[ln]);
-                    for (int v = 0; v < d_nvars[ln]; ++v)
-                    {
-                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                    }
-
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
-                    multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
-                    multivartype[ln][mb].push_back(DB_QUADVAR);
-
-                    offset += ntot;
-                }
-            }
-
-            // Add the local UCD meshes to the local DBfile.
-            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-            {
-                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
-                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
-                const size_t ntot = vertices.size();
-
-                std::ostringstream stream;
-                stream << "level_" << ln << "_mesh_" << mesh;
-                std::string dirname = stream.str();
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named "
-                                             << dirname
-                                             << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
-
-                offset += ntot;
-            }
+    // Funnel the local plot data to the writer processes.
+    const int num_writers = d_num_writers > 0 && d_num_writers < mpi_nodes ? d_num_writers : 0;
+    if (num_writers > 0)
+    {
+        aggregateLocalPlotData(snapshot, num_writers);
+    }
 
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
-            IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
-            IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
-            }
+    // Determine the types of the local meshes and variables.
+    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
+    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        if (!d_coords_data[ln]) continue;
+        meshtype[ln].resize(d_nblocks[ln], DB_QUAD_CURV);
+        vartype[ln].resize(d_nblocks[ln], DB_QUADVAR);
+        multimeshtype[ln].resize(d_nmbs[ln]);
+        multivartype[ln].resize(d_nmbs[ln]);
+        for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+        {
+            multimeshtype[ln][mb].resize(d_mb_nblocks[ln][mb], DB_QUAD_CURV);
+            multivartype[ln][mb].resize(d_mb_nblocks[ln][mb], DB_QUADVAR);
         }
     }
 
-    DBClose(dbfile);
-
     // Send data to the root MPI process required to create the multimesh and
     // multivar objects.
     std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
@@ -1813,94 +1732,629 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
             SAMRAI_MPI::barrier();
         }
     }
-
-    if (mpi_rank == SILO_MPI_ROOT)
-    {
-        // Create and initialize the multimesh Silo database on the root MPI
-        // process.
-        sprintf(temp_buf, "%06d", d_time_step_number);
-        std::string summary_file_name =
-            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+    snapshot.nclouds_per_proc.swap(nclouds_per_proc);
+    snapshot.nblocks_per_proc.swap(nblocks_per_proc);
+    snapshot.nmbs_per_proc.swap(nmbs_per_proc);
+    snapshot.nucd_meshes_per_proc.swap(nucd_meshes_per_proc);
+    snapshot.meshtypes_per_proc.swap(meshtypes_per_proc);
+    snapshot.vartypes_per_proc.swap(vartypes_per_proc);
+    snapshot.mb_nblocks_per_proc.swap(mb_nblocks_per_proc);
+    snapshot.multimeshtypes_per_proc.swap(multimeshtypes_per_proc);
+    snapshot.multivartypes_per_proc.swap(multivartypes_per_proc);
+    snapshot.cloud_names_per_proc.swap(cloud_names_per_proc);
+    snapshot.block_names_per_proc.swap(block_names_per_proc);
+    snapshot.mb_names_per_proc.swap(mb_names_per_proc);
+    snapshot.ucd_mesh_names_per_proc.swap(ucd_mesh_names_per_proc);
+
+    // Write the snapshot, either in the background or immediately.
+    waitForPendingPlotData();
+    if (d_use_async_writes)
+    {
+        d_pending_snapshot = d_next_snapshot;
+        d_next_snapshot = (d_next_snapshot + 1) % 2;
+        if (pthread_create(&d_async_write_thread, NULL, LSiloDataWriter::writeSnapshotThread, this) != 0)
         {
             TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                     << "  Could not create DBfile named "
-                                     << summary_file_name
+                                     << "  Could not create background I/O thread"
                                      << std::endl);
         }
+        d_async_write_pending = true;
+    }
+    else
+    {
+        writeSnapshot(snapshot);
+        SAMRAI_MPI::barrier();
+    }
+    profiler->stopPhase(PROFILE_IO);
+#else
+    TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
+#endif // if defined(IBTK_HAVE_SILO)
+    return;
+} // writePlotData
 
-        int cycle = time_step_number;
-        float time = float(simulation_time);
-        double dtime = simulation_time;
+void
+LSiloDataWriter::setUseAsynchronousWrites(const bool use_async_writes)
+{
+    waitForPendingPlotData();
+    d_use_async_writes = use_async_writes;
+    return;
+} // setUseAsynchronousWrites
 
-        static const int MAX_OPTS = 3;
-        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
-        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
-        DBAddOption(optlist, DBOPT_TIME, &time);
-        DBAddOption(optlist, DBOPT_DTIME, &dtime);
+void
+LSiloDataWriter::setNumberOfWriterProcesses(const int num_writers)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_writers >= 0);
+#endif
+    waitForPendingPlotData();
+    d_num_writers = num_writers;
+    return;
+} // setNumberOfWriterProcesses
 
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-            {
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+void
+LSiloDataWriter::waitForPendingPlotData()
+{
+    if (!d_async_write_pending) return;
+    if (pthread_join(d_async_write_thread, NULL) != 0)
+    {
+        TBOX_ERROR(d_object_name << "::waitForPendingPlotData()\n"
+                                 << "  Could not join background I/O thread"
+                                 << std::endl);
+    }
+    d_async_write_pending = false;
+    return;
+} // waitForPendingPlotData
 
-                    std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_cloud_" << cloud << "/mesh";
-                    std::string meshname = stream.str();
-                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_POINTMESH;
+void
+LSiloDataWriter::lockSiloLibrary()
+{
+    pthread_mutex_lock(&s_silo_mutex);
+    return;
+} // lockSiloLibrary
 
-                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
+void
+LSiloDataWriter::unlockSiloLibrary()
+{
+    pthread_mutex_unlock(&s_silo_mutex);
+    return;
+} // unlockSiloLibrary
 
-                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+void
+LSiloDataWriter::putToDatabase(Pointer<Database> db)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    db->putInteger("LAG_SILO_DATA_WRITER_VERSION", LAG_SILO_DATA_WRITER_VERSION);
 
-                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << cloud_name
-                                                 << std::endl);
-                    }
-                }
+    db->putInteger("d_coarsest_ln", d_coarsest_ln);
+    db->putInteger("d_finest_ln", d_finest_ln);
 
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        std::ostringstream ln_stream;
+        ln_stream << "_" << ln;
+        const std::string ln_string = ln_stream.str();
 
-                    std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_block_" << block << "/mesh";
-                    std::string meshname = stream.str();
-                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = meshtypes_per_proc[ln][proc][block];
+        db->putInteger("d_nclouds" + ln_string, d_nclouds[ln]);
+        if (d_nclouds[ln] > 0)
+        {
+            db->putStringArray(
+                "d_cloud_names" + ln_string, &d_cloud_names[ln][0], static_cast<int>(d_cloud_names[ln].size()));
+            db->putIntegerArray(
+                "d_cloud_nmarks" + ln_string, &d_cloud_nmarks[ln][0], static_cast<int>(d_cloud_nmarks[ln].size()));
+            db->putIntegerArray("d_cloud_first_lag_idx" + ln_string,
+                                &d_cloud_first_lag_idx[ln][0],
+                                static_cast<int>(d_cloud_first_lag_idx[ln].size()));
+        }
 
-                    std::string& block_name = block_names_per_proc[ln][proc][block];
+        db->putInteger("d_nblocks" + ln_string, d_nblocks[ln]);
+        if (d_nblocks[ln] > 0)
+        {
+            db->putStringArray(
+                "d_block_names" + ln_string, &d_block_names[ln][0], static_cast<int>(d_block_names[ln].size()));
 
-                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+            std::vector<int> flattened_block_nelems;
+            flattened_block_nelems.reserve(NDIM * d_block_nelems.size());
+            for (std::vector<IntVector<NDIM> >::const_iterator cit = d_block_nelems[ln].begin();
+                 cit != d_block_nelems[ln].end();
+                 ++cit)
+            {
+                flattened_block_nelems.insert(flattened_block_nelems.end(), &(*cit)[0], &(*cit)[0] + NDIM);
+            }
+            db->putIntegerArray("flattened_block_nelems" + ln_string,
+                                &flattened_block_nelems[0],
+                                static_cast<int>(flattened_block_nelems.size()));
 
-                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named "
-                                                 << block_name
-                                                 << std::endl);
-                    }
-                }
+            std::vector<int> flattened_block_periodic;
+            flattened_block_periodic.reserve(NDIM * d_block_periodic.size());
+            for (std::vector<IntVector<NDIM> >::const_iterator cit = d_block_periodic[ln].begin();
+                 cit != d_block_periodic[ln].end();
+                 ++cit)
+            {
+                flattened_block_periodic.insert(flattened_block_periodic.end(), &(*cit)[0], &(*cit)[0] + NDIM);
+            }
+            db->putIntegerArray("flattened_block_periodic" + ln_string,
+                                &flattened_block_periodic[0],
+                                static_cast<int>(flattened_block_periodic.size()));
 
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
+            db->putIntegerArray("d_block_first_lag_idx" + ln_string,
+                                &d_block_first_lag_idx[ln][0],
+                                static_cast<int>(d_block_first_lag_idx[ln].size()));
+        }
+
+        db->putInteger("d_nmbs" + ln_string, d_nmbs[ln]);
+        if (d_nmbs[ln] > 0)
+        {
+            db->putStringArray("d_mb_names" + ln_string, &d_mb_names[ln][0], static_cast<int>(d_mb_names[ln].size()));
+
+            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
+            {
+                std::ostringstream mb_stream;
+                mb_stream << "_" << mb;
+                const std::string mb_string = mb_stream.str();
+
+                db->putInteger("d_mb_nblocks" + ln_string + mb_string, d_mb_nblocks[ln][mb]);
+                if (d_mb_nblocks[ln][mb] > 0)
+                {
+                    std::vector<int> flattened_mb_nelems;
+                    flattened_mb_nelems.reserve(NDIM * d_mb_nelems.size());
+                    for (std::vector<IntVector<NDIM> >::const_iterator cit = d_mb_nelems[ln][mb].begin();
+                         cit != d_mb_nelems[ln][mb].end();
+                         ++cit)
+                    {
+                        flattened_mb_nelems.insert(flattened_mb_nelems.end(), &(*cit)[0], &(*cit)[0] + NDIM);
+                    }
+                    db->putIntegerArray("flattened_mb_nelems" + ln_string + mb_string,
+                                        &flattened_mb_nelems[0],
+                                        static_cast<int>(flattened_mb_nelems.size()));
+
+                    std::vector<int> flattened_mb_periodic;
+                    flattened_mb_periodic.reserve(NDIM * d_mb_periodic.size());
+                    for (std::vector<IntVector<NDIM> >::const_iterator cit = d_mb_periodic[ln][mb].begin();
+                         cit != d_mb_periodic[ln][mb].end();
+                         ++cit)
+                    {
+                        flattened_mb_periodic.insert(flattened_mb_periodic.end(), &(*cit)[0], &(*cit)[0] + NDIM);
+                    }
+                    db->putIntegerArray("flattened_mb_periodic" + ln_string + mb_string,
+                                        &flattened_mb_periodic[0],
+                                        static_cast<int>(flattened_mb_periodic.size()));
+
+                    db->putIntegerArray("d_mb_first_lag_idx" + ln_string + mb_string,
+                                        &d_mb_first_lag_idx[ln][mb][0],
+                                        static_cast<int>(d_mb_first_lag_idx[ln][mb].size()));
+                }
+            }
+        }
+
+        db->putInteger("d_nucd_meshes" + ln_string, d_nucd_meshes[ln]);
+        if (d_nucd_meshes[ln] > 0)
+        {
+            db->putStringArray("d_ucd_mesh_names" + ln_string,
+                               &d_ucd_mesh_names[ln][0],
+                               static_cast<int>(d_ucd_mesh_names[ln].size()));
+
+            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+            {
+                std::ostringstream mesh_stream;
+                mesh_stream << "_" << mesh;
+                const std::string mesh_string = mesh_stream.str();
+
+                std::vector<int> ucd_mesh_vertices_vector;
+                ucd_mesh_vertices_vector.reserve(d_ucd_mesh_vertices[ln][mesh].size());
+                for (std::set<int>::const_iterator cit = d_ucd_mesh_vertices[ln][mesh].begin();
+                     cit != d_ucd_mesh_vertices[ln][mesh].end();
+                     ++cit)
+                {
+                    ucd_mesh_vertices_vector.push_back(*cit);
+                }
+                db->putInteger("ucd_mesh_vertices_vector.size()" + ln_string + mesh_string,
+                               static_cast<int>(ucd_mesh_vertices_vector.size()));
+                db->putIntegerArray("ucd_mesh_vertices_vector" + ln_string + mesh_string,
+                                    &ucd_mesh_vertices_vector[0],
+                                    static_cast<int>(ucd_mesh_vertices_vector.size()));
+
+                std::vector<int> ucd_mesh_edge_maps_vector;
+                ucd_mesh_edge_maps_vector.reserve(3 * d_ucd_mesh_edge_maps[ln][mesh].size());
+                for (std::multimap<int, std::pair<int, int> >::const_iterator cit =
+                         d_ucd_mesh_edge_maps[ln][mesh].begin();
+                     cit != d_ucd_mesh_edge_maps[ln][mesh].end();
+                     ++cit)
+                {
+                    const int i = cit->first;
+                    std::pair<int, int> e = cit->second;
+                    ucd_mesh_edge_maps_vector.push_back(i);
+                    ucd_mesh_edge_maps_vector.push_back(e.first);
+                    ucd_mesh_edge_maps_vector.push_back(e.second);
+                }
+                db->putInteger("ucd_mesh_edge_maps_vector.size()" + ln_string + mesh_string,
+                               static_cast<int>(ucd_mesh_edge_maps_vector.size()));
+                db->putIntegerArray("ucd_mesh_edge_maps_vector" + ln_string + mesh_string,
+                                    &ucd_mesh_edge_maps_vector[0],
+                                    static_cast<int>(ucd_mesh_edge_maps_vector.size()));
+            }
+        }
+    }
+    return;
+} // putToDatabase
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+LSiloDataWriter::copyVecToBuffer(Vec v, std::vector<double>& buffer)
+{
+    int ierr;
+    PetscInt local_size;
+    ierr = VecGetLocalSize(v, &local_size);
+    IBTK_CHKERRQ(ierr);
+    const double* v_arr;
+    ierr = VecGetArrayRead(v, &v_arr);
+    IBTK_CHKERRQ(ierr);
+    buffer.assign(v_arr, v_arr + local_size);
+    ierr = VecRestoreArrayRead(v, &v_arr);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // copyVecToBuffer
+
+void*
+LSiloDataWriter::writeSnapshotThread(void* writer)
+{
+    LSiloDataWriter* const silo_writer = static_cast<LSiloDataWriter*>(writer);
+    silo_writer->writeSnapshot(*silo_writer->d_snapshots[silo_writer->d_pending_snapshot]);
+    return NULL;
+} // writeSnapshotThread
+
+void
+LSiloDataWriter::writeSnapshot(PlotDataSnapshot& snapshot)
+{
+#if defined(IBTK_HAVE_SILO)
+    // The Silo library is not thread safe, so only one snapshot is written at a
+    // time, even across multiple data writers.
+    lockSiloLibrary();
+
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::string current_file_name;
+    DBfile* dbfile;
+    const int time_step_number = snapshot.time_step_number;
+    const double simulation_time = snapshot.simulation_time;
+    const int mpi_rank = snapshot.mpi_rank;
+    const int mpi_nodes = snapshot.mpi_nodes;
+    const std::string& dump_dirname = snapshot.dump_dirname;
+    const std::string& current_dump_directory_name = snapshot.current_dump_directory_name;
+
+    // Create one local DBfile per writer process.  When the plot data of
+    // several processes are written to the same file, the data of each process
+    // are stored in a separate directory.
+    if (!snapshot.local_data.empty())
+    {
+        sprintf(temp_buf, "%04d", snapshot.file_number);
+        current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
+        current_file_name += temp_buf;
+        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+
+        if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+        {
+            TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                     << "  Could not create DBfile named "
+                                     << current_file_name
+                                     << std::endl);
+        }
+
+        for (unsigned int k = 0; k < snapshot.local_data.size(); ++k)
+        {
+            const LocalPlotData& data = snapshot.local_data[k];
+            std::string proc_dirname;
+            if (snapshot.num_writers > 0)
+            {
+                sprintf(temp_buf, "%04d", snapshot.local_data_ranks[k]);
+                proc_dirname = std::string("proc_") + temp_buf;
+                if (DBMkDir(dbfile, proc_dirname.c_str()) == -1 || DBSetDir(dbfile, proc_dirname.c_str()) == -1)
+                {
+                    TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                             << "  Could not create directory named "
+                                             << proc_dirname
+                                             << std::endl);
+                }
+            }
+
+            // Set the local data.
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+            {
+                if (data.has_coords_data[ln])
+                {
+                    const double* const local_X_arr = data.X_data[ln].empty() ? NULL : &data.X_data[ln][0];
+                    std::vector<const double*> local_v_arrs(d_nvars[ln]);
+                    for (int v = 0; v < d_nvars[ln]; ++v)
+                    {
+                        local_v_arrs[v] = data.var_data[ln][v].empty() ? NULL : &data.var_data[ln][v][0];
+                    }
+
+                    // Keep track of the current offset in the local Vec data.
+                    int offset = 0;
+
+                    // Add the local clouds to the local DBfile.
+                    for (int cloud = 0; cloud < static_cast<int>(data.cloud_nmarks[ln].size()); ++cloud)
+                    {
+                        const int nmarks = data.cloud_nmarks[ln][cloud];
+
+                        std::ostringstream stream;
+                        stream << "level_" << ln << "_cloud_" << cloud;
+                        std::string dirname = stream.str();
+
+                        if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                        {
+                            TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                                     << "  Could not create directory named "
+                                                     << dirname
+                                                     << std::endl);
+                        }
+
+                        const double* const X = local_X_arr + NDIM * offset;
+                        std::vector<const double*> var_vals(d_nvars[ln]);
+                        for (int v = 0; v < d_nvars[ln]; ++v)
+                        {
+                            var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                        }
+
+                        build_local_marker_cloud(dbfile,
+                                                 dirname,
+                                                 nmarks,
+                                                 X,
+                                                 d_nvars[ln],
+                                                 d_var_names[ln],
+                                                 d_var_start_depths[ln],
+                                                 d_var_plot_depths[ln],
+                                                 d_var_depths[ln],
+                                                 var_vals,
+                                                 snapshot.time_step_number,
+                                                 snapshot.simulation_time);
+
+                        offset += nmarks;
+                    }
+
+                    // Add the local blocks to the local DBfile.
+                    for (int block = 0; block < static_cast<int>(data.block_nelems[ln].size()); ++block)
+                    {
+                        const IntVector<NDIM>& nelem = data.block_nelems[ln][block];
+                        const IntVector<NDIM>& periodic = data.block_periodic[ln][block];
+                        const int ntot = nelem.getProduct();
+
+                        std::ostringstream stream;
+                        stream << "level_" << ln << "_block_" << block;
+                        std::string dirname = stream.str();
+
+                        if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                        {
+                            TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                                     << "  Could not create directory named "
+                                                     << dirname
+                                                     << std::endl);
+                        }
+
+                        const double* const X = local_X_arr + NDIM * offset;
+                        std::vector<const double*> var_vals(d_nvars[ln]);
+                        for (int v = 0; v < d_nvars[ln]; ++v)
+                        {
+                            var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                        }
+
+                        build_local_curv_block(dbfile,
+                                               dirname,
+                                               nelem,
+                                               periodic,
+                                               X,
+                                               d_nvars[ln],
+                                               d_var_names[ln],
+                                               d_var_start_depths[ln],
+                                               d_var_plot_depths[ln],
+                                               d_var_depths[ln],
+                                               var_vals,
+                                               snapshot.time_step_number,
+                                               snapshot.simulation_time);
+
+                        offset += ntot;
+                    }
+
+                    // Add the local multiblocks to the local DBfile.
+                    for (int mb = 0; mb < static_cast<int>(data.mb_nelems[ln].size()); ++mb)
+                    {
+                        for (int block = 0; block < static_cast<int>(data.mb_nelems[ln][mb].size()); ++block)
+                        {
+                            const IntVector<NDIM>& nelem = data.mb_nelems[ln][mb][block];
+                            const IntVector<NDIM>& periodic = data.mb_periodic[ln][mb][block];
+                            const int ntot = nelem.getProduct();
+
+                            std::ostringstream stream;
+                            stream << "level_" << ln << "_mb_" << mb << "_block_" << block;
+                            std::string dirname = stream.str();
+
+                            if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                            {
+                                TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                                         << "  Could not create directory named "
+                                                         << dirname
+                                                         << std::endl);
+                            }
+
+                            const double* const X = local_X_arr + NDIM * offset;
+                            std::vector<const double*> var_vals(d_nvars[ln]);
+                            for (int v = 0; v < d_nvars[ln]; ++v)
+                            {
+                                var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                            }
+
+                            build_local_curv_block(dbfile,
+                                                   dirname,
+                                                   nelem,
+                                                   periodic,
+                                                   X,
+                                                   d_nvars[ln],
+                                                   d_var_names[ln],
+                                                   d_var_start_depths[ln],
+                                                   d_var_plot_depths[ln],
+                                                   d_var_depths[ln],
+                                                   var_vals,
+                                                   snapshot.time_step_number,
+                                                   snapshot.simulation_time);
+
+                            offset += ntot;
+                        }
+                    }
+
+                    // Add the local UCD meshes to the local DBfile.
+                    for (int mesh = 0; mesh < static_cast<int>(data.ucd_mesh_vertices[ln].size()); ++mesh)
+                    {
+                        const std::set<int>& vertices = data.ucd_mesh_vertices[ln][mesh];
+                        const std::multimap<int, std::pair<int, int> >& edge_map = data.ucd_mesh_edge_maps[ln][mesh];
+                        const size_t ntot = vertices.size();
+
+                        std::ostringstream stream;
+                        stream << "level_" << ln << "_mesh_" << mesh;
+                        std::string dirname = stream.str();
+
+                        if (DBMkDir(dbfile, dirname.c_str()) == -1)
+                        {
+                            TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                                     << "  Could not create directory named "
+                                                     << dirname
+                                                     << std::endl);
+                        }
+
+                        const double* const X = local_X_arr + NDIM * offset;
+                        std::vector<const double*> var_vals(d_nvars[ln]);
+                        for (int v = 0; v < d_nvars[ln]; ++v)
+                        {
+                            var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
+                        }
+
+                        build_local_ucd_mesh(dbfile,
+                                             dirname,
+                                             vertices,
+                                             edge_map,
+                                             X,
+                                             d_nvars[ln],
+                                             d_var_names[ln],
+                                             d_var_start_depths[ln],
+                                             d_var_plot_depths[ln],
+                                             d_var_depths[ln],
+                                             var_vals,
+                                             snapshot.time_step_number,
+                                             snapshot.simulation_time);
+
+                        offset += ntot;
+                    }
+                }
+            }
+
+            if (snapshot.num_writers > 0 && DBSetDir(dbfile, "..") == -1)
+            {
+                TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                         << "  Could not return to parent directory of "
+                                         << proc_dirname
+                                         << std::endl);
+            }
+        }
+
+        DBClose(dbfile);
+    }
+
+    // Create the multimesh and multivar objects on the root MPI process.
+    std::vector<std::vector<int> >& nclouds_per_proc = snapshot.nclouds_per_proc;
+    std::vector<std::vector<int> >& nblocks_per_proc = snapshot.nblocks_per_proc;
+    std::vector<std::vector<int> >& nmbs_per_proc = snapshot.nmbs_per_proc;
+    std::vector<std::vector<int> >& nucd_meshes_per_proc = snapshot.nucd_meshes_per_proc;
+    std::vector<std::vector<std::vector<int> > >& meshtypes_per_proc = snapshot.meshtypes_per_proc;
+    std::vector<std::vector<std::vector<int> > >& vartypes_per_proc = snapshot.vartypes_per_proc;
+    std::vector<std::vector<std::vector<int> > >& mb_nblocks_per_proc = snapshot.mb_nblocks_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > >& multimeshtypes_per_proc =
+        snapshot.multimeshtypes_per_proc;
+    std::vector<std::vector<std::vector<std::vector<int> > > >& multivartypes_per_proc =
+        snapshot.multivartypes_per_proc;
+    std::vector<std::vector<std::vector<std::string> > >& cloud_names_per_proc = snapshot.cloud_names_per_proc;
+    std::vector<std::vector<std::vector<std::string> > >& block_names_per_proc = snapshot.block_names_per_proc;
+    std::vector<std::vector<std::vector<std::string> > >& mb_names_per_proc = snapshot.mb_names_per_proc;
+    std::vector<std::vector<std::vector<std::string> > >& ucd_mesh_names_per_proc = snapshot.ucd_mesh_names_per_proc;
+    if (mpi_rank == SILO_MPI_ROOT)
+    {
+        // Create and initialize the multimesh Silo database on the root MPI
+        // process.
+        sprintf(temp_buf, "%06d", time_step_number);
+        std::string summary_file_name =
+            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
+        {
+            TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                     << "  Could not create DBfile named "
+                                     << summary_file_name
+                                     << std::endl);
+        }
+
+        int cycle = time_step_number;
+        float time = float(simulation_time);
+        double dtime = simulation_time;
+
+        static const int MAX_OPTS = 3;
+        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
+        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
+        DBAddOption(optlist, DBOPT_TIME, &time);
+        DBAddOption(optlist, DBOPT_DTIME, &dtime);
+
+        for (int proc = 0; proc < mpi_nodes; ++proc)
+        {
+            for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+            {
+                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
+                {
+                    current_file_name = getMeshPathPrefix(proc, mpi_nodes, snapshot.num_writers);
+
+                    std::ostringstream stream;
+                    stream << current_file_name << "level_" << ln << "_cloud_" << cloud << "/mesh";
+                    std::string meshname = stream.str();
+                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
+                    int meshtype = DB_POINTMESH;
+
+                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
+
+                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
+                    {
+                        TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                                 << "  Could not create directory named "
+                                                 << cloud_name
+                                                 << std::endl);
+                    }
+                }
+
+                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                 {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                    current_file_name = getMeshPathPrefix(proc, mpi_nodes, snapshot.num_writers);
+
+                    std::ostringstream stream;
+                    stream << current_file_name << "level_" << ln << "_block_" << block << "/mesh";
+                    std::string meshname = stream.str();
+                    char* meshname_ptr = const_cast<char*>(meshname.c_str());
+                    int meshtype = meshtypes_per_proc[ln][proc][block];
+
+                    std::string& block_name = block_names_per_proc[ln][proc][block];
+
+                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+
+                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
+                    {
+                        TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
+                                                 << "  Could not create directory named "
+                                                 << block_name
+                                                 << std::endl);
+                    }
+                }
+
+                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
+                {
+                    current_file_name = getMeshPathPrefix(proc, mpi_nodes, snapshot.num_writers);
 
                     const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
                     char** meshnames = new char*[nblocks];
@@ -1908,7 +2362,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                     for (int block = 0; block < nblocks; ++block)
                     {
                         std::ostringstream stream;
-                        stream << current_file_name << ":level_" << ln << "_mb_" << mb << "_block_" << block << "/mesh";
+                        stream << current_file_name << "level_" << ln << "_mb_" << mb << "_block_" << block << "/mesh";
                         meshnames[block] = strdup(stream.str().c_str());
                     }
 
@@ -1923,7 +2377,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     if (DBMkDir(dbfile, mb_name.c_str()) == -1)
                     {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                        TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
                                                  << "  Could not create directory named "
                                                  << mb_name
                                                  << std::endl);
@@ -1938,13 +2392,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                 for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                 {
-                    sprintf(temp_buf, "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                    current_file_name = getMeshPathPrefix(proc, mpi_nodes, snapshot.num_writers);
 
                     std::ostringstream stream;
-                    stream << current_file_name << ":level_" << ln << "_mesh_" << mesh << "/mesh";
+                    stream << current_file_name << "level_" << ln << "_mesh_" << mesh << "/mesh";
                     std::string meshname = stream.str();
                     char* meshname_ptr = const_cast<char*>(meshname.c_str());
                     int meshtype = DB_UCDMESH;
@@ -1955,7 +2406,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
                     {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
+                        TBOX_ERROR(d_object_name << "::writeSnapshot()\n"
                                                  << "  Could not create directory named "
                                                  << mesh_name
                                                  << std::endl);
@@ -1966,13 +2417,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                 {
                     for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
                     {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        current_file_name = getMeshPathPrefix(proc, mpi_nodes, snapshot.num_writers);
 
                         std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_cloud_" << cloud << "/"
+                        varname_stream << current_file_name << "level_" << ln << "_cloud_" << cloud << "/"
                                        << d_var_names[ln][v];
                         std::string varname = varname_stream.str();
                         char* varname_ptr = const_cast<char*>(varname.c_str());
@@ -1989,13 +2437,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
                     {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        current_file_name = getMeshPathPrefix(proc, mpi_nodes, snapshot.num_writers);
 
                         std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_block_" << block << "/"
+                        varname_stream << current_file_name << "level_" << ln << "_block_" << block << "/"
                                        << d_var_names[ln][v];
                         std::string varname = varname_stream.str();
                         char* varname_ptr = const_cast<char*>(varname.c_str());
@@ -2012,10 +2457,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
                     {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        current_file_name = getMeshPathPrefix(proc, mpi_nodes, snapshot.num_writers);
 
                         const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
                         char** varnames = new char*[nblocks];
@@ -2023,7 +2465,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                         for (int block = 0; block < nblocks; ++block)
                         {
                             std::ostringstream varname_stream;
-                            varname_stream << current_file_name << ":level_" << ln << "_mb_" << mb << "_block_" << block
+                            varname_stream << current_file_name << "level_" << ln << "_mb_" << mb << "_block_" << block
                                            << d_var_names[ln][v];
                             varnames[block] = strdup(varname_stream.str().c_str());
                         }
@@ -2050,13 +2492,10 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
                     for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
                     {
-                        sprintf(temp_buf, "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
+                        current_file_name = getMeshPathPrefix(proc, mpi_nodes, snapshot.num_writers);
 
                         std::ostringstream varname_stream;
-                        varname_stream << current_file_name << ":level_" << ln << "_mesh_" << mesh << "/"
+                        varname_stream << current_file_name << "level_" << ln << "_mesh_" << mesh << "/"
                                        << d_var_names[ln][v];
                         std::string varname = varname_stream.str();
                         char* varname_ptr = const_cast<char*>(varname.c_str());
@@ -2080,7 +2519,7 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
         // Create or update the dumps file on the root MPI process.
         static bool summary_file_opened = false;
         std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
-        sprintf(temp_buf, "%06d", d_time_step_number);
+        sprintf(temp_buf, "%06d", time_step_number);
         std::string file =
             current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
         if (!summary_file_opened)
@@ -2097,176 +2536,263 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
             sfile.close();
         }
     }
-    SAMRAI_MPI::barrier();
+
+    unlockSiloLibrary();
 #else
-    TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
+    NULL_USE(snapshot);
 #endif // if defined(IBTK_HAVE_SILO)
     return;
-} // writePlotData
+} // writeSnapshot
 
 void
-LSiloDataWriter::putToDatabase(Pointer<Database> db)
+LSiloDataWriter::aggregateLocalPlotData(PlotDataSnapshot& snapshot, const int num_writers)
 {
-#if !defined(NDEBUG)
-    TBOX_ASSERT(db);
-#endif
-    db->putInteger("LAG_SILO_DATA_WRITER_VERSION", LAG_SILO_DATA_WRITER_VERSION);
-
-    db->putInteger("d_coarsest_ln", d_coarsest_ln);
-    db->putInteger("d_finest_ln", d_finest_ln);
+    const int mpi_rank = snapshot.mpi_rank;
+    const int mpi_nodes = snapshot.mpi_nodes;
+    const int group = get_writer_group(mpi_rank, mpi_nodes, num_writers);
+    const int group_writer = get_group_writer(group, mpi_nodes, num_writers);
+    const bool is_writer = mpi_rank == group_writer;
+
+    // (Re-)create the communicator connecting the processes of each group.
+    if (d_writer_comm == MPI_COMM_NULL || d_writer_comm_num_writers != num_writers)
+    {
+        if (d_writer_comm != MPI_COMM_NULL) MPI_Comm_free(&d_writer_comm);
+        MPI_Comm_split(SAMRAI_MPI::commWorld, group, mpi_rank, &d_writer_comm);
+        d_writer_comm_num_writers = num_writers;
+    }
+    int group_size;
+    MPI_Comm_size(d_writer_comm, &group_size);
+
+    // Gather the serialized local plot data on the writer process.
+    std::vector<int> int_data;
+    std::vector<double> dbl_data;
+    packLocalPlotData(snapshot.local_data[0], int_data, dbl_data, d_coarsest_ln, d_finest_ln);
+    int local_sizes[2] = { static_cast<int>(int_data.size()), static_cast<int>(dbl_data.size()) };
+    std::vector<int> group_sizes(2 * group_size, 0);
+    MPI_Gather(local_sizes, 2, MPI_INT, &group_sizes[0], 2, MPI_INT, 0, d_writer_comm);
+
+    std::vector<int> int_counts(group_size, 0), int_displs(group_size, 0);
+    std::vector<int> dbl_counts(group_size, 0), dbl_displs(group_size, 0);
+    for (int k = 0; k < group_size; ++k)
+    {
+        int_counts[k] = group_sizes[2 * k];
+        dbl_counts[k] = group_sizes[2 * k + 1];
+        if (k > 0)
+        {
+            int_displs[k] = int_displs[k - 1] + int_counts[k - 1];
+            dbl_displs[k] = dbl_displs[k - 1] + dbl_counts[k - 1];
+        }
+    }
+    std::vector<int> group_int_data(is_writer ? int_displs.back() + int_counts.back() : 0);
+    std::vector<double> group_dbl_data(is_writer ? dbl_displs.back() + dbl_counts.back() : 0);
+    MPI_Gatherv(int_data.empty() ? NULL : &int_data[0],
+                local_sizes[0],
+                MPI_INT,
+                group_int_data.empty() ? NULL : &group_int_data[0],
+                &int_counts[0],
+                &int_displs[0],
+                MPI_INT,
+                0,
+                d_writer_comm);
+    MPI_Gatherv(dbl_data.empty() ? NULL : &dbl_data[0],
+                local_sizes[1],
+                MPI_DOUBLE,
+                group_dbl_data.empty() ? NULL : &group_dbl_data[0],
+                &dbl_counts[0],
+                &dbl_displs[0],
+                MPI_DOUBLE,
+                0,
+                d_writer_comm);
+
+    // Unpack the plot data of each process in the group on the writer process.
+    // Processes are ordered by rank within the group communicator.
+    snapshot.num_writers = num_writers;
+    snapshot.file_number = group;
+    if (is_writer)
+    {
+        snapshot.local_data.resize(group_size);
+        snapshot.local_data_ranks.resize(group_size);
+        for (int k = 0; k < group_size; ++k)
+        {
+            snapshot.local_data_ranks[k] = group_writer + k;
+            const int* const int_ptr = int_counts[k] > 0 ? &group_int_data[int_displs[k]] : NULL;
+            const double* const dbl_ptr = dbl_counts[k] > 0 ? &group_dbl_data[dbl_displs[k]] : NULL;
+            unpackLocalPlotData(snapshot.local_data[k], int_ptr, dbl_ptr, d_coarsest_ln, d_finest_ln);
+        }
+    }
+    else
+    {
+        snapshot.local_data.clear();
+        snapshot.local_data_ranks.clear();
+    }
+    return;
+} // aggregateLocalPlotData
 
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+void
+LSiloDataWriter::packLocalPlotData(const LocalPlotData& data,
+                                   std::vector<int>& int_data,
+                                   std::vector<double>& dbl_data,
+                                   const int coarsest_ln,
+                                   const int finest_ln)
+{
+    int_data.clear();
+    dbl_data.clear();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
-        std::ostringstream ln_stream;
-        ln_stream << "_" << ln;
-        const std::string ln_string = ln_stream.str();
+        int_data.push_back(data.has_coords_data[ln]);
 
-        db->putInteger("d_nclouds" + ln_string, d_nclouds[ln]);
-        if (d_nclouds[ln] > 0)
+        int_data.push_back(static_cast<int>(data.cloud_nmarks[ln].size()));
+        int_data.insert(int_data.end(), data.cloud_nmarks[ln].begin(), data.cloud_nmarks[ln].end());
+
+        int_data.push_back(static_cast<int>(data.block_nelems[ln].size()));
+        for (unsigned int block = 0; block < data.block_nelems[ln].size(); ++block)
         {
-            db->putStringArray(
-                "d_cloud_names" + ln_string, &d_cloud_names[ln][0], static_cast<int>(d_cloud_names[ln].size()));
-            db->putIntegerArray(
-                "d_cloud_nmarks" + ln_string, &d_cloud_nmarks[ln][0], static_cast<int>(d_cloud_nmarks[ln].size()));
-            db->putIntegerArray("d_cloud_first_lag_idx" + ln_string,
-                                &d_cloud_first_lag_idx[ln][0],
-                                static_cast<int>(d_cloud_first_lag_idx[ln].size()));
+            for (unsigned int d = 0; d < NDIM; ++d) int_data.push_back(data.block_nelems[ln][block](d));
+            for (unsigned int d = 0; d < NDIM; ++d) int_data.push_back(data.block_periodic[ln][block](d));
         }
 
-        db->putInteger("d_nblocks" + ln_string, d_nblocks[ln]);
-        if (d_nblocks[ln] > 0)
+        int_data.push_back(static_cast<int>(data.mb_nelems[ln].size()));
+        for (unsigned int mb = 0; mb < data.mb_nelems[ln].size(); ++mb)
         {
-            db->putStringArray(
-                "d_block_names" + ln_string, &d_block_names[ln][0], static_cast<int>(d_block_names[ln].size()));
-
-            std::vector<int> flattened_block_nelems;
-            flattened_block_nelems.reserve(NDIM * d_block_nelems.size());
-            for (std::vector<IntVector<NDIM> >::const_iterator cit = d_block_nelems[ln].begin();
-                 cit != d_block_nelems[ln].end();
-                 ++cit)
+            int_data.push_back(static_cast<int>(data.mb_nelems[ln][mb].size()));
+            for (unsigned int block = 0; block < data.mb_nelems[ln][mb].size(); ++block)
             {
-                flattened_block_nelems.insert(flattened_block_nelems.end(), &(*cit)[0], &(*cit)[0] + NDIM);
+                for (unsigned int d = 0; d < NDIM; ++d) int_data.push_back(data.mb_nelems[ln][mb][block](d));
+                for (unsigned int d = 0; d < NDIM; ++d) int_data.push_back(data.mb_periodic[ln][mb][block](d));
             }
-            db->putIntegerArray("flattened_block_nelems" + ln_string,
-                                &flattened_block_nelems[0],
-                                static_cast<int>(flattened_block_nelems.size()));
+        }
 
-            std::vector<int> flattened_block_periodic;
-            flattened_block_periodic.reserve(NDIM * d_block_periodic.size());
-            for (std::vector<IntVector<NDIM> >::const_iterator cit = d_block_periodic[ln].begin();
-                 cit != d_block_periodic[ln].end();
-                 ++cit)
+        int_data.push_back(static_cast<int>(data.ucd_mesh_vertices[ln].size()));
+        for (unsigned int mesh = 0; mesh < data.ucd_mesh_vertices[ln].size(); ++mesh)
+        {
+            const std::set<int>& vertices = data.ucd_mesh_vertices[ln][mesh];
+            int_data.push_back(static_cast<int>(vertices.size()));
+            int_data.insert(int_data.end(), vertices.begin(), vertices.end());
+            const std::multimap<int, std::pair<int, int> >& edge_map = data.ucd_mesh_edge_maps[ln][mesh];
+            int_data.push_back(static_cast<int>(edge_map.size()));
+            for (std::multimap<int, std::pair<int, int> >::const_iterator it = edge_map.begin(); it != edge_map.end();
+                 ++it)
             {
-                flattened_block_periodic.insert(flattened_block_periodic.end(), &(*cit)[0], &(*cit)[0] + NDIM);
+                int_data.push_back(it->first);
+                int_data.push_back(it->second.first);
+                int_data.push_back(it->second.second);
             }
-            db->putIntegerArray("flattened_block_periodic" + ln_string,
-                                &flattened_block_periodic[0],
-                                static_cast<int>(flattened_block_periodic.size()));
-
-            db->putIntegerArray("d_block_first_lag_idx" + ln_string,
-                                &d_block_first_lag_idx[ln][0],
-                                static_cast<int>(d_block_first_lag_idx[ln].size()));
         }
 
-        db->putInteger("d_nmbs" + ln_string, d_nmbs[ln]);
-        if (d_nmbs[ln] > 0)
+        int_data.push_back(static_cast<int>(data.X_data[ln].size()));
+        dbl_data.insert(dbl_data.end(), data.X_data[ln].begin(), data.X_data[ln].end());
+        int_data.push_back(static_cast<int>(data.var_data[ln].size()));
+        for (unsigned int v = 0; v < data.var_data[ln].size(); ++v)
         {
-            db->putStringArray("d_mb_names" + ln_string, &d_mb_names[ln][0], static_cast<int>(d_mb_names[ln].size()));
+            int_data.push_back(static_cast<int>(data.var_data[ln][v].size()));
+            dbl_data.insert(dbl_data.end(), data.var_data[ln][v].begin(), data.var_data[ln][v].end());
+        }
+    }
+    return;
+} // packLocalPlotData
 
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-            {
-                std::ostringstream mb_stream;
-                mb_stream << "_" << mb;
-                const std::string mb_string = mb_stream.str();
+void
+LSiloDataWriter::unpackLocalPlotData(LocalPlotData& data,
+                                     const int* int_data,
+                                     const double* dbl_data,
+                                     const int coarsest_ln,
+                                     const int finest_ln)
+{
+    data.has_coords_data.assign(finest_ln + 1, 0);
+    data.cloud_nmarks.assign(finest_ln + 1, std::vector<int>());
+    data.block_nelems.assign(finest_ln + 1, std::vector<IntVector<NDIM> >());
+    data.block_periodic.assign(finest_ln + 1, std::vector<IntVector<NDIM> >());
+    data.mb_nelems.assign(finest_ln + 1, std::vector<std::vector<IntVector<NDIM> > >());
+    data.mb_periodic.assign(finest_ln + 1, std::vector<std::vector<IntVector<NDIM> > >());
+    data.ucd_mesh_vertices.assign(finest_ln + 1, std::vector<std::set<int> >());
+    data.ucd_mesh_edge_maps.assign(finest_ln + 1, std::vector<std::multimap<int, std::pair<int, int> > >());
+    data.X_data.assign(finest_ln + 1, std::vector<double>());
+    data.var_data.assign(finest_ln + 1, std::vector<std::vector<double> >());
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        data.has_coords_data[ln] = *int_data++;
 
-                db->putInteger("d_mb_nblocks" + ln_string + mb_string, d_mb_nblocks[ln][mb]);
-                if (d_mb_nblocks[ln][mb] > 0)
-                {
-                    std::vector<int> flattened_mb_nelems;
-                    flattened_mb_nelems.reserve(NDIM * d_mb_nelems.size());
-                    for (std::vector<IntVector<NDIM> >::const_iterator cit = d_mb_nelems[ln][mb].begin();
-                         cit != d_mb_nelems[ln][mb].end();
-                         ++cit)
-                    {
-                        flattened_mb_nelems.insert(flattened_mb_nelems.end(), &(*cit)[0], &(*cit)[0] + NDIM);
-                    }
-                    db->putIntegerArray("flattened_mb_nelems" + ln_string + mb_string,
-                                        &flattened_mb_nelems[0],
-                                        static_cast<int>(flattened_mb_nelems.size()));
+        const int nclouds = *int_data++;
+        data.cloud_nmarks[ln].assign(int_data, int_data + nclouds);
+        int_data += nclouds;
 
-                    std::vector<int> flattened_mb_periodic;
-                    flattened_mb_periodic.reserve(NDIM * d_mb_periodic.size());
-                    for (std::vector<IntVector<NDIM> >::const_iterator cit = d_mb_periodic[ln][mb].begin();
-                         cit != d_mb_periodic[ln][mb].end();
-                         ++cit)
-                    {
-                        flattened_mb_periodic.insert(flattened_mb_periodic.end(), &(*cit)[0], &(*cit)[0] + NDIM);
-                    }
-                    db->putIntegerArray("flattened_mb_periodic" + ln_string + mb_string,
-                                        &flattened_mb_periodic[0],
-                                        static_cast<int>(flattened_mb_periodic.size()));
+        const int nblocks = *int_data++;
+        data.block_nelems[ln].resize(nblocks);
+        data.block_periodic[ln].resize(nblocks);
+        for (int block = 0; block < nblocks; ++block)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d) data.block_nelems[ln][block](d) = *int_data++;
+            for (unsigned int d = 0; d < NDIM; ++d) data.block_periodic[ln][block](d) = *int_data++;
+        }
 
-                    db->putIntegerArray("d_mb_first_lag_idx" + ln_string + mb_string,
-                                        &d_mb_first_lag_idx[ln][mb][0],
-                                        static_cast<int>(d_mb_first_lag_idx[ln][mb].size()));
-                }
+        const int nmbs = *int_data++;
+        data.mb_nelems[ln].resize(nmbs);
+        data.mb_periodic[ln].resize(nmbs);
+        for (int mb = 0; mb < nmbs; ++mb)
+        {
+            const int mb_nblocks = *int_data++;
+            data.mb_nelems[ln][mb].resize(mb_nblocks);
+            data.mb_periodic[ln][mb].resize(mb_nblocks);
+            for (int block = 0; block < mb_nblocks; ++block)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d) data.mb_nelems[ln][mb][block](d) = *int_data++;
+                for (unsigned int d = 0; d < NDIM; ++d) data.mb_periodic[ln][mb][block](d) = *int_data++;
             }
         }
 
-        db->putInteger("d_nucd_meshes" + ln_string, d_nucd_meshes[ln]);
-        if (d_nucd_meshes[ln] > 0)
+        const int nucd_meshes = *int_data++;
+        data.ucd_mesh_vertices[ln].resize(nucd_meshes);
+        data.ucd_mesh_edge_maps[ln].resize(nucd_meshes);
+        for (int mesh = 0; mesh < nucd_meshes; ++mesh)
         {
-            db->putStringArray("d_ucd_mesh_names" + ln_string,
-                               &d_ucd_mesh_names[ln][0],
-                               static_cast<int>(d_ucd_mesh_names[ln].size()));
-
-            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
+            const int nvertices = *int_data++;
+            data.ucd_mesh_vertices[ln][mesh].insert(int_data, int_data + nvertices);
+            int_data += nvertices;
+            const int nedges = *int_data++;
+            for (int e = 0; e < nedges; ++e, int_data += 3)
             {
-                std::ostringstream mesh_stream;
-                mesh_stream << "_" << mesh;
-                const std::string mesh_string = mesh_stream.str();
-
-                std::vector<int> ucd_mesh_vertices_vector;
-                ucd_mesh_vertices_vector.reserve(d_ucd_mesh_vertices[ln][mesh].size());
-                for (std::set<int>::const_iterator cit = d_ucd_mesh_vertices[ln][mesh].begin();
-                     cit != d_ucd_mesh_vertices[ln][mesh].end();
-                     ++cit)
-                {
-                    ucd_mesh_vertices_vector.push_back(*cit);
-                }
-                db->putInteger("ucd_mesh_vertices_vector.size()" + ln_string + mesh_string,
-                               static_cast<int>(ucd_mesh_vertices_vector.size()));
-                db->putIntegerArray("ucd_mesh_vertices_vector" + ln_string + mesh_string,
-                                    &ucd_mesh_vertices_vector[0],
-                                    static_cast<int>(ucd_mesh_vertices_vector.size()));
-
-                std::vector<int> ucd_mesh_edge_maps_vector;
-                ucd_mesh_edge_maps_vector.reserve(3 * d_ucd_mesh_edge_maps[ln][mesh].size());
-                for (std::multimap<int, std::pair<int, int> >::const_iterator cit =
-                         d_ucd_mesh_edge_maps[ln][mesh].begin();
-                     cit != d_ucd_mesh_edge_maps[ln][mesh].end();
-                     ++cit)
-                {
-                    const int i = cit->first;
-                    std::pair<int, int> e = cit->second;
-                    ucd_mesh_edge_maps_vector.push_back(i);
-                    ucd_mesh_edge_maps_vector.push_back(e.first);
-                    ucd_mesh_edge_maps_vector.push_back(e.second);
-                }
-                db->putInteger("ucd_mesh_edge_maps_vector.size()" + ln_string + mesh_string,
-                               static_cast<int>(ucd_mesh_edge_maps_vector.size()));
-                db->putIntegerArray("ucd_mesh_edge_maps_vector" + ln_string + mesh_string,
-                                    &ucd_mesh_edge_maps_vector[0],
-                                    static_cast<int>(ucd_mesh_edge_maps_vector.size()));
+                data.ucd_mesh_edge_maps[ln][mesh].insert(
+                    std::make_pair(int_data[0], std::make_pair(int_data[1], int_data[2])));
             }
         }
+
+        const int X_size = *int_data++;
+        data.X_data[ln].assign(dbl_data, dbl_data + X_size);
+        dbl_data += X_size;
+        const int nvars = *int_data++;
+        data.var_data[ln].resize(nvars);
+        for (int v = 0; v < nvars; ++v)
+        {
+            const int v_size = *int_data++;
+            data.var_data[ln][v].assign(dbl_data, dbl_data + v_size);
+            dbl_data += v_size;
+        }
     }
     return;
-} // putToDatabase
+} // unpackLocalPlotData
 
-/////////////////////////////// PROTECTED ////////////////////////////////////
-
-/////////////////////////////// PRIVATE //////////////////////////////////////
+std::string
+LSiloDataWriter::getMeshPathPrefix(const int proc, const int mpi_nodes, const int num_writers)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::string prefix = SILO_PROCESSOR_FILE_PREFIX;
+    if (num_writers > 0)
+    {
+        sprintf(temp_buf, "%04d", get_writer_group(proc, mpi_nodes, num_writers));
+        prefix += temp_buf;
+        prefix += SILO_PROCESSOR_FILE_POSTFIX;
+        sprintf(temp_buf, "%04d", proc);
+        prefix += std::string(":proc_") + temp_buf + "/";
+    }
+    else
+    {
+        sprintf(temp_buf, "%04d", proc);
+        prefix += temp_buf;
+        prefix += SILO_PROCESSOR_FILE_POSTFIX;
+        prefix += ":";
+    }
+    return prefix;
+} // getMeshPathPrefix
 
 void
 LSiloDataWriter::buildVecScatters(AO& ao, const int level_number)
@@ -0,0 +1,621 @@
+// Filename: PatchMathKernels.cpp
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+
+#include "ibtk/PatchMathKernels.h"
+#include "ibtk/compiler_hints.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Describes the memory layout of a Fortran-ordered array indexed over the box
+// [ilower,iupper] grown by gcw.  Side-centered arrays are extended by one index
+// along their axis.  The third index is ignored in two spatial dimensions.
+struct ArrayLayout
+{
+    ArrayLayout(const int* const ilower, const int* const iupper, const int gcw, const int axis = -1)
+    {
+        int n[3];
+        for (int d = 0; d < 3; ++d)
+        {
+            if (d < NDIM)
+            {
+                lo[d] = ilower[d] - gcw;
+                n[d] = iupper[d] - ilower[d] + 1 + 2 * gcw + (d == axis ? 1 : 0);
+            }
+            else
+            {
+                lo[d] = 0;
+                n[d] = 1;
+            }
+        }
+        stride[0] = 1;
+        stride[1] = n[0];
+        stride[2] = n[0] * n[1];
+        size = n[0] * n[1] * n[2];
+        return;
+    } // ArrayLayout
+
+    inline int operator()(const int i0, const int i1, const int i2) const
+    {
+        return (i0 - lo[0]) + stride[1] * (i1 - lo[1]) + stride[2] * (i2 - lo[2]);
+    } // operator()
+
+    int lo[3], stride[3], size;
+};
+
+inline int
+lower2(const int* const ilower)
+{
+    return NDIM == 3 ? ilower[NDIM - 1] : 0;
+} // lower2
+
+inline int
+upper2(const int* const iupper)
+{
+    return NDIM == 3 ? iupper[NDIM - 1] : 0;
+} // upper2
+
+// The row kernels below are inlined into each instruction set specific variant
+// of the calling kernel.  The restrict qualifiers allow the compiler to
+// vectorize the loops without runtime alias checks.
+template <bool DAMPED, bool ADD>
+inline void
+laplace_row(double* RESTRICT f,
+            const double* RESTRICT u,
+            const double* RESTRICT u_lower1,
+            const double* RESTRICT u_upper1,
+            const double* RESTRICT u_lower2,
+            const double* RESTRICT u_upper2,
+            const double* RESTRICT v,
+            const int n,
+            const double fac0,
+            const double fac1,
+            const double fac2,
+            const double beta,
+            const double gamma)
+{
+    for (int i = 0; i < n; ++i)
+    {
+#if (NDIM == 2)
+        double val = fac0 * (u[i - 1] + u[i + 1] - 2.0 * u[i]) + fac1 * (u_lower1[i] + u_upper1[i] - 2.0 * u[i]);
+        NULL_USE(u_lower2);
+        NULL_USE(u_upper2);
+        NULL_USE(fac2);
+#endif
+#if (NDIM == 3)
+        double val = fac0 * (u[i - 1] + u[i + 1] - 2.0 * u[i]) + fac1 * (u_lower1[i] + u_upper1[i] - 2.0 * u[i]) +
+                     fac2 * (u_lower2[i] + u_upper2[i] - 2.0 * u[i]);
+#endif
+        if (DAMPED) val += beta * u[i];
+        if (ADD) val += gamma * v[i];
+        f[i] = val;
+    }
+    return;
+} // laplace_row
+
+template <bool ADD>
+inline void
+difference_row(double* RESTRICT g,
+               const double* RESTRICT u_upper,
+               const double* RESTRICT u_lower,
+               const double* RESTRICT v,
+               const int n,
+               const double fac,
+               const double beta)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        double val = fac * (u_upper[i] - u_lower[i]);
+        if (ADD) val += beta * v[i];
+        g[i] = val;
+    }
+    return;
+} // difference_row
+
+template <bool ADD>
+inline void
+div_row(double* RESTRICT D,
+        const double* RESTRICT u0,
+        const double* RESTRICT u1,
+        const double* RESTRICT u1_upper,
+        const double* RESTRICT u2,
+        const double* RESTRICT u2_upper,
+        const double* RESTRICT V,
+        const int n,
+        const double fac0,
+        const double fac1,
+        const double fac2,
+        const double beta)
+{
+    for (int i = 0; i < n; ++i)
+    {
+#if (NDIM == 2)
+        double val = fac0 * (u0[i + 1] - u0[i]) + fac1 * (u1_upper[i] - u1[i]);
+        NULL_USE(u2);
+        NULL_USE(u2_upper);
+        NULL_USE(fac2);
+#endif
+#if (NDIM == 3)
+        double val = fac0 * (u0[i + 1] - u0[i]) + fac1 * (u1_upper[i] - u1[i]) + fac2 * (u2_upper[i] - u2[i]);
+#endif
+        if (ADD) val += beta * V[i];
+        D[i] = val;
+    }
+    return;
+} // div_row
+
+inline void
+average_row(double* RESTRICT U, const double* RESTRICT v_lower, const double* RESTRICT v_upper, const int n)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        U[i] = 0.5 * (v_lower[i] + v_upper[i]);
+    }
+    return;
+} // average_row
+
+template <bool ADD>
+inline void
+multiply_row(double* RESTRICT U,
+             const double* RESTRICT A,
+             const double* RESTRICT V,
+             const double* RESTRICT W,
+             const int n,
+             const double beta)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        double val = A[i] * V[i];
+        if (ADD) val += beta * W[i];
+        U[i] = val;
+    }
+    return;
+} // multiply_row
+
+template <bool DAMPED, bool ADD>
+inline void
+laplace_box(double* const F,
+            const int F_gcw,
+            const double beta,
+            const double* const U,
+            const int U_gcw,
+            const double gamma,
+            const double* const V,
+            const int V_gcw,
+            const int* const ilower,
+            const int* const iupper,
+            const double* const fac)
+{
+    const ArrayLayout F_layout(ilower, iupper, F_gcw);
+    const ArrayLayout U_layout(ilower, iupper, U_gcw);
+    const ArrayLayout V_layout(ilower, iupper, ADD ? V_gcw : 0);
+    const int n = iupper[0] - ilower[0] + 1;
+    const int s1 = U_layout.stride[1];
+    const int s2 = NDIM == 3 ? U_layout.stride[2] : 0;
+    for (int i2 = lower2(ilower); i2 <= upper2(iupper); ++i2)
+    {
+        for (int i1 = ilower[1]; i1 <= iupper[1]; ++i1)
+        {
+            const double* const u = U + U_layout(ilower[0], i1, i2);
+            laplace_row<DAMPED, ADD>(F + F_layout(ilower[0], i1, i2),
+                                     u,
+                                     u - s1,
+                                     u + s1,
+                                     u - s2,
+                                     u + s2,
+                                     ADD ? V + V_layout(ilower[0], i1, i2) : NULL,
+                                     n,
+                                     fac[0],
+                                     fac[1],
+                                     fac[NDIM - 1],
+                                     beta,
+                                     gamma);
+        }
+    }
+    return;
+} // laplace_box
+
+// Gauss-Seidel row update.  Each update uses the updated value to its left, so
+// the loop is not vectorized.
+inline void
+gs_row(float* const u,
+       const float* const u_lower1,
+       const float* const u_upper1,
+       const float* const u_lower2,
+       const float* const u_upper2,
+       const float* const f,
+       const int n,
+       const float fac0,
+       const float fac1,
+       const float fac2,
+       const float fac)
+{
+    for (int i = 0; i < n; ++i)
+    {
+#if (NDIM == 2)
+        u[i] = fac * (fac0 * (u[i - 1] + u[i + 1]) + fac1 * (u_lower1[i] + u_upper1[i]) - f[i]);
+        NULL_USE(u_lower2);
+        NULL_USE(u_upper2);
+        NULL_USE(fac2);
+#endif
+#if (NDIM == 3)
+        u[i] = fac * (fac0 * (u[i - 1] + u[i + 1]) + fac1 * (u_lower1[i] + u_upper1[i]) +
+                      fac2 * (u_lower2[i] + u_upper2[i]) - f[i]);
+#endif
+    }
+    return;
+} // gs_row
+
+inline void
+gs_box(float* const U,
+       const int U_gcw,
+       const double alpha,
+       const double beta,
+       const float* const F,
+       const int F_gcw,
+       const int* const ilower,
+       const int* const iupper,
+       const double* const dx)
+{
+    const double fac0 = alpha / (dx[0] * dx[0]);
+    const double fac1 = alpha / (dx[1] * dx[1]);
+    const double fac2 = NDIM == 3 ? alpha / (dx[NDIM - 1] * dx[NDIM - 1]) : 0.0;
+    const double fac = 0.5 / (fac0 + fac1 + fac2 - 0.5 * beta);
+    const ArrayLayout U_layout(ilower, iupper, U_gcw);
+    const ArrayLayout F_layout(ilower, iupper, F_gcw);
+    const int n = iupper[0] - ilower[0] + 1;
+    const int s1 = U_layout.stride[1];
+    const int s2 = NDIM == 3 ? U_layout.stride[2] : 0;
+    for (int i2 = lower2(ilower); i2 <= upper2(iupper); ++i2)
+    {
+        for (int i1 = ilower[1]; i1 <= iupper[1]; ++i1)
+        {
+            float* const u = U + U_layout(ilower[0], i1, i2);
+            const float* const f = F + F_layout(ilower[0], i1, i2);
+            gs_row(u,
+                   u - s1,
+                   u + s1,
+                   u - s2,
+                   u + s2,
+                   f,
+                   n,
+                   static_cast<float>(fac0),
+                   static_cast<float>(fac1),
+                   static_cast<float>(fac2),
+                   static_cast<float>(fac));
+        }
+    }
+    return;
+} // gs_box
+
+template <typename DstType, typename SrcType>
+inline void
+convert_box(DstType* const U,
+            const SrcType* const V,
+            const int* const array_lower,
+            const int* const array_upper,
+            const int gcw,
+            const int* const ilower,
+            const int* const iupper)
+{
+    const ArrayLayout layout(array_lower, array_upper, gcw);
+    const int n = iupper[0] - ilower[0] + 1;
+    for (int i2 = lower2(ilower); i2 <= upper2(iupper); ++i2)
+    {
+        for (int i1 = ilower[1]; i1 <= iupper[1]; ++i1)
+        {
+            DstType* RESTRICT U_row = U + layout(ilower[0], i1, i2);
+            const SrcType* RESTRICT V_row = V + layout(ilower[0], i1, i2);
+            for (int i = 0; i < n; ++i)
+            {
+                U_row[i] = static_cast<DstType>(V_row[i]);
+            }
+        }
+    }
+    return;
+} // convert_box
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SIMD_TARGET_CLONES void
+PatchMathKernels::laplace(double* const F,
+                          const int F_gcw,
+                          const double alpha,
+                          const double beta,
+                          const double* const U,
+                          const int U_gcw,
+                          const double gamma,
+                          const double* const V,
+                          const int V_gcw,
+                          const int* const ilower,
+                          const int* const iupper,
+                          const double* const dx)
+{
+    double fac[NDIM];
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        fac[d] = alpha / (dx[d] * dx[d]);
+    }
+    const bool damped = beta != 0.0;
+    const bool add = V && gamma != 0.0;
+    if (damped && add)
+    {
+        laplace_box<true, true>(F, F_gcw, beta, U, U_gcw, gamma, V, V_gcw, ilower, iupper, fac);
+    }
+    else if (damped)
+    {
+        laplace_box<true, false>(F, F_gcw, beta, U, U_gcw, gamma, V, V_gcw, ilower, iupper, fac);
+    }
+    else if (add)
+    {
+        laplace_box<false, true>(F, F_gcw, beta, U, U_gcw, gamma, V, V_gcw, ilower, iupper, fac);
+    }
+    else
+    {
+        laplace_box<false, false>(F, F_gcw, beta, U, U_gcw, gamma, V, V_gcw, ilower, iupper, fac);
+    }
+    return;
+} // laplace
+
+SIMD_TARGET_CLONES void
+PatchMathKernels::sideToCellDiv(double* const D,
+                                const int D_gcw,
+                                const double alpha,
+                                const double* const* const u,
+                                const int u_gcw,
+                                const double beta,
+                                const double* const V,
+                                const int V_gcw,
+                                const int* const ilower,
+                                const int* const iupper,
+                                const double* const dx)
+{
+    const double fac0 = alpha / dx[0];
+    const double fac1 = alpha / dx[1];
+    const double fac2 = alpha / dx[NDIM - 1];
+    const bool add = V && beta != 0.0;
+    const ArrayLayout D_layout(ilower, iupper, D_gcw);
+    const ArrayLayout V_layout(ilower, iupper, add ? V_gcw : 0);
+    const ArrayLayout u0_layout(ilower, iupper, u_gcw, 0);
+    const ArrayLayout u1_layout(ilower, iupper, u_gcw, 1);
+    const ArrayLayout u2_layout(ilower, iupper, u_gcw, NDIM - 1);
+    const int s1 = u1_layout.stride[1];
+    const int s2 = NDIM == 3 ? u2_layout.stride[2] : 0;
+    const int n = iupper[0] - ilower[0] + 1;
+    for (int i2 = lower2(ilower); i2 <= upper2(iupper); ++i2)
+    {
+        for (int i1 = ilower[1]; i1 <= iupper[1]; ++i1)
+        {
+            double* const D_row = D + D_layout(ilower[0], i1, i2);
+            const double* const u0 = u[0] + u0_layout(ilower[0], i1, i2);
+            const double* const u1 = u[1] + u1_layout(ilower[0], i1, i2);
+            const double* const u2 = u[NDIM - 1] + u2_layout(ilower[0], i1, i2);
+            if (add)
+            {
+                const double* const V_row = V + V_layout(ilower[0], i1, i2);
+                div_row<true>(D_row, u0, u1, u1 + s1, u2, u2 + s2, V_row, n, fac0, fac1, fac2, beta);
+            }
+            else
+            {
+                div_row<false>(D_row, u0, u1, u1 + s1, u2, u2 + s2, NULL, n, fac0, fac1, fac2, beta);
+            }
+        }
+    }
+    return;
+} // sideToCellDiv
+
+SIMD_TARGET_CLONES void
+PatchMathKernels::cellToSideGrad(double* const* const g,
+                                 const int g_gcw,
+                                 const double alpha,
+                                 const double* const U,
+                                 const int U_gcw,
+                                 const double beta,
+                                 const double* const* const v,
+                                 const int v_gcw,
+                                 const int* const ilower,
+                                 const int* const iupper,
+                                 const double* const dx)
+{
+    const bool add = v && beta != 0.0;
+    const ArrayLayout U_layout(ilower, iupper, U_gcw);
+    for (int axis = 0; axis < NDIM; ++axis)
+    {
+        const double fac = alpha / dx[axis];
+        const ArrayLayout g_layout(ilower, iupper, g_gcw, axis);
+        const ArrayLayout v_layout(ilower, iupper, add ? v_gcw : 0, axis);
+        const int s = U_layout.stride[axis];
+        const int n = iupper[0] - ilower[0] + 1 + (axis == 0 ? 1 : 0);
+        const int i1_upper = iupper[1] + (axis == 1 ? 1 : 0);
+        const int i2_upper = upper2(iupper) + (axis == 2 ? 1 : 0);
+        for (int i2 = lower2(ilower); i2 <= i2_upper; ++i2)
+        {
+            for (int i1 = ilower[1]; i1 <= i1_upper; ++i1)
+            {
+                double* const g_row = g[axis] + g_layout(ilower[0], i1, i2);
+                const double* const U_row = U + U_layout(ilower[0], i1, i2);
+                if (add)
+                {
+                    const double* const v_row = v[axis] + v_layout(ilower[0], i1, i2);
+                    difference_row<true>(g_row, U_row, U_row - s, v_row, n, fac, beta);
+                }
+                else
+                {
+                    difference_row<false>(g_row, U_row, U_row - s, NULL, n, fac, beta);
+                }
+            }
+        }
+    }
+    return;
+} // cellToSideGrad
+
+SIMD_TARGET_CLONES void
+PatchMathKernels::sideToCellInterp(double* const U,
+                                   const int U_gcw,
+                                   const double* const* const v,
+                                   const int v_gcw,
+                                   const int* const ilower,
+                                   const int* const iupper)
+{
+    const ArrayLayout U_layout(ilower, iupper, U_gcw);
+    const int n = iupper[0] - ilower[0] + 1;
+    for (int axis = 0; axis < NDIM; ++axis)
+    {
+        const ArrayLayout v_layout(ilower, iupper, v_gcw, axis);
+        const int s = v_layout.stride[axis];
+        double* const U_axis = U + axis * U_layout.size;
+        for (int i2 = lower2(ilower); i2 <= upper2(iupper); ++i2)
+        {
+            for (int i1 = ilower[1]; i1 <= iupper[1]; ++i1)
+            {
+                const double* const v_row = v[axis] + v_layout(ilower[0], i1, i2);
+                average_row(U_axis + U_layout(ilower[0], i1, i2), v_row, v_row + s, n);
+            }
+        }
+    }
+    return;
+} // sideToCellInterp
+
+SIMD_TARGET_CLONES void
+PatchMathKernels::pointwiseMultiply(double* const U,
+                                    const int U_gcw,
+                                    const double* const A,
+                                    const int A_gcw,
+                                    const double* const V,
+                                    const int V_gcw,
+                                    const double beta,
+                                    const double* const W,
+                                    const int W_gcw,
+                                    const int* const ilower,
+                                    const int* const iupper)
+{
+    const bool add = W && beta != 0.0;
+    const ArrayLayout U_layout(ilower, iupper, U_gcw);
+    const ArrayLayout A_layout(ilower, iupper, A_gcw);
+    const ArrayLayout V_layout(ilower, iupper, V_gcw);
+    const ArrayLayout W_layout(ilower, iupper, add ? W_gcw : 0);
+    const int n = iupper[0] - ilower[0] + 1;
+    for (int i2 = lower2(ilower); i2 <= upper2(iupper); ++i2)
+    {
+        for (int i1 = ilower[1]; i1 <= iupper[1]; ++i1)
+        {
+            double* const U_row = U + U_layout(ilower[0], i1, i2);
+            const double* const A_row = A + A_layout(ilower[0], i1, i2);
+            const double* const V_row = V + V_layout(ilower[0], i1, i2);
+            if (add)
+            {
+                multiply_row<true>(U_row, A_row, V_row, W + W_layout(ilower[0], i1, i2), n, beta);
+            }
+            else
+            {
+                multiply_row<false>(U_row, A_row, V_row, NULL, n, beta);
+            }
+        }
+    }
+    return;
+} // pointwiseMultiply
+
+SIMD_TARGET_CLONES void
+PatchMathKernels::gaussSeidelSmooth(float* const U,
+                                    const int U_gcw,
+                                    const double alpha,
+                                    const double beta,
+                                    const float* const F,
+                                    const int F_gcw,
+                                    const int* const ilower,
+                                    const int* const iupper,
+                                    const double* const dx)
+{
+    gs_box(U, U_gcw, alpha, beta, F, F_gcw, ilower, iupper, dx);
+    return;
+} // gaussSeidelSmooth
+
+SIMD_TARGET_CLONES void
+PatchMathKernels::convert(float* const U,
+                          const double* const V,
+                          const int* const array_lower,
+                          const int* const array_upper,
+                          const int gcw,
+                          const int* const ilower,
+                          const int* const iupper)
+{
+    convert_box(U, V, array_lower, array_upper, gcw, ilower, iupper);
+    return;
+} // convert
+
+SIMD_TARGET_CLONES void
+PatchMathKernels::convert(double* const U,
+                          const float* const V,
+                          const int* const array_lower,
+                          const int* const array_upper,
+                          const int gcw,
+                          const int* const ilower,
+                          const int* const iupper)
+{
+    convert_box(U, V, array_lower, array_upper, gcw, ilower, iupper);
+    return;
+} // convert
+
+const char*
+PatchMathKernels::getInstructionSet()
+{
+#if IBTK_HAVE_TARGET_CLONES
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return "avx512f";
+    if (__builtin_cpu_supports("avx2")) return "avx2";
+#endif
+    return "default";
+} // getInstructionSet
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NO MEMBER FUNCTIONS //////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,7 @@
 #include "SideData.h"
 #include "SideGeometry.h"
 #include "boost/array.hpp"
+#include "ibtk/PatchMathKernels.h"
 #include "ibtk/PatchMathOps.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Pointer.h"
@@ -1331,7 +1332,7 @@ namespace IBTK
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
-PatchMathOps::PatchMathOps()
+PatchMathOps::PatchMathOps() : d_use_fortran_kernels(true)
 {
     // intentionally blank
     return;
@@ -1343,6 +1344,19 @@ PatchMathOps::~PatchMathOps()
     return;
 } // ~PatchMathOps
 
+void
+PatchMathOps::setUseFortranKernels(const bool use_fortran_kernels)
+{
+    d_use_fortran_kernels = use_fortran_kernels;
+    return;
+} // setUseFortranKernels
+
+bool
+PatchMathOps::getUseFortranKernels() const
+{
+    return d_use_fortran_kernels;
+} // getUseFortranKernels
+
 void
 PatchMathOps::curl(Pointer<CellData<NDIM, double> > dst,
                    const Pointer<CellData<NDIM, double> > src,
@@ -2850,24 +2864,46 @@ PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
 
     if (!src2 || (beta == 0.0))
     {
-        S_TO_C_DIV_FC(D,
-                      D_ghosts,
-                      alpha,
-                      u0,
-                      u1,
+        if (d_use_fortran_kernels)
+        {
+            S_TO_C_DIV_FC(D,
+                          D_ghosts,
+                          alpha,
+                          u0,
+                          u1,
 #if (NDIM == 3)
-                      u2,
+                          u2,
 #endif
-                      u_ghosts,
-                      patch_box.lower(0),
-                      patch_box.upper(0),
-                      patch_box.lower(1),
-                      patch_box.upper(1),
+                          u_ghosts,
+                          patch_box.lower(0),
+                          patch_box.upper(0),
+                          patch_box.lower(1),
+                          patch_box.upper(1),
 #if (NDIM == 3)
-                      patch_box.lower(2),
-                      patch_box.upper(2),
+                          patch_box.lower(2),
+                          patch_box.upper(2),
 #endif
-                      dx);
+                          dx);
+        }
+        else
+        {
+            boost::array<const double*, NDIM> u;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                u[d] = src1->getPointer(d);
+            }
+            PatchMathKernels::sideToCellDiv(D,
+                                            D_ghosts,
+                                            alpha,
+                                            u.data(),
+                                            u_ghosts,
+                                            0.0,
+                                            NULL,
+                                            0,
+                                            &patch_box.lower()(0),
+                                            &patch_box.upper()(0),
+                                            dx);
+        }
     }
     else
     {
@@ -2889,27 +2925,49 @@ PatchMathOps::div(Pointer<CellData<NDIM, double> > dst,
                        << std::endl);
         }
 #endif
-        S_TO_C_DIV_ADD_FC(D,
-                          D_ghosts,
-                          alpha,
-                          u0,
-                          u1,
+        if (d_use_fortran_kernels)
+        {
+            S_TO_C_DIV_ADD_FC(D,
+                              D_ghosts,
+                              alpha,
+                              u0,
+                              u1,
 #if (NDIM == 3)
-                          u2,
+                              u2,
 #endif
-                          u_ghosts,
-                          beta,
-                          V,
-                          V_ghosts,
-                          patch_box.lower(0),
-                          patch_box.upper(0),
-                          patch_box.lower(1),
-                          patch_box.upper(1),
+                              u_ghosts,
+                              beta,
+                              V,
+                              V_ghosts,
+                              patch_box.lower(0),
+                              patch_box.upper(0),
+                              patch_box.lower(1),
+                              patch_box.upper(1),
 #if (NDIM == 3)
-                          patch_box.lower(2),
-                          patch_box.upper(2),
+                              patch_box.lower(2),
+                              patch_box.upper(2),
 #endif
-                          dx);
+                              dx);
+        }
+        else
+        {
+            boost::array<const double*, NDIM> u;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                u[d] = src1->getPointer(d);
+            }
+            PatchMathKernels::sideToCellDiv(D,
+                                            D_ghosts,
+                                            alpha,
+                                            u.data(),
+                                            u_ghosts,
+                                            beta,
+                                            V,
+                                            V_ghosts,
+                                            &patch_box.lower()(0),
+                                            &patch_box.upper()(0),
+                                            dx);
+        }
     }
     return;
 } // div
@@ -3270,24 +3328,46 @@ PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
 
     if (!src2 || (beta == 0.0))
     {
-        C_TO_S_GRAD_FC(g0,
-                       g1,
+        if (d_use_fortran_kernels)
+        {
+            C_TO_S_GRAD_FC(g0,
+                           g1,
 #if (NDIM == 3)
-                       g2,
+                           g2,
 #endif
-                       g_ghosts,
-                       alpha,
-                       U,
-                       U_ghosts,
-                       patch_box.lower(0),
-                       patch_box.upper(0),
-                       patch_box.lower(1),
-                       patch_box.upper(1),
+                           g_ghosts,
+                           alpha,
+                           U,
+                           U_ghosts,
+                           patch_box.lower(0),
+                           patch_box.upper(0),
+                           patch_box.lower(1),
+                           patch_box.upper(1),
 #if (NDIM == 3)
-                       patch_box.lower(2),
-                       patch_box.upper(2),
+                           patch_box.lower(2),
+                           patch_box.upper(2),
 #endif
-                       dx);
+                           dx);
+        }
+        else
+        {
+            boost::array<double*, NDIM> g;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                g[d] = dst->getPointer(d);
+            }
+            PatchMathKernels::cellToSideGrad(g.data(),
+                                             g_ghosts,
+                                             alpha,
+                                             U,
+                                             U_ghosts,
+                                             0.0,
+                                             NULL,
+                                             0,
+                                             &patch_box.lower()(0),
+                                             &patch_box.upper()(0),
+                                             dx);
+        }
     }
     else
     {
@@ -3313,31 +3393,58 @@ PatchMathOps::grad(Pointer<SideData<NDIM, double> > dst,
                        << std::endl);
         }
 #endif
-        C_TO_S_GRAD_ADD_FC(g0,
-                           g1,
+        if (d_use_fortran_kernels)
+        {
+            C_TO_S_GRAD_ADD_FC(g0,
+                               g1,
 #if (NDIM == 3)
-                           g2,
+                               g2,
 #endif
-                           g_ghosts,
-                           alpha,
-                           U,
-                           U_ghosts,
-                           beta,
-                           v0,
-                           v1,
+                               g_ghosts,
+                               alpha,
+                               U,
+                               U_ghosts,
+                               beta,
+                               v0,
+                               v1,
 #if (NDIM == 3)
-                           v2,
+                               v2,
 #endif
-                           v_ghosts,
-                           patch_box.lower(0),
-                           patch_box.upper(0),
-                           patch_box.lower(1),
-                           patch_box.upper(1),
+                               v_ghosts,
+                               patch_box.lower(0),
+                               patch_box.upper(0),
+                               patch_box.lower(1),
+                               patch_box.upper(1),
 #if (NDIM == 3)
-                           patch_box.lower(2),
-                           patch_box.upper(2),
+                               patch_box.lower(2),
+                               patch_box.upper(2),
 #endif
-                           dx);
+                               dx);
+        }
+        else
+        {
+            boost::array<double*, NDIM> g;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                g[d] = dst->getPointer(d);
+            }
+            boost::array<const double*, NDIM> v;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                v[d] = src2->getPointer(d);
+            }
+            PatchMathKernels::cellToSideGrad(g.data(),
+                                             g_ghosts,
+                                             alpha,
+                                             U,
+                                             U_ghosts,
+                                             beta,
+                                             v.data(),
+                                             v_ghosts,
+                                             &patch_box.lower()(0),
+                                             &patch_box.upper()(0),
+                                             dx);
+        }
     }
     return;
 } // grad
@@ -4055,24 +4162,37 @@ PatchMathOps::interp(Pointer<CellData<NDIM, double> > dst,
         const double* const v2 = src->getPointer(2, depth);
 #endif
 
-        S_TO_C_INTERP_FC(U,
-                         U_ghosts,
-                         v0,
-                         v1,
+        if (d_use_fortran_kernels)
+        {
+            S_TO_C_INTERP_FC(U,
+                             U_ghosts,
+                             v0,
+                             v1,
 #if (NDIM == 3)
-                         v2,
+                             v2,
 #endif
-                         v_ghosts,
-                         patch_box.lower(0),
-                         patch_box.upper(0),
-                         patch_box.lower(1),
-                         patch_box.upper(1)
+                             v_ghosts,
+                             patch_box.lower(0),
+                             patch_box.upper(0),
+                             patch_box.lower(1),
+                             patch_box.upper(1)
 #if (NDIM == 3)
-                             ,
-                         patch_box.lower(2),
-                         patch_box.upper(2)
+                                 ,
+                             patch_box.lower(2),
+                             patch_box.upper(2)
 #endif
-                             );
+                                 );
+        }
+        else
+        {
+            boost::array<const double*, NDIM> v;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                v[d] = src->getPointer(d, depth);
+            }
+            PatchMathKernels::sideToCellInterp(
+                U, U_ghosts, v.data(), v_ghosts, &patch_box.lower()(0), &patch_box.upper()(0));
+        }
     }
     return;
 } // interp
@@ -4334,7 +4454,12 @@ PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
 
     if (!src2 || (gamma == 0.0))
     {
-        if (beta == 0.0)
+        if (!d_use_fortran_kernels)
+        {
+            PatchMathKernels::laplace(
+                F, F_ghosts, alpha, beta, U, U_ghosts, 0.0, NULL, 0, &patch_box.lower()(0), &patch_box.upper()(0), dx);
+        }
+        else if (beta == 0.0)
         {
             LAPLACE_FC(F,
                        F_ghosts,
@@ -4390,7 +4515,22 @@ PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                        << std::endl);
         }
 #endif
-        if (beta == 0.0)
+        if (!d_use_fortran_kernels)
+        {
+            PatchMathKernels::laplace(F,
+                                      F_ghosts,
+                                      alpha,
+                                      beta,
+                                      U,
+                                      U_ghosts,
+                                      gamma,
+                                      V,
+                                      V_ghosts,
+                                      &patch_box.lower()(0),
+                                      &patch_box.upper()(0),
+                                      dx);
+        }
+        else if (beta == 0.0)
         {
             LAPLACE_ADD_FC(F,
                            F_ghosts,
@@ -4532,7 +4672,12 @@ PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
             }
             iupper[d] += 1;
 
-            if (beta == 0.0)
+            if (!d_use_fortran_kernels)
+            {
+                PatchMathKernels::laplace(
+                    F[d], F_ghosts, alpha, beta, U[d], U_ghosts, 0.0, NULL, 0, ilower.data(), iupper.data(), dx);
+            }
+            else if (beta == 0.0)
             {
                 LAPLACE_FC(F[d],
                            F_ghosts,
@@ -4603,7 +4748,22 @@ PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
             }
             iupper[d] += 1;
 
-            if (beta == 0.0)
+            if (!d_use_fortran_kernels)
+            {
+                PatchMathKernels::laplace(F[d],
+                                          F_ghosts,
+                                          alpha,
+                                          beta,
+                                          U[d],
+                                          U_ghosts,
+                                          gamma,
+                                          V[d],
+                                          V_ghosts,
+                                          ilower.data(),
+                                          iupper.data(),
+                                          dx);
+            }
+            else if (beta == 0.0)
             {
                 LAPLACE_ADD_FC(F[d],
                                F_ghosts,
@@ -5472,22 +5632,30 @@ PatchMathOps::pointwiseMultiply(Pointer<CellData<NDIM, double> > dst,
 
     if (!src2 || (beta == 0.0))
     {
-        MULTIPLY2_FC(D,
-                     D_ghosts,
-                     A,
-                     A_ghosts,
-                     U,
-                     U_ghosts,
-                     patch_box.lower(0),
-                     patch_box.upper(0),
-                     patch_box.lower(1),
-                     patch_box.upper(1)
+        if (d_use_fortran_kernels)
+        {
+            MULTIPLY2_FC(D,
+                         D_ghosts,
+                         A,
+                         A_ghosts,
+                         U,
+                         U_ghosts,
+                         patch_box.lower(0),
+                         patch_box.upper(0),
+                         patch_box.lower(1),
+                         patch_box.upper(1)
 #if (NDIM == 3)
-                         ,
-                     patch_box.lower(2),
-                     patch_box.upper(2)
+                             ,
+                         patch_box.lower(2),
+                         patch_box.upper(2)
 #endif
-                         );
+                             );
+        }
+        else
+        {
+            PatchMathKernels::pointwiseMultiply(
+                D, D_ghosts, A, A_ghosts, U, U_ghosts, 0.0, NULL, 0, &patch_box.lower()(0), &patch_box.upper()(0));
+        }
     }
     else
     {
@@ -5509,25 +5677,33 @@ PatchMathOps::pointwiseMultiply(Pointer<CellData<NDIM, double> > dst,
                        << std::endl);
         }
 #endif
-        MULTIPLY_ADD2_FC(D,
-                         D_ghosts,
-                         A,
-                         A_ghosts,
-                         U,
-                         U_ghosts,
-                         beta,
-                         V,
-                         V_ghosts,
-                         patch_box.lower(0),
-                         patch_box.upper(0),
-                         patch_box.lower(1),
-                         patch_box.upper(1)
+        if (d_use_fortran_kernels)
+        {
+            MULTIPLY_ADD2_FC(D,
+                             D_ghosts,
+                             A,
+                             A_ghosts,
+                             U,
+                             U_ghosts,
+                             beta,
+                             V,
+                             V_ghosts,
+                             patch_box.lower(0),
+                             patch_box.upper(0),
+                             patch_box.lower(1),
+                             patch_box.upper(1)
 #if (NDIM == 3)
-                             ,
-                         patch_box.lower(2),
-                         patch_box.upper(2)
+                                 ,
+                             patch_box.lower(2),
+                             patch_box.upper(2)
 #endif
-                             );
+                                 );
+        }
+        else
+        {
+            PatchMathKernels::pointwiseMultiply(
+                D, D_ghosts, A, A_ghosts, U, U_ghosts, beta, V, V_ghosts, &patch_box.lower()(0), &patch_box.upper()(0));
+        }
     }
     return;
 } // pointwiseMultiply
@@ -5849,22 +6025,30 @@ PatchMathOps::pointwiseMultiply(Pointer<FaceData<NDIM, double> > dst,
 
         if (!src2 || (beta == 0.0))
         {
-            MULTIPLY2_FC(D,
-                         D_ghosts,
-                         A,
-                         A_ghosts,
-                         U,
-                         U_ghosts,
-                         data_box.lower(0),
-                         data_box.upper(0),
-                         data_box.lower(1),
-                         data_box.upper(1)
+            if (d_use_fortran_kernels)
+            {
+                MULTIPLY2_FC(D,
+                             D_ghosts,
+                             A,
+                             A_ghosts,
+                             U,
+                             U_ghosts,
+                             data_box.lower(0),
+                             data_box.upper(0),
+                             data_box.lower(1),
+                             data_box.upper(1)
 #if (NDIM == 3)
-                             ,
-                         data_box.lower(2),
-                         data_box.upper(2)
+                                 ,
+                             data_box.lower(2),
+                             data_box.upper(2)
 #endif
-                             );
+                                 );
+            }
+            else
+            {
+                PatchMathKernels::pointwiseMultiply(
+                    D, D_ghosts, A, A_ghosts, U, U_ghosts, 0.0, NULL, 0, &data_box.lower()(0), &data_box.upper()(0));
+            }
         }
         else
         {
@@ -5886,25 +6070,42 @@ PatchMathOps::pointwiseMultiply(Pointer<FaceData<NDIM, double> > dst,
                            << std::endl);
             }
 #endif
-            MULTIPLY_ADD2_FC(D,
-                             D_ghosts,
-                             A,
-                             A_ghosts,
-                             U,
-                             U_ghosts,
-                             beta,
-                             V,
-                             V_ghosts,
-                             data_box.lower(0),
-                             data_box.upper(0),
-                             data_box.lower(1),
-                             data_box.upper(1)
-#if (NDIM == 3)
-                                 ,
-                             data_box.lower(2),
-                             data_box.upper(2)
-#endif
-                                 );
+            if (d_use_fortran_kernels)
+            {
+                MULTIPLY_ADD2_FC(D,
+                                 D_ghosts,
+                                 A,
+                                 A_ghosts,
+                                 U,
+                                 U_ghosts,
+                                 beta,
+                                 V,
+                                 V_ghosts,
+                                 data_box.lower(0),
+                                 data_box.upper(0),
+                                 data_box.lower(1),
+                                 data_box.upper(1)
+#if (NDIM == 3)
+                                     ,
+                                 data_box.lower(2),
+                                 data_box.upper(2)
+#endif
+                                     );
+            }
+            else
+            {
+                PatchMathKernels::pointwiseMultiply(D,
+                                                    D_ghosts,
+                                                    A,
+                                                    A_ghosts,
+                                                    U,
+                                                    U_ghosts,
+                                                    beta,
+                                                    V,
+                                                    V_ghosts,
+                                                    &data_box.lower()(0),
+                                                    &data_box.upper()(0));
+            }
         }
     }
     return;
@@ -6226,22 +6427,30 @@ PatchMathOps::pointwiseMultiply(Pointer<NodeData<NDIM, double> > dst,
 
     if (!src2 || (beta == 0.0))
     {
-        MULTIPLY2_FC(D,
-                     D_ghosts,
-                     A,
-                     A_ghosts,
-                     U,
-                     U_ghosts,
-                     data_box.lower(0),
-                     data_box.upper(0),
-                     data_box.lower(1),
-                     data_box.upper(1)
+        if (d_use_fortran_kernels)
+        {
+            MULTIPLY2_FC(D,
+                         D_ghosts,
+                         A,
+                         A_ghosts,
+                         U,
+                         U_ghosts,
+                         data_box.lower(0),
+                         data_box.upper(0),
+                         data_box.lower(1),
+                         data_box.upper(1)
 #if (NDIM == 3)
-                         ,
-                     data_box.lower(2),
-                     data_box.upper(2)
+                             ,
+                         data_box.lower(2),
+                         data_box.upper(2)
 #endif
-                         );
+                             );
+        }
+        else
+        {
+            PatchMathKernels::pointwiseMultiply(
+                D, D_ghosts, A, A_ghosts, U, U_ghosts, 0.0, NULL, 0, &data_box.lower()(0), &data_box.upper()(0));
+        }
     }
     else
     {
@@ -6263,25 +6472,33 @@ PatchMathOps::pointwiseMultiply(Pointer<NodeData<NDIM, double> > dst,
                        << std::endl);
         }
 #endif
-        MULTIPLY_ADD2_FC(D,
-                         D_ghosts,
-                         A,
-                         A_ghosts,
-                         U,
-                         U_ghosts,
-                         beta,
-                         V,
-                         V_ghosts,
-                         data_box.lower(0),
-                         data_box.upper(0),
-                         data_box.lower(1),
-                         data_box.upper(1)
+        if (d_use_fortran_kernels)
+        {
+            MULTIPLY_ADD2_FC(D,
+                             D_ghosts,
+                             A,
+                             A_ghosts,
+                             U,
+                             U_ghosts,
+                             beta,
+                             V,
+                             V_ghosts,
+                             data_box.lower(0),
+                             data_box.upper(0),
+                             data_box.lower(1),
+                             data_box.upper(1)
 #if (NDIM == 3)
-                             ,
-                         data_box.lower(2),
-                         data_box.upper(2)
+                                 ,
+                             data_box.lower(2),
+                             data_box.upper(2)
 #endif
-                             );
+                                 );
+        }
+        else
+        {
+            PatchMathKernels::pointwiseMultiply(
+                D, D_ghosts, A, A_ghosts, U, U_ghosts, beta, V, V_ghosts, &data_box.lower()(0), &data_box.upper()(0));
+        }
     }
     return;
 } // pointwiseMultiply
@@ -6604,22 +6821,30 @@ PatchMathOps::pointwiseMultiply(Pointer<SideData<NDIM, double> > dst,
 
         if (!src2 || (beta == 0.0))
         {
-            MULTIPLY2_FC(D,
-                         D_ghosts,
-                         A,
-                         A_ghosts,
-                         U,
-                         U_ghosts,
-                         data_box.lower(0),
-                         data_box.upper(0),
-                         data_box.lower(1),
-                         data_box.upper(1)
+            if (d_use_fortran_kernels)
+            {
+                MULTIPLY2_FC(D,
+                             D_ghosts,
+                             A,
+                             A_ghosts,
+                             U,
+                             U_ghosts,
+                             data_box.lower(0),
+                             data_box.upper(0),
+                             data_box.lower(1),
+                             data_box.upper(1)
 #if (NDIM == 3)
-                             ,
-                         data_box.lower(2),
-                         data_box.upper(2)
+                                 ,
+                             data_box.lower(2),
+                             data_box.upper(2)
 #endif
-                             );
+                                 );
+            }
+            else
+            {
+                PatchMathKernels::pointwiseMultiply(
+                    D, D_ghosts, A, A_ghosts, U, U_ghosts, 0.0, NULL, 0, &data_box.lower()(0), &data_box.upper()(0));
+            }
         }
         else
         {
@@ -6641,25 +6866,42 @@ PatchMathOps::pointwiseMultiply(Pointer<SideData<NDIM, double> > dst,
                            << std::endl);
             }
 #endif
-            MULTIPLY_ADD2_FC(D,
-                             D_ghosts,
-                             A,
-                             A_ghosts,
-                             U,
-                             U_ghosts,
-                             beta,
-                             V,
-                             V_ghosts,
-                             data_box.lower(0),
-                             data_box.upper(0),
-                             data_box.lower(1),
-                             data_box.upper(1)
-#if (NDIM == 3)
-                                 ,
-                             data_box.lower(2),
-                             data_box.upper(2)
-#endif
-                                 );
+            if (d_use_fortran_kernels)
+            {
+                MULTIPLY_ADD2_FC(D,
+                                 D_ghosts,
+                                 A,
+                                 A_ghosts,
+                                 U,
+                                 U_ghosts,
+                                 beta,
+                                 V,
+                                 V_ghosts,
+                                 data_box.lower(0),
+                                 data_box.upper(0),
+                                 data_box.lower(1),
+                                 data_box.upper(1)
+#if (NDIM == 3)
+                                     ,
+                                 data_box.lower(2),
+                                 data_box.upper(2)
+#endif
+                                     );
+            }
+            else
+            {
+                PatchMathKernels::pointwiseMultiply(D,
+                                                    D_ghosts,
+                                                    A,
+                                                    A_ghosts,
+                                                    U,
+                                                    U_ghosts,
+                                                    beta,
+                                                    V,
+                                                    V_ghosts,
+                                                    &data_box.lower()(0),
+                                                    &data_box.upper()(0));
+            }
         }
     }
     return;
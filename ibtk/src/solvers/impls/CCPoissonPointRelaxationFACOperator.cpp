@@ -57,6 +57,7 @@
 #include "IntVector.h"
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
+#include "PatchCellDataOpsReal.h"
 #include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
@@ -80,6 +81,8 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/PatchMathKernels.h"
+#include "ibtk/PatchMathOps.h"
 #include "ibtk/PoissonFACPreconditionerStrategy.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
@@ -198,6 +201,7 @@ enum SmootherType
     PATCH_GAUSS_SEIDEL,
     PROCESSOR_GAUSS_SEIDEL,
     RED_BLACK_GAUSS_SEIDEL,
+    CHEBYSHEV,
     UNKNOWN = -1
 };
 
@@ -206,8 +210,9 @@ get_smoother_type(const std::string& smoother_type_string)
 {
     if (smoother_type_string == "PATCH_GAUSS_SEIDEL") return PATCH_GAUSS_SEIDEL;
     if (smoother_type_string == "PROCESSOR_GAUSS_SEIDEL") return PROCESSOR_GAUSS_SEIDEL;
-    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL")
-        return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "RED_BLACK_GAUSS_SEIDEL") return RED_BLACK_GAUSS_SEIDEL;
+    if (smoother_type_string == "CHEBYSHEV")
+        return CHEBYSHEV;
     else
         return UNKNOWN;
 } // get_smoother_type
@@ -237,6 +242,37 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+// Copies cell-centered data between double and single precision on the portions
+// of the specified boxes that lie within the ghost box of the data.  Both patch
+// data objects must be defined on the same box with the same ghost cell width.
+template <typename DstType, typename SrcType>
+inline void
+convert_data(CellData<NDIM, DstType>& dst_data, const CellData<NDIM, SrcType>& src_data, const BoxList<NDIM>& boxes)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst_data.getGhostBox() == src_data.getGhostBox());
+    TBOX_ASSERT(dst_data.getDepth() == src_data.getDepth());
+#endif
+    const Box<NDIM>& patch_box = dst_data.getBox();
+    const int gcw = (dst_data.getGhostCellWidth()).max();
+    for (BoxList<NDIM>::Iterator it(boxes); it; it++)
+    {
+        const Box<NDIM> box = it() * dst_data.getGhostBox();
+        if (box.empty()) continue;
+        for (int depth = 0; depth < dst_data.getDepth(); ++depth)
+        {
+            PatchMathKernels::convert(dst_data.getPointer(depth),
+                                      src_data.getPointer(depth),
+                                      &patch_box.lower()(0),
+                                      &patch_box.upper()(0),
+                                      gcw,
+                                      &box.lower()(0),
+                                      &box.upper()(0));
+        }
+    }
+    return;
+} // convert_data
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -253,7 +289,9 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
       d_coarse_solver(NULL),
       d_coarse_solver_db(),
       d_patch_bc_box_overlap(),
-      d_patch_neighbor_overlap()
+      d_patch_neighbor_overlap(),
+      d_patch_single_error_data(),
+      d_patch_single_residual_data()
 {
     // Set some default values.
     d_smoother_type = "PATCH_GAUSS_SEIDEL";
@@ -380,6 +418,48 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
 #endif
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
+    const bool chebyshev_smoother = (smoother_type == CHEBYSHEV);
+
+    // Polynomial smoothers require a ghost cell fill prior to each sweep.
+    const int sweeps_per_exchange = (chebyshev_smoother ? 1 : d_smoother_sweeps_per_exchange);
+
+    // Patch Gauss-Seidel sweeps may use single-precision data on patches that
+    // do not touch physical boundaries or coarse-fine interfaces.
+    const bool single_precision = d_use_single_precision_smoother && smoother_type == PATCH_GAUSS_SEIDEL;
+
+    // Setup the Chebyshev iteration for the Jacobi-preconditioned operator.
+    // The search directions and residuals are stored in patch-local temporary
+    // data that persist across sweeps.
+    double chebyshev_theta = 0.0, chebyshev_delta = 0.0, chebyshev_sigma = 0.0, chebyshev_rho = 0.0;
+    std::vector<Pointer<CellData<NDIM, double> > > chebyshev_dir_data, chebyshev_res_data;
+    PatchMathOps patch_math_ops;
+    PatchCellDataOpsReal<NDIM, double> patch_data_ops;
+    if (chebyshev_smoother)
+    {
+        if (d_level_jacobi_max_eig[level_num] <= 0.0)
+        {
+            TBOX_ERROR(d_object_name << "::smoothError():\n"
+                                     << "  no eigenvalue estimate is available on level number " << level_num << "\n"
+                                     << "  smoother type CHEBYSHEV requires constant coefficients"
+                                     << std::endl);
+        }
+        const double eig_max = d_chebyshev_eig_upper_factor * d_level_jacobi_max_eig[level_num];
+        const double eig_min = d_chebyshev_eig_lower_factor * d_level_jacobi_max_eig[level_num];
+        chebyshev_theta = 0.5 * (eig_max + eig_min);
+        chebyshev_delta = 0.5 * (eig_max - eig_min);
+        chebyshev_sigma = chebyshev_theta / chebyshev_delta;
+        chebyshev_rho = 1.0 / chebyshev_sigma;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            const int depth = error_data->getDepth();
+            Pointer<CellData<NDIM, double> > dir_data = new CellData<NDIM, double>(patch->getBox(), depth, 0);
+            dir_data->fillAll(0.0);
+            chebyshev_dir_data.push_back(dir_data);
+            chebyshev_res_data.push_back(new CellData<NDIM, double>(patch->getBox(), depth, 0));
+        }
+    }
 
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
@@ -402,9 +482,59 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     }
 
     // Smooth the error by the specified number of sweeps.
+    //
+    // NOTE: When performing multiple sweeps between ghost cell fills, the
+    // residual ghost cell values are also required, and patches in the
+    // interior of the level are smoothed redundantly on grown boxes whose
+    // widths decrease by one with each sweep until the next ghost cell fill.
+    //
+    // NOTE: When smoothing using single-precision data, the single-precision
+    // error is the only up-to-date copy of the error between ghost cell fills.
+    // Values that are used to fill the ghost cells of neighboring patches are
+    // copied back to the double-precision error prior to each ghost cell fill.
     if (red_black_ordering) num_sweeps *= 2;
+    const bool fill_residual_ghosts = sweeps_per_exchange > 1 && num_sweeps > 1;
+    if (fill_residual_ghosts)
+    {
+        xeqScheduleGhostFillNoCoarse(residual.getComponentDescriptorIndex(0), level_num);
+    }
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
     {
+        const int block_sweep = isweep % sweeps_per_exchange;
+        const bool exchange_ghosts = (block_sweep == 0);
+        const int num_remaining_block_sweeps =
+            std::min(sweeps_per_exchange, num_sweeps - isweep + block_sweep) - block_sweep - 1;
+
+        if (single_precision && isweep > 0 && exchange_ghosts)
+        {
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<CellData<NDIM, float> > single_error_data = d_patch_single_error_data[level_num][patch_counter];
+                if (!single_error_data) continue;
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                const Box<NDIM>& patch_box = patch->getBox();
+                BoxList<NDIM> patch_bdry_boxes(patch_box);
+                patch_bdry_boxes.removeIntersections(Box<NDIM>::grow(patch_box, -d_gcw));
+                convert_data(*error_data, *single_error_data, patch_bdry_boxes);
+            }
+        }
+
+        // Determine the Chebyshev recurrence coefficients for this sweep.
+        double chebyshev_dir_fac = 0.0, chebyshev_res_fac = 0.0;
+        if (chebyshev_smoother && isweep == 0)
+        {
+            chebyshev_res_fac = 1.0 / chebyshev_theta;
+        }
+        else if (chebyshev_smoother)
+        {
+            const double chebyshev_rho_new = 1.0 / (2.0 * chebyshev_sigma - chebyshev_rho);
+            chebyshev_dir_fac = chebyshev_rho_new * chebyshev_rho;
+            chebyshev_res_fac = 2.0 * chebyshev_rho_new / chebyshev_delta;
+            chebyshev_rho = chebyshev_rho_new;
+        }
+
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
         {
@@ -425,12 +555,21 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     TBOX_ASSERT(scratch_data->getGhostCellWidth() == d_gcw);
 #endif
                     error_data->getArrayData().copy(scratch_data->getArrayData(),
-                                                    d_patch_bc_box_overlap[level_num][patch_counter],
+                                                    exchange_ghosts ?
+                                                        d_patch_bc_box_overlap[level_num][patch_counter] :
+                                                        d_patch_bdry_ghost_box_overlap[level_num][patch_counter],
                                                     IntVector<NDIM>(0));
                 }
 
                 // Fill the non-coarse-fine interface ghost cell values.
-                xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+                if (exchange_ghosts)
+                {
+                    xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+                }
+                else
+                {
+                    fillPhysicalBoundaryGhostCells(error_idx, level_num);
+                }
             }
 
             // Complete the coarse-fine interface interpolation by computing the
@@ -446,7 +585,14 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
         }
         else if (isweep > 0)
         {
-            xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+            if (exchange_ghosts)
+            {
+                xeqScheduleGhostFillNoCoarse(error_idx, level_num);
+            }
+            else
+            {
+                fillPhysicalBoundaryGhostCells(error_idx, level_num);
+            }
         }
 
         // Smooth the error on the patches.
@@ -463,7 +609,11 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             TBOX_ASSERT(residual_data->getGhostCellWidth() == d_gcw);
             TBOX_ASSERT(error_data->getDepth() == residual_data->getDepth());
 #endif
-            const Box<NDIM>& patch_box = patch->getBox();
+            const int sweep_width =
+                (sweeps_per_exchange > 1 ?
+                     std::min(d_patch_redundant_sweep_width[level_num][patch_counter], num_remaining_block_sweeps) :
+                     0);
+            const Box<NDIM> smooth_box = Box<NDIM>::grow(patch->getBox(), sweep_width);
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
 
@@ -483,6 +633,28 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 }
             }
 
+            // Perform a Chebyshev sweep using the Jacobi-preconditioned
+            // residual D^{-1} (f - A u), in which D is the diagonal of A.
+            if (chebyshev_smoother)
+            {
+                const double& alpha = d_poisson_spec.getDConstant();
+                const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+                double dx_fac = 0.0;
+                for (unsigned int d = 0; d < NDIM; ++d) dx_fac += 1.0 / (dx[d] * dx[d]);
+                const double diag = beta - 2.0 * alpha * dx_fac;
+                Pointer<CellData<NDIM, double> > dir_data = chebyshev_dir_data[patch_counter];
+                Pointer<CellData<NDIM, double> > res_data = chebyshev_res_data[patch_counter];
+                for (int depth = 0; depth < error_data->getDepth(); ++depth)
+                {
+                    patch_math_ops.laplace(
+                        res_data, alpha, beta, error_data, -1.0, residual_data, patch, depth, depth, depth);
+                }
+                patch_data_ops.linearSum(
+                    dir_data, chebyshev_dir_fac, dir_data, -chebyshev_res_fac / diag, res_data, patch->getBox());
+                patch_data_ops.add(error_data, error_data, dir_data, patch->getBox());
+                continue;
+            }
+
             // Smooth the error for each data depth.
             //
             // NOTE: Since the boundary conditions are handled "implicitly" by
@@ -492,12 +664,50 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             // data.
             const double& alpha = d_poisson_spec.getDConstant();
             const double& beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+            Pointer<CellData<NDIM, float> > single_error_data =
+                single_precision ? d_patch_single_error_data[level_num][patch_counter] :
+                                   Pointer<CellData<NDIM, float> >();
+            if (single_error_data)
+            {
+                // Update the single-precision data prior to the first sweep and
+                // after each ghost cell fill.
+                Pointer<CellData<NDIM, float> > single_residual_data =
+                    d_patch_single_residual_data[level_num][patch_counter];
+                if (isweep == 0)
+                {
+                    const int residual_width =
+                        (fill_residual_ghosts ? d_patch_redundant_sweep_width[level_num][patch_counter] : 0);
+                    convert_data(*single_error_data, *error_data, BoxList<NDIM>(error_data->getGhostBox()));
+                    convert_data(*single_residual_data,
+                                 *residual_data,
+                                 BoxList<NDIM>(Box<NDIM>::grow(patch->getBox(), residual_width)));
+                }
+                else if (exchange_ghosts)
+                {
+                    BoxList<NDIM> ghost_boxes(error_data->getGhostBox());
+                    ghost_boxes.removeIntersections(patch->getBox());
+                    convert_data(*single_error_data, *error_data, ghost_boxes);
+                }
+                for (int depth = 0; depth < error_data->getDepth(); ++depth)
+                {
+                    PatchMathKernels::gaussSeidelSmooth(single_error_data->getPointer(depth),
+                                                        (single_error_data->getGhostCellWidth()).max() - sweep_width,
+                                                        alpha,
+                                                        beta,
+                                                        single_residual_data->getPointer(depth),
+                                                        (single_residual_data->getGhostCellWidth()).max() - sweep_width,
+                                                        &smooth_box.lower()(0),
+                                                        &smooth_box.upper()(0),
+                                                        dx);
+                }
+                continue;
+            }
             for (int depth = 0; depth < error_data->getDepth(); ++depth)
             {
                 double* const U = error_data->getPointer(depth);
-                const int U_ghosts = (error_data->getGhostCellWidth()).max();
+                const int U_ghosts = (error_data->getGhostCellWidth()).max() - sweep_width;
                 const double* const F = residual_data->getPointer(depth);
-                const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                const int F_ghosts = (residual_data->getGhostCellWidth()).max() - sweep_width;
                 if (red_black_ordering)
                 {
                     int red_or_black = isweep % 2; // "red" = 0, "black" = 1
@@ -507,13 +717,13 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                                     beta,
                                     F,
                                     F_ghosts,
-                                    patch_box.lower(0),
-                                    patch_box.upper(0),
-                                    patch_box.lower(1),
-                                    patch_box.upper(1),
+                                    smooth_box.lower(0),
+                                    smooth_box.upper(0),
+                                    smooth_box.lower(1),
+                                    smooth_box.upper(1),
 #if (NDIM == 3)
-                                    patch_box.lower(2),
-                                    patch_box.upper(2),
+                                    smooth_box.lower(2),
+                                    smooth_box.upper(2),
 #endif
                                     dx,
                                     red_or_black);
@@ -526,19 +736,33 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                                  beta,
                                  F,
                                  F_ghosts,
-                                 patch_box.lower(0),
-                                 patch_box.upper(0),
-                                 patch_box.lower(1),
-                                 patch_box.upper(1),
+                                 smooth_box.lower(0),
+                                 smooth_box.upper(0),
+                                 smooth_box.lower(1),
+                                 smooth_box.upper(1),
 #if (NDIM == 3)
-                                 patch_box.lower(2),
-                                 patch_box.upper(2),
+                                 smooth_box.lower(2),
+                                 smooth_box.upper(2),
 #endif
                                  dx);
                 }
             }
         }
     }
+
+    // Copy the smoothed error back to double precision.
+    if (single_precision)
+    {
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            Pointer<CellData<NDIM, float> > single_error_data = d_patch_single_error_data[level_num][patch_counter];
+            if (!single_error_data) continue;
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            convert_data(*error_data, *single_error_data, BoxList<NDIM>(patch->getBox()));
+        }
+    }
     IBTK_TIMER_STOP(t_smooth_error);
     return;
 } // smoothError
@@ -716,7 +940,14 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     d_bc_op = new CartCellRobinPhysBdryOp(d_scratch_idx, d_bc_coefs, false);
 
     // Setup fill pattern spec objects.
-    d_op_stencil_fill_pattern = new CellNoCornersFillPattern(CELLG, true, false, false);
+    if (d_smoother_sweeps_per_exchange > 1)
+    {
+        d_op_stencil_fill_pattern = NULL;
+    }
+    else
+    {
+        d_op_stencil_fill_pattern = new CellNoCornersFillPattern(CELLG, true, false, false);
+    }
 
     // Get overlap information for setting patch boundary conditions.
     d_patch_bc_box_overlap.resize(d_finest_ln + 1);
@@ -736,6 +967,29 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         }
     }
 
+    // Allocate single-precision copies of the error and residual on patches
+    // that do not touch physical boundaries or coarse-fine interfaces.
+    d_patch_single_error_data.resize(d_finest_ln + 1);
+    d_patch_single_residual_data.resize(d_finest_ln + 1);
+    for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+        d_patch_single_error_data[ln].assign(num_local_patches, Pointer<CellData<NDIM, float> >());
+        d_patch_single_residual_data[ln].assign(num_local_patches, Pointer<CellData<NDIM, float> >());
+        if (!d_use_single_precision_smoother) continue;
+        const int depth = solution_pdat_fac->getDefaultDepth();
+        int patch_counter = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+        {
+            if (!d_patch_bdry_ghost_box_overlap[ln][patch_counter].isEmpty()) continue;
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            d_patch_single_error_data[ln][patch_counter] = new CellData<NDIM, float>(patch_box, depth, d_gcw);
+            d_patch_single_residual_data[ln][patch_counter] = new CellData<NDIM, float>(patch_box, depth, d_gcw);
+        }
+    }
+
     // Get overlap information for re-setting patch boundary conditions during
     // smoothing.
     d_patch_neighbor_overlap.resize(d_finest_ln + 1);
@@ -777,6 +1031,8 @@ CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const in
     {
         d_patch_bc_box_overlap.clear();
         d_patch_neighbor_overlap.clear();
+        d_patch_single_error_data.clear();
+        d_patch_single_residual_data.clear();
         if (d_coarse_solver) d_coarse_solver->deallocateSolverState();
     }
     return;
@@ -34,10 +34,14 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <cmath>
 #include <ostream>
 #include <string>
 #include <vector>
 
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
@@ -47,6 +51,7 @@
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
@@ -90,6 +95,30 @@ static Timer* t_prolong_error;
 static Timer* t_prolong_error_and_correct;
 static Timer* t_initialize_operator_state;
 static Timer* t_deallocate_operator_state;
+
+// Number of periodic images of a box (including the box itself).
+static const int NUM_PERIODIC_IMAGES = (NDIM == 2 ? 9 : 27);
+
+inline void
+add_periodic_images(BoxList<NDIM>& boxes, const BoxArray<NDIM>& src_boxes, const IntVector<NDIM>& periodic_shift)
+{
+    for (int i = 0; i < src_boxes.getNumberOfBoxes(); ++i)
+    {
+        for (int k = 0; k < NUM_PERIODIC_IMAGES; ++k)
+        {
+            IntVector<NDIM> periodic_offset = 0;
+            bool valid_offset = true;
+            for (int d = 0, code = k; d < NDIM; ++d, code /= 3)
+            {
+                const int sgn = code % 3 - 1;
+                if (sgn != 0 && periodic_shift(d) == 0) valid_offset = false;
+                periodic_offset(d) = sgn * periodic_shift(d);
+            }
+            if (valid_offset) boxes.appendItem(Box<NDIM>::shift(src_boxes[i], periodic_offset));
+        }
+    }
+    return;
+} // add_periodic_images
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -124,6 +153,10 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
       d_coarse_solver_rel_residual_tol(1.0e-5),
       d_coarse_solver_abs_residual_tol(1.0e-50),
       d_coarse_solver_max_iterations(10),
+      d_smoother_sweeps_per_exchange(1),
+      d_use_single_precision_smoother(false),
+      d_chebyshev_eig_lower_factor(0.1),
+      d_chebyshev_eig_upper_factor(1.0),
       d_context(NULL),
       d_bc_op(NULL),
       d_cf_bdry_op(),
@@ -173,6 +206,41 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
             d_coarse_solver_abs_residual_tol = input_db->getDouble("coarse_solver_abs_residual_tol");
         if (input_db->keyExists("coarse_solver_max_iterations"))
             d_coarse_solver_max_iterations = input_db->getInteger("coarse_solver_max_iterations");
+        if (input_db->keyExists("smoother_sweeps_per_exchange"))
+            d_smoother_sweeps_per_exchange = input_db->getInteger("smoother_sweeps_per_exchange");
+        if (input_db->keyExists("use_single_precision_smoother"))
+            d_use_single_precision_smoother = input_db->getBool("use_single_precision_smoother");
+        if (input_db->keyExists("chebyshev_eig_lower_factor"))
+            d_chebyshev_eig_lower_factor = input_db->getDouble("chebyshev_eig_lower_factor");
+        if (input_db->keyExists("chebyshev_eig_upper_factor"))
+            d_chebyshev_eig_upper_factor = input_db->getDouble("chebyshev_eig_upper_factor");
+    }
+
+    // Communication-avoiding smoothing requires that ghost cell data be wide
+    // enough to support all of the local sweeps performed between ghost cell
+    // fills.
+    if (d_smoother_sweeps_per_exchange < 1)
+    {
+        TBOX_ERROR(d_object_name << "::PoissonFACPreconditionerStrategy():\n"
+                                 << "  smoother_sweeps_per_exchange must be positive"
+                                 << std::endl);
+    }
+    if (d_gcw.min() < d_smoother_sweeps_per_exchange)
+    {
+        TBOX_ERROR(d_object_name << "::PoissonFACPreconditionerStrategy():\n"
+                                 << "  smoother_sweeps_per_exchange = "
+                                 << d_smoother_sweeps_per_exchange
+                                 << " requires ghost_cell_width >= "
+                                 << d_smoother_sweeps_per_exchange
+                                 << std::endl);
+    }
+
+    if (d_chebyshev_eig_lower_factor <= 0.0 || d_chebyshev_eig_upper_factor <= d_chebyshev_eig_lower_factor)
+    {
+        TBOX_ERROR(d_object_name << "::PoissonFACPreconditionerStrategy():\n"
+                                 << "  Chebyshev eigenvalue factors must satisfy\n"
+                                 << "  0 < chebyshev_eig_lower_factor < chebyshev_eig_upper_factor"
+                                 << std::endl);
     }
 
     // Setup scratch variables.
@@ -411,6 +479,77 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
     d_coarsest_ln = solution.getCoarsestLevelNumber();
     d_finest_ln = solution.getFinestLevelNumber();
 
+    // Determine the width by which each patch may be grown when performing
+    // redundant smoothing sweeps between ghost cell fills.  A patch is only
+    // grown when the grown box and its stencil lie entirely within the level
+    // (or its periodic images), so that redundant sweeps never touch ghost
+    // cells set by physical boundary conditions or coarse-fine interface
+    // interpolation.  The same information determines which patches may be
+    // smoothed using single-precision data.
+    d_patch_redundant_sweep_width.resize(d_finest_ln + 1);
+    d_patch_bdry_ghost_box_overlap.resize(d_finest_ln + 1);
+    if (d_smoother_sweeps_per_exchange > 1 || d_use_single_precision_smoother)
+    {
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+            BoxList<NDIM> level_boxes;
+            add_periodic_images(level_boxes, level->getBoxes(), periodic_shift);
+            const int num_local_patches = level->getProcessorMapping().getLocalIndices().getSize();
+            d_patch_redundant_sweep_width[ln].resize(num_local_patches);
+            d_patch_bdry_ghost_box_overlap[ln].resize(num_local_patches);
+            int patch_counter = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                BoxList<NDIM> nbr_boxes(level_boxes);
+                nbr_boxes.intersectBoxes(Box<NDIM>::grow(patch_box, d_smoother_sweeps_per_exchange));
+                int width = 0;
+                for (int w = 1; w < d_smoother_sweeps_per_exchange; ++w)
+                {
+                    BoxList<NDIM> exterior_boxes(Box<NDIM>::grow(patch_box, w + 1));
+                    exterior_boxes.removeIntersections(nbr_boxes);
+                    if (!exterior_boxes.isEmpty()) break;
+                    width = w;
+                }
+                d_patch_redundant_sweep_width[ln][patch_counter] = width;
+                d_patch_bdry_ghost_box_overlap[ln][patch_counter] = BoxList<NDIM>(Box<NDIM>::grow(patch_box, 1));
+                d_patch_bdry_ghost_box_overlap[ln][patch_counter].removeIntersections(nbr_boxes);
+            }
+        }
+    }
+
+    // Estimate the largest eigenvalue of the Jacobi-preconditioned operator on
+    // each level.  These estimates are used by polynomial smoothers and are
+    // obtained from Gershgorin's theorem applied to the constant-coefficient
+    // operator.
+    d_level_jacobi_max_eig.resize(d_finest_ln + 1, 0.0);
+    const bool constant_coefficients =
+        (d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) && d_poisson_spec.dIsConstant();
+    if (constant_coefficients)
+    {
+        Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+        const double* const dx_coarsest = grid_geom->getDx();
+        const double alpha = d_poisson_spec.getDConstant();
+        const double beta = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+        for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            const IntVector<NDIM>& ratio = level->getRatio();
+            double dx_fac = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double dx = dx_coarsest[d] / static_cast<double>(ratio(d));
+                dx_fac += 1.0 / (dx * dx);
+            }
+            const double diag = beta - 2.0 * alpha * dx_fac;
+            d_level_jacobi_max_eig[ln] = 1.0 + std::abs(2.0 * alpha * dx_fac / diag);
+        }
+    }
+
     // Perform implementation-specific initialization.
     initializeOperatorStateSpecialized(solution, rhs, coarsest_reset_ln, finest_reset_ln);
 #if !defined(NDEBUG)
@@ -564,6 +703,10 @@ PoissonFACPreconditionerStrategy::deallocateOperatorState()
 
         d_synch_refine_algorithm.setNull();
         d_synch_refine_schedules.resize(0);
+
+        d_patch_redundant_sweep_width.clear();
+        d_patch_bdry_ghost_box_overlap.clear();
+        d_level_jacobi_max_eig.clear();
     }
 
     // Clear the "reset level" range.
@@ -603,7 +746,11 @@ PoissonFACPreconditionerStrategy::xeqScheduleProlongation(const int dst_idx, con
     for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
     {
         ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
-        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->clearTargetPatchDataIndex();
+            extended_bc_coef->setHomogeneousBc(false);
+        }
     }
     return;
 } // xeqScheduleProlongation
@@ -642,7 +789,11 @@ PoissonFACPreconditionerStrategy::xeqScheduleGhostFillNoCoarse(const int dst_idx
     for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
     {
         ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
-        if (extended_bc_coef) extended_bc_coef->clearTargetPatchDataIndex();
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->clearTargetPatchDataIndex();
+            extended_bc_coef->setHomogeneousBc(false);
+        }
     }
     return;
 } // xeqScheduleGhostFillNoCoarse
@@ -658,6 +809,42 @@ PoissonFACPreconditionerStrategy::xeqScheduleDataSynch(const int dst_idx, const
     return;
 } // xeqScheduleDataSynch
 
+void
+PoissonFACPreconditionerStrategy::fillPhysicalBoundaryGhostCells(const int dst_idx, const int dst_ln)
+{
+    d_bc_op->setPatchDataIndex(dst_idx);
+    d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_bc_op->setHomogeneousBc(true);
+    for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->setTargetPatchDataIndex(dst_idx);
+            extended_bc_coef->setHomogeneousBc(true);
+        }
+    }
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+        {
+            d_bc_op->setPhysicalBoundaryConditions(*patch, d_solution_time, d_gcw);
+        }
+    }
+    for (unsigned int k = 0; k < d_bc_coefs.size(); ++k)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[k]);
+        if (extended_bc_coef)
+        {
+            extended_bc_coef->clearTargetPatchDataIndex();
+            extended_bc_coef->setHomogeneousBc(false);
+        }
+    }
+    return;
+} // fillPhysicalBoundaryGhostCells
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 //////////////////////////////////////////////////////////////////////////////
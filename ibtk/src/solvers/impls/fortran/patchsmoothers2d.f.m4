@@ -153,7 +153,7 @@ c
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( mod(i0+i1,2) .eq. red_or_black ) then
+            if ( modulo(i0+i1,2) .eq. red_or_black ) then
                U(i0,i1) = fac*(
      &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
      &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
@@ -290,7 +290,7 @@ c
 
       do i1 = ilower1,iupper1
          do i0 = ilower0,iupper0
-            if ( (mod(i0+i1,2) .eq. red_or_black) .and.
+            if ( (modulo(i0+i1,2) .eq. red_or_black) .and.
      &           (mask(i0,i1) .eq. 0) ) then
                U(i0,i1) = fac*(
      &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
@@ -167,7 +167,7 @@ c
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( mod(i0+i1+i2,2) .eq. red_or_black ) then
+               if ( modulo(i0+i1+i2,2) .eq. red_or_black ) then
                   U(i0,i1,i2) = fac*(
      &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
      &                 fac1*(U(i0,i1-1,i2)+U(i0,i1+1,i2)) +
@@ -321,7 +321,7 @@ c
       do i2 = ilower2,iupper2
          do i1 = ilower1,iupper1
             do i0 = ilower0,iupper0
-               if ( (mod(i0+i1+i2,2) .eq. red_or_black) .and.
+               if ( (modulo(i0+i1+i2,2) .eq. red_or_black) .and.
      &              (mask(i0,i1,i2) .eq. 0) ) then
                   U(i0,i1,i2) = fac*(
      &                 fac0*(U(i0-1,i1,i2)+U(i0+1,i1,i2)) +
@@ -42,6 +42,7 @@
 #include "VisItDataWriter.h"
 #include "ibtk/AppInitializer.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/TimestepProfiler.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -393,6 +394,12 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
         TimerManager::createManager(timer_manager_db);
     }
+
+    // Configure the per-time step profiler.
+    if (d_input_db->isDatabase("TimestepProfiler"))
+    {
+        TimestepProfiler::getProfiler()->getFromInput(d_input_db->getDatabase("TimestepProfiler"));
+    }
     return;
 } // AppInitializer
 
@@ -78,6 +78,8 @@
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/TimestepProfiler.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -337,15 +339,19 @@ HierarchyIntegrator::advanceHierarchy(double dt)
     if (d_enable_logging)
         plog << d_object_name << "::advanceHierarchy(): time interval = [" << current_time << "," << new_time
              << "], dt = " << dt << "\n";
+    TimestepProfiler* profiler = TimestepProfiler::getProfiler();
+    profiler->beginTimestep(d_integrator_step, current_time);
 
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
         if (d_enable_logging)
             plog << d_object_name << "::advanceHierarchy(): regridding prior to timestep " << d_integrator_step << "\n";
+        profiler->startPhase(PROFILE_REGRID);
         d_regridding_hierarchy = true;
         regridHierarchy();
         d_regridding_hierarchy = false;
+        profiler->stopPhase(PROFILE_REGRID);
         d_at_regrid_time_step = true;
     }
 
@@ -915,6 +921,12 @@ HierarchyIntegrator::resetHierarchyConfiguration(const Pointer<BasePatchHierarch
         }
     }
 
+    // Discard any boundary condition coefficients cached for the old patch
+    // hierarchy configuration.
+    RobinPhysBdryPatchStrategy* const fill_after_regrid_robin_bc_op =
+        dynamic_cast<RobinPhysBdryPatchStrategy*>(d_fill_after_regrid_phys_bdry_bc_op);
+    if (fill_after_regrid_robin_bc_op) fill_after_regrid_robin_bc_op->clearBcCoefCache();
+
     // Perform specialized reset operations.
     resetHierarchyConfigurationSpecialized(base_hierarchy, coarsest_level, finest_level);
 
@@ -0,0 +1,470 @@
+// Filename: TimestepProfiler.cpp
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ibtk/TimestepProfiler.h"
+#include "ibtk/ibtk_enums.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Labels used for the phases in the timelines and in the imbalance report.
+static const char* const PHASE_LABELS[NUM_PROFILING_PHASES + 1] = {
+    "spread", "interp", "force", "stokes_solve", "regrid", "ghost_fill", "io", "timestep"
+};
+
+// Default buffer sizes.
+static const int DEFAULT_EVENT_BUFFER_SIZE = 65536;
+static const int DEFAULT_STEP_BUFFER_SIZE = 4096;
+} // namespace
+
+TimestepProfiler* TimestepProfiler::s_profiler_instance = NULL;
+bool TimestepProfiler::s_registered_callback = false;
+unsigned char TimestepProfiler::s_shutdown_priority = 200;
+
+TimestepProfiler*
+TimestepProfiler::getProfiler()
+{
+    if (!s_profiler_instance)
+    {
+        s_profiler_instance = new TimestepProfiler();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeProfiler, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_profiler_instance;
+} // getProfiler
+
+void
+TimestepProfiler::freeProfiler()
+{
+    if (s_profiler_instance && s_profiler_instance->d_enabled)
+    {
+        s_profiler_instance->endTimestep();
+        s_profiler_instance->writeData();
+    }
+    delete s_profiler_instance;
+    s_profiler_instance = NULL;
+    return;
+} // freeProfiler
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+TimestepProfiler::getFromInput(Pointer<Database> db)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(db);
+#endif
+    if (db->keyExists("output_dirname")) setOutputDirectory(db->getString("output_dirname"));
+    if (db->keyExists("timeline_format"))
+    {
+        setTimelineFormat(string_to_enum<ProfilingTimelineFormat>(db->getString("timeline_format")));
+    }
+    int event_buffer_size = d_event_buffer_size;
+    int step_buffer_size = d_step_buffer_size;
+    if (db->keyExists("event_buffer_size")) event_buffer_size = db->getInteger("event_buffer_size");
+    if (db->keyExists("step_buffer_size")) step_buffer_size = db->getInteger("step_buffer_size");
+    setBufferSizes(event_buffer_size, step_buffer_size);
+    if (db->keyExists("enabled")) setEnabled(db->getBool("enabled"));
+    return;
+} // getFromInput
+
+void
+TimestepProfiler::setEnabled(const bool enabled)
+{
+    if (enabled == d_enabled) return;
+    d_enabled = enabled;
+    if (d_enabled)
+    {
+        setBufferSizes(d_event_buffer_size, d_step_buffer_size);
+    }
+    else
+    {
+        d_in_timestep = false;
+        for (int phase = 0; phase < NUM_PROFILING_PHASES; ++phase) d_phase_depth[phase] = 0;
+    }
+    return;
+} // setEnabled
+
+void
+TimestepProfiler::setOutputDirectory(const std::string& dirname)
+{
+    d_output_dirname = dirname;
+    while (d_output_dirname.size() > 1 && d_output_dirname[d_output_dirname.size() - 1] == '/')
+    {
+        d_output_dirname.erase(d_output_dirname.size() - 1);
+    }
+    return;
+} // setOutputDirectory
+
+void
+TimestepProfiler::setTimelineFormat(const ProfilingTimelineFormat timeline_format)
+{
+    if (timeline_format != CHROME_TRACE_FORMAT && timeline_format != CSV_FORMAT)
+    {
+        TBOX_ERROR("TimestepProfiler::setTimelineFormat():\n"
+                   << "  unsupported timeline format: "
+                   << enum_to_string<ProfilingTimelineFormat>(timeline_format)
+                   << "\n"
+                   << "  supported timeline formats are: CHROME_TRACE_FORMAT, CSV_FORMAT\n");
+    }
+    d_timeline_format = timeline_format;
+    return;
+} // setTimelineFormat
+
+void
+TimestepProfiler::setBufferSizes(const int event_buffer_size, const int step_buffer_size)
+{
+    if (event_buffer_size < 0 || step_buffer_size < 0)
+    {
+        TBOX_ERROR("TimestepProfiler::setBufferSizes():\n"
+                   << "  buffer sizes must be nonnegative\n"
+                   << "  event_buffer_size = "
+                   << event_buffer_size
+                   << ", step_buffer_size = "
+                   << step_buffer_size
+                   << "\n");
+    }
+    d_event_buffer_size = event_buffer_size;
+    d_step_buffer_size = step_buffer_size;
+
+    // Only allocate the buffers once profiling has been enabled.
+    if (d_enabled)
+    {
+        d_events.resize(d_event_buffer_size);
+        d_steps.resize(d_step_buffer_size);
+    }
+    reset();
+    return;
+} // setBufferSizes
+
+void
+TimestepProfiler::beginTimestep(const int step_num, const double sim_time)
+{
+    if (!d_enabled) return;
+    endTimestep();
+    d_in_timestep = true;
+    d_current_step.step_num = step_num;
+    d_current_step.sim_time = sim_time;
+    d_current_step.start_time = MPI_Wtime() - d_reference_time;
+    d_current_step.duration = 0.0;
+    for (int phase = 0; phase < NUM_PROFILING_PHASES; ++phase) d_current_step.phase_time[phase] = 0.0;
+    return;
+} // beginTimestep
+
+void
+TimestepProfiler::endTimestep()
+{
+    if (!d_enabled || !d_in_timestep) return;
+    d_in_timestep = false;
+    d_current_step.duration = MPI_Wtime() - d_reference_time - d_current_step.start_time;
+    if (d_steps.empty()) return;
+    d_steps[d_next_step] = d_current_step;
+    d_next_step = (d_next_step + 1) % d_steps.size();
+    if (d_num_steps < d_steps.size()) ++d_num_steps;
+    return;
+} // endTimestep
+
+void
+TimestepProfiler::writeData()
+{
+    if (!d_enabled) return;
+    Utilities::recursiveMkdir(d_output_dirname);
+    SAMRAI_MPI::barrier();
+    writeTimeline(d_output_dirname);
+    writeImbalanceReport(d_output_dirname);
+    return;
+} // writeData
+
+void
+TimestepProfiler::reset()
+{
+    d_next_event = 0;
+    d_num_events = 0;
+    d_num_dropped_events = 0;
+    d_next_step = 0;
+    d_num_steps = 0;
+    d_in_timestep = false;
+    for (int phase = 0; phase < NUM_PROFILING_PHASES; ++phase) d_phase_depth[phase] = 0;
+    return;
+} // reset
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+TimestepProfiler::TimestepProfiler()
+    : d_enabled(false),
+      d_output_dirname("timestep_profile"),
+      d_timeline_format(CHROME_TRACE_FORMAT),
+      d_reference_time(MPI_Wtime()),
+      d_event_buffer_size(DEFAULT_EVENT_BUFFER_SIZE),
+      d_step_buffer_size(DEFAULT_STEP_BUFFER_SIZE),
+      d_events(),
+      d_next_event(0),
+      d_num_events(0),
+      d_num_dropped_events(0),
+      d_steps(),
+      d_next_step(0),
+      d_num_steps(0),
+      d_in_timestep(false),
+      d_current_step()
+{
+    for (int phase = 0; phase < NUM_PROFILING_PHASES; ++phase)
+    {
+        d_phase_depth[phase] = 0;
+        d_phase_start_time[phase] = 0.0;
+    }
+    return;
+} // TimestepProfiler
+
+TimestepProfiler::~TimestepProfiler()
+{
+    // intentionally blank
+    return;
+} // ~TimestepProfiler
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+TimestepProfiler::recordPhase(const ProfilingPhase phase, const double start_time, const double stop_time)
+{
+    const double duration = stop_time - start_time;
+    if (d_in_timestep) d_current_step.phase_time[phase] += duration;
+    if (d_events.empty()) return;
+    Event& event = d_events[d_next_event];
+    event.step_num = d_in_timestep ? d_current_step.step_num : -1;
+    event.phase = phase;
+    event.start_time = start_time - d_reference_time;
+    event.duration = duration;
+    d_next_event = (d_next_event + 1) % d_events.size();
+    if (d_num_events < d_events.size())
+    {
+        ++d_num_events;
+    }
+    else
+    {
+        ++d_num_dropped_events;
+    }
+    return;
+} // recordPhase
+
+void
+TimestepProfiler::writeTimeline(const std::string& dirname) const
+{
+    const int rank = SAMRAI_MPI::getRank();
+    const bool chrome_trace = d_timeline_format == CHROME_TRACE_FORMAT;
+    std::ostringstream file_name;
+    file_name << dirname << "/timeline." << rank << (chrome_trace ? ".json" : ".csv");
+    std::ofstream os(file_name.str().c_str(), std::ios::out);
+    if (!os.is_open())
+    {
+        TBOX_ERROR("TimestepProfiler::writeTimeline():\n"
+                   << "  unable to open file "
+                   << file_name.str()
+                   << " for writing\n");
+    }
+    os.setf(std::ios_base::fixed);
+
+    const unsigned int first_step = d_steps.empty() ? 0 : (d_next_step + d_steps.size() - d_num_steps) % d_steps.size();
+    const unsigned int first_event =
+        d_events.empty() ? 0 : (d_next_event + d_events.size() - d_num_events) % d_events.size();
+    if (chrome_trace)
+    {
+        // Trace event timestamps and durations are in microseconds.  Time steps
+        // are shown on thread 0 and the phases on thread 1 of each process.
+        os.precision(3);
+        os << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"rank\":" << rank
+           << ",\"dropped_events\":" << d_num_dropped_events << "},\"traceEvents\":[\n";
+        os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":0,\"args\":{\"name\":\"rank "
+           << rank << "\"}}";
+        for (unsigned int k = 0; k < d_num_steps; ++k)
+        {
+            const StepRecord& record = d_steps[(first_step + k) % d_steps.size()];
+            os << ",\n{\"name\":\"" << PHASE_LABELS[NUM_PROFILING_PHASES] << " " << record.step_num
+               << "\",\"cat\":\"timestep\",\"ph\":\"X\",\"pid\":" << rank << ",\"tid\":0,\"ts\":"
+               << 1.0e6 * record.start_time << ",\"dur\":" << 1.0e6 * record.duration
+               << ",\"args\":{\"step\":" << record.step_num << ",\"time\":" << std::setprecision(9)
+               << record.sim_time << std::setprecision(3) << "}}";
+        }
+        for (unsigned int k = 0; k < d_num_events; ++k)
+        {
+            const Event& event = d_events[(first_event + k) % d_events.size()];
+            os << ",\n{\"name\":\"" << PHASE_LABELS[event.phase] << "\",\"cat\":\"phase\",\"ph\":\"X\",\"pid\":"
+               << rank << ",\"tid\":1,\"ts\":" << 1.0e6 * event.start_time << ",\"dur\":" << 1.0e6 * event.duration
+               << ",\"args\":{\"step\":" << event.step_num << "}}";
+        }
+        os << "\n]}\n";
+    }
+    else
+    {
+        // Times are in seconds.  Events recorded outside of a time step are
+        // assigned the step number -1.
+        os.precision(9);
+        os << "step,phase,start_time,duration\n";
+        for (unsigned int k = 0; k < d_num_steps; ++k)
+        {
+            const StepRecord& record = d_steps[(first_step + k) % d_steps.size()];
+            os << record.step_num << "," << PHASE_LABELS[NUM_PROFILING_PHASES] << "," << record.start_time << ","
+               << record.duration << "\n";
+        }
+        for (unsigned int k = 0; k < d_num_events; ++k)
+        {
+            const Event& event = d_events[(first_event + k) % d_events.size()];
+            os << event.step_num << "," << PHASE_LABELS[event.phase] << "," << event.start_time << ","
+               << event.duration << "\n";
+        }
+    }
+    os.close();
+    return;
+} // writeTimeline
+
+void
+TimestepProfiler::writeImbalanceReport(const std::string& dirname) const
+{
+    // Only the time steps that have been retained on every process are
+    // included in the report.
+    const int num_steps = SAMRAI_MPI::minReduction(static_cast<int>(d_num_steps));
+    if (num_steps == 0) return;
+    const int nodes = SAMRAI_MPI::getNodes();
+
+    // Determine the maximum and average time spent in each phase (and in the
+    // entire time step) during each time step.
+    static const int NUM_VALS = NUM_PROFILING_PHASES + 1;
+    const unsigned int first_step = (d_next_step + d_steps.size() - num_steps) % d_steps.size();
+    std::vector<double> max_vals(num_steps * NUM_VALS), avg_vals(num_steps * NUM_VALS);
+    for (int k = 0; k < num_steps; ++k)
+    {
+        const StepRecord& record = d_steps[(first_step + k) % d_steps.size()];
+        for (int phase = 0; phase < NUM_PROFILING_PHASES; ++phase)
+        {
+            max_vals[k * NUM_VALS + phase] = record.phase_time[phase];
+        }
+        max_vals[k * NUM_VALS + NUM_PROFILING_PHASES] = record.duration;
+    }
+    avg_vals = max_vals;
+    SAMRAI_MPI::maxReduction(&max_vals[0], num_steps * NUM_VALS);
+    SAMRAI_MPI::sumReduction(&avg_vals[0], num_steps * NUM_VALS);
+    if (SAMRAI_MPI::getRank() != 0) return;
+    for (int i = 0; i < num_steps * NUM_VALS; ++i)
+    {
+        avg_vals[i] /= static_cast<double>(nodes);
+    }
+
+    // Write the per-step report.
+    const std::string file_name = dirname + "/timestep_imbalance.csv";
+    std::ofstream os(file_name.c_str(), std::ios::out);
+    if (!os.is_open())
+    {
+        TBOX_ERROR("TimestepProfiler::writeImbalanceReport():\n"
+                   << "  unable to open file "
+                   << file_name
+                   << " for writing\n");
+    }
+    os.setf(std::ios_base::scientific);
+    os.precision(6);
+    os << "step,time,phase,max,avg,max_over_avg\n";
+    for (int k = 0; k < num_steps; ++k)
+    {
+        const StepRecord& record = d_steps[(first_step + k) % d_steps.size()];
+        for (int v = 0; v < NUM_VALS; ++v)
+        {
+            const double max_val = max_vals[k * NUM_VALS + v];
+            const double avg_val = avg_vals[k * NUM_VALS + v];
+            os << record.step_num << "," << record.sim_time << "," << PHASE_LABELS[v] << "," << max_val << ","
+               << avg_val << "," << (avg_val > 0.0 ? max_val / avg_val : 1.0) << "\n";
+        }
+    }
+    os.close();
+
+    // Summarize the report.  The imbalance of each phase is the ratio of the
+    // total of the per-step maximum times to the total of the per-step average
+    // times, and the peak step is the time step with the largest maximum time.
+    plog << "TimestepProfiler::writeData(): load imbalance over the last " << num_steps << " time steps on "
+         << nodes << " processes\n";
+    plog << "  " << std::left << std::setw(14) << "phase" << std::right << std::setw(16) << "mean max (s)"
+         << std::setw(16) << "mean avg (s)" << std::setw(10) << "max/avg" << std::setw(12) << "peak step"
+         << std::setw(16) << "peak max (s)" << std::setw(14) << "peak max/avg"
+         << "\n";
+    for (int v = 0; v < NUM_VALS; ++v)
+    {
+        double total_max = 0.0, total_avg = 0.0;
+        int peak_k = 0;
+        for (int k = 0; k < num_steps; ++k)
+        {
+            total_max += max_vals[k * NUM_VALS + v];
+            total_avg += avg_vals[k * NUM_VALS + v];
+            if (max_vals[k * NUM_VALS + v] > max_vals[peak_k * NUM_VALS + v]) peak_k = k;
+        }
+        const double peak_max = max_vals[peak_k * NUM_VALS + v];
+        const double peak_avg = avg_vals[peak_k * NUM_VALS + v];
+        plog << "  " << std::left << std::setw(14) << PHASE_LABELS[v] << std::right << std::scientific
+             << std::setprecision(4) << std::setw(16) << total_max / num_steps << std::setw(16)
+             << total_avg / num_steps << std::fixed << std::setprecision(3) << std::setw(10)
+             << (total_avg > 0.0 ? total_max / total_avg : 1.0) << std::setw(12)
+             << d_steps[(first_step + peak_k) % d_steps.size()].step_num << std::scientific << std::setprecision(4)
+             << std::setw(16) << peak_max << std::fixed << std::setprecision(3) << std::setw(14)
+             << (peak_avg > 0.0 ? peak_max / peak_avg : 1.0) << "\n";
+    }
+    plog.unsetf(std::ios_base::floatfield);
+    plog << std::setprecision(6);
+    return;
+} // writeImbalanceReport
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,249 @@
+// Filename: WorkloadModel.cpp
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+
+#include "Box.h"
+#include "CellData.h"
+#include "Patch.h"
+#include "PatchCellDataOpsReal.h"
+#include "PatchLevel.h"
+#include "ibtk/WorkloadModel.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+WorkloadModel::WorkloadModel(const int window_size)
+    : d_window_size(window_size), d_cell_cost(1.0), d_item_cost(1.0), d_patch_cost(0.0)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(window_size >= 0);
+#endif
+    reset();
+    return;
+} // WorkloadModel
+
+WorkloadModel::~WorkloadModel()
+{
+    // intentionally blank
+    return;
+} // ~WorkloadModel
+
+void
+WorkloadModel::setWindowSize(const int window_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(window_size >= 0);
+#endif
+    d_window_size = window_size;
+    reset();
+    return;
+} // setWindowSize
+
+int
+WorkloadModel::getWindowSize() const
+{
+    return d_window_size;
+} // getWindowSize
+
+bool
+WorkloadModel::isEnabled() const
+{
+    return d_window_size > 0;
+} // isEnabled
+
+void
+WorkloadModel::recordInteractionSample(const int num_items, const double wall_time)
+{
+    const double n = static_cast<double>(num_items);
+    d_num_interaction_samples += 1.0;
+    d_sum_items += n;
+    d_sum_items_sq += n * n;
+    d_sum_time += wall_time;
+    d_sum_items_time += n * wall_time;
+    return;
+} // recordInteractionSample
+
+void
+WorkloadModel::recordLagrangianSample(const double wall_time)
+{
+    d_lag_time += wall_time;
+    return;
+} // recordLagrangianSample
+
+void
+WorkloadModel::recordEulerianSample(const int num_cells, const int num_items, const double wall_time)
+{
+    d_num_eul_samples += 1.0;
+    d_eul_cells += static_cast<double>(num_cells);
+    d_eul_items += static_cast<double>(num_items);
+    d_eul_time += wall_time;
+    return;
+} // recordEulerianSample
+
+bool
+WorkloadModel::calibrate()
+{
+    if (!isEnabled()) return false;
+
+    // Sum the accumulated timings over all processes.
+    static const int NSUMS = 10;
+    double sums[NSUMS] = { d_num_interaction_samples,
+                           d_sum_items,
+                           d_sum_items_sq,
+                           d_sum_time,
+                           d_sum_items_time,
+                           d_lag_time,
+                           d_num_eul_samples,
+                           d_eul_cells,
+                           d_eul_items,
+                           d_eul_time };
+    SAMRAI_MPI::sumReduction(sums, NSUMS);
+    const double num_interaction_samples = sums[0];
+    const double sum_items = sums[1];
+    const double sum_items_sq = sums[2];
+    const double sum_time = sums[3];
+    const double sum_items_time = sums[4];
+    const double lag_time = sums[5];
+    const double eul_cells = sums[7];
+    const double eul_items = sums[8];
+    const double eul_time = sums[9];
+
+    // Eulerian samples are recorded on every process at each time step, so the
+    // number of time steps in the window is the per-process sample count.
+    const double num_steps = sums[6] / static_cast<double>(SAMRAI_MPI::getNodes());
+    if (num_steps < static_cast<double>(d_window_size)) return false;
+    if (eul_cells <= 0.0 || eul_items <= 0.0 || eul_time <= 0.0)
+    {
+        reset();
+        return false;
+    }
+
+    // Fit the per-patch overhead of the interaction timings by least squares.
+    double patch_cost = 0.0;
+    const double denom = num_interaction_samples * sum_items_sq - sum_items * sum_items;
+    if (num_interaction_samples > 1.0 && denom > 0.0)
+    {
+        const double slope = (num_interaction_samples * sum_items_time - sum_items * sum_time) / denom;
+        patch_cost = std::max((sum_time - std::max(slope, 0.0) * sum_items) / num_interaction_samples, 0.0);
+    }
+
+    // Attribute the remaining Lagrangian time to the items.  Each Eulerian
+    // sample counts the items assigned to a process during one time step, so
+    // eul_items is the number of item-steps in the window.
+    d_cell_cost = eul_time / eul_cells;
+    d_item_cost = std::max(sum_time - patch_cost * num_interaction_samples + lag_time, 0.0) / eul_items;
+    d_patch_cost = patch_cost;
+    reset();
+    return true;
+} // calibrate
+
+void
+WorkloadModel::reset()
+{
+    d_num_interaction_samples = 0.0;
+    d_sum_items = 0.0;
+    d_sum_items_sq = 0.0;
+    d_sum_time = 0.0;
+    d_sum_items_time = 0.0;
+    d_lag_time = 0.0;
+    d_num_eul_samples = 0.0;
+    d_eul_cells = 0.0;
+    d_eul_items = 0.0;
+    d_eul_time = 0.0;
+    return;
+} // reset
+
+double
+WorkloadModel::getCellCost() const
+{
+    return d_cell_cost;
+} // getCellCost
+
+double
+WorkloadModel::getItemCost() const
+{
+    return d_item_cost;
+} // getItemCost
+
+double
+WorkloadModel::getPatchCost() const
+{
+    return d_patch_cost;
+} // getPatchCost
+
+double
+WorkloadModel::getRelativeItemCost() const
+{
+    return d_item_cost / d_cell_cost;
+} // getRelativeItemCost
+
+void
+WorkloadModel::addPatchCostToWorkload(Pointer<PatchLevel<NDIM> > level,
+                                      const int workload_idx,
+                                      const int item_count_idx) const
+{
+    const double relative_patch_cost = d_patch_cost / d_cell_cost;
+    if (relative_patch_cost <= 0.0) return;
+    PatchCellDataOpsReal<NDIM, double> patch_cc_data_ops;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, double> > item_count_data = patch->getPatchData(item_count_idx);
+        if (patch_cc_data_ops.max(item_count_data, patch_box) <= 0.0) continue;
+        Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(workload_idx);
+        patch_cc_data_ops.addScalar(
+            workload_data, workload_data, relative_patch_cost / static_cast<double>(patch_box.size()), patch_box);
+    }
+    return;
+} // addPatchCostToWorkload
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
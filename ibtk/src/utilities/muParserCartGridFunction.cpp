@@ -32,31 +32,29 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <map>
 #include <ostream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "ArrayData.h"
 #include "Box.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
-#include "CellIndex.h"
-#include "CellIterator.h"
 #include "FaceData.h"
-#include "FaceIndex.h"
-#include "FaceIterator.h"
+#include "FaceGeometry.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "NodeData.h"
-#include "NodeIndex.h"
-#include "NodeIterator.h"
+#include "NodeGeometry.h"
 #include "Patch.h"
 #include "PatchData.h"
 #include "SideData.h"
-#include "SideIndex.h"
-#include "SideIterator.h"
+#include "SideGeometry.h"
+#include "boost/array.hpp"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/muParserCartGridFunction.h"
@@ -102,8 +100,11 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
       d_constants(),
       d_function_strings(),
       d_parsers(),
+      d_parser_is_constant(),
+      d_is_time_dependent(true),
       d_parser_time(),
-      d_parser_posn()
+      d_parser_posn(),
+      d_parser_vals()
 {
 #if !defined(NDEBUG)
     TBOX_ASSERT(!object_name.empty());
@@ -275,19 +276,39 @@ muParserCartGridFunction::muParserCartGridFunction(const std::string& object_nam
         {
             it->DefineConst(map_cit->first, map_cit->second);
         }
+    }
 
-        // Variables.
-        it->DefineVar("T", &d_parser_time);
-        it->DefineVar("t", &d_parser_time);
-        for (unsigned int d = 0; d < NDIM; ++d)
+    // Variables.  The time and position variables are bound to arrays so that
+    // the parsers may be evaluated in bulk over entire patch boxes.
+    resizeParserBuffers(1);
+
+    // Determine which functions depend on time and which do not depend on any
+    // variables at all.
+    d_is_time_dependent = false;
+    d_parser_is_constant.resize(d_parsers.size());
+    for (unsigned int k = 0; k < d_parsers.size(); ++k)
+    {
+        try
         {
-            std::ostringstream stream;
-            stream << d;
-            const std::string postfix = stream.str();
-            it->DefineVar("X" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("X_" + postfix, &(d_parser_posn[d]));
-            it->DefineVar("x_" + postfix, &(d_parser_posn[d]));
+            const mu::varmap_type& used_vars = d_parsers[k].GetUsedVar();
+            d_is_time_dependent =
+                d_is_time_dependent || used_vars.count("T") > 0 || used_vars.count("t") > 0;
+            d_parser_is_constant[k] = used_vars.empty();
+        }
+        catch (mu::ParserError& e)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  error: "
+                       << e.GetMsg()
+                       << "\n"
+                       << "  in:    "
+                       << e.GetExpr()
+                       << "\n");
+        }
+        catch (...)
+        {
+            TBOX_ERROR("muParserCartGridFunction::muParserCartGridFunction():\n"
+                       << "  unrecognized exception generated by muParser library.\n");
         }
     }
     return;
@@ -305,6 +326,12 @@ muParserCartGridFunction::isTimeDependent() const
     return true;
 } // isTimeDependent
 
+bool
+muParserCartGridFunction::usesTimeVariable() const
+{
+    return d_is_time_dependent;
+} // usesTimeVariable
+
 void
 muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          Pointer<Variable<NDIM> > /*var*/,
@@ -313,15 +340,21 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                                          const bool /*initial_time*/,
                                          Pointer<PatchLevel<NDIM> > /*level*/)
 {
-    d_parser_time = data_time;
-
     const Box<NDIM>& patch_box = patch->getBox();
-    const Index<NDIM>& patch_lower = patch_box.lower();
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
 
     const double* const XLower = pgeom->getXLower();
     const double* const dx = pgeom->getDx();
 
+    // The position of the data point with index i is
+    //
+    //    X(box_axis[c]) = x0[c] + h[c] * (i(c) - box.lower(c)),
+    //
+    // in which box_axis maps the components of the (possibly permuted) data
+    // index space to the coordinate axes.
+    boost::array<int, NDIM> box_axis;
+    boost::array<double, NDIM> x0, h;
+
     // Set the data in the patch.
     Pointer<PatchData<NDIM> > data = patch->getPatchData(data_idx);
 #if !defined(NDEBUG)
@@ -336,36 +369,17 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(cc_data->getDepth()));
 #endif
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            box_axis[d] = d;
+            x0[d] = XLower[d] + 0.5 * dx[d];
+            h[d] = dx[d];
+        }
         for (int data_depth = 0; data_depth < cc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (CellIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const CellIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                }
-                try
-                {
-                    (*cc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
-            }
+            setDataOnBox(
+                cc_data->getArrayData(), data_depth, function_depth, patch_box, box_axis, x0, h, data_time);
         }
     }
     else if (fc_data)
@@ -399,42 +413,23 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (FaceIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                // Face-centered data are stored in permuted index spaces in
+                // which the first component corresponds to the face normal.
+                for (unsigned int c = 0; c < NDIM; ++c)
                 {
-                    const FaceIndex<NDIM>& i = ic();
-                    const Index<NDIM>& cell_idx = i.toCell(1);
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] =
-                                XLower[d] + dx[d] * (static_cast<double>(cell_idx(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*fc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    const unsigned int d = (axis + c) % NDIM;
+                    box_axis[c] = d;
+                    x0[c] = XLower[d] + (d == axis ? 0.0 : 0.5) * dx[d];
+                    h[c] = dx[d];
                 }
+                setDataOnBox(fc_data->getArrayData(axis),
+                             data_depth,
+                             function_depth,
+                             FaceGeometry<NDIM>::toFaceBox(patch_box, axis),
+                             box_axis,
+                             x0,
+                             h,
+                             data_time);
             }
         }
     }
@@ -443,36 +438,23 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
 #if !defined(NDEBUG)
         TBOX_ASSERT(d_parsers.size() == 1 || d_parsers.size() == static_cast<unsigned int>(nc_data->getDepth()));
 #endif
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            box_axis[d] = d;
+            x0[d] = XLower[d];
+            h[d] = dx[d];
+        }
         for (int data_depth = 0; data_depth < nc_data->getDepth(); ++data_depth)
         {
             const int function_depth = (d_parsers.size() == 1 ? 0 : data_depth);
-            for (NodeIterator<NDIM> ic(patch_box); ic; ic++)
-            {
-                const NodeIndex<NDIM>& i = ic();
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                }
-                try
-                {
-                    (*nc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                }
-                catch (mu::ParserError& e)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  error: "
-                               << e.GetMsg()
-                               << "\n"
-                               << "  in:    "
-                               << e.GetExpr()
-                               << "\n");
-                }
-                catch (...)
-                {
-                    TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                               << "  unrecognized exception generated by muParser library.\n");
-                }
-            }
+            setDataOnBox(nc_data->getArrayData(),
+                         data_depth,
+                         function_depth,
+                         NodeGeometry<NDIM>::toNodeBox(patch_box),
+                         box_axis,
+                         x0,
+                         h,
+                         data_time);
         }
     }
     else if (sc_data)
@@ -506,40 +488,20 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
                     function_depth = NDIM * data_depth + axis;
                 }
 
-                for (SideIterator<NDIM> ic(patch_box, axis); ic; ic++)
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const SideIndex<NDIM>& i = ic();
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        if (d == axis)
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)));
-                        }
-                        else
-                        {
-                            d_parser_posn[d] = XLower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
-                        }
-                    }
-                    try
-                    {
-                        (*sc_data)(i, data_depth) = d_parsers[function_depth].Eval();
-                    }
-                    catch (mu::ParserError& e)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  error: "
-                                   << e.GetMsg()
-                                   << "\n"
-                                   << "  in:    "
-                                   << e.GetExpr()
-                                   << "\n");
-                    }
-                    catch (...)
-                    {
-                        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
-                                   << "  unrecognized exception generated by muParser library.\n");
-                    }
+                    box_axis[d] = d;
+                    x0[d] = XLower[d] + (d == axis ? 0.0 : 0.5) * dx[d];
+                    h[d] = dx[d];
                 }
+                setDataOnBox(sc_data->getArrayData(axis),
+                             data_depth,
+                             function_depth,
+                             SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                             box_axis,
+                             x0,
+                             h,
+                             data_time);
             }
         }
     }
@@ -552,6 +514,102 @@ muParserCartGridFunction::setDataOnPatch(const int data_idx,
     return;
 } // setDataOnPatch
 
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+muParserCartGridFunction::resizeParserBuffers(const int bulk_size)
+{
+    if (static_cast<int>(d_parser_time.size()) >= bulk_size) return;
+
+    // Resizing the buffers may invalidate the addresses stored by the parsers,
+    // so the variables must be re-bound.
+    d_parser_time.resize(bulk_size);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        d_parser_posn[d].resize(bulk_size);
+    }
+    d_parser_vals.resize(bulk_size);
+    for (std::vector<mu::Parser>::iterator it = d_parsers.begin(); it != d_parsers.end(); ++it)
+    {
+        it->DefineVar("T", &d_parser_time[0]);
+        it->DefineVar("t", &d_parser_time[0]);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            std::ostringstream stream;
+            stream << d;
+            const std::string postfix = stream.str();
+            it->DefineVar("X" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("x" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("X_" + postfix, &d_parser_posn[d][0]);
+            it->DefineVar("x_" + postfix, &d_parser_posn[d][0]);
+        }
+    }
+    return;
+} // resizeParserBuffers
+
+void
+muParserCartGridFunction::setDataOnBox(ArrayData<NDIM, double>& data,
+                                       const int data_depth,
+                                       const int function_depth,
+                                       const Box<NDIM>& box,
+                                       const boost::array<int, NDIM>& box_axis,
+                                       const boost::array<double, NDIM>& x0,
+                                       const boost::array<double, NDIM>& h,
+                                       const double data_time)
+{
+    if (box.empty()) return;
+    mu::Parser& parser = d_parsers[function_depth];
+    try
+    {
+        // Functions that do not depend on any variables need only be evaluated
+        // once.
+        if (d_parser_is_constant[function_depth])
+        {
+            data.fill(parser.Eval(), box, data_depth);
+            return;
+        }
+
+        // Set the time and position variables for all of the data points in
+        // the box and evaluate the function in bulk.
+        const int bulk_size = box.size();
+        resizeParserBuffers(bulk_size);
+        std::fill(d_parser_time.begin(), d_parser_time.begin() + bulk_size, data_time);
+        int k = 0;
+        for (Box<NDIM>::Iterator b(box); b; b++, ++k)
+        {
+            const Index<NDIM>& i = b();
+            for (unsigned int c = 0; c < NDIM; ++c)
+            {
+                d_parser_posn[box_axis[c]][k] = x0[c] + h[c] * static_cast<double>(i(c) - box.lower(c));
+            }
+        }
+        parser.Eval(&d_parser_vals[0], bulk_size);
+    }
+    catch (mu::ParserError& e)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  error: "
+                   << e.GetMsg()
+                   << "\n"
+                   << "  in:    "
+                   << e.GetExpr()
+                   << "\n");
+    }
+    catch (...)
+    {
+        TBOX_ERROR("muParserCartGridFunction::setDataOnPatch():\n"
+                   << "  unrecognized exception generated by muParser library.\n");
+    }
+
+    // Copy the values into the patch data.
+    int k = 0;
+    for (Box<NDIM>::Iterator b(box); b; b++, ++k)
+    {
+        data(b(), data_depth) = d_parser_vals[k];
+    }
+    return;
+} // setDataOnBox
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
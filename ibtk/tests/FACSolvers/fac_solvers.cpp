@@ -0,0 +1,326 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/Array.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/LinearSolver.h>
+#include <ibtk/SCLaplaceOperator.h>
+#include <ibtk/SCPoissonSolverManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Remove the components of the right-hand side vector f that lie in the
+// nullspace of the periodic Laplacian.  The vector e is used as scratch space.
+void
+remove_nullspace(SAMRAIVectorReal<NDIM, double>& f_vec, SAMRAIVectorReal<NDIM, double>& e_vec)
+{
+    e_vec.setToScalar(1.0);
+    f_vec.addScalar(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                    -f_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false)) /
+                        e_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false)));
+    return;
+} // remove_nullspace
+
+// Solve A*u = f starting from u = 0, and return the relative 2-norm of the
+// residual r = f - A*u along with the number of Krylov iterations.
+double
+solve_and_compute_residual(PoissonSolver& solver,
+                           LaplaceOperator& laplace_op,
+                           SAMRAIVectorReal<NDIM, double>& u_vec,
+                           SAMRAIVectorReal<NDIM, double>& f_vec,
+                           SAMRAIVectorReal<NDIM, double>& r_vec,
+                           int& num_iterations)
+{
+    LinearSolver* p_solver = dynamic_cast<LinearSolver*>(&solver);
+    if (p_solver)
+    {
+        p_solver->setInitialGuessNonzero(false);
+        p_solver->setNullspace(true);
+    }
+    solver.initializeSolverState(u_vec, f_vec);
+    u_vec.setToScalar(0.0);
+    solver.solveSystem(u_vec, f_vec);
+    num_iterations = solver.getNumIterations();
+    solver.deallocateSolverState();
+
+    laplace_op.initializeOperatorState(u_vec, r_vec);
+    laplace_op.apply(u_vec, r_vec);
+    laplace_op.deallocateOperatorState();
+    r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                   Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false));
+    return r_vec.L2Norm() / f_vec.L2Norm();
+} // solve_and_compute_residual
+
+// Record the result of a test.  The iteration count is compared to that of the
+// reference configuration only if max_extra_iterations is nonnegative.
+bool
+check(const std::string& test_name,
+      const double rel_residual,
+      const double tol,
+      const int num_iterations,
+      const int ref_num_iterations,
+      const int max_extra_iterations)
+{
+    bool passed = rel_residual <= tol;
+    if (max_extra_iterations >= 0) passed = passed && num_iterations <= ref_num_iterations + max_extra_iterations;
+    pout << test_name << ": |r|_2 / |f|_2 = " << rel_residual << " after " << num_iterations << " iterations"
+         << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // check
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_test(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "fac_solvers.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double tol = input_db->getDoubleWithDefault("tolerance", 1.0e-7);
+        const Array<std::string> solver_configurations = input_db->getStringArray("solver_configurations");
+        Pointer<Database> krylov_db = input_db->getDatabase("KrylovSolver");
+        Pointer<Database> fac_db = input_db->getDatabase("FACPreconditioner");
+
+        // The FAC preconditioner settings that may be changed by each solver
+        // configuration.
+        const std::string smoother_type = fac_db->getStringWithDefault("smoother_type", "PATCH_GAUSS_SEIDEL");
+        const bool use_single_precision_smoother = fac_db->getBoolWithDefault("use_single_precision_smoother", false);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<SideVariable<NDIM, double> > r_sc_var = new SideVariable<NDIM, double>("r_sc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(1));
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, IntVector<NDIM>(1));
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, IntVector<NDIM>(1));
+        const int r_sc_idx = var_db->registerVariableAndContext(r_sc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(r_cc_idx, 0.0);
+            level->allocatePatchData(u_sc_idx, 0.0);
+            level->allocatePatchData(f_sc_idx, 0.0);
+            level->allocatePatchData(r_sc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        SAMRAIVectorReal<NDIM, double> u_cc_vec("u_cc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_cc_vec("f_cc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> r_cc_vec("r_cc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_sc_vec("u_sc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_sc_vec("f_sc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> r_sc_vec("r_sc", patch_hierarchy, 0, finest_ln);
+
+        u_cc_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_cc_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        r_cc_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+        u_sc_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        f_sc_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+        r_sc_vec.addComponent(r_sc_var, r_sc_idx, h_sc_idx);
+
+        // Setup the right-hand sides.
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(f_sc_idx, f_sc_var, patch_hierarchy, 0.0);
+        remove_nullspace(f_cc_vec, r_cc_vec);
+        remove_nullspace(f_sc_vec, r_sc_vec);
+
+        // Setup the Laplace operators used to compute the residuals.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(NDIM, bc_coef);
+
+        CCLaplaceOperator cc_laplace_op("cc_laplace_op");
+        cc_laplace_op.setPoissonSpecifications(poisson_spec);
+        cc_laplace_op.setPhysicalBcCoef(bc_coef);
+
+        SCLaplaceOperator sc_laplace_op("sc_laplace_op");
+        sc_laplace_op.setPoissonSpecifications(poisson_spec);
+        sc_laplace_op.setPhysicalBcCoefs(bc_coefs);
+
+        // Solve the periodic Poisson problem with FGMRES preconditioned by FAC
+        // for each solver configuration.  Every solve must reach the residual
+        // tolerance, and, when requested, must do so in nearly the same number
+        // of iterations as the first (reference) configuration.
+        int ref_cc_num_iterations = 0, ref_sc_num_iterations = 0;
+        for (int k = 0; k < solver_configurations.getSize(); ++k)
+        {
+            const std::string& config_name = solver_configurations[k];
+            Pointer<Database> config_db = input_db->getDatabase(config_name);
+            fac_db->putString("smoother_type", config_db->getStringWithDefault("smoother_type", smoother_type));
+            fac_db->putBool(
+                "use_single_precision_smoother",
+                config_db->getBoolWithDefault("use_single_precision_smoother", use_single_precision_smoother));
+            const int max_extra_iterations = k == 0 ? -1 : config_db->getIntegerWithDefault("max_extra_iterations", -1);
+
+            CCPoissonSolverManager* cc_solver_manager = CCPoissonSolverManager::getManager();
+            Pointer<PoissonSolver> cc_solver =
+                cc_solver_manager->allocateSolver(CCPoissonSolverManager::PETSC_KRYLOV_SOLVER,
+                                                  "cc_solver",
+                                                  krylov_db,
+                                                  "cc_",
+                                                  CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER,
+                                                  "cc_pc",
+                                                  fac_db,
+                                                  "cc_pc_");
+            cc_solver->setPoissonSpecifications(poisson_spec);
+            cc_solver->setPhysicalBcCoef(bc_coef);
+            int cc_num_iterations = 0;
+            const double cc_rel_residual =
+                solve_and_compute_residual(*cc_solver, cc_laplace_op, u_cc_vec, f_cc_vec, r_cc_vec, cc_num_iterations);
+            if (k == 0) ref_cc_num_iterations = cc_num_iterations;
+            passed = check("cell-centered FGMRES-FAC solver (" + config_name + ")",
+                           cc_rel_residual,
+                           tol,
+                           cc_num_iterations,
+                           ref_cc_num_iterations,
+                           max_extra_iterations) &&
+                     passed;
+
+            SCPoissonSolverManager* sc_solver_manager = SCPoissonSolverManager::getManager();
+            Pointer<PoissonSolver> sc_solver =
+                sc_solver_manager->allocateSolver(SCPoissonSolverManager::PETSC_KRYLOV_SOLVER,
+                                                  "sc_solver",
+                                                  krylov_db,
+                                                  "sc_",
+                                                  SCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER,
+                                                  "sc_pc",
+                                                  fac_db,
+                                                  "sc_pc_");
+            sc_solver->setPoissonSpecifications(poisson_spec);
+            sc_solver->setPhysicalBcCoefs(bc_coefs);
+            int sc_num_iterations = 0;
+            const double sc_rel_residual =
+                solve_and_compute_residual(*sc_solver, sc_laplace_op, u_sc_vec, f_sc_vec, r_sc_vec, sc_num_iterations);
+            if (k == 0) ref_sc_num_iterations = sc_num_iterations;
+            passed = check("side-centered FGMRES-FAC solver (" + config_name + ")",
+                           sc_rel_residual,
+                           tol,
+                           sc_num_iterations,
+                           ref_sc_num_iterations,
+                           max_extra_iterations) &&
+                     passed;
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed;
+} // run_test
@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include "fac_solvers.cpp"
+
+int test_argc;
+char** test_argv;
+
+#if (NDIM == 2)
+#define TEST_CASE_NAME ibtk_FACSolvers_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME ibtk_FACSolvers_3d
+#endif
+
+TEST(TEST_CASE_NAME, periodic_fgmres_fac_solves)
+{
+    EXPECT_EQ(run_test(test_argc, test_argv), true);
+}
+
+int
+main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    test_argc = argc;
+    test_argv = argv;
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,356 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LInitStrategy.h>
+#include <ibtk/LNodeSetData.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+void
+node_posn(const int lag_idx, const int num_nodes, const double center_x, double* const X)
+{
+    const double theta = 2.0 * M_PI * static_cast<double>(lag_idx) / static_cast<double>(num_nodes);
+    for (unsigned int d = 0; d < NDIM; ++d) X[d] = 0.5;
+    X[0] = center_x + 0.23 * std::cos(theta);
+    X[1] += 0.23 * std::sin(theta);
+    return;
+} // node_posn
+
+class RingInitializer : public LInitStrategy
+{
+public:
+    RingInitializer(const int num_nodes, const double center_x) : d_num_nodes(num_nodes), d_center_x(center_x)
+    {
+        // intentionally blank
+        return;
+    } // RingInitializer
+
+    bool getLevelHasLagrangianData(const int level_number, const bool /*can_be_refined*/) const
+    {
+        return level_number == 0;
+    } // getLevelHasLagrangianData
+
+    unsigned int computeGlobalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                    const int level_number,
+                                                    const double /*init_data_time*/,
+                                                    const bool /*can_be_refined*/,
+                                                    const bool /*initial_time*/)
+    {
+        return level_number == 0 ? d_num_nodes : 0;
+    } // computeGlobalNodeCountOnPatchLevel
+
+    unsigned int computeLocalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                   const int level_number,
+                                                   const double /*init_data_time*/,
+                                                   const bool /*can_be_refined*/,
+                                                   const bool /*initial_time*/)
+    {
+        if (level_number != 0) return 0;
+        unsigned int local_node_count = 0;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int k = 0; k < d_num_nodes; ++k)
+            {
+                double X[NDIM];
+                node_posn(k, d_num_nodes, d_center_x, X);
+                const Index<NDIM> idx =
+                    IndexUtilities::getCellIndex(X, hierarchy->getGridGeometry(), level->getRatio());
+                if (patch->getBox().contains(idx)) ++local_node_count;
+            }
+        }
+        return local_node_count;
+    } // computeLocalNodeCountOnPatchLevel
+
+    unsigned int initializeDataOnPatchLevel(const int lag_node_index_idx,
+                                            const unsigned int global_index_offset,
+                                            const unsigned int local_index_offset,
+                                            Pointer<LData> X_data,
+                                            Pointer<LData> /*U_data*/,
+                                            Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const int level_number,
+                                            const double /*init_data_time*/,
+                                            const bool /*can_be_refined*/,
+                                            const bool /*initial_time*/,
+                                            LDataManager* const /*l_data_manager*/)
+    {
+        boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        int local_idx = -1;
+        int local_node_count = 0;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> index_data = patch->getPatchData(lag_node_index_idx);
+            for (int k = 0; k < d_num_nodes; ++k)
+            {
+                double X[NDIM];
+                node_posn(k, d_num_nodes, d_center_x, X);
+                const Index<NDIM> idx =
+                    IndexUtilities::getCellIndex(X, hierarchy->getGridGeometry(), level->getRatio());
+                if (!patch->getBox().contains(idx)) continue;
+                ++local_node_count;
+                const int lagrangian_idx = k + global_index_offset;
+                const int local_petsc_idx = ++local_idx + local_index_offset;
+                const int global_petsc_idx = local_petsc_idx + global_index_offset;
+                node_posn(k, d_num_nodes, d_center_x, &X_array[local_petsc_idx][0]);
+                if (!index_data->isElement(idx))
+                {
+                    index_data->appendItemPointer(idx, new LNodeSet());
+                }
+                index_data->getItem(idx)->push_back(new LNode(lagrangian_idx, global_petsc_idx, local_petsc_idx));
+            }
+        }
+        X_data->restoreArrays();
+        return local_node_count;
+    } // initializeDataOnPatchLevel
+
+private:
+    int d_num_nodes;
+    double d_center_x;
+};
+
+LDataManager*
+build_manager(const std::string& name,
+              Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+              const int num_nodes,
+              const double center_x)
+{
+    LDataManager* l_data_manager =
+        LDataManager::getManager(name, "IB_4", "IB_4", false, IntVector<NDIM>(0), /*register_for_restart*/ false);
+    l_data_manager->registerLInitStrategy(new RingInitializer(num_nodes, center_x));
+    l_data_manager->setPatchHierarchy(patch_hierarchy);
+    l_data_manager->setPatchLevels(0, 0);
+    l_data_manager->initializeLevelData(patch_hierarchy, 0, 0.0, false, true, NULL, true);
+    l_data_manager->resetHierarchyConfiguration(patch_hierarchy, 0, 0);
+    l_data_manager->freeLInitStrategy();
+    return l_data_manager;
+} // build_manager
+
+void
+displace_nodes(LDataManager* const l_data_manager, const double shift)
+{
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, 0);
+    boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    for (unsigned int k = 0; k < X_data->getLocalNodeCount(); ++k)
+    {
+        X_array[k][0] += shift;
+    }
+    X_data->restoreArrays();
+    return;
+} // displace_nodes
+
+void
+get_lag_values(LDataManager* const l_data_manager, const std::string& quantity_name, std::vector<double>& values)
+{
+    Pointer<LData> data = l_data_manager->getLData(quantity_name, 0);
+    Vec petsc_vec = data->getVec();
+    Vec lag_vec;
+    int ierr = VecDuplicate(petsc_vec, &lag_vec);
+    IBTK_CHKERRQ(ierr);
+    l_data_manager->scatterPETScToLagrangian(petsc_vec, lag_vec, 0);
+    int ilo, ihi;
+    ierr = VecGetOwnershipRange(lag_vec, &ilo, &ihi);
+    IBTK_CHKERRQ(ierr);
+    const double* lag_array;
+    ierr = VecGetArrayRead(lag_vec, &lag_array);
+    IBTK_CHKERRQ(ierr);
+    values.assign(lag_array, lag_array + (ihi - ilo));
+    ierr = VecRestoreArrayRead(lag_vec, &lag_array);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&lag_vec);
+    IBTK_CHKERRQ(ierr);
+    return;
+} // get_lag_values
+
+bool
+compare_node_sets(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                  LDataManager* const flat_manager,
+                  LDataManager* const original_manager,
+                  const int num_nodes)
+{
+    const int flat_idx = flat_manager->getLNodePatchDescriptorIndex();
+    const int original_idx = original_manager->getLNodePatchDescriptorIndex();
+    int num_mismatched_cells = 0;
+    int num_owned_nodes = 0;
+    int num_periodic_nodes = 0;
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> flat_data = patch->getPatchData(flat_idx);
+        Pointer<LNodeSetData> original_data = patch->getPatchData(original_idx);
+        for (LNodeSetData::CellIterator it(patch->getBox()); it; it++)
+        {
+            const Index<NDIM>& i = *it;
+            LNodeSet* const flat_node_set = flat_data->getItem(i);
+            LNodeSet* const original_node_set = original_data->getItem(i);
+            const size_t flat_size = flat_node_set ? flat_node_set->size() : 0;
+            const size_t original_size = original_node_set ? original_node_set->size() : 0;
+            if (flat_size != original_size)
+            {
+                ++num_mismatched_cells;
+                continue;
+            }
+            num_owned_nodes += flat_size;
+            bool cell_matches = true;
+            for (size_t k = 0; k < flat_size; ++k)
+            {
+                const LNodeSet::value_type& flat_node = (*flat_node_set)[k];
+                const LNodeSet::value_type& original_node = (*original_node_set)[k];
+                cell_matches = cell_matches &&
+                               flat_node->getLagrangianIndex() == original_node->getLagrangianIndex() &&
+                               flat_node->getPeriodicOffset() == original_node->getPeriodicOffset() &&
+                               flat_node->getPeriodicDisplacement() == original_node->getPeriodicDisplacement();
+                if (flat_node->getPeriodicOffset() != IntVector<NDIM>(0)) ++num_periodic_nodes;
+            }
+            if (!cell_matches) ++num_mismatched_cells;
+        }
+    }
+    num_mismatched_cells = SAMRAI_MPI::sumReduction(num_mismatched_cells);
+    num_owned_nodes = SAMRAI_MPI::sumReduction(num_owned_nodes);
+    num_periodic_nodes = SAMRAI_MPI::sumReduction(num_periodic_nodes);
+    const bool passed = num_mismatched_cells == 0 && num_owned_nodes == num_nodes && num_periodic_nodes > 0;
+    pout << "node sets: mismatched cells = " << num_mismatched_cells << ", owned nodes = " << num_owned_nodes
+         << ", periodic nodes = " << num_periodic_nodes << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // compare_node_sets
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_test(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ldata_redistribution.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_nodes = input_db->getIntegerWithDefault("num_nodes", 128);
+        const double center_x = input_db->getDoubleWithDefault("center_x", 0.75);
+        const double shift_factor = input_db->getDoubleWithDefault("shift_factor", 0.75);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+
+        // Distribute two identical copies of the Lagrangian nodes, one for each
+        // redistribution algorithm.
+        LDataManager* flat_manager = build_manager("FlatLDataManager", patch_hierarchy, num_nodes, center_x);
+        LDataManager* original_manager = build_manager("OriginalLDataManager", patch_hierarchy, num_nodes, center_x);
+        flat_manager->setUseFlatDataRedistribution(true);
+        original_manager->setUseFlatDataRedistribution(false);
+
+        // Move the nodes by a fraction of a grid cell, so that nodes change
+        // cells and patches and some of them pass through the periodic
+        // boundary, and then redistribute them.
+        const double shift = shift_factor * grid_geometry->getDx()[0];
+        displace_nodes(flat_manager, shift);
+        displace_nodes(original_manager, shift);
+        flat_manager->beginDataRedistribution();
+        flat_manager->endDataRedistribution();
+        original_manager->beginDataRedistribution();
+        original_manager->endDataRedistribution();
+
+        // Both algorithms must produce the same node sets and the same
+        // Lagrangian data.
+        passed = compare_node_sets(patch_hierarchy, flat_manager, original_manager, num_nodes) && passed;
+        std::vector<double> flat_X, original_X;
+        get_lag_values(flat_manager, LDataManager::POSN_DATA_NAME, flat_X);
+        get_lag_values(original_manager, LDataManager::POSN_DATA_NAME, original_X);
+        double max_diff = 0.0;
+        for (size_t k = 0; k < flat_X.size(); ++k)
+        {
+            max_diff = std::max(max_diff, std::abs(flat_X[k] - original_X[k]));
+        }
+        max_diff = SAMRAI_MPI::maxReduction(max_diff);
+        pout << "X: max difference = " << max_diff << (max_diff == 0.0 ? "" : " (FAILED)") << "\n";
+        passed = max_diff == 0.0 && passed;
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed;
+} // run_test
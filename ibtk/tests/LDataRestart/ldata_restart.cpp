@@ -0,0 +1,333 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+#include <petscvec.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <MemoryDatabase.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/RestartManager.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LInitStrategy.h>
+#include <ibtk/LNodeSetData.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// The initial position and velocity of the Lagrangian node with the given
+// Lagrangian index.  The nodes are distributed along a circle of radius 0.25
+// centered in the unit square (or cube).
+void
+node_posn(const int lag_idx, const int num_nodes, double* const X)
+{
+    const double theta = 2.0 * M_PI * static_cast<double>(lag_idx) / static_cast<double>(num_nodes);
+    for (unsigned int d = 0; d < NDIM; ++d) X[d] = 0.5;
+    X[0] += 0.25 * std::cos(theta);
+    X[1] += 0.25 * std::sin(theta);
+    return;
+} // node_posn
+
+void
+node_vel(const int lag_idx, const int /*num_nodes*/, double* const U)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) U[d] = static_cast<double>((d + 1) * lag_idx);
+    return;
+} // node_vel
+
+// A minimal Lagrangian initializer that places the nodes on the coarsest level
+// of the patch hierarchy.
+class RingInitializer : public LInitStrategy
+{
+public:
+    RingInitializer(const int num_nodes) : d_num_nodes(num_nodes)
+    {
+        // intentionally blank
+        return;
+    } // RingInitializer
+
+    bool getLevelHasLagrangianData(const int level_number, const bool /*can_be_refined*/) const
+    {
+        return level_number == 0;
+    } // getLevelHasLagrangianData
+
+    unsigned int computeGlobalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                    const int level_number,
+                                                    const double /*init_data_time*/,
+                                                    const bool /*can_be_refined*/,
+                                                    const bool /*initial_time*/)
+    {
+        return level_number == 0 ? d_num_nodes : 0;
+    } // computeGlobalNodeCountOnPatchLevel
+
+    unsigned int computeLocalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                   const int level_number,
+                                                   const double /*init_data_time*/,
+                                                   const bool /*can_be_refined*/,
+                                                   const bool /*initial_time*/)
+    {
+        if (level_number != 0) return 0;
+        unsigned int local_node_count = 0;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int k = 0; k < d_num_nodes; ++k)
+            {
+                double X[NDIM];
+                node_posn(k, d_num_nodes, X);
+                const Index<NDIM> idx =
+                    IndexUtilities::getCellIndex(X, hierarchy->getGridGeometry(), level->getRatio());
+                if (patch->getBox().contains(idx)) ++local_node_count;
+            }
+        }
+        return local_node_count;
+    } // computeLocalNodeCountOnPatchLevel
+
+    unsigned int initializeDataOnPatchLevel(const int lag_node_index_idx,
+                                            const unsigned int global_index_offset,
+                                            const unsigned int local_index_offset,
+                                            Pointer<LData> X_data,
+                                            Pointer<LData> U_data,
+                                            Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const int level_number,
+                                            const double /*init_data_time*/,
+                                            const bool /*can_be_refined*/,
+                                            const bool /*initial_time*/,
+                                            LDataManager* const /*l_data_manager*/)
+    {
+        boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+        int local_idx = -1;
+        int local_node_count = 0;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> index_data = patch->getPatchData(lag_node_index_idx);
+            for (int k = 0; k < d_num_nodes; ++k)
+            {
+                double X[NDIM];
+                node_posn(k, d_num_nodes, X);
+                const Index<NDIM> idx =
+                    IndexUtilities::getCellIndex(X, hierarchy->getGridGeometry(), level->getRatio());
+                if (!patch->getBox().contains(idx)) continue;
+                ++local_node_count;
+                const int lagrangian_idx = k + global_index_offset;
+                const int local_petsc_idx = ++local_idx + local_index_offset;
+                const int global_petsc_idx = local_petsc_idx + global_index_offset;
+                node_posn(k, d_num_nodes, &X_array[local_petsc_idx][0]);
+                node_vel(k, d_num_nodes, &U_array[local_petsc_idx][0]);
+                if (!index_data->isElement(idx))
+                {
+                    index_data->appendItemPointer(idx, new LNodeSet());
+                }
+                index_data->getItem(idx)->push_back(new LNode(lagrangian_idx, global_petsc_idx, local_petsc_idx));
+            }
+        }
+        X_data->restoreArrays();
+        U_data->restoreArrays();
+        return local_node_count;
+    } // initializeDataOnPatchLevel
+
+private:
+    int d_num_nodes;
+};
+
+// Compare the values of the specified Lagrangian quantity, in global
+// Lagrangian order, to the expected values.
+bool
+check_lag_values(const std::string& test_name,
+                 LDataManager* const l_data_manager,
+                 const std::string& quantity_name,
+                 void (*fcn)(int, int, double*),
+                 const int num_nodes,
+                 const double tol)
+{
+    Pointer<LData> data = l_data_manager->getLData(quantity_name, 0);
+    Vec petsc_vec = data->getVec();
+    Vec lag_vec;
+    int ierr = VecDuplicate(petsc_vec, &lag_vec);
+    IBTK_CHKERRQ(ierr);
+    l_data_manager->scatterPETScToLagrangian(petsc_vec, lag_vec, 0);
+    int ilo, ihi;
+    ierr = VecGetOwnershipRange(lag_vec, &ilo, &ihi);
+    IBTK_CHKERRQ(ierr);
+    const double* lag_array;
+    ierr = VecGetArrayRead(lag_vec, &lag_array);
+    IBTK_CHKERRQ(ierr);
+    double max_err = 0.0;
+    for (int k = ilo / NDIM; k < ihi / NDIM; ++k)
+    {
+        double expected[NDIM];
+        fcn(k, num_nodes, expected);
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            max_err = std::max(max_err, std::abs(lag_array[(k - ilo / NDIM) * NDIM + d] - expected[d]));
+        }
+    }
+    ierr = VecRestoreArrayRead(lag_vec, &lag_array);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&lag_vec);
+    IBTK_CHKERRQ(ierr);
+    max_err = SAMRAI_MPI::maxReduction(max_err);
+    const bool passed = max_err <= tol;
+    pout << test_name << ": max error = " << max_err << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // check_lag_values
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_test(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ldata_restart.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_nodes = input_db->getIntegerWithDefault("num_nodes", 64);
+        const std::string restart_dirname = input_db->getStringWithDefault("restart_dirname", "restart_ldata");
+        const double tol = 1.0e-14;
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+
+        // Distribute the Lagrangian nodes on the patch hierarchy, with the
+        // values of the Lagrangian data written to separate restart files.
+        LDataManager* l_data_manager = LDataManager::getManager("LDataManager", "IB_4", "IB_4");
+        l_data_manager->setUseCollectiveRestartIO(true);
+        l_data_manager->registerLInitStrategy(new RingInitializer(num_nodes));
+        l_data_manager->setPatchHierarchy(patch_hierarchy);
+        l_data_manager->setPatchLevels(0, 0);
+        l_data_manager->initializeLevelData(patch_hierarchy, 0, 0.0, false, true, NULL, true);
+        l_data_manager->resetHierarchyConfiguration(patch_hierarchy, 0, 0);
+        l_data_manager->freeLInitStrategy();
+        passed = check_lag_values(
+                     "initial X", l_data_manager, LDataManager::POSN_DATA_NAME, node_posn, num_nodes, tol) &&
+                 passed;
+
+        // Check that the layout of an LData object can be written without its
+        // values, and that the values are restored when they are written.
+        for (int put_values = 0; put_values <= 1; ++put_values)
+        {
+            Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, 0);
+            Pointer<Database> db = new MemoryDatabase("LData");
+            U_data->putToDatabase(db, put_values);
+            Pointer<LData> U_restored = new LData(db);
+            double max_err = 0.0;
+            const boost::multi_array_ref<double, 2>& U_array = *U_data->getLocalFormVecArray();
+            const boost::multi_array_ref<double, 2>& U_restored_array = *U_restored->getLocalFormVecArray();
+            for (unsigned int k = 0; k < U_data->getLocalNodeCount(); ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    max_err = std::max(max_err, std::abs(U_restored_array[k][d] - (put_values ? U_array[k][d] : 0.0)));
+                }
+            }
+            U_data->restoreArrays();
+            U_restored->restoreArrays();
+            max_err = SAMRAI_MPI::maxReduction(max_err);
+            pout << "LData database round trip (put_values = " << put_values << "): max error = " << max_err
+                 << (max_err <= tol ? "" : " (FAILED)") << "\n";
+            passed = max_err <= tol && passed;
+        }
+
+        // Write the restart database and the Lagrangian data restart files.
+        RestartManager::getManager()->writeRestartFile(restart_dirname, 0);
+        l_data_manager->writeLDataToRestartFile(restart_dirname, 0);
+
+        // Restore the data manager from the restart files and check that the
+        // Lagrangian data values are recovered.
+        LDataManager::freeAllManagers();
+        RestartManager::getManager()->openRestartFile(restart_dirname, 0, SAMRAI_MPI::getNodes());
+        l_data_manager = LDataManager::getManager("LDataManager", "IB_4", "IB_4");
+        RestartManager::getManager()->closeRestartFile();
+        l_data_manager->readLDataFromRestartFile(restart_dirname, 0);
+        passed = check_lag_values(
+                     "restored X", l_data_manager, LDataManager::POSN_DATA_NAME, node_posn, num_nodes, tol) &&
+                 passed;
+        passed = check_lag_values(
+                     "restored U", l_data_manager, LDataManager::VEL_DATA_NAME, node_vel, num_nodes, tol) &&
+                 passed;
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed;
+} // run_test
@@ -0,0 +1,525 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIndex.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideData.h>
+#include <SideIndex.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/LInitStrategy.h>
+#include <ibtk/LNodeSetData.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+
+void
+node_posn(const int lag_idx, const int num_nodes, const double center_x, double* const X)
+{
+    const double theta = 2.0 * M_PI * static_cast<double>(lag_idx) / static_cast<double>(num_nodes);
+    for (unsigned int d = 0; d < NDIM; ++d) X[d] = 0.5;
+    X[0] = center_x + 0.23 * std::cos(theta);
+    X[1] += 0.23 * std::sin(theta);
+    return;
+} // node_posn
+
+class RingInitializer : public LInitStrategy
+{
+public:
+    RingInitializer(const int num_nodes, const double center_x) : d_num_nodes(num_nodes), d_center_x(center_x)
+    {
+        // intentionally blank
+        return;
+    } // RingInitializer
+
+    bool getLevelHasLagrangianData(const int level_number, const bool /*can_be_refined*/) const
+    {
+        return level_number == 0;
+    } // getLevelHasLagrangianData
+
+    unsigned int computeGlobalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                    const int level_number,
+                                                    const double /*init_data_time*/,
+                                                    const bool /*can_be_refined*/,
+                                                    const bool /*initial_time*/)
+    {
+        return level_number == 0 ? d_num_nodes : 0;
+    } // computeGlobalNodeCountOnPatchLevel
+
+    unsigned int computeLocalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                   const int level_number,
+                                                   const double /*init_data_time*/,
+                                                   const bool /*can_be_refined*/,
+                                                   const bool /*initial_time*/)
+    {
+        if (level_number != 0) return 0;
+        unsigned int local_node_count = 0;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int k = 0; k < d_num_nodes; ++k)
+            {
+                double X[NDIM];
+                node_posn(k, d_num_nodes, d_center_x, X);
+                const Index<NDIM> idx =
+                    IndexUtilities::getCellIndex(X, hierarchy->getGridGeometry(), level->getRatio());
+                if (patch->getBox().contains(idx)) ++local_node_count;
+            }
+        }
+        return local_node_count;
+    } // computeLocalNodeCountOnPatchLevel
+
+    unsigned int initializeDataOnPatchLevel(const int lag_node_index_idx,
+                                            const unsigned int global_index_offset,
+                                            const unsigned int local_index_offset,
+                                            Pointer<LData> X_data,
+                                            Pointer<LData> /*U_data*/,
+                                            Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const int level_number,
+                                            const double /*init_data_time*/,
+                                            const bool /*can_be_refined*/,
+                                            const bool /*initial_time*/,
+                                            LDataManager* const /*l_data_manager*/)
+    {
+        boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        int local_idx = -1;
+        int local_node_count = 0;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> index_data = patch->getPatchData(lag_node_index_idx);
+            for (int k = 0; k < d_num_nodes; ++k)
+            {
+                double X[NDIM];
+                node_posn(k, d_num_nodes, d_center_x, X);
+                const Index<NDIM> idx =
+                    IndexUtilities::getCellIndex(X, hierarchy->getGridGeometry(), level->getRatio());
+                if (!patch->getBox().contains(idx)) continue;
+                ++local_node_count;
+                const int lagrangian_idx = k + global_index_offset;
+                const int local_petsc_idx = ++local_idx + local_index_offset;
+                const int global_petsc_idx = local_petsc_idx + global_index_offset;
+                node_posn(k, d_num_nodes, d_center_x, &X_array[local_petsc_idx][0]);
+                if (!index_data->isElement(idx))
+                {
+                    index_data->appendItemPointer(idx, new LNodeSet());
+                }
+                index_data->getItem(idx)->push_back(new LNode(lagrangian_idx, global_petsc_idx, local_petsc_idx));
+            }
+        }
+        X_data->restoreArrays();
+        return local_node_count;
+    } // initializeDataOnPatchLevel
+
+private:
+    int d_num_nodes;
+    double d_center_x;
+};
+
+// A smooth periodic function used to initialize the Eulerian data, including
+// the ghost cell values, without filling ghost cells.
+double
+eulerian_fcn(const double* const x, const int depth)
+{
+    double val = std::sin(2.0 * M_PI * (x[0] + 0.1 * depth)) * std::cos(2.0 * M_PI * x[1]);
+#if (NDIM == 3)
+    val *= std::cos(2.0 * M_PI * x[2]);
+#endif
+    return val;
+} // eulerian_fcn
+
+void
+fill_eulerian_data(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int u_cc_idx, const int u_sc_idx)
+{
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Index<NDIM>& patch_lower = patch->getBox().lower();
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const x_lower = pgeom->getXLower();
+        const double* const dx = pgeom->getDx();
+        double x[NDIM];
+
+        Pointer<CellData<NDIM, double> > u_cc_data = patch->getPatchData(u_cc_idx);
+        for (Box<NDIM>::Iterator b(u_cc_data->getGhostBox()); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                x[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+            }
+            for (int depth = 0; depth < u_cc_data->getDepth(); ++depth)
+            {
+                (*u_cc_data)(CellIndex<NDIM>(i), depth) = eulerian_fcn(x, depth);
+            }
+        }
+
+        Pointer<SideData<NDIM, double> > u_sc_data = patch->getPatchData(u_sc_idx);
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (Box<NDIM>::Iterator b(u_sc_data->getArrayData(axis).getBox()); b; b++)
+            {
+                const Index<NDIM>& i = b();
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    x[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + (d == axis ? 0.0 : 0.5));
+                }
+                (*u_sc_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower)) = eulerian_fcn(x, axis);
+            }
+        }
+    }
+    return;
+} // fill_eulerian_data
+
+// Set the Lagrangian values F to a smooth function of the node positions X.
+void
+fill_lagrangian_data(Pointer<LData> F_data, Pointer<LData> X_data)
+{
+    boost::multi_array_ref<double, 2>& F_array = *F_data->getLocalFormVecArray();
+    const boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    for (unsigned int k = 0; k < F_data->getLocalNodeCount(); ++k)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            F_array[k][d] = std::cos(2.0 * M_PI * X_array[k][d]) + static_cast<double>(d);
+        }
+    }
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
+} // fill_lagrangian_data
+
+void
+get_local_values(Pointer<LData> data, std::vector<double>& values)
+{
+    const boost::multi_array_ref<double, 2>& array = *data->getLocalFormVecArray();
+    values.assign(array.data(), array.data() + array.num_elements());
+    data->restoreArrays();
+    return;
+} // get_local_values
+
+void
+zero_eulerian_data(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int f_idx)
+{
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > f_cc_data = patch->getPatchData(f_idx);
+        Pointer<SideData<NDIM, double> > f_sc_data = patch->getPatchData(f_idx);
+        if (f_cc_data) f_cc_data->fillAll(0.0);
+        if (f_sc_data) f_sc_data->fillAll(0.0);
+    }
+    return;
+} // zero_eulerian_data
+
+// Accumulate the maximum absolute difference between two arrays and the
+// maximum absolute value of the first one, including the ghost cell region.
+void
+accumulate_array_difference(const ArrayData<NDIM, double>& a,
+                            const ArrayData<NDIM, double>& b,
+                            double& max_diff,
+                            double& max_val)
+{
+    const size_t size = a.getBox().size();
+    for (int depth = 0; depth < a.getDepth(); ++depth)
+    {
+        const double* const a_ptr = a.getPointer(depth);
+        const double* const b_ptr = b.getPointer(depth);
+        for (size_t k = 0; k < size; ++k)
+        {
+            max_diff = std::max(max_diff, std::abs(a_ptr[k] - b_ptr[k]));
+            max_val = std::max(max_val, std::abs(a_ptr[k]));
+        }
+    }
+    return;
+} // accumulate_array_difference
+
+double
+compute_relative_difference(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int f_idx, const int g_idx)
+{
+    double max_diff = 0.0;
+    double max_val = 0.0;
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > f_cc_data = patch->getPatchData(f_idx);
+        Pointer<CellData<NDIM, double> > g_cc_data = patch->getPatchData(g_idx);
+        Pointer<SideData<NDIM, double> > f_sc_data = patch->getPatchData(f_idx);
+        Pointer<SideData<NDIM, double> > g_sc_data = patch->getPatchData(g_idx);
+        if (f_cc_data)
+        {
+            accumulate_array_difference(f_cc_data->getArrayData(), g_cc_data->getArrayData(), max_diff, max_val);
+        }
+        if (f_sc_data)
+        {
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                accumulate_array_difference(
+                    f_sc_data->getArrayData(axis), g_sc_data->getArrayData(axis), max_diff, max_val);
+            }
+        }
+    }
+    max_diff = SAMRAI_MPI::maxReduction(max_diff);
+    max_val = SAMRAI_MPI::maxReduction(max_val);
+    return max_val > 0.0 ? max_diff / max_val : max_diff;
+} // compute_relative_difference
+
+// Interpolate and spread with and without the CSR copies of the node index
+// data, and check that both code paths produce the same results.
+bool
+compare_interaction(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                    LDataManager* const l_data_manager,
+                    const int u_idx,
+                    const int f_idx,
+                    const int f_csr_idx,
+                    const std::string& label)
+{
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, 0);
+    Pointer<LData> U_data = l_data_manager->getLData("U", 0);
+    Pointer<LData> F_data = l_data_manager->getLData("F", 0);
+
+    // Interpolation evaluates each node independently, so both code paths must
+    // produce identical values.
+    std::vector<double> U_values, U_csr_values;
+    l_data_manager->setUseCSRIndexData(false);
+    l_data_manager->interp(u_idx, U_data, X_data, 0);
+    get_local_values(U_data, U_values);
+    l_data_manager->setUseCSRIndexData(true);
+    l_data_manager->interp(u_idx, U_data, X_data, 0);
+    get_local_values(U_data, U_csr_values);
+    int num_mismatched_values = 0;
+    for (size_t k = 0; k < U_values.size(); ++k)
+    {
+        if (U_values[k] != U_csr_values[k]) ++num_mismatched_values;
+    }
+    num_mismatched_values = SAMRAI_MPI::sumReduction(num_mismatched_values);
+    pout << label << " interpolation: mismatched values = " << num_mismatched_values
+         << (num_mismatched_values == 0 ? "" : " (FAILED)") << "\n";
+
+    // The nodes may be spread in a different order, so the spread values only
+    // agree up to roundoff.
+    fill_lagrangian_data(F_data, X_data);
+    zero_eulerian_data(patch_hierarchy, f_idx);
+    zero_eulerian_data(patch_hierarchy, f_csr_idx);
+    l_data_manager->setUseCSRIndexData(false);
+    l_data_manager->spread(f_idx, F_data, X_data, NULL, 0);
+    l_data_manager->setUseCSRIndexData(true);
+    l_data_manager->spread(f_csr_idx, F_data, X_data, NULL, 0);
+    const double spread_diff = compute_relative_difference(patch_hierarchy, f_idx, f_csr_idx);
+    const bool spread_passed = spread_diff <= 1.0e-12;
+    pout << label << " spreading: relative difference = " << spread_diff << (spread_passed ? "" : " (FAILED)")
+         << "\n";
+
+    l_data_manager->setUseCSRIndexData(false);
+    return num_mismatched_values == 0 && spread_passed;
+} // compare_interaction
+
+// Count the nodes that appear in the ghost cell regions of the patches through
+// the periodic boundary.
+int
+count_periodic_nodes(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, LDataManager* const l_data_manager)
+{
+    const int idx = l_data_manager->getLNodePatchDescriptorIndex();
+    int num_periodic_nodes = 0;
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(idx);
+        for (LNodeSetData::SetIterator it(*idx_data); it; it++)
+        {
+            const LNodeSet& node_set = it.getItem();
+            for (LNodeSet::const_iterator n = node_set.begin(); n != node_set.end(); ++n)
+            {
+                if ((*n)->getPeriodicOffset() != IntVector<NDIM>(0)) ++num_periodic_nodes;
+            }
+        }
+    }
+    return SAMRAI_MPI::sumReduction(num_periodic_nodes);
+} // count_periodic_nodes
+
+void
+displace_nodes(LDataManager* const l_data_manager, const double shift)
+{
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, 0);
+    boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    for (unsigned int k = 0; k < X_data->getLocalNodeCount(); ++k)
+    {
+        X_array[k][0] += shift;
+    }
+    X_data->restoreArrays();
+    return;
+} // displace_nodes
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_test(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "le_interactor_csr.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const int num_nodes = input_db->getIntegerWithDefault("num_nodes", 128);
+        const double center_x = input_db->getDoubleWithDefault("center_x", 0.75);
+        const double shift_factor = input_db->getDoubleWithDefault("shift_factor", 0.75);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.  The
+        // ghost cell width is wide enough for the IB_4 kernel.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        const IntVector<NDIM> ghosts = LEInteractor::getMinimumGhostWidth("IB_4");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc", NDIM);
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc", NDIM);
+        Pointer<CellVariable<NDIM, double> > f_cc_csr_var = new CellVariable<NDIM, double>("f_cc_csr", NDIM);
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_csr_var = new SideVariable<NDIM, double>("f_sc_csr");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, ghosts);
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, ghosts);
+        const int f_cc_csr_idx = var_db->registerVariableAndContext(f_cc_csr_var, ctx, ghosts);
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, ghosts);
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, ghosts);
+        const int f_sc_csr_idx = var_db->registerVariableAndContext(f_sc_csr_var, ctx, ghosts);
+
+        // Initialize the patch hierarchy and allocate data.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(u_cc_idx, 0.0);
+        level->allocatePatchData(f_cc_idx, 0.0);
+        level->allocatePatchData(f_cc_csr_idx, 0.0);
+        level->allocatePatchData(u_sc_idx, 0.0);
+        level->allocatePatchData(f_sc_idx, 0.0);
+        level->allocatePatchData(f_sc_csr_idx, 0.0);
+        fill_eulerian_data(patch_hierarchy, u_cc_idx, u_sc_idx);
+
+        // Distribute a ring of Lagrangian nodes that crosses the periodic
+        // boundary.
+        LDataManager* l_data_manager = LDataManager::getManager(
+            "LEInteractorCSRManager", "IB_4", "IB_4", false, IntVector<NDIM>(0), /*register_for_restart*/ false);
+        l_data_manager->registerLInitStrategy(new RingInitializer(num_nodes, center_x));
+        l_data_manager->setPatchHierarchy(patch_hierarchy);
+        l_data_manager->setPatchLevels(0, 0);
+        l_data_manager->initializeLevelData(patch_hierarchy, 0, 0.0, false, true, NULL, true);
+        l_data_manager->resetHierarchyConfiguration(patch_hierarchy, 0, 0);
+        l_data_manager->freeLInitStrategy();
+        l_data_manager->createLData("U", 0, NDIM, /*maintain_data*/ true);
+        l_data_manager->createLData("F", 0, NDIM, /*maintain_data*/ true);
+
+        const int num_periodic_nodes = count_periodic_nodes(patch_hierarchy, l_data_manager);
+        pout << "periodic nodes = " << num_periodic_nodes << (num_periodic_nodes > 0 ? "" : " (FAILED)") << "\n";
+        passed = num_periodic_nodes > 0 && passed;
+        passed = compare_interaction(patch_hierarchy, l_data_manager, u_cc_idx, f_cc_idx, f_cc_csr_idx, "cell") &&
+                 passed;
+        passed = compare_interaction(patch_hierarchy, l_data_manager, u_sc_idx, f_sc_idx, f_sc_csr_idx, "side") &&
+                 passed;
+
+        // Move and redistribute the nodes, so that the CSR copies of the node
+        // index data must be rebuilt, and compare again.
+        displace_nodes(l_data_manager, shift_factor * grid_geometry->getDx()[0]);
+        l_data_manager->beginDataRedistribution();
+        l_data_manager->endDataRedistribution();
+        passed = compare_interaction(patch_hierarchy, l_data_manager, u_cc_idx, f_cc_idx, f_cc_csr_idx, "cell") &&
+                 passed;
+        passed = compare_interaction(patch_hierarchy, l_data_manager, u_sc_idx, f_sc_idx, f_sc_csr_idx, "side") &&
+                 passed;
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed;
+} // run_test
@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include "le_interactor_csr.cpp"
+
+int test_argc;
+char** test_argv;
+
+#if (NDIM == 2)
+#define TEST_CASE_NAME ibtk_LEInteractorCSR_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME ibtk_LEInteractorCSR_3d
+#endif
+
+TEST(TEST_CASE_NAME, csr_and_index_set_interaction_agree)
+{
+    EXPECT_EQ(run_test(test_argc, test_argv), true);
+}
+
+int
+main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    test_argc = argc;
+    test_argv = argv;
+    return RUN_ALL_TESTS();
+}
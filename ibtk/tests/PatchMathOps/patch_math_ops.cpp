@@ -0,0 +1,444 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+// Headers for major SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <FaceData.h>
+#include <FaceVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <NodeData.h>
+#include <NodeVariable.h>
+#include <SideData.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/PatchMathOps.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Fill patch data (including ghost cells) with pseudo-random values in [-1,1].
+// Reseeding the generator before each call yields identical data.
+void
+randomize(ArrayData<NDIM, double>& data, const unsigned int seed)
+{
+    std::srand(seed);
+    for (int depth = 0; depth < data.getDepth(); ++depth)
+    {
+        double* const ptr = data.getPointer(depth);
+        const int n = data.getBox().size();
+        for (int i = 0; i < n; ++i)
+        {
+            ptr[i] = 2.0 * static_cast<double>(std::rand()) / static_cast<double>(RAND_MAX) - 1.0;
+        }
+    }
+    return;
+} // randomize
+
+void
+randomize(Pointer<CellData<NDIM, double> > data, const unsigned int seed)
+{
+    randomize(data->getArrayData(), seed);
+    return;
+} // randomize
+
+void
+randomize(Pointer<NodeData<NDIM, double> > data, const unsigned int seed)
+{
+    randomize(data->getArrayData(), seed);
+    return;
+} // randomize
+
+void
+randomize(Pointer<FaceData<NDIM, double> > data, const unsigned int seed)
+{
+    for (unsigned int axis = 0; axis < NDIM; ++axis) randomize(data->getArrayData(axis), seed + axis);
+    return;
+} // randomize
+
+void
+randomize(Pointer<SideData<NDIM, double> > data, const unsigned int seed)
+{
+    for (unsigned int axis = 0; axis < NDIM; ++axis) randomize(data->getArrayData(axis), seed + axis);
+    return;
+} // randomize
+
+// Compute the maximum relative difference between two arrays over their
+// entire (ghost) boxes.
+double
+max_difference(const ArrayData<NDIM, double>& data1, const ArrayData<NDIM, double>& data2)
+{
+    TBOX_ASSERT(data1.getBox() == data2.getBox());
+    TBOX_ASSERT(data1.getDepth() == data2.getDepth());
+    double max_diff = 0.0;
+    for (int depth = 0; depth < data1.getDepth(); ++depth)
+    {
+        const double* const ptr1 = data1.getPointer(depth);
+        const double* const ptr2 = data2.getPointer(depth);
+        const int n = data1.getBox().size();
+        for (int i = 0; i < n; ++i)
+        {
+            const double scale = std::max(1.0, std::max(std::abs(ptr1[i]), std::abs(ptr2[i])));
+            max_diff = std::max(max_diff, std::abs(ptr1[i] - ptr2[i]) / scale);
+        }
+    }
+    return max_diff;
+} // max_difference
+
+double
+max_difference(Pointer<CellData<NDIM, double> > data1, Pointer<CellData<NDIM, double> > data2)
+{
+    return max_difference(data1->getArrayData(), data2->getArrayData());
+} // max_difference
+
+double
+max_difference(Pointer<NodeData<NDIM, double> > data1, Pointer<NodeData<NDIM, double> > data2)
+{
+    return max_difference(data1->getArrayData(), data2->getArrayData());
+} // max_difference
+
+double
+max_difference(Pointer<FaceData<NDIM, double> > data1, Pointer<FaceData<NDIM, double> > data2)
+{
+    double max_diff = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        max_diff = std::max(max_diff, max_difference(data1->getArrayData(axis), data2->getArrayData(axis)));
+    }
+    return max_diff;
+} // max_difference
+
+double
+max_difference(Pointer<SideData<NDIM, double> > data1, Pointer<SideData<NDIM, double> > data2)
+{
+    double max_diff = 0.0;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        max_diff = std::max(max_diff, max_difference(data1->getArrayData(axis), data2->getArrayData(axis)));
+    }
+    return max_diff;
+} // max_difference
+
+// Record the result of a comparison.
+bool
+check(const std::string& op_name, const double max_diff, const double tol)
+{
+    const bool passed = max_diff <= tol;
+    pout << op_name << ": max relative difference = " << max_diff << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // check
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_test(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "patch_math_ops.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double tol = input_db->getDoubleWithDefault("tolerance", 1.0e-12);
+        const int gcw = input_db->getIntegerWithDefault("ghost_cell_width", 2);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.  For
+        // each centering, "alpha", "u", and "v" are operands, and "f" and "g"
+        // are the results computed by the Fortran and C++ kernels.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        const IntVector<NDIM> ghosts(gcw);
+        static const int NVARS = 5;
+        static const char* const var_names[NVARS] = { "alpha", "u", "v", "f", "g" };
+        int cc_idx[NVARS], fc_idx[NVARS], nc_idx[NVARS], sc_idx[NVARS];
+        for (int k = 0; k < NVARS; ++k)
+        {
+            const std::string name = var_names[k];
+            cc_idx[k] = var_db->registerVariableAndContext(new CellVariable<NDIM, double>(name + "_cc"), ctx, ghosts);
+            fc_idx[k] = var_db->registerVariableAndContext(new FaceVariable<NDIM, double>(name + "_fc"), ctx, ghosts);
+            nc_idx[k] = var_db->registerVariableAndContext(new NodeVariable<NDIM, double>(name + "_nc"), ctx, ghosts);
+            sc_idx[k] = var_db->registerVariableAndContext(new SideVariable<NDIM, double>(name + "_sc"), ctx, ghosts);
+        }
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (int k = 0; k < NVARS; ++k)
+            {
+                level->allocatePatchData(cc_idx[k], 0.0);
+                level->allocatePatchData(fc_idx[k], 0.0);
+                level->allocatePatchData(nc_idx[k], 0.0);
+                level->allocatePatchData(sc_idx[k], 0.0);
+            }
+        }
+
+        // Setup the Fortran and C++ patch operators.
+        PatchMathOps fortran_ops, cxx_ops;
+        fortran_ops.setUseFortranKernels(true);
+        cxx_ops.setUseFortranKernels(false);
+
+        // Compare the two implementations on each patch.  The results are
+        // initialized to identical random values so that ghost cell values,
+        // which neither implementation should modify, are also compared.
+        const double alpha = 1.3, beta = 0.7, gamma = -0.4;
+        Pointer<CellData<NDIM, double> > null_cc;
+        Pointer<SideData<NDIM, double> > null_sc;
+        double max_diff[15];
+        std::fill(max_diff, max_diff + 15, 0.0);
+        unsigned int seed = 0;
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+                Pointer<CellData<NDIM, double> > a_cc = patch->getPatchData(cc_idx[0]);
+                Pointer<CellData<NDIM, double> > u_cc = patch->getPatchData(cc_idx[1]);
+                Pointer<CellData<NDIM, double> > v_cc = patch->getPatchData(cc_idx[2]);
+                Pointer<CellData<NDIM, double> > f_cc = patch->getPatchData(cc_idx[3]);
+                Pointer<CellData<NDIM, double> > g_cc = patch->getPatchData(cc_idx[4]);
+                Pointer<FaceData<NDIM, double> > a_fc = patch->getPatchData(fc_idx[0]);
+                Pointer<FaceData<NDIM, double> > u_fc = patch->getPatchData(fc_idx[1]);
+                Pointer<FaceData<NDIM, double> > v_fc = patch->getPatchData(fc_idx[2]);
+                Pointer<FaceData<NDIM, double> > f_fc = patch->getPatchData(fc_idx[3]);
+                Pointer<FaceData<NDIM, double> > g_fc = patch->getPatchData(fc_idx[4]);
+                Pointer<NodeData<NDIM, double> > a_nc = patch->getPatchData(nc_idx[0]);
+                Pointer<NodeData<NDIM, double> > u_nc = patch->getPatchData(nc_idx[1]);
+                Pointer<NodeData<NDIM, double> > v_nc = patch->getPatchData(nc_idx[2]);
+                Pointer<NodeData<NDIM, double> > f_nc = patch->getPatchData(nc_idx[3]);
+                Pointer<NodeData<NDIM, double> > g_nc = patch->getPatchData(nc_idx[4]);
+                Pointer<SideData<NDIM, double> > a_sc = patch->getPatchData(sc_idx[0]);
+                Pointer<SideData<NDIM, double> > u_sc = patch->getPatchData(sc_idx[1]);
+                Pointer<SideData<NDIM, double> > v_sc = patch->getPatchData(sc_idx[2]);
+                Pointer<SideData<NDIM, double> > f_sc = patch->getPatchData(sc_idx[3]);
+                Pointer<SideData<NDIM, double> > g_sc = patch->getPatchData(sc_idx[4]);
+
+                randomize(a_cc, ++seed);
+                randomize(u_cc, ++seed);
+                randomize(v_cc, ++seed);
+                randomize(a_fc, seed += NDIM);
+                randomize(u_fc, seed += NDIM);
+                randomize(v_fc, seed += NDIM);
+                randomize(a_nc, ++seed);
+                randomize(u_nc, ++seed);
+                randomize(v_nc, ++seed);
+                randomize(a_sc, seed += NDIM);
+                randomize(u_sc, seed += NDIM);
+                randomize(v_sc, seed += NDIM);
+                seed += NDIM;
+
+                // Cell-centered Laplacian, with and without damping and with
+                // and without the additional source term.
+                randomize(f_cc, seed);
+                randomize(g_cc, seed);
+                fortran_ops.laplace(f_cc, alpha, 0.0, u_cc, 0.0, null_cc, patch);
+                cxx_ops.laplace(g_cc, alpha, 0.0, u_cc, 0.0, null_cc, patch);
+                max_diff[0] = std::max(max_diff[0], max_difference(f_cc, g_cc));
+
+                randomize(f_cc, seed);
+                randomize(g_cc, seed);
+                fortran_ops.laplace(f_cc, alpha, beta, u_cc, 0.0, null_cc, patch);
+                cxx_ops.laplace(g_cc, alpha, beta, u_cc, 0.0, null_cc, patch);
+                max_diff[1] = std::max(max_diff[1], max_difference(f_cc, g_cc));
+
+                randomize(f_cc, seed);
+                randomize(g_cc, seed);
+                fortran_ops.laplace(f_cc, alpha, beta, u_cc, gamma, v_cc, patch);
+                cxx_ops.laplace(g_cc, alpha, beta, u_cc, gamma, v_cc, patch);
+                max_diff[2] = std::max(max_diff[2], max_difference(f_cc, g_cc));
+
+                // Side-centered Laplacian.
+                randomize(f_sc, seed);
+                randomize(g_sc, seed);
+                fortran_ops.laplace(f_sc, alpha, beta, u_sc, 0.0, null_sc, patch);
+                cxx_ops.laplace(g_sc, alpha, beta, u_sc, 0.0, null_sc, patch);
+                max_diff[3] = std::max(max_diff[3], max_difference(f_sc, g_sc));
+
+                randomize(f_sc, seed);
+                randomize(g_sc, seed);
+                fortran_ops.laplace(f_sc, alpha, beta, u_sc, gamma, v_sc, patch);
+                cxx_ops.laplace(g_sc, alpha, beta, u_sc, gamma, v_sc, patch);
+                max_diff[4] = std::max(max_diff[4], max_difference(f_sc, g_sc));
+
+                // Divergence of side-centered data.
+                randomize(f_cc, seed);
+                randomize(g_cc, seed);
+                fortran_ops.div(f_cc, alpha, u_sc, 0.0, null_cc, patch);
+                cxx_ops.div(g_cc, alpha, u_sc, 0.0, null_cc, patch);
+                max_diff[5] = std::max(max_diff[5], max_difference(f_cc, g_cc));
+
+                randomize(f_cc, seed);
+                randomize(g_cc, seed);
+                fortran_ops.div(f_cc, alpha, u_sc, beta, v_cc, patch);
+                cxx_ops.div(g_cc, alpha, u_sc, beta, v_cc, patch);
+                max_diff[6] = std::max(max_diff[6], max_difference(f_cc, g_cc));
+
+                // Gradient of cell-centered data.
+                randomize(f_sc, seed);
+                randomize(g_sc, seed);
+                fortran_ops.grad(f_sc, alpha, u_cc, 0.0, null_sc, patch);
+                cxx_ops.grad(g_sc, alpha, u_cc, 0.0, null_sc, patch);
+                max_diff[7] = std::max(max_diff[7], max_difference(f_sc, g_sc));
+
+                randomize(f_sc, seed);
+                randomize(g_sc, seed);
+                fortran_ops.grad(f_sc, alpha, u_cc, beta, v_sc, patch);
+                cxx_ops.grad(g_sc, alpha, u_cc, beta, v_sc, patch);
+                max_diff[8] = std::max(max_diff[8], max_difference(f_sc, g_sc));
+
+                // Interpolation of side-centered data to cell centers.
+                randomize(f_cc, seed);
+                randomize(g_cc, seed);
+                fortran_ops.interp(f_cc, u_sc, patch);
+                cxx_ops.interp(g_cc, u_sc, patch);
+                max_diff[9] = std::max(max_diff[9], max_difference(f_cc, g_cc));
+
+                // Pointwise multiplication with variable coefficients.
+                randomize(f_cc, seed);
+                randomize(g_cc, seed);
+                fortran_ops.pointwiseMultiply(f_cc, a_cc, u_cc, beta, v_cc, patch);
+                cxx_ops.pointwiseMultiply(g_cc, a_cc, u_cc, beta, v_cc, patch);
+                max_diff[10] = std::max(max_diff[10], max_difference(f_cc, g_cc));
+
+                randomize(f_fc, seed);
+                randomize(g_fc, seed);
+                fortran_ops.pointwiseMultiply(f_fc, a_fc, u_fc, beta, v_fc, patch);
+                cxx_ops.pointwiseMultiply(g_fc, a_fc, u_fc, beta, v_fc, patch);
+                max_diff[11] = std::max(max_diff[11], max_difference(f_fc, g_fc));
+
+                randomize(f_nc, seed);
+                randomize(g_nc, seed);
+                fortran_ops.pointwiseMultiply(f_nc, a_nc, u_nc, beta, v_nc, patch);
+                cxx_ops.pointwiseMultiply(g_nc, a_nc, u_nc, beta, v_nc, patch);
+                max_diff[12] = std::max(max_diff[12], max_difference(f_nc, g_nc));
+
+                randomize(f_sc, seed);
+                randomize(g_sc, seed);
+                fortran_ops.pointwiseMultiply(f_sc, a_sc, u_sc, beta, v_sc, patch);
+                cxx_ops.pointwiseMultiply(g_sc, a_sc, u_sc, beta, v_sc, patch);
+                max_diff[13] = std::max(max_diff[13], max_difference(f_sc, g_sc));
+
+                randomize(f_sc, seed);
+                randomize(g_sc, seed);
+                fortran_ops.pointwiseMultiply(f_sc, a_sc, u_sc, 0.0, null_sc, patch);
+                cxx_ops.pointwiseMultiply(g_sc, a_sc, u_sc, 0.0, null_sc, patch);
+                max_diff[14] = std::max(max_diff[14], max_difference(f_sc, g_sc));
+            }
+        }
+
+        // Report the results.
+        static const char* const op_names[15] = { "cell-centered laplace",
+                                                  "cell-centered damped laplace",
+                                                  "cell-centered damped laplace with source",
+                                                  "side-centered damped laplace",
+                                                  "side-centered damped laplace with source",
+                                                  "side-to-cell divergence",
+                                                  "side-to-cell divergence with source",
+                                                  "cell-to-side gradient",
+                                                  "cell-to-side gradient with source",
+                                                  "side-to-cell interpolation",
+                                                  "cell-centered pointwise multiply",
+                                                  "face-centered pointwise multiply",
+                                                  "node-centered pointwise multiply",
+                                                  "side-centered pointwise multiply",
+                                                  "side-centered pointwise multiply without source" };
+        for (int k = 0; k < 15; ++k)
+        {
+            max_diff[k] = SAMRAI_MPI::maxReduction(max_diff[k]);
+            passed = check(op_names[k], max_diff[k], tol) && passed;
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed;
+} // run_test
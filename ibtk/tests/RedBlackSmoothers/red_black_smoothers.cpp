@@ -0,0 +1,346 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <sstream>
+#include <vector>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/Array.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonPointRelaxationFACOperator.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/SCLaplaceOperator.h>
+#include <ibtk/SCPoissonPointRelaxationFACOperator.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Remove the components of the right-hand side vector f that lie in the
+// nullspace of the periodic Laplacian.  The vector e is used as scratch space.
+void
+remove_nullspace(SAMRAIVectorReal<NDIM, double>& f_vec, SAMRAIVectorReal<NDIM, double>& e_vec)
+{
+    e_vec.setToScalar(1.0);
+    f_vec.addScalar(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                    -f_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false)) /
+                        e_vec.dot(Pointer<SAMRAIVectorReal<NDIM, double> >(&e_vec, false)));
+    return;
+} // remove_nullspace
+
+// Smooth the error equation A*u = f on the coarsest level starting from u = 0
+// and return the relative max norm of the residual r = f - A*u.
+double
+smooth_and_compute_residual(PoissonFACPreconditionerStrategy& fac_op,
+                            LaplaceOperator& laplace_op,
+                            SAMRAIVectorReal<NDIM, double>& u_vec,
+                            SAMRAIVectorReal<NDIM, double>& f_vec,
+                            SAMRAIVectorReal<NDIM, double>& r_vec,
+                            const int num_sweeps)
+{
+    fac_op.initializeOperatorState(u_vec, f_vec);
+    u_vec.setToScalar(0.0);
+    fac_op.smoothError(u_vec, f_vec, u_vec.getCoarsestLevelNumber(), num_sweeps, false, false);
+    fac_op.deallocateOperatorState();
+
+    laplace_op.initializeOperatorState(u_vec, r_vec);
+    laplace_op.apply(u_vec, r_vec);
+    laplace_op.deallocateOperatorState();
+    r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                   Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false));
+    return r_vec.maxNorm() / f_vec.maxNorm();
+} // smooth_and_compute_residual
+
+// Record the result of a test.
+bool
+check(const std::string& test_name, const double rel_residual, const double tol)
+{
+    const bool passed = rel_residual <= tol;
+    pout << test_name << ": |r|_oo / |f|_oo = " << rel_residual << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // check
+
+// Record the result of comparing a few sweeps of the smoother with S > 1 sweeps
+// per ghost cell exchange to the same number of sweeps with S = 1.  Because the
+// sweeps between exchanges read stale ghost cell values, the smoothed errors
+// differ, but the residual must not be much larger than with S = 1.
+bool
+check_comparison(const std::string& test_name,
+                 const double rel_residual,
+                 const double ref_rel_residual,
+                 const double rel_difference,
+                 const double max_residual_ratio)
+{
+    const bool passed = rel_residual <= max_residual_ratio * ref_rel_residual;
+    pout << test_name << ": |r|_oo / |f|_oo = " << rel_residual << " (S = 1: " << ref_rel_residual
+         << "), |u - u_1|_oo / |u_1|_oo = " << rel_difference << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // check_comparison
+
+// Compute |u - u_ref|_oo / |u_ref|_oo using r as scratch space.
+double
+compute_relative_difference(SAMRAIVectorReal<NDIM, double>& u_vec,
+                            SAMRAIVectorReal<NDIM, double>& u_ref_vec,
+                            SAMRAIVectorReal<NDIM, double>& r_vec)
+{
+    r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_vec, false),
+                   Pointer<SAMRAIVectorReal<NDIM, double> >(&u_ref_vec, false));
+    return r_vec.maxNorm() / u_ref_vec.maxNorm();
+} // compute_relative_difference
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_test(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "red_black_smoothers.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double tol = input_db->getDoubleWithDefault("tolerance", 1.0e-8);
+        const int num_sweeps = input_db->getIntegerWithDefault("num_sweeps", 1000);
+        const int gcw = input_db->getIntegerWithDefault("ghost_cell_width", 2);
+        const Array<int> sweeps_per_exchange = input_db->getIntegerArray("smoother_sweeps_per_exchange");
+        const int num_comparison_sweeps = input_db->getIntegerWithDefault("num_comparison_sweeps", 8);
+        const double max_residual_ratio = input_db->getDoubleWithDefault("max_residual_ratio", 1.5);
+        Pointer<Database> fac_db = input_db->getDatabase("FACOperator");
+        fac_db->putInteger("ghost_cell_width", gcw);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        const IntVector<NDIM> ghosts(gcw);
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+        Pointer<SideVariable<NDIM, double> > u_sc_var = new SideVariable<NDIM, double>("u_sc");
+        Pointer<SideVariable<NDIM, double> > f_sc_var = new SideVariable<NDIM, double>("f_sc");
+        Pointer<SideVariable<NDIM, double> > r_sc_var = new SideVariable<NDIM, double>("r_sc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, ghosts);
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, ghosts);
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, ghosts);
+        const int u_sc_idx = var_db->registerVariableAndContext(u_sc_var, ctx, ghosts);
+        const int f_sc_idx = var_db->registerVariableAndContext(f_sc_var, ctx, ghosts);
+        const int r_sc_idx = var_db->registerVariableAndContext(r_sc_var, ctx, ghosts);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(r_cc_idx, 0.0);
+            level->allocatePatchData(u_sc_idx, 0.0);
+            level->allocatePatchData(f_sc_idx, 0.0);
+            level->allocatePatchData(r_sc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+
+        SAMRAIVectorReal<NDIM, double> u_cc_vec("u_cc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_cc_vec("f_cc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> r_cc_vec("r_cc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> u_sc_vec("u_sc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> f_sc_vec("f_sc", patch_hierarchy, 0, finest_ln);
+        SAMRAIVectorReal<NDIM, double> r_sc_vec("r_sc", patch_hierarchy, 0, finest_ln);
+
+        u_cc_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        f_cc_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        r_cc_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+        u_sc_vec.addComponent(u_sc_var, u_sc_idx, h_sc_idx);
+        f_sc_vec.addComponent(f_sc_var, f_sc_idx, h_sc_idx);
+        r_sc_vec.addComponent(r_sc_var, r_sc_idx, h_sc_idx);
+
+        // The results of the first value of smoother_sweeps_per_exchange are the
+        // references for the comparisons.
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_cc_ref_vec = u_cc_vec.cloneVector("u_cc_ref");
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_sc_ref_vec = u_sc_vec.cloneVector("u_sc_ref");
+        u_cc_ref_vec->allocateVectorData();
+        u_sc_ref_vec->allocateVectorData();
+        double ref_cc_rel_residual = 0.0, ref_sc_rel_residual = 0.0;
+
+        // Setup the right-hand sides.
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+        f_fcn.setDataOnPatchHierarchy(f_sc_idx, f_sc_var, patch_hierarchy, 0.0);
+        remove_nullspace(f_cc_vec, r_cc_vec);
+        remove_nullspace(f_sc_vec, r_sc_vec);
+
+        // Setup the Laplace operators used to compute the residuals.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs(NDIM, bc_coef);
+
+        CCLaplaceOperator cc_laplace_op("cc_laplace_op");
+        cc_laplace_op.setPoissonSpecifications(poisson_spec);
+        cc_laplace_op.setPhysicalBcCoef(bc_coef);
+
+        SCLaplaceOperator sc_laplace_op("sc_laplace_op");
+        sc_laplace_op.setPoissonSpecifications(poisson_spec);
+        sc_laplace_op.setPhysicalBcCoefs(bc_coefs);
+
+        // Apply many red-black Gauss-Seidel sweeps on the periodic level.  The
+        // level includes cells with negative indices, so every cell is updated
+        // only if the red-black coloring is computed correctly there.
+        for (int k = 0; k < sweeps_per_exchange.getSize(); ++k)
+        {
+            fac_db->putInteger("smoother_sweeps_per_exchange", sweeps_per_exchange[k]);
+            std::ostringstream suffix;
+            suffix << " (smoother_sweeps_per_exchange = " << sweeps_per_exchange[k] << ")";
+
+            Pointer<CCPoissonPointRelaxationFACOperator> cc_fac_op =
+                new CCPoissonPointRelaxationFACOperator("cc_fac_op", fac_db, "");
+            cc_fac_op->setPoissonSpecifications(poisson_spec);
+            cc_fac_op->setPhysicalBcCoef(bc_coef);
+            const double cc_rel_residual =
+                smooth_and_compute_residual(*cc_fac_op, cc_laplace_op, u_cc_vec, f_cc_vec, r_cc_vec, num_sweeps);
+            passed = check("cell-centered red-black smoother" + suffix.str(), cc_rel_residual, tol) && passed;
+
+            const double cc_cmp_rel_residual = smooth_and_compute_residual(
+                *cc_fac_op, cc_laplace_op, u_cc_vec, f_cc_vec, r_cc_vec, num_comparison_sweeps);
+            if (k == 0)
+            {
+                ref_cc_rel_residual = cc_cmp_rel_residual;
+                u_cc_ref_vec->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_cc_vec, false));
+            }
+            else
+            {
+                const double cc_rel_difference = compute_relative_difference(u_cc_vec, *u_cc_ref_vec, r_cc_vec);
+                passed = check_comparison("cell-centered red-black smoother comparison" + suffix.str(),
+                                          cc_cmp_rel_residual,
+                                          ref_cc_rel_residual,
+                                          cc_rel_difference,
+                                          max_residual_ratio) &&
+                         passed;
+            }
+
+            Pointer<SCPoissonPointRelaxationFACOperator> sc_fac_op =
+                new SCPoissonPointRelaxationFACOperator("sc_fac_op", fac_db, "");
+            sc_fac_op->setPoissonSpecifications(poisson_spec);
+            sc_fac_op->setPhysicalBcCoefs(bc_coefs);
+            const double sc_rel_residual =
+                smooth_and_compute_residual(*sc_fac_op, sc_laplace_op, u_sc_vec, f_sc_vec, r_sc_vec, num_sweeps);
+            passed = check("side-centered red-black smoother" + suffix.str(), sc_rel_residual, tol) && passed;
+
+            const double sc_cmp_rel_residual = smooth_and_compute_residual(
+                *sc_fac_op, sc_laplace_op, u_sc_vec, f_sc_vec, r_sc_vec, num_comparison_sweeps);
+            if (k == 0)
+            {
+                ref_sc_rel_residual = sc_cmp_rel_residual;
+                u_sc_ref_vec->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&u_sc_vec, false));
+            }
+            else
+            {
+                const double sc_rel_difference = compute_relative_difference(u_sc_vec, *u_sc_ref_vec, r_sc_vec);
+                passed = check_comparison("side-centered red-black smoother comparison" + suffix.str(),
+                                          sc_cmp_rel_residual,
+                                          ref_sc_rel_residual,
+                                          sc_rel_difference,
+                                          max_residual_ratio) &&
+                         passed;
+            }
+        }
+        u_cc_ref_vec->freeVectorComponents();
+        u_sc_ref_vec->freeVectorComponents();
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed;
+} // run_test
@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include "red_black_smoothers.cpp"
+
+int test_argc;
+char** test_argv;
+
+#if (NDIM == 2)
+#define TEST_CASE_NAME ibtk_RedBlackSmoothers_2d
+#endif
+#if (NDIM == 3)
+#define TEST_CASE_NAME ibtk_RedBlackSmoothers_3d
+#endif
+
+TEST(TEST_CASE_NAME, periodic_level_with_negative_indices)
+{
+    EXPECT_EQ(run_test(test_argc, test_argv), true);
+}
+
+int
+main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    test_argc = argc;
+    test_argv = argv;
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,307 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+// Headers for major SAMRAI objects
+#include <ArrayData.h>
+#include <BergerRigoutsos.h>
+#include <BoundaryBox.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellIterator.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CartCellRobinPhysBdryOp.h>
+#include <ibtk/PhysicalBoundaryUtilities.h>
+#include <ibtk/PoissonUtilities.h>
+#include <ibtk/muParserRobinBcCoefs.h>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// The (linear) inhomogeneous boundary value g(X) used on every boundary.
+double
+g_exact(const double* const X)
+{
+    double g = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        g += static_cast<double>(d + 1) * X[d];
+    }
+    return g;
+} // g_exact
+
+// Check the ghost values set by Dirichlet boundary conditions when the
+// interior values are zero.  In this case, u_g = 2*g at the boundary, or
+// u_g = 0 for homogeneous boundary conditions.  Ghost cells at physical
+// boundary corners are not checked.
+bool
+check_ghost_values(const std::string& test_name,
+                   Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                   const int Q_idx,
+                   const bool homogeneous_bc,
+                   const double tol)
+{
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = patch_hierarchy->getGridGeometry();
+    const Box<NDIM>& domain_box = grid_geom->getPhysicalDomain()[0];
+    double max_err = 0.0;
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const x_lower = pgeom->getXLower();
+        const double* const dx = pgeom->getDx();
+        Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+        for (Box<NDIM>::Iterator b(Q_data->getGhostBox()); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            if (domain_box.contains(i)) continue;
+            int num_outside = 0, bdry_normal_axis = 0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (i(d) < patch_box.lower(d) || i(d) > patch_box.upper(d))
+                {
+                    ++num_outside;
+                    bdry_normal_axis = d;
+                }
+            }
+            if (num_outside != 1) continue;
+            double X_bdry[NDIM];
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X_bdry[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
+            }
+            X_bdry[bdry_normal_axis] =
+                i(bdry_normal_axis) < patch_box.lower(bdry_normal_axis) ? x_lower[bdry_normal_axis] :
+                                                                          pgeom->getXUpper()[bdry_normal_axis];
+            const double expected = homogeneous_bc ? 0.0 : 2.0 * g_exact(X_bdry);
+            max_err = std::max(max_err, std::abs((*Q_data)(i) - expected));
+        }
+    }
+    max_err = SAMRAI_MPI::maxReduction(max_err);
+    const bool passed = max_err <= tol;
+    pout << test_name << ": max error = " << max_err << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // check_ghost_values
+
+// Check the values of g obtained by calling setBcCoefs() directly, i.e., by a
+// caller that does not set the homogeneous boundary condition flag.
+bool
+check_gcoef_values(const std::string& test_name,
+                   Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                   RobinBcCoefStrategy<NDIM>& bc_coef,
+                   const double tol)
+{
+    double max_err = 0.0;
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        if (!pgeom->getTouchesRegularBoundary()) continue;
+        const double* const x_lower = pgeom->getXLower();
+        const double* const dx = pgeom->getDx();
+        const Array<BoundaryBox<NDIM> > physical_codim1_boxes =
+            PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
+        for (int n = 0; n < physical_codim1_boxes.size(); ++n)
+        {
+            const BoundaryBox<NDIM>& bdry_box = physical_codim1_boxes[n];
+            const unsigned int bdry_normal_axis = bdry_box.getLocationIndex() / 2;
+            const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(bdry_box);
+            Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            bc_coef.setBcCoefs(
+                acoef_data, bcoef_data, gcoef_data, Pointer<Variable<NDIM> >(), *patch, bdry_box, 0.0);
+            for (Box<NDIM>::Iterator b(bc_coef_box); b; b++)
+            {
+                const Index<NDIM>& i = b();
+                double X_bdry[NDIM];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X_bdry[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) +
+                                                      (d == bdry_normal_axis ? 0.0 : 0.5));
+                }
+                max_err = std::max(max_err, std::abs((*gcoef_data)(i, 0) - g_exact(X_bdry)));
+            }
+        }
+    }
+    max_err = SAMRAI_MPI::maxReduction(max_err);
+    const bool passed = max_err <= tol;
+    pout << test_name << ": max error = " << max_err << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // check_gcoef_values
+
+// Fill the physical boundary ghost cells of Q with zero interior values.
+void
+fill_ghost_values(Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                  const int Q_idx,
+                  CartCellRobinPhysBdryOp& bc_op,
+                  const bool homogeneous_bc)
+{
+    bc_op.setHomogeneousBc(homogeneous_bc);
+    Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idx);
+        Q_data->fillAll(0.0);
+        if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+        {
+            bc_op.setPhysicalBoundaryConditions(*patch, 0.0, Q_data->getGhostCellWidth());
+        }
+    }
+    return;
+} // fill_ghost_values
+
+/*******************************************************************************
+ * For each run, the input filename must be given on the command line.  In all *
+ * cases, the command line is:                                                 *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+bool
+run_test(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "robin_bc_coefs.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double tol = input_db->getDoubleWithDefault("tolerance", 1.0e-12);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > Q_var = new CellVariable<NDIM, double>("Q");
+        Pointer<CellVariable<NDIM, double> > rhs_var = new CellVariable<NDIM, double>("rhs");
+        const int Q_idx = var_db->registerVariableAndContext(Q_var, ctx, IntVector<NDIM>(1));
+        const int rhs_idx = var_db->registerVariableAndContext(rhs_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(Q_idx, 0.0);
+        level->allocatePatchData(rhs_idx, 0.0);
+
+        // Setup the boundary condition objects.  The coefficients do not
+        // depend on time, so they are cached by the boundary operator.
+        muParserRobinBcCoefs bc_coef("bc_coef", app_initializer->getComponentDatabase("bc_coef"), grid_geometry);
+        CartCellRobinPhysBdryOp bc_op(Q_idx, &bc_coef, false);
+
+        // Alternate between homogeneous and inhomogeneous boundary fills.
+        fill_ghost_values(patch_hierarchy, Q_idx, bc_op, true);
+        passed = check_ghost_values("homogeneous fill", patch_hierarchy, Q_idx, true, tol) && passed;
+        fill_ghost_values(patch_hierarchy, Q_idx, bc_op, false);
+        passed = check_ghost_values("inhomogeneous fill", patch_hierarchy, Q_idx, false, tol) && passed;
+        fill_ghost_values(patch_hierarchy, Q_idx, bc_op, true);
+        passed = check_ghost_values("homogeneous fill (cached)", patch_hierarchy, Q_idx, true, tol) && passed;
+        fill_ghost_values(patch_hierarchy, Q_idx, bc_op, false);
+        passed = check_ghost_values("inhomogeneous fill (cached)", patch_hierarchy, Q_idx, false, tol) && passed;
+
+        // Use the boundary condition object in a homogeneous RHS adjustment,
+        // and then check that a caller that does not set the homogeneous
+        // boundary condition flag still obtains the inhomogeneous values of g.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        double max_rhs = 0.0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > rhs_data = patch->getPatchData(rhs_idx);
+            rhs_data->fillAll(0.0);
+            if (patch->getPatchGeometry()->getTouchesRegularBoundary())
+            {
+                PoissonUtilities::adjustRHSAtPhysicalBoundary(
+                    *rhs_data, patch, poisson_spec, &bc_coef, 0.0, /*homogeneous_bc*/ true);
+            }
+            for (CellIterator<NDIM> ic(patch->getBox()); ic; ic++)
+            {
+                max_rhs = std::max(max_rhs, std::abs((*rhs_data)(ic())));
+            }
+        }
+        max_rhs = SAMRAI_MPI::maxReduction(max_rhs);
+        pout << "homogeneous RHS adjustment: max |rhs| = " << max_rhs << (max_rhs <= tol ? "" : " (FAILED)") << "\n";
+        passed = max_rhs <= tol && passed;
+        passed = check_gcoef_values("g after homogeneous RHS adjustment", patch_hierarchy, bc_coef, tol) && passed;
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed;
+} // run_test
@@ -38,10 +38,12 @@
 #include <string>
 #include <vector>
 
+#include "CellData.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
 #include "FaceVariable.h"
 #include "IntVector.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "RefineAlgorithm.h"
 #include "RefinePatchStrategy.h"
@@ -118,6 +120,27 @@ public:
      */
     void applyConvectiveOperator(int Q_idx, int N_idx);
 
+    /*!
+     * \brief Compute the action of the convective operator for several
+     * quantities that are advected by the same velocity field.
+     *
+     * Each quantity must have the same data depth as the variable used to
+     * construct the operator.  The quantities are packed into a single
+     * multi-depth scratch variable so that ghost cell filling, the evaluation
+     * of the PPM predictor, and the synchronization of fluxes on the patch
+     * hierarchy are performed once for all quantities.
+     *
+     * \param Q_idxs patch data indices of the quantities to be advected
+     * \param N_idxs patch data indices in which to store the results
+     * \param Q_bc_coefs boundary conditions for each quantity; if empty, the
+     * boundary conditions used to construct the operator are used for all
+     * quantities
+     */
+    void applyConvectiveOperator(const std::vector<int>& Q_idxs,
+                                 const std::vector<int>& N_idxs,
+                                 const std::vector<std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> >&
+                                     Q_bc_coefs = std::vector<std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> >());
+
     /*!
      * \name General operator functionality.
      */
@@ -197,6 +220,33 @@ private:
      */
     AdvDiffPPMConvectiveOperator& operator=(const AdvDiffPPMConvectiveOperator& that);
 
+    /*!
+     * \brief Enforce inflow boundary conditions and compute the face-centered
+     * PPM predicted values (and fluxes, if needed) for all components of the
+     * specified cell-centered data.
+     */
+    void computeFaceValues(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                           int Q_scratch_idx,
+                           int q_extrap_idx,
+                           int q_flux_idx,
+                           const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs);
+
+    /*!
+     * \brief Compute the convective derivative from the face-centered values
+     * (or fluxes) starting at component q_depth_offset.
+     */
+    void differenceFaceValues(SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                              int q_extrap_idx,
+                              int q_flux_idx,
+                              int q_depth_offset,
+                              SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > N_data);
+
+    /*!
+     * \brief Setup the packed scratch data and communication schedules used to
+     * apply the operator to the specified number of quantities at once.
+     */
+    void initializeBatchState(int num_quantities);
+
     // Data communication algorithms, operators, and schedules.
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_coarsen_alg;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_coarsen_scheds;
@@ -216,6 +266,14 @@ private:
     int d_Q_scratch_idx;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > d_q_extrap_var, d_q_flux_var;
     int d_q_extrap_idx, d_q_flux_idx;
+
+    // Packed scratch data and communication schedules used when applying the
+    // operator to several quantities at once.
+    int d_batch_num_quantities;
+    int d_Q_batch_scratch_idx, d_q_batch_extrap_idx, d_q_batch_flux_idx;
+    SAMRAI::tbox::Pointer<SAMRAI::xfer::RefinePatchStrategy<NDIM> > d_batch_ghostfill_strategy;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_batch_ghostfill_scheds;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_batch_coarsen_scheds;
 };
 } // namespace IBAMR
 
@@ -38,6 +38,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "HierarchyFaceDataOpsReal.h"
 #include "IntVector.h"
@@ -52,6 +53,11 @@ namespace IBAMR
 {
 class ConvectiveOperator;
 } // namespace IBAMR
+namespace IBTK
+{
+class LaplaceOperator;
+class PoissonSolver;
+} // namespace IBTK
 namespace SAMRAI
 {
 namespace hier
@@ -60,6 +66,8 @@ template <int DIM>
 class BasePatchHierarchy;
 template <int DIM>
 class PatchHierarchy;
+template <int DIM>
+class Variable;
 } // namespace hier
 namespace mesh
 {
@@ -71,6 +79,13 @@ namespace pdat
 template <int DIM, class TYPE>
 class CellVariable;
 } // namespace pdat
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+template <int DIM>
+class RobinBcCoefStrategy;
+} // namespace solv
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -94,6 +109,51 @@ namespace IBAMR
  *
  * Various options are available for the spatial and temporal discretizations.
  *
+ * When input database key <tt>batch_helmholtz_solves</tt> is set to \p TRUE,
+ * consecutively registered transported quantities that use constant diffusion
+ * coefficients and that have identical diffusion coefficients, damping
+ * coefficients, and diffusion time stepping types are packed into a single
+ * multi-depth cell variable, and the corresponding linear systems are solved
+ * together as a single block-diagonal system.  This allows the ghost cell
+ * fills and Krylov reductions to be shared among many species.  Batched solves
+ * use the default Helmholtz solver settings.  Quantities for which a Helmholtz
+ * solver or right-hand-side operator is provided via setHelmholtzSolver() or
+ * setHelmholtzRHSOperator() are never batched.
+ *
+ * Each batch is solved at the point at which its last quantity would be solved
+ * for without batching, so that quantities outside of the batch see the same
+ * data as before.  Within a batch, however, the forcing terms of all of the
+ * quantities are evaluated before any of them is updated, so that a forcing
+ * term that depends on other quantities of the same batch sees their values
+ * from the previous cycle rather than their updated values.  Because such
+ * couplings are already treated explicitly by this integrator, this only
+ * changes which lagged values are used.  Quantities that require the updated
+ * values of earlier quantities should not be batched together, e.g., by
+ * registering them with different diffusion coefficients or by disabling
+ * batching.
+ *
+ * Batching the Helmholtz solves also enables batching of the convective
+ * operators (see below) unless <tt>batch_convective_operators</tt> is set
+ * explicitly.
+ *
+ * When input database key <tt>batch_convective_operators</tt> is set to \p
+ * TRUE, the convective terms of transported quantities that are advected by
+ * the same velocity field, that have the same data depth, and that use
+ * identical convective operator settings and convective time stepping types
+ * are evaluated together by a single call to
+ * AdvDiffPPMConvectiveOperator::applyConvectiveOperator(), so that ghost cell
+ * filling and flux synchronization are shared among the quantities.  Only
+ * quantities that use the default \p "PPM" convective operator are batched;
+ * quantities for which a convective operator is provided via
+ * setConvectiveOperator() are never batched.  Each convective term depends
+ * only on the corresponding quantity and its advection velocity, so batching
+ * does not change the order of the time integration.
+ *
+ * Advection velocities, diffusion coefficients, and forcing terms that are
+ * provided by IBTK::muParserCartGridFunction objects whose expressions do not
+ * refer to the time variable are evaluated only once after each regridding
+ * operation and are subsequently copied rather than re-evaluated.
+ *
  * \see HierarchyIntegrator
  * \see SAMRAI::mesh::StandardTagAndInitStrategy
  * \see SAMRAI::algs::TimeRefinementIntegrator
@@ -355,6 +415,44 @@ protected:
              SAMRAI::tbox::Pointer<ConvectiveOperator> > d_Q_convective_op;
     std::map<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> >, bool> d_Q_convective_op_needs_init;
 
+    /*!
+     * Batched Helmholtz solver data.  For each transported quantity,
+     * d_Q_helmholtz_batch stores the index of the batch containing that
+     * quantity, or -1 if the quantity is solved for individually, and
+     * d_Q_helmholtz_batch_depth_offset stores the offset of the components of
+     * that quantity within the packed batch variable.
+     */
+    bool d_batch_helmholtz_solves;
+    std::vector<int> d_Q_helmholtz_batch, d_Q_helmholtz_batch_depth_offset;
+    std::vector<std::vector<unsigned int> > d_helmholtz_batch_Q_idxs;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > > d_helmholtz_batch_Q_var,
+        d_helmholtz_batch_Q_rhs_var;
+    std::vector<std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*> > d_helmholtz_batch_bc_coef;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_helmholtz_batch_sol_vecs,
+        d_helmholtz_batch_rhs_vecs;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::PoissonSolver> > d_helmholtz_batch_solvers;
+    std::vector<SAMRAI::tbox::Pointer<IBTK::LaplaceOperator> > d_helmholtz_batch_rhs_ops;
+    std::vector<bool> d_helmholtz_batch_solvers_need_init, d_helmholtz_batch_rhs_ops_need_init;
+
+    /*!
+     * Batched convective operator data.  For each transported quantity,
+     * d_Q_convective_batch stores the index of the batch containing that
+     * quantity, or -1 if the convective operator is applied to the quantity
+     * individually.  The convective operator of the first quantity of each
+     * batch is used to evaluate the convective terms of the entire batch.
+     */
+    bool d_batch_convective_ops;
+    std::vector<int> d_Q_convective_batch;
+    std::vector<std::vector<unsigned int> > d_convective_batch_Q_idxs;
+
+    /*!
+     * Advection velocities, diffusion coefficients, and forcing terms that are
+     * set by functions that do not depend on time are evaluated only once
+     * after each regridding operation.  d_fcn_data_is_current indicates which
+     * of these variables hold current data that may be reused.
+     */
+    std::map<SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> >, bool> d_fcn_data_is_current;
+
 private:
     /*!
      * \brief Default constructor.
@@ -383,6 +481,49 @@ private:
      */
     AdvDiffSemiImplicitHierarchyIntegrator& operator=(const AdvDiffSemiImplicitHierarchyIntegrator& that);
 
+    /*!
+     * Determine which transported quantities may be solved for together and
+     * register the packed variables used by the batched Helmholtz solves.
+     * Quantities flagged in \a Q_has_custom_helmholtz_ops are excluded from
+     * the batches.
+     */
+    void setupHelmholtzBatches(const std::vector<bool>& Q_has_custom_helmholtz_ops);
+
+    /*!
+     * Copy data between a transported quantity and the corresponding
+     * components of the packed variable of its Helmholtz batch.
+     */
+    void copyHelmholtzBatchData(unsigned int l, int Q_data_idx, int batch_data_idx, bool pack);
+
+    /*!
+     * Solve the packed Helmholtz system of a batch and copy the solution to the
+     * new data of each of the quantities in the batch.
+     */
+    void solveHelmholtzBatch(unsigned int batch);
+
+    /*!
+     * Determine which transported quantities may have their convective terms
+     * evaluated together.  Quantities flagged in \a Q_has_custom_convective_op
+     * are excluded from the batches.
+     */
+    void setupConvectiveBatches(const std::vector<bool>& Q_has_custom_convective_op);
+
+    /*!
+     * Return the transported quantities whose convective terms are evaluated
+     * when quantity number \a l is processed: the quantity itself if it is not
+     * batched, all of the quantities in its batch if it is the first quantity
+     * of its batch, and no quantities otherwise.
+     */
+    std::vector<unsigned int> getConvectiveBatchQuantities(unsigned int l) const;
+
+    /*!
+     * Evaluate the convective operator for the specified transported
+     * quantities, which must share the same advection velocity, using the
+     * values stored in their scratch data.  The results are stored in the
+     * scratch data of the corresponding convective terms.
+     */
+    void applyConvectiveOperators(const std::vector<unsigned int>& Q_idxs, int u_idx, double time);
+
     /*!
      * Read input values from a given database.
      */
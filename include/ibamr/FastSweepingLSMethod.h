@@ -73,6 +73,9 @@ namespace IBAMR
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
  *
+ * \note The sweeps may be restricted to a narrow band about the interface; see
+ * LSInitStrategy.
+ *
  * References
  * Zhao, H., <A HREF="http://www.ams.org/journals/mcom/2005-74-250/S0025-5718-04-01678-3/">
  * A Fast Sweeping Method For Eikonal Equations</A>
@@ -107,16 +110,25 @@ protected:
 
 private:
     /*!
-     * \brief Do one fast sweep over the hierarchy.
+     * \brief Do one fast sweep in each of the 2^NDIM sweep directions over the
+     * hierarchy.
+     *
+     * Each directional sweep visits all of the active boxes of a patch in the
+     * order of the sweep before the next directional sweep is started, so that
+     * information propagates across the active boxes of the patch within a
+     * single sweep.
      */
     void fastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops, int dist_idx) const;
 
     /*!
-     * \brief Do one fast sweep over a patch.
+     * \brief Do a single directional sweep over the cells of a patch that lie
+     * in the specified box.  The entries of \a sweep_dir are +1 or -1.
      */
     void fastSweep(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                   const SAMRAI::hier::Box<NDIM>& domain_box) const;
+                   const SAMRAI::hier::Box<NDIM>& box,
+                   const SAMRAI::hier::Box<NDIM>& domain_box,
+                   const int* sweep_dir) const;
 
     /*!
      * Read input values from a given database.
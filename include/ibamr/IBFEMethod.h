@@ -185,7 +185,17 @@ public:
     typedef IBTK::TensorMeshFcnPtr PK1StressFcnPtr;
 
     /*!
-     * Struct encapsulating PK1 stress tensor function data.
+     * Typedef specifying interface for PK1 stress tensor function that is
+     * evaluated at all of the quadrature points of an element or element side
+     * in a single call.
+     *
+     * \see IBTK::TensorMeshBlockFcnPtr
+     */
+    typedef IBTK::TensorMeshBlockFcnPtr PK1StressBlockFcnPtr;
+
+    /*!
+     * Struct encapsulating PK1 stress tensor function data.  Either a
+     * pointwise function or a block function may be specified.
      */
     struct PK1StressFcnData
     {
@@ -194,11 +204,31 @@ public:
                          void* const ctx = NULL,
                          const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
                          const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
-            : fcn(fcn), system_data(system_data), ctx(ctx), quad_type(quad_type), quad_order(quad_order)
+            : fcn(fcn),
+              block_fcn(NULL),
+              system_data(system_data),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order)
+        {
+        }
+
+        PK1StressFcnData(PK1StressBlockFcnPtr block_fcn,
+                         const std::vector<IBTK::SystemData>& system_data = std::vector<IBTK::SystemData>(),
+                         void* const ctx = NULL,
+                         const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                         const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+            : fcn(NULL),
+              block_fcn(block_fcn),
+              system_data(system_data),
+              ctx(ctx),
+              quad_type(quad_type),
+              quad_order(quad_order)
         {
         }
 
         PK1StressFcnPtr fcn;
+        PK1StressBlockFcnPtr block_fcn;
         std::vector<IBTK::SystemData> system_data;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -447,6 +477,12 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Record the wall clock time spent solving the fluid equations during the
+     * current time step.
+     */
+    void recordFluidSolveTime(double wall_time);
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -504,6 +540,11 @@ public:
 
     /*!
      * Write the equation_systems data to a restart file in the specified directory.
+     *
+     * \note When the input option libmesh_partition_agnostic_restart is set to
+     * false, each process writes the values of the degrees of freedom that it
+     * owns to a separate file, and restarting requires the same partitioning
+     * of the FE meshes.
      */
     void writeFEDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number);
 
@@ -565,6 +606,12 @@ protected:
      */
     bool d_do_log;
 
+    /*
+     * The number of time steps over which timings are accumulated to calibrate
+     * the work load estimates.  Calibration is disabled when this is zero.
+     */
+    int d_workload_calibration_window;
+
     /*
      * Pointers to the patch hierarchy and gridding algorithm objects associated
      * with this object.
@@ -665,6 +712,18 @@ protected:
      */
     std::string d_libmesh_restart_file_extension;
 
+    /*
+     * Whether libMesh equation systems are written to partition-agnostic
+     * restart files (the default), or whether each process writes only its
+     * locally owned values to a separate restart file.  The latter avoids the
+     * global renumbering of the degrees of freedom and the system headers, but
+     * requires the restarted computation to use the same partitioning of the FE
+     * meshes.  The read setting is the one in effect when the restart files
+     * were written.
+     */
+    bool d_libmesh_partition_agnostic_restart;
+    bool d_libmesh_restart_read_partition_agnostic;
+
 private:
     /*!
      * \brief Default constructor.
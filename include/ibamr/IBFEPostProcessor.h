@@ -103,6 +103,9 @@ public:
     /*!
      * \brief Function for reconstructing the Cauchy stress from the PK1 stress,
      * using the PK1 stress function data provided by the ctx argument.
+     *
+     * \note If the PK1 stress function data only provides a block function, the
+     * block function is evaluated at a single point.
      */
     static inline void cauchy_stress_from_PK1_stress_fcn(
         libMesh::TensorValue<double>& sigma,
@@ -121,7 +124,65 @@ public:
         IBTK::TensorMeshFcnPtr PK1_stress_fcn = PK1_stress_fcn_data->fcn;
         void* PK1_stress_fcn_ctx = PK1_stress_fcn_data->ctx;
         libMesh::TensorValue<double> PP;
-        PK1_stress_fcn(PP, FF, X, s, elem, system_var_data, system_grad_var_data, data_time, PK1_stress_fcn_ctx);
+        if (PK1_stress_fcn)
+        {
+            PK1_stress_fcn(PP, FF, X, s, elem, system_var_data, system_grad_var_data, data_time, PK1_stress_fcn_ctx);
+        }
+        else
+        {
+            IBTK::TensorMeshBlockFcnPtr PK1_stress_block_fcn = PK1_stress_fcn_data->block_fcn;
+            TBOX_ASSERT(PK1_stress_block_fcn);
+
+            // With a block of a single point, the structure-of-arrays storage
+            // used by the block function reduces to component-major storage.
+            double PP_block[NDIM * NDIM], FF_block[NDIM * NDIM], X_block[NDIM], s_block[NDIM];
+            for (unsigned int i = 0; i < NDIM; ++i)
+            {
+                X_block[i] = X(i);
+                s_block[i] = s(i);
+                for (unsigned int j = 0; j < NDIM; ++j)
+                {
+                    PP_block[i * NDIM + j] = 0.0;
+                    FF_block[i * NDIM + j] = FF(i, j);
+                }
+            }
+            const size_t n_systems = system_var_data.size();
+            std::vector<const double*> var_data_ptrs(n_systems, NULL);
+            for (size_t k = 0; k < n_systems; ++k)
+            {
+                if (!system_var_data[k]->empty()) var_data_ptrs[k] = &(*system_var_data[k])[0];
+            }
+            const size_t n_grad_systems = system_grad_var_data.size();
+            std::vector<std::vector<double> > grad_var_data(n_grad_systems);
+            std::vector<const double*> grad_var_data_ptrs(n_grad_systems, NULL);
+            for (size_t k = 0; k < n_grad_systems; ++k)
+            {
+                const std::vector<libMesh::VectorValue<double> >& grad_vars = *system_grad_var_data[k];
+                grad_var_data[k].resize(grad_vars.size() * NDIM);
+                for (size_t v = 0; v < grad_vars.size(); ++v)
+                {
+                    for (unsigned int i = 0; i < NDIM; ++i) grad_var_data[k][v * NDIM + i] = grad_vars[v](i);
+                }
+                if (!grad_var_data[k].empty()) grad_var_data_ptrs[k] = &grad_var_data[k][0];
+            }
+            PK1_stress_block_fcn(PP_block,
+                                 FF_block,
+                                 X_block,
+                                 s_block,
+                                 1,
+                                 elem,
+                                 var_data_ptrs,
+                                 grad_var_data_ptrs,
+                                 data_time,
+                                 PK1_stress_fcn_ctx);
+            for (unsigned int i = 0; i < NDIM; ++i)
+            {
+                for (unsigned int j = 0; j < NDIM; ++j)
+                {
+                    PP(i, j) = PP_block[i * NDIM + j];
+                }
+            }
+        }
         sigma = PP * FF.transpose() / FF.det();
         return;
     } // cauchy_stress_from_PK1_stress_fcn
@@ -286,6 +286,36 @@ protected:
      */
     double d_regrid_cfl_interval, d_regrid_cfl_estimate;
 
+    /*!
+     * The regrid structure CFL interval indicates the number of meshwidths a
+     * Lagrangian point may actually move between invocations of the regridding
+     * process.  Unlike the regrid CFL estimate, which bounds the displacement
+     * of all points by the maximum fluid velocity, the regrid structure CFL
+     * estimate tracks the displacement of each Lagrangian point from its
+     * position at the most recent regrid, so that slowly moving structures do
+     * not trigger regridding because of fast flow elsewhere in the domain.
+     *
+     * NOTE: When the structure CFL-based regrid interval is specified, it is
+     * used instead of both the CFL-based and the fixed-step regrid intervals.
+     * If the IB strategy does not track point displacements, the CFL estimate
+     * is used in place of the structure CFL estimate.
+     */
+    double d_regrid_structure_cfl_interval, d_regrid_structure_cfl_estimate;
+
+    /*!
+     * Displacement accumulated prior to the most recent reset of the reference
+     * positions that did not coincide with a regrid (e.g., when restarting).
+     */
+    double d_regrid_structure_cfl_offset;
+
+    /*!
+     * The number of time steps between redistributions of the Lagrangian data
+     * on the present configuration of the patch hierarchy.  Lagrangian-only
+     * redistribution is skipped at time steps at which the patch hierarchy is
+     * regridded, and it is disabled when the interval is zero.
+     */
+    int d_lag_redistribution_interval;
+
     /*
      * IB method implementation object.
      */
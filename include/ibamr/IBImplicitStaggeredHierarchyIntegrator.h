@@ -375,6 +375,9 @@ private:
     KSP d_schur_solver;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_u_scratch_vec, d_f_scratch_vec;
     Vec d_X_current;
+
+    // Wall time spent in Stokes solves during the current call to integrateHierarchy().
+    double d_fluid_solve_time;
 };
 } // namespace IBAMR
 
@@ -381,6 +381,24 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Record the wall clock time spent solving the fluid equations during the
+     * current time step.
+     */
+    void recordFluidSolveTime(double wall_time);
+
+    /*!
+     * Reset the reference positions used to measure the displacements of the
+     * Lagrangian points.
+     */
+    void resetPointDisplacements();
+
+    /*!
+     * Return the maximum displacement of any Lagrangian point since the most
+     * recent call to resetPointDisplacements().
+     */
+    double getMaxPointDisplacement();
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -533,6 +551,9 @@ protected:
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn, d_spread_kernel_fcn;
     bool d_error_if_points_leave_domain;
+    bool d_use_flat_data_redistribution;
+    bool d_use_collective_restart_io;
+    int d_workload_calibration_window;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
     /*
@@ -353,6 +353,35 @@ public:
     virtual void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                          int workload_data_idx);
 
+    /*!
+     * Record the wall clock time spent solving the fluid equations during the
+     * current time step, for use in calibrating work load estimates.
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void recordFluidSolveTime(double wall_time);
+
+    /*!
+     * Reset the reference positions used to measure the displacements of the
+     * Lagrangian points to the present positions of the points.
+     *
+     * An empty default implementation is provided.
+     */
+    virtual void resetPointDisplacements();
+
+    /*!
+     * Return the maximum displacement of any Lagrangian point since the most
+     * recent call to resetPointDisplacements(), measured in units of the grid
+     * spacing of the level of the patch hierarchy to which the point is
+     * assigned.
+     *
+     * A default implementation is provided that returns -1 to indicate that
+     * point displacements are not tracked by this IB strategy.
+     *
+     * \note This method is collective.
+     */
+    virtual double getMaxPointDisplacement();
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -371,6 +400,19 @@ public:
     virtual void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                        SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Redistribute Lagrangian data on the present configuration of the patch
+     * hierarchy, i.e., without regridding the patch hierarchy.  This updates
+     * the assignment of Lagrangian points to patches and processes without
+     * reinitializing any Eulerian data or solvers.
+     *
+     * A default implementation is provided that calls beginDataRedistribution()
+     * followed immediately by endDataRedistribution().
+     */
+    virtual void
+    redistributeLagrangianData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                               SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
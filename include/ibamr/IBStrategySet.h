@@ -281,6 +281,25 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Record the wall clock time spent solving the fluid equations during the
+     * current time step.
+     */
+    void recordFluidSolveTime(double wall_time);
+
+    /*!
+     * Reset the reference positions used to measure the displacements of the
+     * Lagrangian points.
+     */
+    void resetPointDisplacements();
+
+    /*!
+     * Return the maximum displacement of any Lagrangian point since the most
+     * recent call to resetPointDisplacements(), or -1 if any of the IB
+     * strategies does not track point displacements.
+     */
+    double getMaxPointDisplacement();
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -252,6 +252,24 @@ public:
     void updateWorkloadEstimates(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                  int workload_data_idx);
 
+    /*!
+     * Record the wall clock time spent solving the fluid equations during the
+     * current time step.
+     */
+    void recordFluidSolveTime(double wall_time);
+
+    /*!
+     * Reset the reference positions used to measure the displacements of the
+     * Lagrangian points.
+     */
+    void resetPointDisplacements();
+
+    /*!
+     * Return the maximum displacement of any Lagrangian point since the most
+     * recent call to resetPointDisplacements().
+     */
+    double getMaxPointDisplacement();
+
     /*!
      * Begin redistributing Lagrangian data prior to regridding the patch
      * hierarchy.
@@ -340,6 +358,12 @@ protected:
      */
     bool d_do_log;
 
+    /*
+     * The number of time steps over which timings are accumulated to calibrate
+     * the work load estimates.  Calibration is disabled when this is zero.
+     */
+    int d_workload_calibration_window;
+
     /*
      * Pointers to the patch hierarchy and gridding algorithm objects associated
      * with this object.
@@ -57,6 +57,7 @@
 namespace IBAMR
 {
 class ConvectiveOperator;
+class StaggeredStokesInitialGuessAccelerator;
 } // namespace IBAMR
 namespace IBTK
 {
@@ -356,6 +357,7 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_stokes_solver_db, d_stokes_precond_db, d_stokes_sub_precond_db;
     SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
     bool d_stokes_solver_needs_init;
+    SAMRAI::tbox::Pointer<StaggeredStokesInitialGuessAccelerator> d_stokes_initial_guess_accelerator;
 
     /*!
      * Fluid solver variables.
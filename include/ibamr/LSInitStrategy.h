@@ -38,6 +38,7 @@
 #include <string>
 #include <vector>
 
+#include "BoxList.h"
 #include "ibamr/ibamr_enums.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
@@ -77,6 +78,24 @@ namespace IBAMR
 /*!
  * \brief Class LSInitStrategy provides a generic interface for initializing the
  * implementation details of a particular version of the level set method.
+ *
+ * Implementations may restrict their iterations to a narrow band about the
+ * interface.  The band consists of the cells in which the magnitude of the level
+ * set is less than \a narrow_band_width grid cells of the corresponding level;
+ * it is stored as a list of active tiles of 4^NDIM cells on each patch.  The
+ * first iteration is always performed over all cells.  The band is then
+ * redetermined at the start of every subsequent iteration, and tiles that
+ * neighbor a cell within the band, including a ghost cell, are also active, so
+ * that the band grows into patches that are reached only through patch or
+ * coarse-fine boundaries.  Once the iterations have finished, the values
+ * outside the band are clamped to plus or minus the band width.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ use_narrow_band = FALSE  // restrict iterations to a band about the interface
+ narrow_band_width = 6.0  // band half-width, in grid cells of each level
+ \endverbatim
  */
 class LSInitStrategy : public SAMRAI::tbox::Serializable
 {
@@ -126,6 +145,62 @@ public:
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
 protected:
+    /*!
+     * \brief Read the narrow band parameters from the input database.
+     */
+    void getNarrowBandFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Determine the narrow band about the zero level set of the data
+     * with the specified patch data index.
+     *
+     * \note The ghost cell values of the data are used to determine the band,
+     * and so they should be filled before calling this method.
+     */
+    void updateNarrowBand(int D_idx, SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
+    /*!
+     * \brief Clamp the values of the data with the specified patch data index
+     * that lie outside of the narrow band to plus or minus the band width.
+     */
+    void clampOutsideNarrowBand(int D_idx,
+                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy) const;
+
+    /*!
+     * \brief Discard the narrow band.
+     */
+    void deallocateNarrowBand();
+
+    /*!
+     * \brief Return whether the narrow band has been determined.
+     */
+    bool hasNarrowBand() const;
+
+    /*!
+     * \brief Return the boxes to be updated on the local patch with the
+     * specified level and local patch numbers.  If the narrow band has not been
+     * determined, the patch box is returned.
+     */
+    SAMRAI::hier::BoxList<NDIM>
+    getActiveBoxes(const SAMRAI::hier::Box<NDIM>& patch_box, int ln, int local_patch_num) const;
+
+    /*!
+     * \brief Copy the cell-centered data within the narrow band.
+     */
+    void copyNarrowBandData(int dst_idx,
+                            int src_idx,
+                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy) const;
+
+    /*!
+     * \brief Compute the weighted discrete L2-norm of the difference between
+     * two cell-centered quantities within the narrow band.
+     */
+    double
+    computeNarrowBandDifferenceL2Norm(int D_idx,
+                                      int D_iter_idx,
+                                      int wgt_idx,
+                                      SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy) const;
+
     // Book-keeping.
     std::string d_object_name;
     bool d_registered_for_restart;
@@ -145,6 +220,12 @@ protected:
     std::vector<LocateInterfaceNeighborhoodFcnPtr> d_locate_interface_fcns;
     std::vector<void*> d_locate_interface_fcns_ctx;
 
+    // Narrow band parameters and the active boxes of each local patch, indexed
+    // by level number and local patch number.
+    bool d_use_narrow_band;
+    double d_narrow_band_width;
+    std::vector<std::vector<SAMRAI::hier::BoxList<NDIM> > > d_narrow_band_boxes;
+
 private:
     /*!
      * \brief Copy constructor.
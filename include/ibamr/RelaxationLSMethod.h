@@ -71,6 +71,9 @@ namespace IBAMR
  * produces the signed distance away from an interface.
  *
  *
+ * \note The relaxation may be restricted to a narrow band about the interface;
+ * see LSInitStrategy.
+ *
  * Reference
  * Min, C., <A HREF="http://www.sciencedirect.com/science/article/pii/S0021999109007189">
  * On reinitializing level set functions</A>
@@ -110,11 +113,13 @@ private:
                const int iter) const;
 
     /*!
-     * \brief Do one relaxation step over a patch.
+     * \brief Do one relaxation step over the cells of a patch that lie in the
+     * specified box.
      */
     void relax(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
                const SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_init_idx,
                const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+               const SAMRAI::hier::Box<NDIM>& box,
                const int iter) const;
 
     /*!
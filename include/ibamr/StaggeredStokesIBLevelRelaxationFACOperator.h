@@ -35,6 +35,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <stddef.h>
 #include <string>
 #include <utility>
 #include <vector>
@@ -123,6 +124,7 @@ namespace IBAMR
  coarse_solver_db = { ... }                     // SAMRAI::tbox::Database for initializing
  coarse
  level solver
+ reuse_SAJ_pattern = FALSE                      // reuse symbolic SAJ products between solves
  \endverbatim
 */
 class StaggeredStokesIBLevelRelaxationFACOperator : public StaggeredStokesFACPreconditionerStrategy
@@ -347,6 +349,16 @@ private:
     std::vector<Mat> d_SAJ_mat, d_SAJ_prolongation_mat, d_stokesib_prolongation_mat, d_galerkin_stokesib_mat;
     std::vector<Vec> d_scale_SAJ_restriction_mat, d_scale_stokesib_restriction_mat;
 
+    /*
+     * Whether the SAJ operators are retained when the operator state is
+     * deallocated, so that only the numeric phase of the triple products is
+     * recomputed when the nonzero patterns of the operators used to build them
+     * are unchanged.  The nonzero patterns are compared via the local hash
+     * values of the patterns of those operators.
+     */
+    bool d_reuse_SAJ_pattern;
+    std::vector<size_t> d_SAJ_pattern_hash;
+
     /*
      * Mappings from patch indices to patch operators.
      */
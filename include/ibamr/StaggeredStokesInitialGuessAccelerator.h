@@ -0,0 +1,223 @@
+// Filename: StaggeredStokesInitialGuessAccelerator.h
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBAMR_StaggeredStokesInitialGuessAccelerator
+#define included_IBAMR_StaggeredStokesInitialGuessAccelerator
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "SAMRAIVectorReal.h"
+#include "ibamr/StaggeredStokesSolver.h"
+#include "ibtk/LinearOperator.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class StaggeredStokesInitialGuessAccelerator uses the solutions of
+ * previous staggered-grid Stokes solves to compute initial guesses for
+ * subsequent solves.
+ *
+ * The accelerator retains up to \em k pairs \f$(x_i, b_i)\f$ of solutions and
+ * right-hand sides of the linear system \f$Ax = b\f$.  The pairs are
+ * orthonormalized with respect to the right-hand sides, so that the \f$b_i\f$
+ * form an orthonormal basis and \f$A x_i \approx b_i\f$.  Given a new
+ * right-hand side \f$b\f$ and the initial guess \f$x_0\f$ provided by the
+ * caller, the initial guess is replaced by
+ * \f[
+ *   x_0 + \sum_i (b_i, r_0) x_i, \quad r_0 = b - A x_0,
+ * \f]
+ * which minimizes the residual over \f$x_0 + \mathrm{span}\{x_i\}\f$.  This
+ * requires one application of the operator per solve.
+ *
+ * The operator is obtained from the Stokes solver when that solver is an
+ * IBTK::KrylovLinearSolver (e.g., PETScKrylovStaggeredStokesSolver), in which
+ * case inhomogeneous boundary conditions are handled in the same way as in the
+ * solver itself.  For other solvers, the initial guess is instead replaced by
+ * the projection \f$\sum_i (b_i, b) x_i\f$.
+ *
+ * The retained solutions are only valid as long as the operator does not
+ * change, and resetHistory() must be called whenever the time step size or
+ * the problem coefficients change.  The accelerator must be reinitialized
+ * whenever the patch hierarchy changes.
+ *
+ * Sample input:
+ * \verbatim
+ max_history_size = 4     // default: 4
+ drop_tolerance = 1.0e-8  // default: 1.0e-8
+ enable_logging = FALSE   // default: FALSE
+ \endverbatim
+ *
+ * \note Solutions are discarded when they are (nearly) linearly dependent on
+ * the retained solutions; \a drop_tolerance is the relative size below which
+ * the orthogonalized right-hand side is considered to vanish.
+ */
+class StaggeredStokesInitialGuessAccelerator
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    StaggeredStokesInitialGuessAccelerator(const std::string& object_name,
+                                           SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~StaggeredStokesInitialGuessAccelerator();
+
+    /*!
+     * \brief Set the Stokes solver whose solutions are used to compute the
+     * initial guesses.
+     */
+    void setStokesSolver(SAMRAI::tbox::Pointer<StaggeredStokesSolver> stokes_solver);
+
+    /*!
+     * \brief Allocate the data required to store the solution history.
+     *
+     * \note Any previously retained solutions are discarded.
+     */
+    void initializeAcceleratorState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                                    const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Deallocate the data used to store the solution history.
+     */
+    void deallocateAcceleratorState();
+
+    /*!
+     * \brief Return whether the accelerator has been initialized.
+     */
+    bool getIsInitialized() const;
+
+    /*!
+     * \brief Discard all retained solutions.
+     */
+    void resetHistory();
+
+    /*!
+     * \brief Return the number of retained solutions.
+     */
+    int getHistorySize() const;
+
+    /*!
+     * \brief Replace the initial guess \a x for the system with right-hand side
+     * \a b by the minimal-residual initial guess.
+     *
+     * The right-hand side \a b must not change before the subsequent call to
+     * recordSolution().
+     */
+    void computeInitialGuess(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                             SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Add the solution \a x of the system whose right-hand side was
+     * provided to the most recent call to computeInitialGuess() to the
+     * solution history.
+     */
+    void recordSolution(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    StaggeredStokesInitialGuessAccelerator();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    StaggeredStokesInitialGuessAccelerator(const StaggeredStokesInitialGuessAccelerator& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    StaggeredStokesInitialGuessAccelerator& operator=(const StaggeredStokesInitialGuessAccelerator& that);
+
+    /*!
+     * \brief Set d_b_hat to the right-hand side \a b, modified to account for
+     * inhomogeneous boundary conditions when the operator is available.
+     */
+    void setModifiedRhs(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    // Object name and configuration.
+    std::string d_object_name;
+    int d_max_history_size;
+    double d_drop_tol;
+    bool d_enable_logging;
+
+    // The Stokes solver and, when available, the operator used by that solver.
+    SAMRAI::tbox::Pointer<StaggeredStokesSolver> d_stokes_solver;
+    SAMRAI::tbox::Pointer<IBTK::LinearOperator> d_A;
+
+    // Storage for the solution history.  d_x_vecs[d_history[k]] and
+    // d_b_vecs[d_history[k]] are the kth retained pair, ordered from oldest to
+    // newest.  One more pair is allocated than can be retained, so that a new
+    // pair can be orthogonalized before the oldest pair is discarded.
+    bool d_is_initialized;
+    std::vector<SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > > d_x_vecs, d_b_vecs;
+    std::deque<int> d_history;
+
+    // Scratch data.
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_b_hat, d_r;
+    bool d_have_rhs;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_StaggeredStokesInitialGuessAccelerator
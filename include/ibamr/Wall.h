@@ -35,6 +35,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
 #include "tbox/Array.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
@@ -56,6 +58,10 @@ public:
     // typedef for Wall Force Function Pointer
     typedef double (*WallForceFcnPtr)(double D, const SAMRAI::tbox::Array<double> params);
 
+    // typedef for batched Wall Force Function Pointer.  Evaluates the force
+    // magnitude F[k] for each of the n (positive) wall distances D[k].
+    typedef void (*WallForceBatchFcnPtr)(const double* D, double* F, int n, const SAMRAI::tbox::Array<double>& params);
+
     // Constructor.
     Wall(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> wall_db,
          SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry,
@@ -70,6 +76,11 @@ public:
     // Register the function for evaluating wall forces.
     void registerWallForceFcn(WallForceFcnPtr wall_force_fcn);
 
+    // Register a batched function for evaluating wall forces.  When
+    // registered, this is used in place of the pointwise function by
+    // applyForces().
+    void registerWallForceBatchFcn(WallForceBatchFcnPtr wall_force_batch_fcn);
+
     // Get the force area box of the wall.
     SAMRAI::hier::Box<NDIM> getForceArea();
 
@@ -82,6 +93,10 @@ public:
     // Apply force based on distance
     double applyForce(double wall_distance, double eval_time);
 
+    // Apply forces to the n nodes with (local, depth-NDIM) array offsets
+    // node_idxs, accumulating into F based on the positions X.
+    void applyForces(const double* X, double* F, const int* node_idxs, int n, double eval_time);
+
 private:
     // Information about where the wall is, which way it points, and
     // how far it affects particles:
@@ -97,6 +112,11 @@ private:
 
     // Function for applying wall force:
     WallForceFcnPtr d_wall_force_fcn;
+    WallForceBatchFcnPtr d_wall_force_batch_fcn;
+
+    // Scratch storage for batched force evaluation:
+    std::vector<double> d_dist_scratch, d_force_scratch;
+    std::vector<int> d_idx_scratch;
 };
 } // namespace IBAMR
 
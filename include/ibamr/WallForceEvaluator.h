@@ -35,6 +35,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <vector>
+
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LNodeSetData.h"
@@ -55,9 +57,26 @@ public:
     // Register a WallForceFcnPtr to be used by all walls.
     void registerWallForceFcn(Wall::WallForceFcnPtr wall_force_fcn);
 
+    // Register a batched WallForceBatchFcnPtr to be used by all walls.
+    void registerWallForceBatchFcn(Wall::WallForceBatchFcnPtr wall_force_batch_fcn);
+
     // add a wall to the WallForceEvaluator
     void addWall(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> wall_db, double wall_ghost_dist);
 
+    // Build the lists of candidate nodes for each wall.  This is called
+    // following each redistribution of Lagrangian data.
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager);
+
+    // Discard the lists of candidate nodes for the specified level.  The lists
+    // are rebuilt by the next call to initializeLevelData() or
+    // computeLagrangianForce(), so this must be called whenever the Lagrangian
+    // data are redistributed without calling initializeLevelData().
+    void resetLevelData(int level_number);
+
     // compute forces from all walls
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
@@ -80,6 +99,11 @@ private:
     // collection of walls:
     std::vector<Wall> d_walls_vec;
 
+    // Per-level, per-wall lists of the local array offsets (local PETSc index
+    // times NDIM) of the nodes that lie in the force area of each wall:
+    std::vector<std::vector<std::vector<int> > > d_wall_node_idxs;
+    std::vector<bool> d_is_initialized;
+
     // grid geometry, used when making walls:
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
 };
@@ -60,6 +60,7 @@
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/TimestepProfiler.h"
 #include "ibtk/ibtk_enums.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
@@ -168,13 +169,16 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
     d_ins_hier_integrator->preprocessIntegrateHierarchy(current_time, new_time, ins_num_cycles);
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
+    TimestepProfiler* profiler = TimestepProfiler::getProfiler();
     switch (d_time_stepping_type)
     {
     case FORWARD_EULER:
     case BACKWARD_EULER:
     case TRAPEZOIDAL_RULE:
         if (d_enable_logging) plog << d_object_name << "::preprocessIntegrateHierarchy(): computing Lagrangian force\n";
+        profiler->startPhase(PROFILE_FORCE);
         d_ib_method_ops->computeLagrangianForce(current_time);
+        profiler->stopPhase(PROFILE_FORCE);
         if (d_enable_logging)
             plog << d_object_name << "::preprocessIntegrateHierarchy(): spreading Lagrangian force "
                                      "to the Eulerian grid\n";
@@ -228,6 +232,7 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
                                                                d_ins_hier_integrator->getNewContext());
     const int p_new_idx = var_db->mapVariableAndContextToIndex(d_ins_hier_integrator->getPressureVariable(),
                                                                d_ins_hier_integrator->getNewContext());
+    TimestepProfiler* profiler = TimestepProfiler::getProfiler();
 
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
     switch (d_time_stepping_type)
@@ -238,7 +243,9 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         break;
     case MIDPOINT_RULE:
         if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+        profiler->startPhase(PROFILE_FORCE);
         d_ib_method_ops->computeLagrangianForce(half_time);
+        profiler->stopPhase(PROFILE_FORCE);
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
         d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
@@ -253,7 +260,9 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         {
             // NOTE: We do not re-compute the force unless it could have changed.
             if (d_enable_logging) plog << d_object_name << "::integrateHierarchy(): computing Lagrangian force\n";
+            profiler->startPhase(PROFILE_FORCE);
             d_ib_method_ops->computeLagrangianForce(new_time);
+            profiler->stopPhase(PROFILE_FORCE);
             if (d_enable_logging)
                 plog << d_object_name << "::integrateHierarchy(): spreading Lagrangian force to the Eulerian grid\n";
             d_hier_velocity_data_ops->setToScalar(d_f_idx, 0.0);
@@ -293,6 +302,8 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
     d_ib_method_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
     if (d_enable_logging)
         plog << d_object_name << "::integrateHierarchy(): solving the incompressible Navier-Stokes equations\n";
+    profiler->startPhase(PROFILE_STOKES_SOLVE);
+    const double fluid_solve_start_time = MPI_Wtime();
     if (d_current_num_cycles > 1)
     {
         d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
@@ -308,6 +319,8 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
         }
     }
+    d_ib_method_ops->recordFluidSolveTime(MPI_Wtime() - fluid_solve_start_time);
+    profiler->stopPhase(PROFILE_STOKES_SOLVE);
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
 
     // Interpolate the Eulerian velocity to the curvilinear mesh.
@@ -492,6 +505,19 @@ IBExplicitHierarchyIntegrator::postprocessIntegrateHierarchy(const double curren
     // Deallocate IB data.
     d_ib_method_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
 
+    // Update the displacement of the Lagrangian points since the last regrid.
+    if (d_regrid_structure_cfl_interval > 0.0)
+    {
+        const double max_displacement = d_ib_method_ops->getMaxPointDisplacement();
+        d_regrid_structure_cfl_estimate = (max_displacement >= 0.0 ?
+                                               d_regrid_structure_cfl_offset + max_displacement :
+                                               d_regrid_cfl_estimate);
+        if (d_enable_logging)
+            plog << d_object_name << "::postprocessIntegrateHierarchy(): maximum IB point displacement since "
+                                     "last regrid = "
+                 << d_regrid_structure_cfl_estimate << "\n";
+    }
+
     // Deallocate Eulerian scratch data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -105,6 +105,7 @@
 #include "libmesh/type_vector.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/vector_value.h"
+#include "libmesh/xdr_cxx.h"
 #include "petscvec.h"
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -221,6 +222,113 @@ get_x_and_FF(libMesh::VectorValue<double>& x,
     return;
 }
 
+// Scratch storage for evaluating PK1 stress functions at all of the quadrature
+// points of an element or element side.
+struct PK1StressBlockData
+{
+    std::vector<double> PP, FF, x, X;
+    std::vector<std::vector<double> > var_data, grad_var_data;
+    std::vector<const double*> var_data_ptrs, grad_var_data_ptrs;
+};
+
+// Evaluate a block PK1 stress function at all of the quadrature points of the
+// present element or element side.
+void
+eval_PK1_stress_block(std::vector<TensorValue<double> >& PP,
+                      PK1StressBlockData& block_data,
+                      const IBFEMethod::PK1StressFcnData& PK1_stress_fcn_data,
+                      const std::vector<libMesh::Point>& q_point,
+                      const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data,
+                      const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data,
+                      const size_t X_sys_idx,
+                      const std::vector<size_t>& system_idxs,
+                      Elem* const elem,
+                      const unsigned int n_qp,
+                      const double data_time)
+{
+    // Gather the deformation and the positions into structure-of-arrays form.
+    block_data.PP.resize(NDIM * NDIM * n_qp);
+    block_data.FF.resize(NDIM * NDIM * n_qp);
+    block_data.x.resize(NDIM * n_qp);
+    block_data.X.resize(NDIM * n_qp);
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            block_data.x[i * n_qp + qp] = x_data[i];
+            block_data.X[i * n_qp + qp] = q_point[qp](i);
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                block_data.FF[(i * NDIM + j) * n_qp + qp] = grad_x_data[i](j);
+            }
+        }
+    }
+
+    // Gather the system data.
+    const size_t n_systems = system_idxs.size();
+    block_data.var_data.resize(n_systems);
+    block_data.grad_var_data.resize(n_systems);
+    block_data.var_data_ptrs.resize(n_systems);
+    block_data.grad_var_data_ptrs.resize(n_systems);
+    for (size_t k = 0; k < n_systems; ++k)
+    {
+        const size_t n_vars = n_qp > 0 ? fe_interp_var_data[0][system_idxs[k]].size() : 0;
+        const size_t n_grad_vars = n_qp > 0 ? fe_interp_grad_var_data[0][system_idxs[k]].size() : 0;
+        std::vector<double>& var_data = block_data.var_data[k];
+        std::vector<double>& grad_var_data = block_data.grad_var_data[k];
+        var_data.resize(n_vars * n_qp);
+        grad_var_data.resize(n_grad_vars * NDIM * n_qp);
+        for (unsigned int qp = 0; qp < n_qp; ++qp)
+        {
+            const std::vector<double>& qp_var_data = fe_interp_var_data[qp][system_idxs[k]];
+            const std::vector<VectorValue<double> >& qp_grad_var_data = fe_interp_grad_var_data[qp][system_idxs[k]];
+            for (size_t v = 0; v < n_vars; ++v)
+            {
+                var_data[v * n_qp + qp] = qp_var_data[v];
+            }
+            for (size_t v = 0; v < n_grad_vars; ++v)
+            {
+                for (unsigned int i = 0; i < NDIM; ++i)
+                {
+                    grad_var_data[(v * NDIM + i) * n_qp + qp] = qp_grad_var_data[v](i);
+                }
+            }
+        }
+        block_data.var_data_ptrs[k] = var_data.empty() ? NULL : &var_data[0];
+        block_data.grad_var_data_ptrs[k] = grad_var_data.empty() ? NULL : &grad_var_data[0];
+    }
+
+    // Evaluate the stress and scatter it back to tensor form.
+    if (n_qp > 0)
+    {
+        PK1_stress_fcn_data.block_fcn(&block_data.PP[0],
+                                      &block_data.FF[0],
+                                      &block_data.x[0],
+                                      &block_data.X[0],
+                                      n_qp,
+                                      elem,
+                                      block_data.var_data_ptrs,
+                                      block_data.grad_var_data_ptrs,
+                                      data_time,
+                                      PK1_stress_fcn_data.ctx);
+    }
+    PP.resize(n_qp);
+    for (unsigned int qp = 0; qp < n_qp; ++qp)
+    {
+        PP[qp].zero();
+        for (unsigned int i = 0; i < NDIM; ++i)
+        {
+            for (unsigned int j = 0; j < NDIM; ++j)
+            {
+                PP[qp](i, j) = block_data.PP[(i * NDIM + j) * n_qp + qp];
+            }
+        }
+    }
+    return;
+}
+
 static const Real PENALTY = 1.e10;
 
 void
@@ -305,6 +413,134 @@ libmesh_restart_file_name(const std::string& restart_dump_dirname,
                      << std::setfill('0') << std::right << time_step_number << "." << extension;
     return file_name_prefix.str();
 }
+
+std::string
+libmesh_local_restart_file_name(const std::string& restart_dump_dirname,
+                                unsigned int time_step_number,
+                                unsigned int part,
+                                int rank)
+{
+    std::ostringstream file_name_prefix;
+    file_name_prefix << restart_dump_dirname << "/libmesh_data_part_" << part << "." << std::setw(6)
+                     << std::setfill('0') << std::right << time_step_number << "." << std::setw(5) << rank
+                     << ".xdr";
+    return file_name_prefix.str();
+}
+
+void
+write_local_vector_data(Xdr& io, const NumericVector<double>& vec)
+{
+    unsigned int size = static_cast<unsigned int>(vec.size());
+    unsigned int first_local_index = static_cast<unsigned int>(vec.first_local_index());
+    const unsigned int last_local_index = static_cast<unsigned int>(vec.last_local_index());
+    std::vector<double> vals;
+    vals.reserve(last_local_index - first_local_index);
+    for (unsigned int i = first_local_index; i < last_local_index; ++i)
+    {
+        vals.push_back(vec(i));
+    }
+    io.data(size);
+    io.data(first_local_index);
+    io.data(vals);
+    return;
+}
+
+void
+read_local_vector_data(Xdr& io, NumericVector<double>& vec, const std::string& file_name)
+{
+    unsigned int size, first_local_index;
+    std::vector<double> vals;
+    io.data(size);
+    io.data(first_local_index);
+    io.data(vals);
+    if (size != vec.size() || first_local_index != vec.first_local_index() || vals.size() != vec.local_size())
+    {
+        TBOX_ERROR("IBFEMethod: restart file " << file_name
+                                               << " does not match the present partitioning of the FE mesh.\n"
+                                               << "  use partition-agnostic restart files to restart with a "
+                                                  "different partitioning."
+                                               << std::endl);
+    }
+    for (unsigned int k = 0; k < vals.size(); ++k)
+    {
+        vec.set(first_local_index + k, vals[k]);
+    }
+    vec.close();
+    return;
+}
+
+// Write the locally owned values of the solution and of all additional vectors
+// of each system.  System definitions are not written; they are recreated from
+// the input database when restarting.
+void
+write_local_equation_systems_data(EquationSystems& equation_systems, const std::string& file_name)
+{
+    Xdr io(file_name, ENCODE);
+    int n_procs = SAMRAI_MPI::getNodes();
+    unsigned int n_systems = equation_systems.n_systems();
+    io.data(n_procs);
+    io.data(n_systems);
+    for (unsigned int sys_num = 0; sys_num < n_systems; ++sys_num)
+    {
+        System& system = equation_systems.get_system(sys_num);
+        std::string system_name = system.name();
+        io.data(system_name);
+        write_local_vector_data(io, *system.solution);
+        unsigned int n_vectors = system.n_vectors();
+        io.data(n_vectors);
+        for (System::vectors_iterator it = system.vectors_begin(); it != system.vectors_end(); ++it)
+        {
+            std::string vector_name = it->first;
+            io.data(vector_name);
+            write_local_vector_data(io, *it->second);
+        }
+    }
+    io.close();
+    return;
+}
+
+void
+read_local_equation_systems_data(EquationSystems& equation_systems, const std::string& file_name)
+{
+    Xdr io(file_name, DECODE);
+    int n_procs;
+    unsigned int n_systems;
+    io.data(n_procs);
+    io.data(n_systems);
+    if (n_procs != SAMRAI_MPI::getNodes())
+    {
+        TBOX_ERROR("IBFEMethod: restart file " << file_name << " was written by " << n_procs << " processes.\n"
+                                               << "  use partition-agnostic restart files to restart with a "
+                                                  "different number of processes."
+                                               << std::endl);
+    }
+    for (unsigned int sys_num = 0; sys_num < n_systems; ++sys_num)
+    {
+        std::string system_name;
+        io.data(system_name);
+        if (!equation_systems.has_system(system_name))
+        {
+            TBOX_ERROR("IBFEMethod: system " << system_name << " in restart file " << file_name
+                                             << " has not been created."
+                                             << std::endl);
+        }
+        System& system = equation_systems.get_system(system_name);
+        read_local_vector_data(io, *system.solution, file_name);
+        unsigned int n_vectors;
+        io.data(n_vectors);
+        for (unsigned int k = 0; k < n_vectors; ++k)
+        {
+            std::string vector_name;
+            io.data(vector_name);
+            NumericVector<double>& vec =
+                system.have_vector(vector_name) ? system.get_vector(vector_name) : system.add_vector(vector_name);
+            read_local_vector_data(io, vec, file_name);
+        }
+        system.update();
+    }
+    io.close();
+    return;
+}
 }
 
 const std::string IBFEMethod::COORDS_SYSTEM_NAME = "IB coordinates system";
@@ -709,11 +945,13 @@ IBFEMethod::computeLagrangianForce(const double data_time)
     TBOX_ASSERT(MathUtilities<double>::equalEps(data_time, d_half_time));
     for (unsigned part = 0; part < d_num_parts; ++part)
     {
+        const double start_time = MPI_Wtime();
         if (d_stress_normalization_part[part])
         {
             computeStressNormalization(*d_Phi_half_vecs[part], *d_X_half_vecs[part], data_time, part);
         }
         computeInteriorForceDensity(*d_F_half_vecs[part], *d_X_half_vecs[part], d_Phi_half_vecs[part], data_time, part);
+        d_fe_data_managers[part]->recordLagrangianWorkloadSample(MPI_Wtime() - start_time);
     }
     return;
 } // computeLagrangianForce
@@ -737,6 +975,9 @@ IBFEMethod::spreadForce(const int f_data_idx,
             f_data_idx, *F_ghost_vec, *X_ghost_vec, FORCE_SYSTEM_NAME, f_phys_bdry_op, data_time);
         if (d_split_normal_force || d_split_tangential_force)
         {
+            // The split force terms are spread outside of FEDataManager::spread(),
+            // so their cost is recorded as additional Lagrangian work.
+            const double start_time = MPI_Wtime();
             if (d_use_jump_conditions && d_split_normal_force)
             {
                 imposeJumpConditions(f_data_idx, *F_ghost_vec, *X_ghost_vec, data_time, part);
@@ -745,6 +986,7 @@ IBFEMethod::spreadForce(const int f_data_idx,
             {
                 spreadTransmissionForceDensity(f_data_idx, *X_ghost_vec, f_phys_bdry_op, data_time, part);
             }
+            d_fe_data_managers[part]->recordLagrangianWorkloadSample(MPI_Wtime() - start_time);
         }
     }
     return;
@@ -799,13 +1041,14 @@ IBFEMethod::initializeFEEquationSystems()
         const std::string& manager_name = manager_stream.str();
         d_fe_data_managers[part] = FEDataManager::getManager(manager_name, d_interp_spec[part], d_spread_spec[part]);
         d_ghosts = IntVector<NDIM>::max(d_ghosts, d_fe_data_managers[part]->getGhostCellWidth());
+        d_fe_data_managers[part]->setWorkloadCalibrationWindow(d_workload_calibration_window);
 
         // Create FE equation systems objects and corresponding variables.
         d_equation_systems[part] = new EquationSystems(*d_meshes[part]);
         EquationSystems* equation_systems = d_equation_systems[part];
         d_fe_data_managers[part]->setEquationSystems(equation_systems, d_max_level_number - 1);
         d_fe_data_managers[part]->COORDINATES_SYSTEM_NAME = COORDS_SYSTEM_NAME;
-        if (from_restart)
+        if (from_restart && d_libmesh_restart_read_partition_agnostic)
         {
             const std::string& file_name = libmesh_restart_file_name(
                 d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, d_libmesh_restart_file_extension);
@@ -863,10 +1106,17 @@ IBFEMethod::initializeFEData()
     {
         // Initialize FE equation systems.
         EquationSystems* equation_systems = d_equation_systems[part];
-        if (from_restart)
+        if (from_restart && d_libmesh_restart_read_partition_agnostic)
         {
             equation_systems->reinit();
         }
+        else if (from_restart)
+        {
+            equation_systems->init();
+            const std::string& file_name = libmesh_local_restart_file_name(
+                d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, SAMRAI_MPI::getRank());
+            read_local_equation_systems_data(*equation_systems, file_name);
+        }
         else
         {
             equation_systems->init();
@@ -1019,6 +1269,16 @@ IBFEMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/
     return;
 } // updateWorkloadEstimates
 
+void
+IBFEMethod::recordFluidSolveTime(const double wall_time)
+{
+    for (unsigned int part = 0; part < d_num_parts; ++part)
+    {
+        d_fe_data_managers[part]->recordEulerianWorkloadSample(wall_time);
+    }
+    return;
+} // recordFluidSolveTime
+
 void IBFEMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                          Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -1109,12 +1369,24 @@ IBFEMethod::putToDatabase(Pointer<Database> db)
     db->putBool("d_split_tangential_force", d_split_tangential_force);
     db->putBool("d_use_jump_conditions", d_use_jump_conditions);
     db->putBool("d_use_consistent_mass_matrix", d_use_consistent_mass_matrix);
+    db->putBool("d_libmesh_partition_agnostic_restart", d_libmesh_partition_agnostic_restart);
     return;
 } // putToDatabase
 
 void
 IBFEMethod::writeFEDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number)
 {
+    if (!d_libmesh_partition_agnostic_restart)
+    {
+        Utilities::recursiveMkdir(restart_dump_dirname);
+        for (unsigned int part = 0; part < d_num_parts; ++part)
+        {
+            const std::string& file_name = libmesh_local_restart_file_name(
+                restart_dump_dirname, time_step_number, part, SAMRAI_MPI::getRank());
+            write_local_equation_systems_data(*d_equation_systems[part], file_name);
+        }
+        return;
+    }
     for (unsigned int part = 0; part < d_num_parts; ++part)
     {
         const std::string& file_name =
@@ -1190,6 +1462,8 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
     std::vector<const std::vector<double> *> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> > *> surface_force_grad_var_data, surface_pressure_grad_var_data;
+    std::vector<std::vector<TensorValue<double> > > PP_block(num_PK1_fcns);
+    PK1StressBlockData PK1_block_data;
 
     // Setup global and elemental right-hand-side vectors.
     NumericVector<double>* Phi_rhs_vec = Phi_system.rhs;
@@ -1227,6 +1501,21 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
             fe.interpolate(elem, side);
             const unsigned int n_qp = qrule_face->n_points();
             const size_t n_basis = phi_face.size();
+            for (unsigned int k = 0; k < num_PK1_fcns; ++k)
+            {
+                if (!d_PK1_stress_fcn_data[part][k].block_fcn) continue;
+                eval_PK1_stress_block(PP_block[k],
+                                      PK1_block_data,
+                                      d_PK1_stress_fcn_data[part][k],
+                                      q_point_face,
+                                      fe_interp_var_data,
+                                      fe_interp_grad_var_data,
+                                      X_sys_idx,
+                                      PK1_fcn_system_idxs[k],
+                                      elem,
+                                      n_qp,
+                                      data_time);
+            }
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
                 // X:     reference coordinate
@@ -1251,7 +1540,12 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].block_fcn)
+                    {
+                        PP = PP_block[k][qp];
+                        Phi += n * ((PP * FF_trans) * n) / J;
+                    }
+                    else if (d_PK1_stress_fcn_data[part][k].fcn)
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
@@ -1360,7 +1654,8 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
     const size_t num_PK1_fcns = d_PK1_stress_fcn_data[part].size();
     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
     {
-        if (!d_PK1_stress_fcn_data[part][k].fcn) continue;
+        const bool use_block_fcn = d_PK1_stress_fcn_data[part][k].block_fcn != NULL;
+        if (!d_PK1_stress_fcn_data[part][k].fcn && !use_block_fcn) continue;
 
         // Extract the FE systems and DOF maps, and setup the FE object.
         System& G_system = equation_systems->get_system(FORCE_SYSTEM_NAME);
@@ -1411,6 +1706,8 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
 
         std::vector<const std::vector<double>*> PK1_var_data;
         std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+        std::vector<TensorValue<double> > PP_block;
+        PK1StressBlockData PK1_block_data;
 
         // Loop over the elements to compute the right-hand side vector.  This
         // is computed via
@@ -1436,19 +1733,46 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
             fe.interpolate(elem);
             const unsigned int n_qp = qrule->n_points();
             const size_t n_basis = dphi.size();
+            if (use_block_fcn)
+            {
+                eval_PK1_stress_block(PP_block,
+                                      PK1_block_data,
+                                      d_PK1_stress_fcn_data[part][k],
+                                      q_point,
+                                      fe_interp_var_data,
+                                      fe_interp_grad_var_data,
+                                      X_sys_idx,
+                                      PK1_fcn_system_idxs,
+                                      elem,
+                                      n_qp,
+                                      data_time);
+            }
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
-                const libMesh::Point& X = q_point[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
-
                 // Compute the value of the first Piola-Kirchhoff stress tensor
                 // at the quadrature point and add the corresponding forces to
                 // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                d_PK1_stress_fcn_data[part][k].fcn(
-                    PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, d_PK1_stress_fcn_data[part][k].ctx);
+                if (use_block_fcn)
+                {
+                    PP = PP_block[qp];
+                }
+                else
+                {
+                    const libMesh::Point& X = q_point[qp];
+                    const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                    const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                    get_x_and_FF(x, FF, x_data, grad_x_data);
+                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    d_PK1_stress_fcn_data[part][k].fcn(PP,
+                                                       FF,
+                                                       x,
+                                                       X,
+                                                       elem,
+                                                       PK1_var_data,
+                                                       PK1_grad_var_data,
+                                                       data_time,
+                                                       d_PK1_stress_fcn_data[part][k].ctx);
+                }
                 for (unsigned int k = 0; k < n_basis; ++k)
                 {
                     F_qp = -PP * dphi[k][qp] * JxW[qp];
@@ -1478,6 +1802,20 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
                 fe.interpolate(elem, side);
                 const unsigned int n_qp = qrule_face->n_points();
                 const size_t n_basis = phi_face.size();
+                if (use_block_fcn)
+                {
+                    eval_PK1_stress_block(PP_block,
+                                          PK1_block_data,
+                                          d_PK1_stress_fcn_data[part][k],
+                                          q_point_face,
+                                          fe_interp_var_data,
+                                          fe_interp_grad_var_data,
+                                          X_sys_idx,
+                                          PK1_fcn_system_idxs,
+                                          elem,
+                                          n_qp,
+                                          data_time);
+                }
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
                     const libMesh::Point& X = q_point_face[qp];
@@ -1491,7 +1829,11 @@ IBFEMethod::computeInteriorForceDensity(PetscVector<double>& G_vec,
                     // Compute the value of the first Piola-Kirchhoff stress
                     // tensor at the quadrature point and add the corresponding
                     // traction force to the right-hand-side vector.
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (use_block_fcn)
+                    {
+                        F += PP_block[qp] * normal_face[qp];
+                    }
+                    else if (d_PK1_stress_fcn_data[part][k].fcn)
                     {
                         fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
                         d_PK1_stress_fcn_data[part][k].fcn(PP,
@@ -1869,6 +2211,8 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
     std::vector<const std::vector<double> *> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> > *> surface_force_grad_var_data, surface_pressure_grad_var_data;
+    std::vector<std::vector<TensorValue<double> > > PP_block(num_PK1_fcns);
+    PK1StressBlockData PK1_block_data;
 
     // Loop over the patches to spread the transmission elastic force density
     // onto the grid.
@@ -1930,6 +2274,21 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
                 const unsigned int n_qp = qrule_face->n_points();
                 T_bdry.resize(T_bdry.size() + NDIM * n_qp);
                 x_bdry.resize(x_bdry.size() + NDIM * n_qp);
+                for (unsigned int k = 0; k < num_PK1_fcns; ++k)
+                {
+                    if (!d_PK1_stress_fcn_data[part][k].block_fcn) continue;
+                    eval_PK1_stress_block(PP_block[k],
+                                          PK1_block_data,
+                                          d_PK1_stress_fcn_data[part][k],
+                                          q_point_face,
+                                          fe_interp_var_data,
+                                          fe_interp_grad_var_data,
+                                          X_sys_idx,
+                                          PK1_fcn_system_idxs[k],
+                                          elem,
+                                          n_qp,
+                                          data_time);
+                }
                 for (unsigned int qp = 0; qp < n_qp; ++qp, ++qp_offset)
                 {
                     const libMesh::Point& X = q_point_face[qp];
@@ -1944,7 +2303,11 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].block_fcn)
+                        {
+                            F -= PP_block[k][qp] * normal_face[qp] * JxW_face[qp];
+                        }
+                        else if (d_PK1_stress_fcn_data[part][k].fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
@@ -2121,6 +2484,8 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
     std::vector<std::vector<const std::vector<VectorValue<double> >*> > PK1_grad_var_data(num_PK1_fcns);
     std::vector<const std::vector<double> *> surface_force_var_data, surface_pressure_var_data;
     std::vector<const std::vector<VectorValue<double> > *> surface_force_grad_var_data, surface_pressure_grad_var_data;
+    std::vector<std::vector<TensorValue<double> > > PP_block(num_PK1_fcns);
+    PK1StressBlockData PK1_block_data;
 
     // Loop over the patches to impose jump conditions on the Eulerian grid that
     // are determined from the interior and transmission elastic force
@@ -2269,6 +2634,21 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
                 fe.reinit(elem, side, TOL, &intersection_ref_coords);
                 fe.interpolate(elem, side);
                 const size_t n_qp = intersection_ref_coords.size();
+                for (unsigned int k = 0; k < num_PK1_fcns; ++k)
+                {
+                    if (!d_PK1_stress_fcn_data[part][k].block_fcn) continue;
+                    eval_PK1_stress_block(PP_block[k],
+                                          PK1_block_data,
+                                          d_PK1_stress_fcn_data[part][k],
+                                          intersection_ref_coords,
+                                          fe_interp_var_data,
+                                          fe_interp_grad_var_data,
+                                          X_sys_idx,
+                                          PK1_fcn_system_idxs[k],
+                                          elem,
+                                          static_cast<unsigned int>(n_qp),
+                                          data_time);
+                }
                 for (unsigned int qp = 0; qp < n_qp; ++qp)
                 {
                     const SideIndex<NDIM>& i_s = intersection_indices[qp];
@@ -2312,7 +2692,11 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].block_fcn)
+                        {
+                            F -= PP_block[k][qp] * normal_face[qp];
+                        }
+                        else if (d_PK1_stress_fcn_data[part][k].fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
@@ -2491,6 +2875,8 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     }
     d_libmesh_restart_read_dir = restart_read_dirname;
     d_libmesh_restart_restore_number = restart_restore_number;
+    d_libmesh_partition_agnostic_restart = true;
+    d_libmesh_restart_read_partition_agnostic = true;
 
     // Store the mesh pointers.
     d_meshes = meshes;
@@ -2510,6 +2896,7 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     d_use_jump_conditions = false;
     d_use_consistent_mass_matrix = true;
     d_do_log = false;
+    d_workload_calibration_window = 0;
 
     d_fe_family.resize(d_num_parts, INVALID_FE);
     d_fe_order.resize(d_num_parts, INVALID_ORDER);
@@ -2686,6 +3073,10 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     {
         d_libmesh_restart_file_extension = "xdr";
     }
+    if (db->keyExists("libmesh_partition_agnostic_restart"))
+    {
+        d_libmesh_partition_agnostic_restart = db->getBool("libmesh_partition_agnostic_restart");
+    }
 
     // Other settings.
     if (db->isInteger("min_ghost_cell_width"))
@@ -2700,6 +3091,8 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->keyExists("workload_calibration_window"))
+        d_workload_calibration_window = db->getInteger("workload_calibration_window");
 
     if (db->isDouble("epsilon")) d_epsilon = db->getDouble("epsilon");
     return;
@@ -2730,6 +3123,10 @@ IBFEMethod::getFromRestart()
     d_split_tangential_force = db->getBool("d_split_tangential_force");
     d_use_jump_conditions = db->getBool("d_use_jump_conditions");
     d_use_consistent_mass_matrix = db->getBool("d_use_consistent_mass_matrix");
+    if (db->keyExists("d_libmesh_partition_agnostic_restart"))
+    {
+        d_libmesh_restart_read_partition_agnostic = db->getBool("d_libmesh_partition_agnostic_restart");
+    }
     return;
 } // getFromRestart
 
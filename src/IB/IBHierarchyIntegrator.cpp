@@ -200,6 +200,16 @@ IBHierarchyIntegrator::preprocessIntegrateHierarchy(const double current_time,
 {
     HierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
 
+    // Redistribute the Lagrangian data on the present patch hierarchy
+    // configuration, unless the hierarchy has just been regridded.
+    if (d_lag_redistribution_interval > 0 && !atRegridTimeStep() &&
+        d_integrator_step % d_lag_redistribution_interval == 0)
+    {
+        if (d_enable_logging)
+            plog << d_object_name << "::preprocessIntegrateHierarchy(): redistributing Lagrangian data\n";
+        d_ib_method_ops->redistributeLagrangianData(d_hierarchy, d_gridding_alg);
+    }
+
     // Determine whether there has been a time step size change.
     const double dt = new_time - current_time;
     static bool skip_check_for_dt_change = MathUtilities<double>::equalEps(d_integrator_time, d_start_time) ||
@@ -445,6 +455,14 @@ IBHierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > h
         level->deallocatePatchData(d_scratch_data);
     }
 
+    // Start tracking Lagrangian point displacements.  Any displacement that
+    // was accumulated prior to restarting is retained as an offset.
+    if (d_regrid_structure_cfl_interval > 0.0)
+    {
+        d_ib_method_ops->resetPointDisplacements();
+        d_regrid_structure_cfl_offset = d_regrid_structure_cfl_estimate;
+    }
+
     // Indicate that the hierarchy is initialized.
     d_hierarchy_is_initialized = true;
     return;
@@ -486,8 +504,11 @@ IBHierarchyIntegrator::regridHierarchy()
         LMarkerUtilities::pruneInvalidMarkers(d_mark_current_idx, d_hierarchy);
     }
 
-    // Reset the regrid CFL estimate.
+    // Reset the regrid CFL estimates.
     d_regrid_cfl_estimate = 0.0;
+    d_regrid_structure_cfl_estimate = 0.0;
+    d_regrid_structure_cfl_offset = 0.0;
+    if (d_regrid_structure_cfl_interval > 0.0) d_ib_method_ops->resetPointDisplacements();
     return;
 } // regridHierarchy
 
@@ -528,8 +549,14 @@ IBHierarchyIntegrator::IBHierarchyIntegrator(const std::string& object_name,
     d_time_stepping_type = MIDPOINT_RULE;
     d_regrid_cfl_interval = 0.0;
     d_regrid_cfl_estimate = 0.0;
+    d_regrid_structure_cfl_interval = 0.0;
+    d_regrid_structure_cfl_estimate = 0.0;
+    d_regrid_structure_cfl_offset = 0.0;
+    d_lag_redistribution_interval = 0;
     d_error_on_dt_change = true;
     d_warn_on_dt_change = false;
+    d_u_phys_bdry_op = NULL;
+    d_p_phys_bdry_op = NULL;
 
     // Do not allocate a workload variable by default.
     d_workload_var.setNull();
@@ -547,7 +574,11 @@ IBHierarchyIntegrator::atRegridPointSpecialized() const
 {
     const bool initial_time = MathUtilities<double>::equalEps(d_integrator_time, d_start_time);
     if (initial_time) return true;
-    if (d_regrid_cfl_interval > 0.0)
+    if (d_regrid_structure_cfl_interval > 0.0)
+    {
+        return (d_regrid_structure_cfl_estimate >= d_regrid_structure_cfl_interval);
+    }
+    else if (d_regrid_cfl_interval > 0.0)
     {
         return (d_regrid_cfl_estimate >= d_regrid_cfl_interval);
     }
@@ -627,6 +658,11 @@ IBHierarchyIntegrator::resetHierarchyConfigurationSpecialized(const Pointer<Base
     d_hier_velocity_data_ops->resetLevels(0, finest_hier_level);
     d_hier_pressure_data_ops->resetLevels(0, finest_hier_level);
     d_hier_cc_data_ops->resetLevels(0, finest_hier_level);
+
+    // Discard any boundary condition coefficients cached for the old patch
+    // hierarchy configuration.
+    if (d_u_phys_bdry_op) d_u_phys_bdry_op->clearBcCoefCache();
+    if (d_p_phys_bdry_op) d_p_phys_bdry_op->clearBcCoefCache();
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -651,6 +687,8 @@ IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     db->putString("d_time_stepping_type", enum_to_string<TimeSteppingType>(d_time_stepping_type));
     db->putDouble("d_regrid_cfl_interval", d_regrid_cfl_interval);
     db->putDouble("d_regrid_cfl_estimate", d_regrid_cfl_estimate);
+    db->putDouble("d_regrid_structure_cfl_interval", d_regrid_structure_cfl_interval);
+    db->putDouble("d_regrid_structure_cfl_estimate", d_regrid_structure_cfl_estimate);
     return;
 } // putToDatabaseSpecialized
 
@@ -660,6 +698,10 @@ void
 IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
 {
     if (db->keyExists("regrid_cfl_interval")) d_regrid_cfl_interval = db->getDouble("regrid_cfl_interval");
+    if (db->keyExists("regrid_structure_cfl_interval"))
+        d_regrid_structure_cfl_interval = db->getDouble("regrid_structure_cfl_interval");
+    if (db->keyExists("lag_redistribution_interval"))
+        d_lag_redistribution_interval = db->getInteger("lag_redistribution_interval");
     if (db->keyExists("error_on_dt_change"))
         d_error_on_dt_change = db->getBool("error_on_dt_change");
     else if (db->keyExists("error_on_timestep_change"))
@@ -703,6 +745,10 @@ IBHierarchyIntegrator::getFromRestart()
     d_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("d_time_stepping_type"));
     d_regrid_cfl_interval = db->getDouble("d_regrid_cfl_interval");
     d_regrid_cfl_estimate = db->getDouble("d_regrid_cfl_estimate");
+    if (db->keyExists("d_regrid_structure_cfl_interval"))
+        d_regrid_structure_cfl_interval = db->getDouble("d_regrid_structure_cfl_interval");
+    if (db->keyExists("d_regrid_structure_cfl_estimate"))
+        d_regrid_structure_cfl_estimate = db->getDouble("d_regrid_structure_cfl_estimate");
     return;
 } // getFromRestart
 
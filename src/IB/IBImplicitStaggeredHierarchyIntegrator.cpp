@@ -68,6 +68,7 @@
 #include "ibtk/KrylovLinearSolver.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
 #include "ibtk/RobinPhysBdryPatchStrategy.h"
+#include "ibtk/TimestepProfiler.h"
 #include "ibtk/ibtk_enums.h"
 #include "petscerror.h"
 #include "petscksp.h"
@@ -152,6 +153,7 @@ IBImplicitStaggeredHierarchyIntegrator::IBImplicitStaggeredHierarchyIntegrator(
     d_solve_for_position = false;
     d_use_structure_predictor = false;
     d_jac_delta_fcn = "IB_4";
+    d_fluid_solve_time = 0.0;
 
     // Set options from input.
     if (input_db)
@@ -281,6 +283,9 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy(const double current_
                                                            const double new_time,
                                                            const int cycle_num)
 {
+    // Time spent in the Stokes solves performed within the coupled solve is
+    // accumulated and reported to the IB method as the Eulerian workload.
+    d_fluid_solve_time = 0.0;
     if (d_solve_for_position)
     {
         integrateHierarchy_position(current_time, new_time, cycle_num);
@@ -289,6 +294,7 @@ IBImplicitStaggeredHierarchyIntegrator::integrateHierarchy(const double current_
     {
         integrateHierarchy_velocity(current_time, new_time, cycle_num);
     }
+    d_ib_method_ops->recordFluidSolveTime(d_fluid_solve_time);
     return;
 } // integrateHierarchy
 
@@ -367,6 +373,19 @@ IBImplicitStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const doub
     // Deallocate IB data.
     d_ib_implicit_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
 
+    // Update the displacement of the Lagrangian points since the last regrid.
+    if (d_regrid_structure_cfl_interval > 0.0)
+    {
+        const double max_displacement = d_ib_method_ops->getMaxPointDisplacement();
+        d_regrid_structure_cfl_estimate = (max_displacement >= 0.0 ?
+                                               d_regrid_structure_cfl_offset + max_displacement :
+                                               d_regrid_cfl_estimate);
+        if (d_enable_logging)
+            plog << d_object_name << "::postprocessIntegrateHierarchy(): maximum IB point displacement since "
+                                     "last regrid = "
+                 << d_regrid_structure_cfl_estimate << "\n";
+    }
+
     // Deallocate Eulerian scratch data.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -960,7 +979,9 @@ IBImplicitStaggeredHierarchyIntegrator::IBFunction_position(SNES /*snes*/, Vec x
         TBOX_ERROR("unsupported time stepping type\n");
     }
     d_ib_implicit_ops->setUpdatedPosition(X);
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_FORCE);
     d_ib_implicit_ops->computeLagrangianForce(force_time);
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_FORCE);
     if (d_enable_logging)
     {
         plog << d_object_name << "::integrateHierarchy_position(): spreading Lagrangian force to the Eulerian grid\n";
@@ -1081,7 +1102,9 @@ IBImplicitStaggeredHierarchyIntegrator::IBFunction_velocity(SNES /*snes*/, Vec x
     default:
         TBOX_ERROR("unsupported time stepping type\n");
     }
+    TimestepProfiler::getProfiler()->startPhase(PROFILE_FORCE);
     d_ib_implicit_ops->computeLagrangianForce(force_time);
+    TimestepProfiler::getProfiler()->stopPhase(PROFILE_FORCE);
     if (d_enable_logging)
     {
         plog << d_object_name << "::integrateHierarchy_velocity(): spreading Lagrangian force to the Eulerian grid\n";
@@ -1478,7 +1501,9 @@ IBImplicitStaggeredHierarchyIntegrator::IBPCApply_position(Vec x, Vec y)
     // Step 1: eul_y := inv(L)*eul_x
     eul_y->setToScalar(0.0);
     d_stokes_solver->setHomogeneousBc(true);
+    double fluid_solve_start_time = MPI_Wtime();
     d_stokes_solver->solveSystem(*eul_y, *eul_x);
+    d_fluid_solve_time += MPI_Wtime() - fluid_solve_start_time;
 
     // Step 2: lag_y := lag_x + dt*J*eul_y/2
     d_hier_velocity_data_ops->scale(d_u_idx, -0.5, eul_y->getComponentDescriptorIndex(0));
@@ -1507,7 +1532,9 @@ IBImplicitStaggeredHierarchyIntegrator::IBPCApply_position(Vec x, Vec y)
     d_f_scratch_vec->setToScalar(0.0);
     d_hier_velocity_data_ops->copyData(d_f_scratch_vec->getComponentDescriptorIndex(0), d_f_idx);
     d_stokes_solver->setHomogeneousBc(true);
+    fluid_solve_start_time = MPI_Wtime();
     d_stokes_solver->solveSystem(*d_u_scratch_vec, *d_f_scratch_vec);
+    d_fluid_solve_time += MPI_Wtime() - fluid_solve_start_time;
     eul_y->add(eul_y, d_u_scratch_vec);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(component_x_vecs[0], &eul_x);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(component_y_vecs[0], &eul_y);
@@ -1524,7 +1551,9 @@ IBImplicitStaggeredHierarchyIntegrator::IBPCApply_velocity(Vec x, Vec y)
 #if !defined(NDEBUG)
     TBOX_ASSERT(p_stokes_solver);
 #endif
+    const double fluid_solve_start_time = MPI_Wtime();
     bool converged = p_stokes_solver->getStaggeredStokesFACPreconditioner()->solveSystem(*u_p, *f_g);
+    d_fluid_solve_time += MPI_Wtime() - fluid_solve_start_time;
     PetscErrorCode ierr = !converged;
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVectorRead(x, &f_g);
     IBTK::PETScSAMRAIVectorReal::restoreSAMRAIVector(y, &u_p);
@@ -1560,7 +1589,9 @@ IBImplicitStaggeredHierarchyIntegrator::lagrangianSchurApply(Vec X, Vec Y)
     d_u_scratch_vec->setToScalar(0.0);
     d_hier_velocity_data_ops->copyData(d_f_scratch_vec->getComponentDescriptorIndex(0), d_f_idx);
     d_stokes_solver->setHomogeneousBc(true);
+    const double fluid_solve_start_time = MPI_Wtime();
     d_stokes_solver->solveSystem(*d_u_scratch_vec, *d_f_scratch_vec);
+    d_fluid_solve_time += MPI_Wtime() - fluid_solve_start_time;
     d_hier_velocity_data_ops->scale(d_u_idx, 0.25, d_u_scratch_vec->getComponentDescriptorIndex(0));
     d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
     d_u_phys_bdry_op->setHomogeneousBc(false);
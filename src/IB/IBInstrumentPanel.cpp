@@ -70,6 +70,7 @@
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
+#include "ibtk/LSiloDataWriter.h"
 #include "ibtk/LNode.h"
 #include "ibtk/ibtk_utilities.h"
 #include "petscvec.h"
@@ -1279,6 +1280,9 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
     current_file_name += temp_buf;
     current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
 
+    // The Silo library is not thread safe, and Lagrangian plot data may be
+    // written by LSiloDataWriter in a background thread.
+    LSiloDataWriter::lockSiloLibrary();
     if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
     {
         TBOX_ERROR(d_object_name + "::writePlotData():\n"
@@ -1305,6 +1309,7 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
     }
 
     DBClose(dbfile);
+    LSiloDataWriter::unlockSiloLibrary();
 
     if (mpi_rank == SILO_MPI_ROOT)
     {
@@ -1313,6 +1318,7 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
         sprintf(temp_buf, "%06d", d_instrument_read_timestep_num);
         std::string summary_file_name =
             dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+        LSiloDataWriter::lockSiloLibrary();
         if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, NULL, DB_PDB)))
         {
             TBOX_ERROR(d_object_name + "::writePlotData():\n"
@@ -1365,6 +1371,7 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
         }
 
         DBClose(dbfile);
+        LSiloDataWriter::unlockSiloLibrary();
 
         // Create or update the dumps file on the root MPI process.
         static bool summary_file_opened = false;
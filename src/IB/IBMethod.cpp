@@ -166,6 +166,9 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_interp_kernel_fcn = "IB_4";
     d_spread_kernel_fcn = "IB_4";
     d_error_if_points_leave_domain = false;
+    d_use_flat_data_redistribution = false;
+    d_use_collective_restart_io = false;
+    d_workload_calibration_window = 0;
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_force_jac_mffd = false;
@@ -194,6 +197,9 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseFlatDataRedistribution(d_use_flat_data_redistribution);
+    d_l_data_manager->setUseCollectiveRestartIO(d_use_collective_restart_io);
+    d_l_data_manager->setWorkloadCalibrationWindow(d_workload_calibration_window);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -852,6 +858,7 @@ IBMethod::computeLagrangianForce(const double data_time)
     getForceData(&F_data, &F_needs_ghost_fill, data_time);
     getPositionData(&X_data, &X_needs_ghost_fill, data_time);
     getVelocityData(&U_data, data_time);
+    const double start_time = MPI_Wtime();
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -863,6 +870,7 @@ IBMethod::computeLagrangianForce(const double data_time)
                 (*F_data)[ln], (*X_data)[ln], (*U_data)[ln], d_hierarchy, ln, data_time, d_l_data_manager);
         }
     }
+    d_l_data_manager->recordLagrangianWorkloadSample(MPI_Wtime() - start_time);
     *F_needs_ghost_fill = true;
     return;
 } // computeLagrangianForce
@@ -1521,6 +1529,26 @@ IBMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
     return;
 } // updateWorkloadEstimates
 
+void
+IBMethod::recordFluidSolveTime(const double wall_time)
+{
+    d_l_data_manager->recordEulerianWorkloadSample(wall_time);
+    return;
+} // recordFluidSolveTime
+
+void
+IBMethod::resetPointDisplacements()
+{
+    d_l_data_manager->resetNodeDisplacements();
+    return;
+} // resetPointDisplacements
+
+double
+IBMethod::getMaxPointDisplacement()
+{
+    return d_l_data_manager->computeMaxNodeDisplacement();
+} // getMaxPointDisplacement
+
 void IBMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                        Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -2068,6 +2096,12 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     }
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
+    if (db->keyExists("use_flat_data_redistribution"))
+        d_use_flat_data_redistribution = db->getBool("use_flat_data_redistribution");
+    if (db->keyExists("use_collective_restart_io"))
+        d_use_collective_restart_io = db->getBool("use_collective_restart_io");
+    if (db->keyExists("workload_calibration_window"))
+        d_workload_calibration_window = db->getInteger("workload_calibration_window");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
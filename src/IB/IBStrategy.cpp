@@ -255,6 +255,26 @@ IBStrategy::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/
     return;
 } // updateWorkloadEstimates
 
+void
+IBStrategy::recordFluidSolveTime(double /*wall_time*/)
+{
+    // intentionally blank
+    return;
+} // recordFluidSolveTime
+
+void
+IBStrategy::resetPointDisplacements()
+{
+    // intentionally blank
+    return;
+} // resetPointDisplacements
+
+double
+IBStrategy::getMaxPointDisplacement()
+{
+    return -1.0;
+} // getMaxPointDisplacement
+
 void IBStrategy::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                          Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -269,6 +289,15 @@ void IBStrategy::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarch
     return;
 } // endDataRedistribution
 
+void
+IBStrategy::redistributeLagrangianData(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                       Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
+{
+    beginDataRedistribution(hierarchy, gridding_alg);
+    endDataRedistribution(hierarchy, gridding_alg);
+    return;
+} // redistributeLagrangianData
+
 void
 IBStrategy::initializeLevelData(Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
                                 int /*level_number*/,
@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -377,6 +378,42 @@ IBStrategySet::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > hierarchy,
     return;
 } // updateWorkloadEstimates
 
+void
+IBStrategySet::recordFluidSolveTime(const double wall_time)
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->recordFluidSolveTime(wall_time);
+    }
+    return;
+} // recordFluidSolveTime
+
+void
+IBStrategySet::resetPointDisplacements()
+{
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        (*cit)->resetPointDisplacements();
+    }
+    return;
+} // resetPointDisplacements
+
+double
+IBStrategySet::getMaxPointDisplacement()
+{
+    double max_displacement = 0.0;
+    for (std::vector<Pointer<IBStrategy> >::const_iterator cit = d_strategy_set.begin(); cit != d_strategy_set.end();
+         ++cit)
+    {
+        const double displacement = (*cit)->getMaxPointDisplacement();
+        if (displacement < 0.0) return -1.0;
+        max_displacement = std::max(max_displacement, displacement);
+    }
+    return max_displacement;
+} // getMaxPointDisplacement
+
 void
 IBStrategySet::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                        Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
@@ -196,6 +196,7 @@ IMPMethod::IMPMethod(const std::string& object_name, Pointer<Database> input_db,
     d_error_if_points_leave_domain = false;
     d_ghosts = LEInteractor::getMinimumGhostWidth(KERNEL_FCN);
     d_do_log = false;
+    d_workload_calibration_window = 0;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -210,6 +211,7 @@ IMPMethod::IMPMethod(const std::string& object_name, Pointer<Database> input_db,
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setWorkloadCalibrationWindow(d_workload_calibration_window);
 
     // Reset the current time step interval.
     d_current_time = std::numeric_limits<double>::quiet_NaN();
@@ -472,6 +474,7 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(u_data->getGhostBox() * idx_data->getGhostBox(), axis);
             }
+            const double start_time = MPI_Wtime();
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const Index<NDIM>& i = *it;
@@ -550,6 +553,8 @@ IMPMethod::interpolateVelocity(const int u_data_idx,
                     }
                 }
             }
+            d_l_data_manager->recordInteractionWorkloadSample(static_cast<int>(idx_data->getLocalPETScIndices().size()),
+                                                              MPI_Wtime() - start_time);
         }
         (*U_data)[ln]->restoreArrays();
         (*Grad_U_data)[ln]->restoreArrays();
@@ -742,6 +747,7 @@ IMPMethod::computeLagrangianForce(const double data_time)
     bool* X_needs_ghost_fill;
     getPositionData(&X_data, &X_needs_ghost_fill, data_time);
     getDeformationGradientData(&F_data, data_time);
+    const double start_time = MPI_Wtime();
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
@@ -795,6 +801,7 @@ IMPMethod::computeLagrangianForce(const double data_time)
             }
         }
     }
+    d_l_data_manager->recordLagrangianWorkloadSample(MPI_Wtime() - start_time);
     return;
 } // computeLagrangianForce
 
@@ -865,6 +872,7 @@ IMPMethod::spreadForce(const int f_data_idx,
             const double* const dx = patch_geom->getDx();
             double dV_c = 1.0;
             for (unsigned int d = 0; d < NDIM; ++d) dV_c *= dx[d];
+            const double start_time = MPI_Wtime();
             for (LNodeSetData::CellIterator it(idx_data->getGhostBox()); it; it++)
             {
                 const Index<NDIM>& i = *it;
@@ -939,6 +947,8 @@ IMPMethod::spreadForce(const int f_data_idx,
                     }
                 }
             }
+            d_l_data_manager->recordInteractionWorkloadSample(static_cast<int>(idx_data->getLocalPETScIndices().size()),
+                                                              MPI_Wtime() - start_time);
             if (f_phys_bdry_op)
             {
                 f_phys_bdry_op->setPatchDataIndex(f_data_idx);
@@ -1010,6 +1020,26 @@ IMPMethod::updateWorkloadEstimates(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
     return;
 } // updateWorkloadEstimates
 
+void
+IMPMethod::recordFluidSolveTime(const double wall_time)
+{
+    d_l_data_manager->recordEulerianWorkloadSample(wall_time);
+    return;
+} // recordFluidSolveTime
+
+void
+IMPMethod::resetPointDisplacements()
+{
+    d_l_data_manager->resetNodeDisplacements();
+    return;
+} // resetPointDisplacements
+
+double
+IMPMethod::getMaxPointDisplacement()
+{
+    return d_l_data_manager->computeMaxNodeDisplacement();
+} // getMaxPointDisplacement
+
 void IMPMethod::beginDataRedistribution(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
                                         Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
@@ -1268,6 +1298,8 @@ IMPMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
         d_do_log = db->getBool("enable_logging");
+    if (db->keyExists("workload_calibration_window"))
+        d_workload_calibration_window = db->getInteger("workload_calibration_window");
     return;
 } // getFromInput
 
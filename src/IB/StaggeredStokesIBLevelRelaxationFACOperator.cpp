@@ -65,6 +65,7 @@
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
 #include "boost/array.hpp"
+#include "boost/functional/hash.hpp"
 #include "ibamr/StaggeredStokesIBLevelRelaxationFACOperator.h"
 #include "ibamr/StaggeredStokesPETScLevelSolver.h"
 #include "ibamr/StaggeredStokesPETScMatUtilities.h"
@@ -94,6 +95,7 @@
 #include "petscksp.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
 #include "tbox/Timer.h"
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
@@ -110,6 +112,36 @@ namespace
 static const int SIDEG = 1;
 static const int CELLG = 1;
 static const int NOGHOST = 0;
+
+// Compute a hash value of the sparsity pattern of the locally owned rows of a
+// matrix.
+size_t
+compute_local_pattern_hash(Mat mat)
+{
+    int ierr;
+    size_t seed = 0;
+    PetscInt m, n, rstart, rend;
+    ierr = MatGetSize(mat, &m, &n);
+    IBTK_CHKERRQ(ierr);
+    ierr = MatGetOwnershipRange(mat, &rstart, &rend);
+    IBTK_CHKERRQ(ierr);
+    boost::hash_combine(seed, m);
+    boost::hash_combine(seed, n);
+    boost::hash_combine(seed, rstart);
+    boost::hash_combine(seed, rend);
+    for (PetscInt row = rstart; row < rend; ++row)
+    {
+        PetscInt ncols;
+        const PetscInt* cols;
+        ierr = MatGetRow(mat, row, &ncols, &cols, NULL);
+        IBTK_CHKERRQ(ierr);
+        boost::hash_combine(seed, ncols);
+        boost::hash_range(seed, cols, cols + ncols);
+        ierr = MatRestoreRow(mat, row, &ncols, &cols, NULL);
+        IBTK_CHKERRQ(ierr);
+    }
+    return seed;
+} // compute_local_pattern_hash
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -129,7 +161,8 @@ StaggeredStokesIBLevelRelaxationFACOperator::StaggeredStokesIBLevelRelaxationFAC
       d_u_petsc_prolongation_method("RT0"),
       d_p_petsc_prolongation_method("CONSERVATIVE"),
       d_SAJ_fill(1.0),
-      d_RStokesIBP_fill(1.0)
+      d_RStokesIBP_fill(1.0),
+      d_reuse_SAJ_pattern(false)
 {
     // Set the time stepping type to UNKNOWN to ensure that the IB solver sets it correctly.
     d_time_stepping_type = UNKNOWN_TIME_STEPPING_TYPE;
@@ -153,6 +186,7 @@ StaggeredStokesIBLevelRelaxationFACOperator::StaggeredStokesIBLevelRelaxationFAC
             d_level_solver_max_iterations = input_db->getInteger("level_solver_max_iterations");
         if (input_db->keyExists("SAJ_fill")) d_SAJ_fill = input_db->getDouble("SAJ_fill");
         if (input_db->keyExists("RStokesIBP_fill")) d_RStokesIBP_fill = input_db->getDouble("RStokesIBP_fill");
+        if (input_db->keyExists("reuse_SAJ_pattern")) d_reuse_SAJ_pattern = input_db->getBool("reuse_SAJ_pattern");
         if (input_db->isDatabase("level_solver_db"))
         {
             d_level_solver_db = input_db->getDatabase("level_solver_db");
@@ -194,6 +228,11 @@ StaggeredStokesIBLevelRelaxationFACOperator::~StaggeredStokesIBLevelRelaxationFA
     {
         deallocateOperatorState();
     }
+    for (std::vector<Mat>::iterator it = d_SAJ_mat.begin(); it != d_SAJ_mat.end(); ++it)
+    {
+        const int ierr = MatDestroy(&(*it));
+        IBTK_CHKERRQ(ierr);
+    }
     return;
 } // ~StaggeredStokesIBLevelRelaxationFACOperator
 
@@ -601,13 +640,50 @@ StaggeredStokesIBLevelRelaxationFACOperator::initializeOperatorStateSpecialized(
         }
     }
 
-    // Compute SAJ operator for various patch levels.
+    // Compute SAJ operator for various patch levels.  When the SAJ operators
+    // are retained between solves, only the numeric phase of the triple
+    // products is recomputed on levels on which the nonzero patterns of the
+    // operators used to build them are unchanged.
+    for (int ln = d_finest_ln + 1; ln < static_cast<int>(d_SAJ_mat.size()); ++ln)
+    {
+        ierr = MatDestroy(&d_SAJ_mat[ln]);
+        IBTK_CHKERRQ(ierr);
+    }
     d_SAJ_mat.resize(d_finest_ln + 1, NULL);
+    d_SAJ_pattern_hash.resize(d_finest_ln + 1, 0);
     for (int ln = std::min(d_finest_ln, finest_reset_ln); ln >= std::max(d_coarsest_ln, coarsest_reset_ln - 1); --ln)
     {
+        MatReuse scall = MAT_INITIAL_MATRIX;
+        if (d_reuse_SAJ_pattern)
+        {
+            size_t pattern_hash = 0;
+            if (ln == d_finest_ln)
+            {
+                boost::hash_combine(pattern_hash, compute_local_pattern_hash(d_A_mat));
+                boost::hash_combine(pattern_hash, compute_local_pattern_hash(d_J_mat));
+            }
+            else
+            {
+                boost::hash_combine(pattern_hash, d_SAJ_pattern_hash[ln + 1]);
+                boost::hash_combine(pattern_hash, compute_local_pattern_hash(d_SAJ_prolongation_mat[ln]));
+            }
+            const int pattern_unchanged =
+                SAMRAI_MPI::minReduction(static_cast<int>(d_SAJ_mat[ln] && pattern_hash == d_SAJ_pattern_hash[ln]));
+            if (pattern_unchanged)
+            {
+                scall = MAT_REUSE_MATRIX;
+            }
+            else
+            {
+                ierr = MatDestroy(&d_SAJ_mat[ln]);
+                IBTK_CHKERRQ(ierr);
+            }
+            d_SAJ_pattern_hash[ln] = pattern_hash;
+        }
+
         if (ln == d_finest_ln)
         {
-            ierr = MatPtAP(d_A_mat, d_J_mat, MAT_INITIAL_MATRIX, d_SAJ_fill, &d_SAJ_mat[ln]);
+            ierr = MatPtAP(d_A_mat, d_J_mat, scall, d_SAJ_fill, &d_SAJ_mat[ln]);
             IBTK_CHKERRQ(ierr);
 
             // Compute the scale for the spreading operator.
@@ -622,8 +698,7 @@ StaggeredStokesIBLevelRelaxationFACOperator::initializeOperatorStateSpecialized(
         }
         else
         {
-            ierr =
-                MatPtAP(d_SAJ_mat[ln + 1], d_SAJ_prolongation_mat[ln], MAT_INITIAL_MATRIX, d_SAJ_fill, &d_SAJ_mat[ln]);
+            ierr = MatPtAP(d_SAJ_mat[ln + 1], d_SAJ_prolongation_mat[ln], scall, d_SAJ_fill, &d_SAJ_mat[ln]);
             IBTK_CHKERRQ(ierr);
             ierr = MatDiagonalScale(d_SAJ_mat[ln], d_scale_SAJ_restriction_mat[ln], NULL);
             IBTK_CHKERRQ(ierr);
@@ -837,12 +912,16 @@ StaggeredStokesIBLevelRelaxationFACOperator::deallocateOperatorStateSpecialized(
         d_scale_stokesib_restriction_mat[ln] = NULL;
     }
 
-    // Deallocate SAJ and Galerkin Stokes-IB Mat.
+    // Deallocate SAJ and Galerkin Stokes-IB Mat.  SAJ Mat are retained when
+    // their symbolic products may be reused.
     for (int ln = std::min(d_finest_ln, finest_reset_ln); ln >= std::max(d_coarsest_ln, coarsest_reset_ln - 1); --ln)
     {
-        ierr = MatDestroy(&d_SAJ_mat[ln]);
-        IBTK_CHKERRQ(ierr);
-        d_SAJ_mat[ln] = NULL;
+        if (!d_reuse_SAJ_pattern)
+        {
+            ierr = MatDestroy(&d_SAJ_mat[ln]);
+            IBTK_CHKERRQ(ierr);
+            d_SAJ_mat[ln] = NULL;
+        }
 
         ierr = MatDestroy(&d_galerkin_stokesib_mat[ln]);
         IBTK_CHKERRQ(ierr);
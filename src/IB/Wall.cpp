@@ -32,6 +32,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <cmath>
+
 #include "ibamr/Wall.h"
 #include "ibamr/namespaces.h"
 
@@ -44,6 +46,7 @@ namespace IBAMR
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 Wall::Wall(Pointer<Database> wall_db, Pointer<CartesianGridGeometry<NDIM> > grid_geometry, double wall_ghost_dist)
+    : d_wall_force_fcn(NULL), d_wall_force_batch_fcn(NULL)
 {
     // get geometry for the wall force box and scaling from cells to numerical postions
     const Box<NDIM> domain_box = grid_geometry->getPhysicalDomain()[0];
@@ -128,7 +131,9 @@ Wall::Wall(const Wall& other_wall)
       d_location(other_wall.d_location),
       d_force_distance(other_wall.d_force_distance),
       d_parameters(other_wall.d_parameters),
-      d_force_area(other_wall.d_force_area)
+      d_force_area(other_wall.d_force_area),
+      d_wall_force_fcn(other_wall.d_wall_force_fcn),
+      d_wall_force_batch_fcn(other_wall.d_wall_force_batch_fcn)
 {
     // this body intentionally blank
     return;
@@ -144,6 +149,8 @@ Wall& Wall::operator=(const Wall& other_wall)
         d_force_distance = other_wall.d_force_distance;
         d_force_area = other_wall.d_force_area;
         d_parameters = other_wall.d_parameters;
+        d_wall_force_fcn = other_wall.d_wall_force_fcn;
+        d_wall_force_batch_fcn = other_wall.d_wall_force_batch_fcn;
     }
     return *this;
 }
@@ -157,6 +164,13 @@ Wall::registerWallForceFcn(WallForceFcnPtr wall_force_fcn)
     return;
 } // registerWallForceFcn
 
+void
+Wall::registerWallForceBatchFcn(WallForceBatchFcnPtr wall_force_batch_fcn)
+{
+    d_wall_force_batch_fcn = wall_force_batch_fcn;
+    return;
+} // registerWallForceBatchFcn
+
 Box<NDIM>
 Wall::getForceArea()
 {
@@ -200,6 +214,60 @@ Wall::applyForce(double wall_distance, double /*eval_time*/)
     }
 } // applyForce
 
+void
+Wall::applyForces(const double* const X,
+                  double* const F,
+                  const int* const node_idxs,
+                  const int n,
+                  const double eval_time)
+{
+    if (n == 0) return;
+    const int axis = d_axis;
+    const double location = d_location;
+    const double force_distance = d_force_distance;
+
+    if (!d_wall_force_batch_fcn)
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            const int idx = node_idxs[k] + axis;
+            F[idx] += applyForce(X[idx] - location, eval_time);
+        }
+        return;
+    }
+
+    // Gather the distances of the nodes that are within the force distance of
+    // the wall, evaluate the force for all of them at once, and then scatter
+    // the signed forces back.
+    d_dist_scratch.resize(n);
+    d_force_scratch.resize(n);
+    d_idx_scratch.resize(n);
+    int n_active = 0;
+    for (int k = 0; k < n; ++k)
+    {
+        const int idx = node_idxs[k] + axis;
+        const double wall_distance = X[idx] - location;
+        if (wall_distance == 0.0)
+        {
+            TBOX_ERROR("Particle is on the wall, must be inside the domain");
+        }
+        if (std::abs(wall_distance) < force_distance)
+        {
+            d_dist_scratch[n_active] = std::abs(wall_distance);
+            d_idx_scratch[n_active] = idx;
+            ++n_active;
+        }
+    }
+    if (n_active == 0) return;
+    d_wall_force_batch_fcn(&d_dist_scratch[0], &d_force_scratch[0], n_active, d_parameters);
+    for (int k = 0; k < n_active; ++k)
+    {
+        const int idx = d_idx_scratch[k];
+        F[idx] += (X[idx] > location ? d_force_scratch[k] : -d_force_scratch[k]);
+    }
+    return;
+} // applyForces
+
 /////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
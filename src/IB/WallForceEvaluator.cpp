@@ -32,6 +32,9 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <vector>
+
 #include "ibamr/WallForceEvaluator.h"
 #include "ibamr/namespaces.h"
 
@@ -101,6 +104,16 @@ WallForceEvaluator::registerWallForceFcn(Wall::WallForceFcnPtr wall_force_fcn)
     return;
 } // registerWallForceFcn
 
+void
+WallForceEvaluator::registerWallForceBatchFcn(Wall::WallForceBatchFcnPtr wall_force_batch_fcn)
+{
+    for (std::vector<Wall>::iterator wall_it = d_walls_vec.begin(); wall_it != d_walls_vec.end(); ++wall_it)
+    {
+        wall_it->registerWallForceBatchFcn(wall_force_batch_fcn);
+    }
+    return;
+} // registerWallForceBatchFcn
+
 void
 WallForceEvaluator::addWall(Pointer<Database> wall_db, double wall_ghost_dist)
 {
@@ -112,6 +125,61 @@ WallForceEvaluator::addWall(Pointer<Database> wall_db, double wall_ghost_dist)
     return;
 } // addWall
 
+void
+WallForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                        const int level_number,
+                                        const double /*init_data_time*/,
+                                        const bool /*initial_time*/,
+                                        LDataManager* const l_data_manager)
+{
+    // Discard any lists built for the previous distribution of Lagrangian data.
+    resetLevelData(level_number);
+    if (!l_data_manager->levelContainsLagrangianData(level_number)) return;
+
+    const int new_size = std::max(level_number + 1, static_cast<int>(d_is_initialized.size()));
+    d_wall_node_idxs.resize(new_size);
+    d_is_initialized.resize(new_size, false);
+
+    // Collect the nodes in the (padded) force area of each wall.  Because the
+    // force area includes the Lagrangian ghost distance, these lists remain
+    // valid until the next redistribution of Lagrangian data.
+    std::vector<std::vector<int> >& wall_node_idxs = d_wall_node_idxs[level_number];
+    wall_node_idxs.resize(d_walls_vec.size());
+    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const IntVector<NDIM>& ratio = level->getRatio();
+    for (unsigned int wall = 0; wall < d_walls_vec.size(); ++wall)
+    {
+        std::vector<int>& node_idxs = wall_node_idxs[wall];
+        node_idxs.clear();
+        const Box<NDIM> force_area = Box<NDIM>::refine(d_walls_vec[wall].getForceArea(), ratio);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
+            const Box<NDIM> intersect_box = patch->getBox() * force_area;
+            if (intersect_box.empty()) continue;
+            for (LNodeSetData::DataIterator it = current_idx_data->data_begin(intersect_box);
+                 it != current_idx_data->data_end();
+                 ++it)
+            {
+                node_idxs.push_back(NDIM * (*it)->getLocalPETScIndex());
+            }
+        }
+    }
+    d_is_initialized[level_number] = true;
+    return;
+} // initializeLevelData
+
+void
+WallForceEvaluator::resetLevelData(const int level_number)
+{
+    if (level_number >= static_cast<int>(d_is_initialized.size())) return;
+    d_wall_node_idxs[level_number].clear();
+    d_is_initialized[level_number] = false;
+    return;
+} // resetLevelData
+
 void
 WallForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                            Pointer<LData> X_data,
@@ -121,58 +189,23 @@ WallForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                            const double eval_time,
                                            LDataManager* const l_data_manager)
 {
-    PetscScalar* force;
-    VecGetArray(F_data->getVec(), &force);
-
-    // get access to petsc vector of positions.
-    PetscScalar* lposition;
-    VecGetArray(X_data->getVec(), &lposition);
-
-    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
-
-    for (std::vector<Wall>::iterator wall_it = d_walls_vec.begin(); wall_it != d_walls_vec.end(); ++wall_it)
-    { // iterate through walls
-
-        // get axis (which direction the wall is normal to)
-        int axis = wall_it->getAxis();
-
-        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
-        const IntVector<NDIM>& ratio = level->getRatio();
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        { // iterate through patches
-
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
-            const Box<NDIM>& patch_box = patch->getBox();
-
-            // get just the area near the wall
-            const Box<NDIM> intersect_box = patch_box * Box<NDIM>::refine(wall_it->getForceArea(), ratio);
+    if (level_number >= static_cast<int>(d_is_initialized.size()) || !d_is_initialized[level_number])
+    {
+        initializeLevelData(hierarchy, level_number, eval_time, false, l_data_manager);
+    }
+    if (level_number >= static_cast<int>(d_is_initialized.size()) || !d_is_initialized[level_number]) return;
 
-            // iterate through cells in relevant area
-            for (LNodeSetData::CellIterator scit(intersect_box); scit; scit++)
-            {
-                // get current nodes in the cell.
-                const Index<NDIM>& search_cell_idx = *scit;
-                LNodeSet* search_node_set = current_idx_data->getItem(search_cell_idx);
-
-                // if particles exist in this cell, add forces to them
-                if (search_node_set)
-                {
-                    for (LNodeSet::iterator it = search_node_set->begin(); it != search_node_set->end(); ++it)
-                    {
-                        // get node data
-                        LNodeSet::value_type& particle_node_idx = *it;
-                        const int particle_petsc_idx = particle_node_idx->getLocalPETScIndex();
-
-                        // get wall distance
-                        double wall_distance = lposition[particle_petsc_idx * NDIM + axis] - wall_it->getLocation();
-                        force[particle_petsc_idx * NDIM + axis] += wall_it->applyForce(wall_distance, eval_time);
-                    } // iterate through nodes
-                }     // if search_node_set
-            }         // iterate through cells in wall area
-        }             // iterate through patches
-    }                 // iterate through walls
-    VecRestoreArray(F_data->getVec(), &force);
+    double* const F = F_data->getLocalFormVecArray()->data();
+    const double* const X = X_data->getLocalFormVecArray()->data();
+    std::vector<std::vector<int> >& wall_node_idxs = d_wall_node_idxs[level_number];
+    for (unsigned int wall = 0; wall < d_walls_vec.size(); ++wall)
+    {
+        const std::vector<int>& node_idxs = wall_node_idxs[wall];
+        if (node_idxs.empty()) continue;
+        d_walls_vec[wall].applyForces(X, F, &node_idxs[0], static_cast<int>(node_idxs.size()), eval_time);
+    }
+    F_data->restoreArrays();
+    X_data->restoreArrays();
     return;
 } // computeLagrangianForce
 
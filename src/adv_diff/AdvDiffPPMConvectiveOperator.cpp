@@ -34,6 +34,7 @@
 
 #include <stddef.h>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -346,7 +347,11 @@ AdvDiffPPMConvectiveOperator::AdvDiffPPMConvectiveOperator(const std::string& ob
       d_q_extrap_var(NULL),
       d_q_flux_var(NULL),
       d_q_extrap_idx(-1),
-      d_q_flux_idx(-1)
+      d_q_flux_idx(-1),
+      d_batch_num_quantities(0),
+      d_Q_batch_scratch_idx(-1),
+      d_q_batch_extrap_idx(-1),
+      d_q_batch_flux_idx(-1)
 {
     if (d_difference_form != ADVECTIVE && d_difference_form != CONSERVATIVE && d_difference_form != SKEW_SYMMETRIC)
     {
@@ -458,162 +463,7 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
-
-            Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(d_Q_scratch_idx);
-            const IntVector<NDIM>& Q_data_gcw = Q_data->getGhostCellWidth();
-#if !defined(NDEBUG)
-            TBOX_ASSERT(Q_data_gcw.min() == Q_data_gcw.max());
-#endif
-            Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
-            const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
-#if !defined(NDEBUG)
-            TBOX_ASSERT(u_ADV_data_gcw.min() == u_ADV_data_gcw.max());
-#endif
-            Pointer<FaceData<NDIM, double> > q_extrap_data = patch->getPatchData(d_q_extrap_idx);
-            const IntVector<NDIM>& q_extrap_data_gcw = q_extrap_data->getGhostCellWidth();
-#if !defined(NDEBUG)
-            TBOX_ASSERT(q_extrap_data_gcw.min() == q_extrap_data_gcw.max());
-#endif
-            CellData<NDIM, double>& Q0_data = *Q_data;
-            CellData<NDIM, double> Q1_data(patch_box, 1, Q_data_gcw);
-#if (NDIM == 3)
-            CellData<NDIM, double> Q2_data(patch_box, 1, Q_data_gcw);
-#endif
-            CellData<NDIM, double> dQ_data(patch_box, 1, Q_data_gcw);
-            CellData<NDIM, double> Q_L_data(patch_box, 1, Q_data_gcw);
-            CellData<NDIM, double> Q_R_data(patch_box, 1, Q_data_gcw);
-
-            // Enforce physical boundary conditions at inflow boundaries.
-            AdvDiffPhysicalBoundaryUtilities::setPhysicalBoundaryConditions(
-                Q_data,
-                u_ADV_data,
-                patch,
-                d_bc_coefs,
-                d_solution_time,
-                /*inflow_boundary_only*/ d_outflow_bdry_extrap_type != "NONE",
-                d_homogeneous_bc);
-
-            // Extrapolate from cell centers to cell faces.
-            for (unsigned int d = 0; d < d_Q_data_depth; ++d)
-            {
-                GODUNOV_EXTRAPOLATE_FC(
-#if (NDIM == 2)
-                    patch_lower(0),
-                    patch_upper(0),
-                    patch_lower(1),
-                    patch_upper(1),
-                    Q_data_gcw(0),
-                    Q_data_gcw(1),
-                    Q0_data.getPointer(d),
-                    Q1_data.getPointer(),
-                    dQ_data.getPointer(),
-                    Q_L_data.getPointer(),
-                    Q_R_data.getPointer(),
-                    u_ADV_data_gcw(0),
-                    u_ADV_data_gcw(1),
-                    q_extrap_data_gcw(0),
-                    q_extrap_data_gcw(1),
-                    u_ADV_data->getPointer(0),
-                    u_ADV_data->getPointer(1),
-                    q_extrap_data->getPointer(0, d),
-                    q_extrap_data->getPointer(1, d)
-#endif
-#if (NDIM == 3)
-                        patch_lower(0),
-                    patch_upper(0),
-                    patch_lower(1),
-                    patch_upper(1),
-                    patch_lower(2),
-                    patch_upper(2),
-                    Q_data_gcw(0),
-                    Q_data_gcw(1),
-                    Q_data_gcw(2),
-                    Q0_data.getPointer(d),
-                    Q1_data.getPointer(),
-                    Q2_data.getPointer(),
-                    dQ_data.getPointer(),
-                    Q_L_data.getPointer(),
-                    Q_R_data.getPointer(),
-                    u_ADV_data_gcw(0),
-                    u_ADV_data_gcw(1),
-                    u_ADV_data_gcw(2),
-                    q_extrap_data_gcw(0),
-                    q_extrap_data_gcw(1),
-                    q_extrap_data_gcw(2),
-                    u_ADV_data->getPointer(0),
-                    u_ADV_data->getPointer(1),
-                    u_ADV_data->getPointer(2),
-                    q_extrap_data->getPointer(0, d),
-                    q_extrap_data->getPointer(1, d),
-                    q_extrap_data->getPointer(2, d)
-#endif
-                        );
-            }
-
-            // If we are using conservative or skew-symmetric differencing,
-            // compute the advective fluxes.  These need to be synchronized on
-            // the patch hierarchy.
-            if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
-            {
-                Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
-                const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
-                Pointer<FaceData<NDIM, double> > q_flux_data = patch->getPatchData(d_q_flux_idx);
-                const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
-                for (unsigned int d = 0; d < d_Q_data_depth; ++d)
-                {
-                    static const double dt = 1.0;
-                    ADVECT_FLUX_FC(dt,
-#if (NDIM == 2)
-                                   patch_lower(0),
-                                   patch_upper(0),
-                                   patch_lower(1),
-                                   patch_upper(1),
-                                   u_ADV_data_gcw(0),
-                                   u_ADV_data_gcw(1),
-                                   q_extrap_data_gcw(0),
-                                   q_extrap_data_gcw(1),
-                                   q_flux_data_gcw(0),
-                                   q_flux_data_gcw(1),
-                                   u_ADV_data->getPointer(0),
-                                   u_ADV_data->getPointer(1),
-                                   q_extrap_data->getPointer(0, d),
-                                   q_extrap_data->getPointer(1, d),
-                                   q_flux_data->getPointer(0, d),
-                                   q_flux_data->getPointer(1, d)
-#endif
-#if (NDIM == 3)
-                                       patch_lower(0),
-                                   patch_upper(0),
-                                   patch_lower(1),
-                                   patch_upper(1),
-                                   patch_lower(2),
-                                   patch_upper(2),
-                                   u_ADV_data_gcw(0),
-                                   u_ADV_data_gcw(1),
-                                   u_ADV_data_gcw(2),
-                                   q_extrap_data_gcw(0),
-                                   q_extrap_data_gcw(1),
-                                   q_extrap_data_gcw(2),
-                                   q_flux_data_gcw(0),
-                                   q_flux_data_gcw(1),
-                                   q_flux_data_gcw(2),
-                                   u_ADV_data->getPointer(0),
-                                   u_ADV_data->getPointer(1),
-                                   u_ADV_data->getPointer(2),
-                                   q_extrap_data->getPointer(0, d),
-                                   q_extrap_data->getPointer(1, d),
-                                   q_extrap_data->getPointer(2, d),
-                                   q_flux_data->getPointer(0, d),
-                                   q_flux_data->getPointer(1, d),
-                                   q_flux_data->getPointer(2, d)
-#endif
-                                       );
-                }
-            }
+            computeFaceValues(patch, d_Q_scratch_idx, d_q_extrap_idx, d_q_flux_idx, d_bc_coefs);
         }
     }
 
@@ -630,144 +480,121 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > N_data = patch->getPatchData(N_idx);
+            differenceFaceValues(patch, d_q_extrap_idx, d_q_flux_idx, 0, N_data);
+        }
+    }
 
-            const Box<NDIM>& patch_box = patch->getBox();
-            const IntVector<NDIM>& patch_lower = patch_box.lower();
-            const IntVector<NDIM>& patch_upper = patch_box.upper();
+    // Deallocate scratch data.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(d_Q_scratch_idx);
+        level->deallocatePatchData(d_q_extrap_idx);
+        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
+            level->deallocatePatchData(d_q_flux_idx);
+    }
 
-            const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
-            const double* const dx = patch_geom->getDx();
+    IBAMR_TIMER_STOP(t_apply_convective_operator);
+    return;
+} // applyConvectiveOperator
 
-            Pointer<CellData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
+void
+AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const std::vector<int>& Q_idxs,
+                                                      const std::vector<int>& N_idxs,
+                                                      const std::vector<std::vector<RobinBcCoefStrategy<NDIM>*> >& Q_bc_coefs)
+{
+    IBAMR_TIMER_START(t_apply_convective_operator);
+#if !defined(NDEBUG)
+    if (!d_is_initialized)
+    {
+        TBOX_ERROR("AdvDiffPPMConvectiveOperator::applyConvectiveOperator():\n"
+                   << "  operator must be initialized prior to call to applyConvectiveOperator\n");
+    }
+    TBOX_ASSERT(Q_idxs.size() == N_idxs.size());
+    TBOX_ASSERT(Q_bc_coefs.empty() || Q_bc_coefs.size() == Q_idxs.size());
+#endif
+    const int num_quantities = static_cast<int>(Q_idxs.size());
+    if (num_quantities == 0)
+    {
+        IBAMR_TIMER_STOP(t_apply_convective_operator);
+        return;
+    }
+    const int Q_depth = static_cast<int>(d_Q_data_depth);
 
-            if (d_difference_form == ADVECTIVE || d_difference_form == SKEW_SYMMETRIC)
-            {
-                Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
-                const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
-                Pointer<FaceData<NDIM, double> > q_extrap_data = patch->getPatchData(d_q_extrap_idx);
-                const IntVector<NDIM>& q_extrap_data_gcw = q_extrap_data->getGhostCellWidth();
-                for (unsigned int d = 0; d < d_Q_data_depth; ++d)
-                {
-                    ADVECT_DERIVATIVE_FC(dx,
-#if (NDIM == 2)
-                                         patch_lower(0),
-                                         patch_upper(0),
-                                         patch_lower(1),
-                                         patch_upper(1),
-                                         u_ADV_data_gcw(0),
-                                         u_ADV_data_gcw(1),
-                                         q_extrap_data_gcw(0),
-                                         q_extrap_data_gcw(1),
-                                         u_ADV_data->getPointer(0),
-                                         u_ADV_data->getPointer(1),
-                                         q_extrap_data->getPointer(0, d),
-                                         q_extrap_data->getPointer(1, d),
-                                         N_data_gcw(0),
-                                         N_data_gcw(1),
+    // Setup the packed scratch data and the corresponding communications
+    // schedules.
+    initializeBatchState(num_quantities);
+
+    // The boundary conditions for the packed data are the concatenation of the
+    // boundary conditions for the individual quantities.
+    std::vector<RobinBcCoefStrategy<NDIM>*> bc_coefs;
+    bc_coefs.reserve(num_quantities * Q_depth);
+    for (int k = 0; k < num_quantities; ++k)
+    {
+        const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_k_bc_coefs = Q_bc_coefs.empty() ? d_bc_coefs : Q_bc_coefs[k];
+#if !defined(NDEBUG)
+        TBOX_ASSERT(static_cast<int>(Q_k_bc_coefs.size()) == Q_depth);
 #endif
-#if (NDIM == 3)
-                                         patch_lower(0),
-                                         patch_upper(0),
-                                         patch_lower(1),
-                                         patch_upper(1),
-                                         patch_lower(2),
-                                         patch_upper(2),
-                                         u_ADV_data_gcw(0),
-                                         u_ADV_data_gcw(1),
-                                         u_ADV_data_gcw(2),
-                                         q_extrap_data_gcw(0),
-                                         q_extrap_data_gcw(1),
-                                         q_extrap_data_gcw(2),
-                                         u_ADV_data->getPointer(0),
-                                         u_ADV_data->getPointer(1),
-                                         u_ADV_data->getPointer(2),
-                                         q_extrap_data->getPointer(0, d),
-                                         q_extrap_data->getPointer(1, d),
-                                         q_extrap_data->getPointer(2, d),
-                                         N_data_gcw(0),
-                                         N_data_gcw(1),
-                                         N_data_gcw(2),
-#endif
-                                         N_data->getPointer(d));
-                }
-            }
+        bc_coefs.insert(bc_coefs.end(), Q_k_bc_coefs.begin(), Q_k_bc_coefs.end());
+    }
 
-            if (d_difference_form == CONSERVATIVE)
+    // Allocate scratch data and pack the quantities into it.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_Q_batch_scratch_idx);
+        level->allocatePatchData(d_q_batch_extrap_idx);
+        if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
+            level->allocatePatchData(d_q_batch_flux_idx);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > Q_batch_data = patch->getPatchData(d_Q_batch_scratch_idx);
+            for (int k = 0; k < num_quantities; ++k)
             {
-                Pointer<FaceData<NDIM, double> > q_flux_data = patch->getPatchData(d_q_flux_idx);
-                const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
-                for (unsigned int d = 0; d < d_Q_data_depth; ++d)
-                {
-                    static const double alpha = 1.0;
-                    F_TO_C_DIV_FC(N_data->getPointer(d),
-                                  N_data_gcw.min(),
-                                  alpha,
-#if (NDIM == 2)
-                                  q_flux_data->getPointer(0, d),
-                                  q_flux_data->getPointer(1, d),
-                                  q_flux_data_gcw.min(),
-                                  patch_lower(0),
-                                  patch_upper(0),
-                                  patch_lower(1),
-                                  patch_upper(1),
+                Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_idxs[k]);
+#if !defined(NDEBUG)
+                TBOX_ASSERT(Q_data->getDepth() == Q_depth);
 #endif
-#if (NDIM == 3)
-                                  q_flux_data->getPointer(0, d),
-                                  q_flux_data->getPointer(1, d),
-                                  q_flux_data->getPointer(2, d),
-                                  q_flux_data_gcw.min(),
-                                  patch_lower(0),
-                                  patch_upper(0),
-                                  patch_lower(1),
-                                  patch_upper(1),
-                                  patch_lower(2),
-                                  patch_upper(2),
-#endif
-                                  dx);
+                for (int d = 0; d < Q_depth; ++d)
+                {
+                    Q_batch_data->copyDepth(k * Q_depth + d, *Q_data, d);
                 }
             }
+        }
+    }
 
-            if (d_difference_form == SKEW_SYMMETRIC)
+    // Fill ghost cells for all quantities at once and extrapolate from cell
+    // centers to cell faces.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        d_batch_ghostfill_scheds[ln]->fillData(d_solution_time);
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            computeFaceValues(patch, d_Q_batch_scratch_idx, d_q_batch_extrap_idx, d_q_batch_flux_idx, bc_coefs);
+        }
+    }
+
+    // Synchronize data for all quantities on the patch hierarchy.
+    for (int ln = d_finest_ln; ln > d_coarsest_ln; --ln)
+    {
+        d_batch_coarsen_scheds[ln]->coarsenData();
+    }
+
+    // Difference values on the patches.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int k = 0; k < num_quantities; ++k)
             {
-                Pointer<FaceData<NDIM, double> > q_flux_data = patch->getPatchData(d_q_flux_idx);
-                const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
-                for (unsigned int d = 0; d < d_Q_data_depth; ++d)
-                {
-                    static const double alpha = 0.5;
-                    static const double beta = 0.5;
-                    F_TO_C_DIV_ADD_FC(N_data->getPointer(d),
-                                      N_data_gcw.min(),
-                                      alpha,
-#if (NDIM == 2)
-                                      q_flux_data->getPointer(0, d),
-                                      q_flux_data->getPointer(1, d),
-                                      q_flux_data_gcw.min(),
-                                      beta,
-                                      N_data->getPointer(d),
-                                      N_data_gcw.min(),
-                                      patch_lower(0),
-                                      patch_upper(0),
-                                      patch_lower(1),
-                                      patch_upper(1),
-#endif
-#if (NDIM == 3)
-                                      q_flux_data->getPointer(0, d),
-                                      q_flux_data->getPointer(1, d),
-                                      q_flux_data->getPointer(2, d),
-                                      q_flux_data_gcw.min(),
-                                      beta,
-                                      N_data->getPointer(d),
-                                      N_data_gcw.min(),
-                                      patch_lower(0),
-                                      patch_upper(0),
-                                      patch_lower(1),
-                                      patch_upper(1),
-                                      patch_lower(2),
-                                      patch_upper(2),
-#endif
-                                      dx);
-                }
+                Pointer<CellData<NDIM, double> > N_data = patch->getPatchData(N_idxs[k]);
+                differenceFaceValues(patch, d_q_batch_extrap_idx, d_q_batch_flux_idx, k * Q_depth, N_data);
             }
         }
     }
@@ -776,10 +603,10 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_Q_scratch_idx);
-        level->deallocatePatchData(d_q_extrap_idx);
+        level->deallocatePatchData(d_Q_batch_scratch_idx);
+        level->deallocatePatchData(d_q_batch_extrap_idx);
         if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
-            level->deallocatePatchData(d_q_flux_idx);
+            level->deallocatePatchData(d_q_batch_flux_idx);
     }
 
     IBAMR_TIMER_STOP(t_apply_convective_operator);
@@ -857,6 +684,12 @@ AdvDiffPPMConvectiveOperator::deallocateOperatorState()
     }
     d_ghostfill_scheds.clear();
 
+    // Deallocate the communication schedules for the packed data.
+    d_batch_ghostfill_strategy.setNull();
+    d_batch_ghostfill_scheds.clear();
+    d_batch_coarsen_scheds.clear();
+    d_batch_num_quantities = 0;
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -867,6 +700,402 @@ AdvDiffPPMConvectiveOperator::deallocateOperatorState()
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+AdvDiffPPMConvectiveOperator::computeFaceValues(Pointer<Patch<NDIM> > patch,
+                                                const int Q_scratch_idx,
+                                                const int q_extrap_idx,
+                                                const int q_flux_idx,
+                                                const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs)
+{
+    const Box<NDIM>& patch_box = patch->getBox();
+    const IntVector<NDIM>& patch_lower = patch_box.lower();
+    const IntVector<NDIM>& patch_upper = patch_box.upper();
+
+    Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_scratch_idx);
+    const IntVector<NDIM>& Q_data_gcw = Q_data->getGhostCellWidth();
+    const int Q_depth = Q_data->getDepth();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_data_gcw.min() == Q_data_gcw.max());
+#endif
+    Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
+    const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(u_ADV_data_gcw.min() == u_ADV_data_gcw.max());
+#endif
+    Pointer<FaceData<NDIM, double> > q_extrap_data = patch->getPatchData(q_extrap_idx);
+    const IntVector<NDIM>& q_extrap_data_gcw = q_extrap_data->getGhostCellWidth();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_extrap_data_gcw.min() == q_extrap_data_gcw.max());
+#endif
+    CellData<NDIM, double>& Q0_data = *Q_data;
+    CellData<NDIM, double> Q1_data(patch_box, 1, Q_data_gcw);
+#if (NDIM == 3)
+    CellData<NDIM, double> Q2_data(patch_box, 1, Q_data_gcw);
+#endif
+    CellData<NDIM, double> dQ_data(patch_box, 1, Q_data_gcw);
+    CellData<NDIM, double> Q_L_data(patch_box, 1, Q_data_gcw);
+    CellData<NDIM, double> Q_R_data(patch_box, 1, Q_data_gcw);
+
+    // Enforce physical boundary conditions at inflow boundaries.
+    AdvDiffPhysicalBoundaryUtilities::setPhysicalBoundaryConditions(
+        Q_data,
+        u_ADV_data,
+        patch,
+        bc_coefs,
+        d_solution_time,
+        /*inflow_boundary_only*/ d_outflow_bdry_extrap_type != "NONE",
+        d_homogeneous_bc);
+
+    // Extrapolate from cell centers to cell faces.
+    for (int d = 0; d < Q_depth; ++d)
+    {
+        GODUNOV_EXTRAPOLATE_FC(
+#if (NDIM == 2)
+            patch_lower(0),
+            patch_upper(0),
+            patch_lower(1),
+            patch_upper(1),
+            Q_data_gcw(0),
+            Q_data_gcw(1),
+            Q0_data.getPointer(d),
+            Q1_data.getPointer(),
+            dQ_data.getPointer(),
+            Q_L_data.getPointer(),
+            Q_R_data.getPointer(),
+            u_ADV_data_gcw(0),
+            u_ADV_data_gcw(1),
+            q_extrap_data_gcw(0),
+            q_extrap_data_gcw(1),
+            u_ADV_data->getPointer(0),
+            u_ADV_data->getPointer(1),
+            q_extrap_data->getPointer(0, d),
+            q_extrap_data->getPointer(1, d)
+#endif
+#if (NDIM == 3)
+                patch_lower(0),
+            patch_upper(0),
+            patch_lower(1),
+            patch_upper(1),
+            patch_lower(2),
+            patch_upper(2),
+            Q_data_gcw(0),
+            Q_data_gcw(1),
+            Q_data_gcw(2),
+            Q0_data.getPointer(d),
+            Q1_data.getPointer(),
+            Q2_data.getPointer(),
+            dQ_data.getPointer(),
+            Q_L_data.getPointer(),
+            Q_R_data.getPointer(),
+            u_ADV_data_gcw(0),
+            u_ADV_data_gcw(1),
+            u_ADV_data_gcw(2),
+            q_extrap_data_gcw(0),
+            q_extrap_data_gcw(1),
+            q_extrap_data_gcw(2),
+            u_ADV_data->getPointer(0),
+            u_ADV_data->getPointer(1),
+            u_ADV_data->getPointer(2),
+            q_extrap_data->getPointer(0, d),
+            q_extrap_data->getPointer(1, d),
+            q_extrap_data->getPointer(2, d)
+#endif
+                );
+    }
+
+    // If we are using conservative or skew-symmetric differencing,
+    // compute the advective fluxes.  These need to be synchronized on
+    // the patch hierarchy.
+    if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
+    {
+        Pointer<FaceData<NDIM, double> > q_flux_data = patch->getPatchData(q_flux_idx);
+        const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
+        for (int d = 0; d < Q_depth; ++d)
+        {
+            static const double dt = 1.0;
+            ADVECT_FLUX_FC(dt,
+#if (NDIM == 2)
+                           patch_lower(0),
+                           patch_upper(0),
+                           patch_lower(1),
+                           patch_upper(1),
+                           u_ADV_data_gcw(0),
+                           u_ADV_data_gcw(1),
+                           q_extrap_data_gcw(0),
+                           q_extrap_data_gcw(1),
+                           q_flux_data_gcw(0),
+                           q_flux_data_gcw(1),
+                           u_ADV_data->getPointer(0),
+                           u_ADV_data->getPointer(1),
+                           q_extrap_data->getPointer(0, d),
+                           q_extrap_data->getPointer(1, d),
+                           q_flux_data->getPointer(0, d),
+                           q_flux_data->getPointer(1, d)
+#endif
+#if (NDIM == 3)
+                               patch_lower(0),
+                           patch_upper(0),
+                           patch_lower(1),
+                           patch_upper(1),
+                           patch_lower(2),
+                           patch_upper(2),
+                           u_ADV_data_gcw(0),
+                           u_ADV_data_gcw(1),
+                           u_ADV_data_gcw(2),
+                           q_extrap_data_gcw(0),
+                           q_extrap_data_gcw(1),
+                           q_extrap_data_gcw(2),
+                           q_flux_data_gcw(0),
+                           q_flux_data_gcw(1),
+                           q_flux_data_gcw(2),
+                           u_ADV_data->getPointer(0),
+                           u_ADV_data->getPointer(1),
+                           u_ADV_data->getPointer(2),
+                           q_extrap_data->getPointer(0, d),
+                           q_extrap_data->getPointer(1, d),
+                           q_extrap_data->getPointer(2, d),
+                           q_flux_data->getPointer(0, d),
+                           q_flux_data->getPointer(1, d),
+                           q_flux_data->getPointer(2, d)
+#endif
+                               );
+        }
+    }
+    return;
+} // computeFaceValues
+
+void
+AdvDiffPPMConvectiveOperator::differenceFaceValues(Pointer<Patch<NDIM> > patch,
+                                                   const int q_extrap_idx,
+                                                   const int q_flux_idx,
+                                                   const int q_depth_offset,
+                                                   Pointer<CellData<NDIM, double> > N_data)
+{
+    const Box<NDIM>& patch_box = patch->getBox();
+    const IntVector<NDIM>& patch_lower = patch_box.lower();
+    const IntVector<NDIM>& patch_upper = patch_box.upper();
+
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+    const double* const dx = patch_geom->getDx();
+
+    const IntVector<NDIM>& N_data_gcw = N_data->getGhostCellWidth();
+    const int N_depth = N_data->getDepth();
+
+    if (d_difference_form == ADVECTIVE || d_difference_form == SKEW_SYMMETRIC)
+    {
+        Pointer<FaceData<NDIM, double> > u_ADV_data = patch->getPatchData(d_u_idx);
+        const IntVector<NDIM>& u_ADV_data_gcw = u_ADV_data->getGhostCellWidth();
+        Pointer<FaceData<NDIM, double> > q_extrap_data = patch->getPatchData(q_extrap_idx);
+        const IntVector<NDIM>& q_extrap_data_gcw = q_extrap_data->getGhostCellWidth();
+        for (int d = 0; d < N_depth; ++d)
+        {
+            ADVECT_DERIVATIVE_FC(dx,
+#if (NDIM == 2)
+                                 patch_lower(0),
+                                 patch_upper(0),
+                                 patch_lower(1),
+                                 patch_upper(1),
+                                 u_ADV_data_gcw(0),
+                                 u_ADV_data_gcw(1),
+                                 q_extrap_data_gcw(0),
+                                 q_extrap_data_gcw(1),
+                                 u_ADV_data->getPointer(0),
+                                 u_ADV_data->getPointer(1),
+                                 q_extrap_data->getPointer(0, q_depth_offset + d),
+                                 q_extrap_data->getPointer(1, q_depth_offset + d),
+                                 N_data_gcw(0),
+                                 N_data_gcw(1),
+#endif
+#if (NDIM == 3)
+                                 patch_lower(0),
+                                 patch_upper(0),
+                                 patch_lower(1),
+                                 patch_upper(1),
+                                 patch_lower(2),
+                                 patch_upper(2),
+                                 u_ADV_data_gcw(0),
+                                 u_ADV_data_gcw(1),
+                                 u_ADV_data_gcw(2),
+                                 q_extrap_data_gcw(0),
+                                 q_extrap_data_gcw(1),
+                                 q_extrap_data_gcw(2),
+                                 u_ADV_data->getPointer(0),
+                                 u_ADV_data->getPointer(1),
+                                 u_ADV_data->getPointer(2),
+                                 q_extrap_data->getPointer(0, q_depth_offset + d),
+                                 q_extrap_data->getPointer(1, q_depth_offset + d),
+                                 q_extrap_data->getPointer(2, q_depth_offset + d),
+                                 N_data_gcw(0),
+                                 N_data_gcw(1),
+                                 N_data_gcw(2),
+#endif
+                                 N_data->getPointer(d));
+        }
+    }
+
+    if (d_difference_form == CONSERVATIVE)
+    {
+        Pointer<FaceData<NDIM, double> > q_flux_data = patch->getPatchData(q_flux_idx);
+        const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
+        for (int d = 0; d < N_depth; ++d)
+        {
+            static const double alpha = 1.0;
+            F_TO_C_DIV_FC(N_data->getPointer(d),
+                          N_data_gcw.min(),
+                          alpha,
+#if (NDIM == 2)
+                          q_flux_data->getPointer(0, q_depth_offset + d),
+                          q_flux_data->getPointer(1, q_depth_offset + d),
+                          q_flux_data_gcw.min(),
+                          patch_lower(0),
+                          patch_upper(0),
+                          patch_lower(1),
+                          patch_upper(1),
+#endif
+#if (NDIM == 3)
+                          q_flux_data->getPointer(0, q_depth_offset + d),
+                          q_flux_data->getPointer(1, q_depth_offset + d),
+                          q_flux_data->getPointer(2, q_depth_offset + d),
+                          q_flux_data_gcw.min(),
+                          patch_lower(0),
+                          patch_upper(0),
+                          patch_lower(1),
+                          patch_upper(1),
+                          patch_lower(2),
+                          patch_upper(2),
+#endif
+                          dx);
+        }
+    }
+
+    if (d_difference_form == SKEW_SYMMETRIC)
+    {
+        Pointer<FaceData<NDIM, double> > q_flux_data = patch->getPatchData(q_flux_idx);
+        const IntVector<NDIM>& q_flux_data_gcw = q_flux_data->getGhostCellWidth();
+        for (int d = 0; d < N_depth; ++d)
+        {
+            static const double alpha = 0.5;
+            static const double beta = 0.5;
+            F_TO_C_DIV_ADD_FC(N_data->getPointer(d),
+                              N_data_gcw.min(),
+                              alpha,
+#if (NDIM == 2)
+                              q_flux_data->getPointer(0, q_depth_offset + d),
+                              q_flux_data->getPointer(1, q_depth_offset + d),
+                              q_flux_data_gcw.min(),
+                              beta,
+                              N_data->getPointer(d),
+                              N_data_gcw.min(),
+                              patch_lower(0),
+                              patch_upper(0),
+                              patch_lower(1),
+                              patch_upper(1),
+#endif
+#if (NDIM == 3)
+                              q_flux_data->getPointer(0, q_depth_offset + d),
+                              q_flux_data->getPointer(1, q_depth_offset + d),
+                              q_flux_data->getPointer(2, q_depth_offset + d),
+                              q_flux_data_gcw.min(),
+                              beta,
+                              N_data->getPointer(d),
+                              N_data_gcw.min(),
+                              patch_lower(0),
+                              patch_upper(0),
+                              patch_lower(1),
+                              patch_upper(1),
+                              patch_lower(2),
+                              patch_upper(2),
+#endif
+                              dx);
+        }
+    }
+    return;
+} // differenceFaceValues
+
+void
+AdvDiffPPMConvectiveOperator::initializeBatchState(const int num_quantities)
+{
+    if (num_quantities == d_batch_num_quantities && !d_batch_ghostfill_scheds.empty()) return;
+    d_batch_num_quantities = num_quantities;
+
+    // Lookup or register the packed scratch variables.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<VariableContext> context = var_db->getContext(d_object_name + "::CONTEXT");
+    const int batch_depth = num_quantities * d_Q_data_depth;
+    std::ostringstream batch_name_stream;
+    batch_name_stream << d_object_name << "::batch_" << num_quantities;
+    const std::string batch_name = batch_name_stream.str();
+
+    Pointer<CellVariable<NDIM, double> > Q_batch_var = var_db->getVariable(batch_name + "::Q");
+    if (Q_batch_var)
+    {
+        d_Q_batch_scratch_idx = var_db->mapVariableAndContextToIndex(Q_batch_var, context);
+    }
+    else
+    {
+        Q_batch_var = new CellVariable<NDIM, double>(batch_name + "::Q", batch_depth);
+        d_Q_batch_scratch_idx = var_db->registerVariableAndContext(Q_batch_var, context, GADVECTG);
+    }
+    Pointer<FaceVariable<NDIM, double> > q_batch_extrap_var = var_db->getVariable(batch_name + "::q_extrap");
+    if (q_batch_extrap_var)
+    {
+        d_q_batch_extrap_idx = var_db->mapVariableAndContextToIndex(q_batch_extrap_var, context);
+    }
+    else
+    {
+        q_batch_extrap_var = new FaceVariable<NDIM, double>(batch_name + "::q_extrap", batch_depth);
+        d_q_batch_extrap_idx = var_db->registerVariableAndContext(q_batch_extrap_var, context, IntVector<NDIM>(0));
+    }
+    Pointer<FaceVariable<NDIM, double> > q_batch_flux_var = var_db->getVariable(batch_name + "::q_flux");
+    if (q_batch_flux_var)
+    {
+        d_q_batch_flux_idx = var_db->mapVariableAndContextToIndex(q_batch_flux_var, context);
+    }
+    else
+    {
+        q_batch_flux_var = new FaceVariable<NDIM, double>(batch_name + "::q_flux", batch_depth);
+        d_q_batch_flux_idx = var_db->registerVariableAndContext(q_batch_flux_var, context, IntVector<NDIM>(0));
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_Q_batch_scratch_idx >= 0);
+    TBOX_ASSERT(d_q_batch_extrap_idx >= 0);
+    TBOX_ASSERT(d_q_batch_flux_idx >= 0);
+#endif
+
+    // Setup the coarsen algorithm and schedules.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    Pointer<CoarsenOperator<NDIM> > coarsen_op = grid_geom->lookupCoarsenOperator(d_q_flux_var, "CONSERVATIVE_COARSEN");
+    Pointer<CoarsenAlgorithm<NDIM> > coarsen_alg = new CoarsenAlgorithm<NDIM>();
+    if (d_difference_form == ADVECTIVE || d_difference_form == SKEW_SYMMETRIC)
+        coarsen_alg->registerCoarsen(d_q_batch_extrap_idx, d_q_batch_extrap_idx, coarsen_op);
+    if (d_difference_form == CONSERVATIVE || d_difference_form == SKEW_SYMMETRIC)
+        coarsen_alg->registerCoarsen(d_q_batch_flux_idx, d_q_batch_flux_idx, coarsen_op);
+    d_batch_coarsen_scheds.resize(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln + 1; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        Pointer<PatchLevel<NDIM> > coarser_level = d_hierarchy->getPatchLevel(ln - 1);
+        d_batch_coarsen_scheds[ln] = coarsen_alg->createSchedule(coarser_level, level);
+    }
+
+    // Setup the refine algorithm and schedules.  The packed data are filled in
+    // the interiors of all patches prior to filling ghost cell values, so the
+    // packed data serve as their own source data.
+    Pointer<RefineOperator<NDIM> > refine_op = grid_geom->lookupRefineOperator(d_Q_var, "CONSERVATIVE_LINEAR_REFINE");
+    Pointer<RefineAlgorithm<NDIM> > refine_alg = new RefineAlgorithm<NDIM>();
+    refine_alg->registerRefine(d_Q_batch_scratch_idx, d_Q_batch_scratch_idx, d_Q_batch_scratch_idx, refine_op);
+    d_batch_ghostfill_strategy.setNull();
+    if (d_outflow_bdry_extrap_type != "NONE")
+        d_batch_ghostfill_strategy = new CartExtrapPhysBdryOp(d_Q_batch_scratch_idx, d_outflow_bdry_extrap_type);
+    d_batch_ghostfill_scheds.resize(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        d_batch_ghostfill_scheds[ln] = refine_alg->createSchedule(level, ln - 1, d_hierarchy, d_batch_ghostfill_strategy);
+    }
+    return;
+} // initializeBatchState
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
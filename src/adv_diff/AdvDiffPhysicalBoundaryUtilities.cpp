@@ -160,6 +160,13 @@ AdvDiffPhysicalBoundaryUtilities::setPhysicalBoundaryConditions(Pointer<CellData
             }
         }
     }
+
+    // Reset any extended Robin BC coef objects.
+    for (int depth = 0; depth < Q_data->getDepth(); ++depth)
+    {
+        ExtendedRobinBcCoefStrategy* extended_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(bc_coefs[depth]);
+        if (extended_bc_coef) extended_bc_coef->setHomogeneousBc(false);
+    }
     return;
 } // setPhysicalBoundaryConditions
 
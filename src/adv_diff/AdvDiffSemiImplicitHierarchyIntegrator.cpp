@@ -38,6 +38,7 @@
 #include <map>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -45,6 +46,7 @@
 #include "BasePatchHierarchy.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
+#include "CellData.h"
 #include "CellDataFactory.h"
 #include "CellVariable.h"
 #include "FaceData.h"
@@ -61,20 +63,26 @@
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
 #include "SideVariable.h"
 #include "Variable.h"
 #include "VariableContext.h"
 #include "VariableDatabase.h"
 #include "ibamr/AdvDiffConvectiveOperatorManager.h"
 #include "ibamr/AdvDiffHierarchyIntegrator.h"
+#include "ibamr/AdvDiffPPMConvectiveOperator.h"
 #include "ibamr/AdvDiffSemiImplicitHierarchyIntegrator.h"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/CCLaplaceOperator.h"
+#include "ibtk/CCPoissonSolverManager.h"
 #include "ibtk/CartGridFunction.h"
+#include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LaplaceOperator.h"
 #include "ibtk/PoissonSolver.h"
+#include "ibtk/muParserCartGridFunction.h"
 #include "tbox/Database.h"
 #include "tbox/MathUtilities.h"
 #include "tbox/MemoryDatabase.h"
@@ -111,6 +119,18 @@ namespace IBAMR
 // Number of ghosts cells used for each variable quantity.
 static const int CELLG = 1;
 
+namespace
+{
+// Indicates whether the function is known not to depend on time, so that data
+// that it has already set need not be re-evaluated at later times.
+inline bool
+is_time_independent(Pointer<CartGridFunction> fcn)
+{
+    Pointer<muParserCartGridFunction> parser_fcn = fcn;
+    return parser_fcn && !parser_fcn->usesTimeVariable();
+} // is_time_independent
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(const std::string& object_name,
@@ -127,6 +147,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::AdvDiffSemiImplicitHierarchyIntegrator(c
     d_default_init_convective_time_stepping_type = MIDPOINT_RULE;
     d_default_convective_op_type = AdvDiffConvectiveOperatorManager::DEFAULT;
     d_default_convective_op_input_db = new MemoryDatabase(d_object_name + "::default_convective_op_input_db");
+    d_batch_helmholtz_solves = false;
+    d_batch_convective_ops = false;
 
     // Initialize object with data read from the input and restart databases.
     bool from_restart = RestartManager::getManager()->isFromRestart();
@@ -413,11 +435,13 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
     // Register variables using the default variable registration routine.
     AdvDiffHierarchyIntegrator::registerVariables();
 
-    // Setup the convective operators.
-    for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
-         ++cit)
+    // Setup the convective operators, keeping track of which operators were
+    // provided by the user.
+    std::vector<bool> Q_has_custom_convective_op(d_Q_var.size(), false);
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
     {
-        Pointer<CellVariable<NDIM, double> > Q_var = *cit;
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[l];
+        Q_has_custom_convective_op[l] = !d_Q_convective_op[Q_var].isNull();
         getConvectiveOperator(Q_var);
     }
 
@@ -450,10 +474,24 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
                          "CONSERVATIVE_LINEAR_REFINE");
     }
 
+    // Determine which quantities use Helmholtz solvers or RHS operators that
+    // were provided by the user.  Default solvers and operators are allocated
+    // during the common initialization operations below.
+    std::vector<bool> Q_has_custom_helmholtz_ops(d_Q_var.size(), false);
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
+    {
+        Q_has_custom_helmholtz_ops[l] = (l < d_helmholtz_solvers.size() && d_helmholtz_solvers[l]) ||
+                                        (l < d_helmholtz_rhs_ops.size() && d_helmholtz_rhs_ops[l]);
+    }
+
     // Perform hierarchy initialization operations common to all implementations
     // of AdvDiffHierarchyIntegrator.
     AdvDiffHierarchyIntegrator::initializeHierarchyIntegrator(hierarchy, gridding_alg);
 
+    // Determine which quantities may be solved for together.
+    setupHelmholtzBatches(Q_has_custom_helmholtz_ops);
+    setupConvectiveBatches(Q_has_custom_convective_op);
+
     // Indicate that the integrator has been initialized.
     d_integrator_is_initialized = true;
     return;
@@ -501,6 +539,8 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
     {
         std::fill(d_helmholtz_solvers_need_init.begin(), d_helmholtz_solvers_need_init.end(), true);
         std::fill(d_helmholtz_rhs_ops_need_init.begin(), d_helmholtz_rhs_ops_need_init.end(), true);
+        std::fill(d_helmholtz_batch_solvers_need_init.begin(), d_helmholtz_batch_solvers_need_init.end(), true);
+        std::fill(d_helmholtz_batch_rhs_ops_need_init.begin(), d_helmholtz_batch_rhs_ops_need_init.end(), true);
         d_coarsest_reset_ln = 0;
         d_finest_reset_ln = finest_ln;
     }
@@ -523,8 +563,20 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
         if (d_u_fcn[u_var])
         {
-            d_u_fcn[u_var]->setDataOnPatchHierarchy(u_current_idx, u_var, d_hierarchy, current_time);
-            d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
+            const bool time_independent = is_time_independent(d_u_fcn[u_var]);
+            if (!time_independent || !d_fcn_data_is_current[u_var])
+            {
+                d_u_fcn[u_var]->setDataOnPatchHierarchy(u_current_idx, u_var, d_hierarchy, current_time);
+                d_fcn_data_is_current[u_var] = time_independent;
+            }
+            if (time_independent)
+            {
+                d_hier_fc_data_ops->copyData(u_new_idx, u_current_idx);
+            }
+            else
+            {
+                d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
+            }
         }
         else
         {
@@ -543,7 +595,136 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         if (D_fcn)
         {
             const int D_current_idx = var_db->mapVariableAndContextToIndex(D_var, getCurrentContext());
-            D_fcn->setDataOnPatchHierarchy(D_current_idx, D_var, d_hierarchy, current_time);
+            const bool time_independent = is_time_independent(D_fcn);
+            if (!time_independent || !d_fcn_data_is_current[D_var])
+            {
+                D_fcn->setDataOnPatchHierarchy(D_current_idx, D_var, d_hierarchy, current_time);
+                d_fcn_data_is_current[D_var] = time_independent;
+            }
+
+            // Carry the coefficient over to the new data, which becomes the
+            // current data at the end of the time step.
+            if (time_independent)
+            {
+                const int D_new_idx = var_db->mapVariableAndContextToIndex(D_var, getNewContext());
+                d_hier_sc_data_ops->copyData(D_new_idx, D_current_idx, /*interior_only*/ false);
+            }
+        }
+    }
+
+    // Set the current values of forcing terms that do not depend on time.  The
+    // new values computed in integrateHierarchy() are copied from these data.
+    for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_F_var.begin(); cit != d_F_var.end();
+         ++cit)
+    {
+        Pointer<CellVariable<NDIM, double> > F_var = *cit;
+        Pointer<CartGridFunction> F_fcn = d_F_fcn[F_var];
+        if (is_time_independent(F_fcn) && !d_fcn_data_is_current[F_var])
+        {
+            const int F_current_idx = var_db->mapVariableAndContextToIndex(F_var, getCurrentContext());
+            F_fcn->setDataOnPatchHierarchy(F_current_idx, F_var, d_hierarchy, current_time);
+            d_fcn_data_is_current[F_var] = true;
+        }
+    }
+
+    // Setup the batched operators and solvers and compute the right-hand-side
+    // terms for the quantities that are solved for together.
+    for (unsigned int batch = 0; batch < d_helmholtz_batch_Q_idxs.size(); ++batch)
+    {
+        const std::vector<unsigned int>& Q_idxs = d_helmholtz_batch_Q_idxs[batch];
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[Q_idxs[0]];
+        Pointer<CellVariable<NDIM, double> > Q_batch_var = d_helmholtz_batch_Q_var[batch];
+        const int Q_batch_scratch_idx = var_db->mapVariableAndContextToIndex(Q_batch_var, getScratchContext());
+        const int Q_rhs_batch_scratch_idx =
+            var_db->mapVariableAndContextToIndex(d_helmholtz_batch_Q_rhs_var[batch], getScratchContext());
+        const TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
+        const double lambda = d_Q_damping_coef[Q_var];
+        const double kappa = d_Q_diffusion_coef[Q_var];
+#if !defined(NDEBUG)
+        for (unsigned int k = 1; k < Q_idxs.size(); ++k)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_k_var = d_Q_var[Q_idxs[k]];
+            TBOX_ASSERT(d_Q_diffusion_time_stepping_type[Q_k_var] == diffusion_time_stepping_type);
+            TBOX_ASSERT(d_Q_damping_coef[Q_k_var] == lambda);
+            TBOX_ASSERT(d_Q_diffusion_coef[Q_k_var] == kappa);
+        }
+#endif
+
+        // Setup the problem coefficients for the linear solve for Q(n+1).
+        double K = 0.0;
+        switch (diffusion_time_stepping_type)
+        {
+        case BACKWARD_EULER:
+            K = 1.0;
+            break;
+        case FORWARD_EULER:
+            K = 0.0;
+            break;
+        case TRAPEZOIDAL_RULE:
+            K = 0.5;
+            break;
+        default:
+            TBOX_ERROR(d_object_name << "::integrateHierarchy():\n"
+                                     << "  unsupported diffusion time stepping type: "
+                                     << enum_to_string<TimeSteppingType>(diffusion_time_stepping_type)
+                                     << " \n"
+                                     << "  valid choices are: BACKWARD_EULER, FORWARD_EULER, TRAPEZOIDAL_RULE\n");
+        }
+        PoissonSpecifications solver_spec(d_object_name + "::solver_spec::" + Q_batch_var->getName());
+        PoissonSpecifications rhs_op_spec(d_object_name + "::rhs_op_spec::" + Q_batch_var->getName());
+        solver_spec.setCConstant(1.0 / dt + K * lambda);
+        rhs_op_spec.setCConstant(1.0 / dt - (1.0 - K) * lambda);
+        solver_spec.setDConstant(-K * kappa);
+        rhs_op_spec.setDConstant(+(1.0 - K) * kappa);
+
+        // Initialize the RHS operator and compute the RHS vectors.
+        Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_batch_rhs_ops[batch];
+        helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
+        helmholtz_rhs_op->setPhysicalBcCoefs(d_helmholtz_batch_bc_coef[batch]);
+        helmholtz_rhs_op->setHomogeneousBc(false);
+        helmholtz_rhs_op->setSolutionTime(current_time);
+        helmholtz_rhs_op->setTimeInterval(current_time, new_time);
+        if (d_helmholtz_batch_rhs_ops_need_init[batch])
+        {
+            if (d_enable_logging)
+            {
+                plog << d_object_name << ": "
+                     << "Initializing Helmholtz RHS operator for batch number " << batch << "\n";
+            }
+            helmholtz_rhs_op->initializeOperatorState(*d_helmholtz_batch_sol_vecs[batch],
+                                                      *d_helmholtz_batch_rhs_vecs[batch]);
+            d_helmholtz_batch_rhs_ops_need_init[batch] = false;
+        }
+        for (std::vector<unsigned int>::const_iterator it = Q_idxs.begin(); it != Q_idxs.end(); ++it)
+        {
+            const int Q_current_idx = var_db->mapVariableAndContextToIndex(d_Q_var[*it], getCurrentContext());
+            copyHelmholtzBatchData(*it, Q_current_idx, Q_batch_scratch_idx, /*pack*/ true);
+        }
+        helmholtz_rhs_op->apply(*d_helmholtz_batch_sol_vecs[batch], *d_helmholtz_batch_rhs_vecs[batch]);
+        for (std::vector<unsigned int>::const_iterator it = Q_idxs.begin(); it != Q_idxs.end(); ++it)
+        {
+            const int Q_rhs_scratch_idx =
+                var_db->mapVariableAndContextToIndex(d_Q_Q_rhs_map[d_Q_var[*it]], getScratchContext());
+            copyHelmholtzBatchData(*it, Q_rhs_scratch_idx, Q_rhs_batch_scratch_idx, /*pack*/ false);
+        }
+
+        // Initialize the linear solver.
+        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_batch_solvers[batch];
+        helmholtz_solver->setPoissonSpecifications(solver_spec);
+        helmholtz_solver->setPhysicalBcCoefs(d_helmholtz_batch_bc_coef[batch]);
+        helmholtz_solver->setHomogeneousBc(false);
+        helmholtz_solver->setSolutionTime(new_time);
+        helmholtz_solver->setTimeInterval(current_time, new_time);
+        if (d_helmholtz_batch_solvers_need_init[batch])
+        {
+            if (d_enable_logging)
+            {
+                plog << d_object_name << ": "
+                     << "Initializing Helmholtz solvers for batch number " << batch << "\n";
+            }
+            helmholtz_solver->initializeSolverState(*d_helmholtz_batch_sol_vecs[batch],
+                                                    *d_helmholtz_batch_rhs_vecs[batch]);
+            d_helmholtz_batch_solvers_need_init[batch] = false;
         }
     }
 
@@ -559,6 +740,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
         TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
         const double lambda = d_Q_damping_coef[Q_var];
         const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[Q_var];
+        const bool is_batched = d_Q_helmholtz_batch[l] >= 0;
 
         const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
         const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
@@ -609,42 +791,49 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
             rhs_op_spec.setDConstant(+(1.0 - K) * kappa);
         }
 
-        // Initialize the RHS operator and compute the RHS vector.
-        Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
-        helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
-        helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
-        helmholtz_rhs_op->setHomogeneousBc(false);
-        helmholtz_rhs_op->setSolutionTime(current_time);
-        helmholtz_rhs_op->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_rhs_ops_need_init[l])
+        // Initialize the RHS operator and compute the RHS vector.  For batched
+        // quantities, this has already been done above.
+        d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
+        if (!is_batched)
         {
-            if (d_enable_logging)
+            Pointer<LaplaceOperator> helmholtz_rhs_op = d_helmholtz_rhs_ops[l];
+            helmholtz_rhs_op->setPoissonSpecifications(rhs_op_spec);
+            helmholtz_rhs_op->setPhysicalBcCoefs(Q_bc_coef);
+            helmholtz_rhs_op->setHomogeneousBc(false);
+            helmholtz_rhs_op->setSolutionTime(current_time);
+            helmholtz_rhs_op->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_rhs_ops_need_init[l])
             {
-                plog << d_object_name << ": "
-                     << "Initializing Helmholtz RHS operator for variable number " << l << "\n";
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz RHS operator for variable number " << l << "\n";
+                }
+                helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_rhs_ops_need_init[l] = false;
             }
-            helmholtz_rhs_op->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_rhs_ops_need_init[l] = false;
+            helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
         }
-        d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx, false);
-        helmholtz_rhs_op->apply(*d_sol_vecs[l], *d_rhs_vecs[l]);
 
         // Initialize the linear solver.
-        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
-        helmholtz_solver->setPoissonSpecifications(solver_spec);
-        helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
-        helmholtz_solver->setHomogeneousBc(false);
-        helmholtz_solver->setSolutionTime(new_time);
-        helmholtz_solver->setTimeInterval(current_time, new_time);
-        if (d_helmholtz_solvers_need_init[l])
+        if (!is_batched)
         {
-            if (d_enable_logging)
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            helmholtz_solver->setPoissonSpecifications(solver_spec);
+            helmholtz_solver->setPhysicalBcCoefs(Q_bc_coef);
+            helmholtz_solver->setHomogeneousBc(false);
+            helmholtz_solver->setSolutionTime(new_time);
+            helmholtz_solver->setTimeInterval(current_time, new_time);
+            if (d_helmholtz_solvers_need_init[l])
             {
-                plog << d_object_name << ": "
-                     << "Initializing Helmholtz solvers for variable number " << l << "\n";
+                if (d_enable_logging)
+                {
+                    plog << d_object_name << ": "
+                         << "Initializing Helmholtz solvers for variable number " << l << "\n";
+                }
+                helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                d_helmholtz_solvers_need_init[l] = false;
             }
-            helmholtz_solver->initializeSolverState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-            d_helmholtz_solvers_need_init[l] = false;
         }
 
         // Account for the convective difference term.
@@ -669,19 +858,29 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
                                          << num_cycles
                                          << "\n");
             }
-            if (d_Q_convective_op_needs_init[Q_var])
+
+            // The convective terms of batched quantities are all evaluated when
+            // the first quantity in the batch is processed.
+            const std::vector<unsigned int> convective_Q_idxs = getConvectiveBatchQuantities(l);
+            if (!convective_Q_idxs.empty())
             {
-                d_Q_convective_op[Q_var]->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
-                d_Q_convective_op_needs_init[Q_var] = false;
+                if (d_Q_convective_op_needs_init[Q_var])
+                {
+                    d_Q_convective_op[Q_var]->initializeOperatorState(*d_sol_vecs[l], *d_rhs_vecs[l]);
+                    d_Q_convective_op_needs_init[Q_var] = false;
+                }
+                for (std::vector<unsigned int>::const_iterator it = convective_Q_idxs.begin();
+                     it != convective_Q_idxs.end();
+                     ++it)
+                {
+                    const int Q_k_current_idx = var_db->mapVariableAndContextToIndex(d_Q_var[*it], getCurrentContext());
+                    const int Q_k_scratch_idx = var_db->mapVariableAndContextToIndex(d_Q_var[*it], getScratchContext());
+                    d_hier_cc_data_ops->copyData(Q_k_scratch_idx, Q_k_current_idx);
+                }
+                const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
+                applyConvectiveOperators(convective_Q_idxs, u_current_idx, current_time);
             }
-            const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
-            d_Q_convective_op[Q_var]->setAdvectionVelocity(u_current_idx);
-            const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
-            const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
             const int N_scratch_idx = var_db->mapVariableAndContextToIndex(N_var, getScratchContext());
-            d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx);
-            d_Q_convective_op[Q_var]->setSolutionTime(current_time);
-            d_Q_convective_op[Q_var]->applyConvectiveOperator(Q_scratch_idx, N_scratch_idx);
             const int N_old_new_idx = var_db->mapVariableAndContextToIndex(N_old_var, getNewContext());
             d_hier_cc_data_ops->copyData(N_old_new_idx, N_scratch_idx);
             if (convective_time_stepping_type == FORWARD_EULER)
@@ -752,7 +951,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
                 const int u_current_idx = var_db->mapVariableAndContextToIndex(u_var, getCurrentContext());
                 const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
                 const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
-                if (d_u_fcn[u_var])
+                if (d_u_fcn[u_var] && !is_time_independent(d_u_fcn[u_var]))
                 {
                     d_u_fcn[u_var]->setDataOnPatchHierarchy(u_new_idx, u_var, d_hierarchy, new_time);
                 }
@@ -798,28 +997,37 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
                 }
             }
             const int N_scratch_idx = var_db->mapVariableAndContextToIndex(N_var, getScratchContext());
-            if (cycle_num > 0)
+            const std::vector<unsigned int> convective_Q_idxs = getConvectiveBatchQuantities(l);
+            if (cycle_num > 0 && !convective_Q_idxs.empty())
             {
                 if (convective_time_stepping_type == MIDPOINT_RULE)
                 {
+                    for (std::vector<unsigned int>::const_iterator it = convective_Q_idxs.begin();
+                         it != convective_Q_idxs.end();
+                         ++it)
+                    {
+                        Pointer<CellVariable<NDIM, double> > Q_k_var = d_Q_var[*it];
+                        const int Q_k_current_idx = var_db->mapVariableAndContextToIndex(Q_k_var, getCurrentContext());
+                        const int Q_k_scratch_idx = var_db->mapVariableAndContextToIndex(Q_k_var, getScratchContext());
+                        const int Q_k_new_idx = var_db->mapVariableAndContextToIndex(Q_k_var, getNewContext());
+                        d_hier_cc_data_ops->linearSum(Q_k_scratch_idx, 0.5, Q_k_current_idx, 0.5, Q_k_new_idx);
+                    }
                     const int u_scratch_idx = var_db->mapVariableAndContextToIndex(u_var, getScratchContext());
-                    d_Q_convective_op[Q_var]->setAdvectionVelocity(u_scratch_idx);
-                    const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
-                    const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
-                    const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
-                    d_hier_cc_data_ops->linearSum(Q_scratch_idx, 0.5, Q_current_idx, 0.5, Q_new_idx);
-                    d_Q_convective_op[Q_var]->setSolutionTime(half_time);
-                    d_Q_convective_op[Q_var]->applyConvectiveOperator(Q_scratch_idx, N_scratch_idx);
+                    applyConvectiveOperators(convective_Q_idxs, u_scratch_idx, half_time);
                 }
                 else if (convective_time_stepping_type == TRAPEZOIDAL_RULE)
                 {
+                    for (std::vector<unsigned int>::const_iterator it = convective_Q_idxs.begin();
+                         it != convective_Q_idxs.end();
+                         ++it)
+                    {
+                        Pointer<CellVariable<NDIM, double> > Q_k_var = d_Q_var[*it];
+                        const int Q_k_scratch_idx = var_db->mapVariableAndContextToIndex(Q_k_var, getScratchContext());
+                        const int Q_k_new_idx = var_db->mapVariableAndContextToIndex(Q_k_var, getNewContext());
+                        d_hier_cc_data_ops->copyData(Q_k_scratch_idx, Q_k_new_idx);
+                    }
                     const int u_new_idx = var_db->mapVariableAndContextToIndex(u_var, getNewContext());
-                    d_Q_convective_op[Q_var]->setAdvectionVelocity(u_new_idx);
-                    const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
-                    const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
-                    d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_new_idx);
-                    d_Q_convective_op[Q_var]->setSolutionTime(new_time);
-                    d_Q_convective_op[Q_var]->applyConvectiveOperator(Q_scratch_idx, N_scratch_idx);
+                    applyConvectiveOperators(convective_Q_idxs, u_new_idx, new_time);
                 }
             }
             if (convective_time_stepping_type == ADAMS_BASHFORTH)
@@ -845,24 +1053,48 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
         // Account for forcing terms.
         if (d_F_fcn[F_var])
         {
-            d_F_fcn[F_var]->setDataOnPatchHierarchy(F_scratch_idx, F_var, d_hierarchy, half_time);
+            if (is_time_independent(d_F_fcn[F_var]))
+            {
+                const int F_current_idx = var_db->mapVariableAndContextToIndex(F_var, getCurrentContext());
+                d_hier_cc_data_ops->copyData(F_scratch_idx, F_current_idx);
+            }
+            else
+            {
+                d_F_fcn[F_var]->setDataOnPatchHierarchy(F_scratch_idx, F_var, d_hierarchy, half_time);
+            }
             d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, 1.0, F_scratch_idx, Q_rhs_scratch_idx);
         }
 
-        // Solve for Q(n+1).
-        Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
-        helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
-        d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
-        if (d_enable_logging)
-            plog << d_object_name << "::integrateHierarchy(): diffusion solve number of iterations = "
-                 << helmholtz_solver->getNumIterations() << "\n";
-        if (d_enable_logging)
-            plog << d_object_name << "::integrateHierarchy(): diffusion solve residual norm        = "
-                 << helmholtz_solver->getResidualNorm() << "\n";
-        if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
+        // Solve for Q(n+1).  Batched quantities are packed into the batch
+        // variables, and the batch is solved for once its last quantity has
+        // been packed.
+        const int batch = d_Q_helmholtz_batch[l];
+        if (batch >= 0)
         {
-            pout << d_object_name << "::integrateHierarchy():"
-                 << "  WARNING: linear solver iterations == max iterations\n";
+            const int Q_batch_scratch_idx =
+                var_db->mapVariableAndContextToIndex(d_helmholtz_batch_Q_var[batch], getScratchContext());
+            const int Q_rhs_batch_scratch_idx =
+                var_db->mapVariableAndContextToIndex(d_helmholtz_batch_Q_rhs_var[batch], getScratchContext());
+            copyHelmholtzBatchData(l, Q_scratch_idx, Q_batch_scratch_idx, /*pack*/ true);
+            copyHelmholtzBatchData(l, Q_rhs_scratch_idx, Q_rhs_batch_scratch_idx, /*pack*/ true);
+            if (l == d_helmholtz_batch_Q_idxs[batch].back()) solveHelmholtzBatch(batch);
+        }
+        else
+        {
+            Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_solvers[l];
+            helmholtz_solver->solveSystem(*d_sol_vecs[l], *d_rhs_vecs[l]);
+            d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
+            if (d_enable_logging)
+                plog << d_object_name << "::integrateHierarchy(): diffusion solve number of iterations = "
+                     << helmholtz_solver->getNumIterations() << "\n";
+            if (d_enable_logging)
+                plog << d_object_name << "::integrateHierarchy(): diffusion solve residual norm        = "
+                     << helmholtz_solver->getResidualNorm() << "\n";
+            if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
+            {
+                pout << d_object_name << "::integrateHierarchy():"
+                     << "  WARNING: linear solver iterations == max iterations\n";
+            }
         }
 
         // Reset the right-hand side vector.
@@ -955,7 +1187,31 @@ AdvDiffSemiImplicitHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
         Pointer<CellVariable<NDIM, double> > Q_var = *cit;
         d_Q_convective_op_needs_init[Q_var] = true;
     }
+    d_fcn_data_is_current.clear();
     AdvDiffHierarchyIntegrator::resetHierarchyConfigurationSpecialized(base_hierarchy, coarsest_level, finest_level);
+
+    // Reset the batched solution and rhs vectors.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int wgt_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
+    const unsigned int num_batches = d_helmholtz_batch_Q_idxs.size();
+    d_helmholtz_batch_sol_vecs.resize(num_batches);
+    d_helmholtz_batch_rhs_vecs.resize(num_batches);
+    for (unsigned int batch = 0; batch < num_batches; ++batch)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_batch_var = d_helmholtz_batch_Q_var[batch];
+        Pointer<CellVariable<NDIM, double> > Q_rhs_batch_var = d_helmholtz_batch_Q_rhs_var[batch];
+        const int Q_batch_scratch_idx = var_db->mapVariableAndContextToIndex(Q_batch_var, getScratchContext());
+        const int Q_rhs_batch_scratch_idx = var_db->mapVariableAndContextToIndex(Q_rhs_batch_var, getScratchContext());
+        d_helmholtz_batch_sol_vecs[batch] = new SAMRAIVectorReal<NDIM, double>(
+            d_object_name + "::sol_vec::" + Q_batch_var->getName(), d_hierarchy, 0, finest_hier_level);
+        d_helmholtz_batch_sol_vecs[batch]->addComponent(Q_batch_var, Q_batch_scratch_idx, wgt_idx, d_hier_cc_data_ops);
+        d_helmholtz_batch_rhs_vecs[batch] = new SAMRAIVectorReal<NDIM, double>(
+            d_object_name + "::rhs_vec::" + Q_batch_var->getName(), d_hierarchy, 0, finest_hier_level);
+        d_helmholtz_batch_rhs_vecs[batch]->addComponent(
+            Q_rhs_batch_var, Q_rhs_batch_scratch_idx, wgt_idx, d_hier_cc_data_ops);
+    }
+    std::fill(d_helmholtz_batch_solvers_need_init.begin(), d_helmholtz_batch_solvers_need_init.end(), true);
+    std::fill(d_helmholtz_batch_rhs_ops_need_init.begin(), d_helmholtz_batch_rhs_ops_need_init.end(), true);
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -973,6 +1229,272 @@ AdvDiffSemiImplicitHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Databas
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+AdvDiffSemiImplicitHierarchyIntegrator::setupHelmholtzBatches(const std::vector<bool>& Q_has_custom_helmholtz_ops)
+{
+    d_Q_helmholtz_batch.assign(d_Q_var.size(), -1);
+    d_Q_helmholtz_batch_depth_offset.assign(d_Q_var.size(), 0);
+    d_helmholtz_batch_Q_idxs.clear();
+    if (!d_batch_helmholtz_solves) return;
+
+    // Group together consecutive quantities with constant diffusion
+    // coefficients that have identical Helmholtz operators.  Only consecutive
+    // quantities are grouped, so that the quantities are still solved for in the
+    // order in which they were registered.  Quantities with user-provided
+    // solvers or RHS operators are always solved for individually.
+    std::vector<std::vector<unsigned int> > groups;
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[l];
+        if (Q_has_custom_helmholtz_ops[l]) continue;
+        if (isDiffusionCoefficientVariable(Q_var)) continue;
+        const TimeSteppingType diffusion_time_stepping_type = d_Q_diffusion_time_stepping_type[Q_var];
+        if (diffusion_time_stepping_type != BACKWARD_EULER && diffusion_time_stepping_type != FORWARD_EULER &&
+            diffusion_time_stepping_type != TRAPEZOIDAL_RULE)
+        {
+            continue;
+        }
+        bool joins_group = false;
+        if (!groups.empty() && groups.back().back() + 1 == l)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_group_var = d_Q_var[groups.back().front()];
+            joins_group = d_Q_diffusion_time_stepping_type[Q_group_var] == diffusion_time_stepping_type &&
+                          d_Q_diffusion_coef[Q_group_var] == d_Q_diffusion_coef[Q_var] &&
+                          d_Q_damping_coef[Q_group_var] == d_Q_damping_coef[Q_var];
+        }
+        if (joins_group)
+        {
+            groups.back().push_back(l);
+        }
+        else
+        {
+            groups.push_back(std::vector<unsigned int>(1, l));
+        }
+    }
+
+    // Setup the packed variables, operators, and solvers for each group
+    // containing more than one quantity.
+    const IntVector<NDIM> cell_ghosts = CELLG;
+    for (std::vector<std::vector<unsigned int> >::const_iterator it = groups.begin(); it != groups.end(); ++it)
+    {
+        if (it->size() < 2) continue;
+        const int batch = static_cast<int>(d_helmholtz_batch_Q_idxs.size());
+        d_helmholtz_batch_Q_idxs.push_back(*it);
+        int batch_depth = 0;
+        std::vector<RobinBcCoefStrategy<NDIM>*> batch_bc_coef;
+        for (std::vector<unsigned int>::const_iterator l_it = it->begin(); l_it != it->end(); ++l_it)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[*l_it];
+            Pointer<CellDataFactory<NDIM, double> > Q_factory = Q_var->getPatchDataFactory();
+            d_Q_helmholtz_batch[*l_it] = batch;
+            d_Q_helmholtz_batch_depth_offset[*l_it] = batch_depth;
+            batch_depth += Q_factory->getDefaultDepth();
+            const std::vector<RobinBcCoefStrategy<NDIM>*>& Q_bc_coef = d_Q_bc_coef[Q_var];
+            batch_bc_coef.insert(batch_bc_coef.end(), Q_bc_coef.begin(), Q_bc_coef.end());
+        }
+        d_helmholtz_batch_bc_coef.push_back(batch_bc_coef);
+
+        std::ostringstream name_stream;
+        name_stream << d_object_name << "::helmholtz_batch_" << batch;
+        const std::string name = name_stream.str();
+
+        Pointer<CellVariable<NDIM, double> > Q_batch_var = new CellVariable<NDIM, double>(name + "::Q", batch_depth);
+        int Q_batch_scratch_idx;
+        registerVariable(Q_batch_scratch_idx, Q_batch_var, cell_ghosts, getScratchContext());
+        d_helmholtz_batch_Q_var.push_back(Q_batch_var);
+
+        Pointer<CellVariable<NDIM, double> > Q_rhs_batch_var =
+            new CellVariable<NDIM, double>(name + "::Q_rhs", batch_depth);
+        int Q_rhs_batch_scratch_idx;
+        registerVariable(Q_rhs_batch_scratch_idx, Q_rhs_batch_var, cell_ghosts, getScratchContext());
+        d_helmholtz_batch_Q_rhs_var.push_back(Q_rhs_batch_var);
+
+        d_helmholtz_batch_solvers.push_back(
+            CCPoissonSolverManager::getManager()->allocateSolver(d_helmholtz_solver_type,
+                                                                 name + "::helmholtz_solver",
+                                                                 d_helmholtz_solver_db,
+                                                                 "adv_diff_",
+                                                                 d_helmholtz_precond_type,
+                                                                 name + "::helmholtz_precond",
+                                                                 d_helmholtz_precond_db,
+                                                                 "adv_diff_pc_",
+                                                                 d_helmholtz_sub_precond_type,
+                                                                 name + "::helmholtz_sub_precond",
+                                                                 d_helmholtz_sub_precond_db,
+                                                                 "adv_diff_sub_pc_"));
+        d_helmholtz_batch_solvers_need_init.push_back(true);
+        d_helmholtz_batch_rhs_ops.push_back(
+            new CCLaplaceOperator(name + "::helmholtz_rhs_op", /*homogeneous_bc*/ false));
+        d_helmholtz_batch_rhs_ops_need_init.push_back(true);
+    }
+    return;
+} // setupHelmholtzBatches
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::solveHelmholtzBatch(const unsigned int batch)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const std::vector<unsigned int>& Q_idxs = d_helmholtz_batch_Q_idxs[batch];
+    const int Q_batch_scratch_idx =
+        var_db->mapVariableAndContextToIndex(d_helmholtz_batch_Q_var[batch], getScratchContext());
+    Pointer<PoissonSolver> helmholtz_solver = d_helmholtz_batch_solvers[batch];
+    helmholtz_solver->solveSystem(*d_helmholtz_batch_sol_vecs[batch], *d_helmholtz_batch_rhs_vecs[batch]);
+    for (std::vector<unsigned int>::const_iterator it = Q_idxs.begin(); it != Q_idxs.end(); ++it)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[*it];
+        const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
+        const int Q_new_idx = var_db->mapVariableAndContextToIndex(Q_var, getNewContext());
+        copyHelmholtzBatchData(*it, Q_scratch_idx, Q_batch_scratch_idx, /*pack*/ false);
+        d_hier_cc_data_ops->copyData(Q_new_idx, Q_scratch_idx);
+    }
+    if (d_enable_logging)
+        plog << d_object_name << "::integrateHierarchy(): batch " << batch
+             << " diffusion solve number of iterations = " << helmholtz_solver->getNumIterations() << "\n";
+    if (d_enable_logging)
+        plog << d_object_name << "::integrateHierarchy(): batch " << batch
+             << " diffusion solve residual norm        = " << helmholtz_solver->getResidualNorm() << "\n";
+    if (helmholtz_solver->getNumIterations() == helmholtz_solver->getMaxIterations())
+    {
+        pout << d_object_name << "::integrateHierarchy():"
+             << "  WARNING: linear solver iterations == max iterations\n";
+    }
+    return;
+} // solveHelmholtzBatch
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::copyHelmholtzBatchData(const unsigned int l,
+                                                               const int Q_data_idx,
+                                                               const int batch_data_idx,
+                                                               const bool pack)
+{
+    const int depth_offset = d_Q_helmholtz_batch_depth_offset[l];
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > Q_data = patch->getPatchData(Q_data_idx);
+            Pointer<CellData<NDIM, double> > batch_data = patch->getPatchData(batch_data_idx);
+            const int depth = Q_data->getDepth();
+            for (int d = 0; d < depth; ++d)
+            {
+                if (pack)
+                {
+                    batch_data->copyDepth(depth_offset + d, *Q_data, d);
+                }
+                else
+                {
+                    Q_data->copyDepth(d, *batch_data, depth_offset + d);
+                }
+            }
+        }
+    }
+    return;
+} // copyHelmholtzBatchData
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::setupConvectiveBatches(const std::vector<bool>& Q_has_custom_convective_op)
+{
+    d_Q_convective_batch.assign(d_Q_var.size(), -1);
+    d_convective_batch_Q_idxs.clear();
+    if (!d_batch_convective_ops) return;
+
+    // Group together quantities that are advected by the same velocity field
+    // and that use identical PPM convective operators.  Quantities with
+    // user-provided convective operators are always treated individually.
+    std::vector<std::vector<unsigned int> > groups;
+    for (unsigned int l = 0; l < d_Q_var.size(); ++l)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[l];
+        if (Q_has_custom_convective_op[l] || !d_Q_u_map[Q_var]) continue;
+        Pointer<AdvDiffPPMConvectiveOperator> ppm_convective_op = d_Q_convective_op[Q_var];
+        if (!ppm_convective_op) continue;
+        Pointer<CellDataFactory<NDIM, double> > Q_factory = Q_var->getPatchDataFactory();
+        bool found_group = false;
+        for (std::vector<std::vector<unsigned int> >::iterator it = groups.begin(); it != groups.end() && !found_group;
+             ++it)
+        {
+            Pointer<CellVariable<NDIM, double> > Q_group_var = d_Q_var[it->front()];
+            Pointer<CellDataFactory<NDIM, double> > Q_group_factory = Q_group_var->getPatchDataFactory();
+            if (d_Q_u_map[Q_group_var] == d_Q_u_map[Q_var] &&
+                Q_group_factory->getDefaultDepth() == Q_factory->getDefaultDepth() &&
+                d_Q_convective_op_type[Q_group_var] == d_Q_convective_op_type[Q_var] &&
+                d_Q_convective_op_input_db[Q_group_var] == d_Q_convective_op_input_db[Q_var] &&
+                d_Q_difference_form[Q_group_var] == d_Q_difference_form[Q_var] &&
+                d_Q_convective_time_stepping_type[Q_group_var] == d_Q_convective_time_stepping_type[Q_var] &&
+                d_Q_init_convective_time_stepping_type[Q_group_var] == d_Q_init_convective_time_stepping_type[Q_var])
+            {
+                it->push_back(l);
+                found_group = true;
+            }
+        }
+        if (!found_group) groups.push_back(std::vector<unsigned int>(1, l));
+    }
+
+    // Keep the groups containing more than one quantity.
+    for (std::vector<std::vector<unsigned int> >::const_iterator it = groups.begin(); it != groups.end(); ++it)
+    {
+        if (it->size() < 2) continue;
+        const int batch = static_cast<int>(d_convective_batch_Q_idxs.size());
+        d_convective_batch_Q_idxs.push_back(*it);
+        for (std::vector<unsigned int>::const_iterator l_it = it->begin(); l_it != it->end(); ++l_it)
+        {
+            d_Q_convective_batch[*l_it] = batch;
+        }
+    }
+    return;
+} // setupConvectiveBatches
+
+std::vector<unsigned int>
+AdvDiffSemiImplicitHierarchyIntegrator::getConvectiveBatchQuantities(const unsigned int l) const
+{
+    const int batch = d_Q_convective_batch[l];
+    if (batch < 0) return std::vector<unsigned int>(1, l);
+    const std::vector<unsigned int>& Q_idxs = d_convective_batch_Q_idxs[batch];
+    return Q_idxs.front() == l ? Q_idxs : std::vector<unsigned int>();
+} // getConvectiveBatchQuantities
+
+void
+AdvDiffSemiImplicitHierarchyIntegrator::applyConvectiveOperators(const std::vector<unsigned int>& Q_idxs,
+                                                                 const int u_idx,
+                                                                 const double time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!Q_idxs.empty());
+#endif
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<ConvectiveOperator> convective_op = d_Q_convective_op[d_Q_var[Q_idxs.front()]];
+    convective_op->setAdvectionVelocity(u_idx);
+    convective_op->setSolutionTime(time);
+    if (Q_idxs.size() == 1)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[Q_idxs.front()];
+        const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
+        const int N_scratch_idx = var_db->mapVariableAndContextToIndex(d_Q_N_map[Q_var], getScratchContext());
+        convective_op->applyConvectiveOperator(Q_scratch_idx, N_scratch_idx);
+        return;
+    }
+
+    // Evaluate the convective terms for all of the quantities at once.
+    std::vector<int> Q_scratch_idxs, N_scratch_idxs;
+    std::vector<std::vector<RobinBcCoefStrategy<NDIM>*> > Q_bc_coefs;
+    for (std::vector<unsigned int>::const_iterator it = Q_idxs.begin(); it != Q_idxs.end(); ++it)
+    {
+        Pointer<CellVariable<NDIM, double> > Q_var = d_Q_var[*it];
+        Q_scratch_idxs.push_back(var_db->mapVariableAndContextToIndex(Q_var, getScratchContext()));
+        N_scratch_idxs.push_back(var_db->mapVariableAndContextToIndex(d_Q_N_map[Q_var], getScratchContext()));
+        Q_bc_coefs.push_back(d_Q_bc_coef[Q_var]);
+    }
+    Pointer<AdvDiffPPMConvectiveOperator> ppm_convective_op = convective_op;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ppm_convective_op);
+#endif
+    ppm_convective_op->applyConvectiveOperator(Q_scratch_idxs, N_scratch_idxs, Q_bc_coefs);
+    return;
+} // applyConvectiveOperators
+
 void
 AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
 {
@@ -1021,6 +1543,11 @@ AdvDiffSemiImplicitHierarchyIntegrator::getFromInput(Pointer<Database> db, bool
         else if (db->keyExists("default_convective_op_db"))
             d_default_convective_op_input_db = db->getDatabase("default_convective_op_db");
     }
+    if (db->keyExists("batch_helmholtz_solves")) d_batch_helmholtz_solves = db->getBool("batch_helmholtz_solves");
+    if (db->keyExists("batch_convective_operators"))
+        d_batch_convective_ops = db->getBool("batch_convective_operators");
+    else
+        d_batch_convective_ops = d_batch_helmholtz_solves;
     return;
 } // getFromInput
 
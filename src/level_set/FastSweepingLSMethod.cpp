@@ -32,7 +32,11 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <vector>
+
 #include "ibamr/FastSweepingLSMethod.h"
+#include "BoxList.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IBAMR_config.h"
@@ -62,6 +66,19 @@ void FAST_SWEEP_1ST_ORDER_FC(double* U,
 #if (NDIM == 3)
                              const int& ilower2,
                              const int& iupper2,
+#endif
+                             const int& slower0,
+                             const int& supper0,
+                             const int& slower1,
+                             const int& supper1,
+#if (NDIM == 3)
+                             const int& slower2,
+                             const int& supper2,
+#endif
+                             const int& sweep0,
+                             const int& sweep1,
+#if (NDIM == 3)
+                             const int& sweep2,
 #endif
                              const int& dlower0,
                              const int& dupper0,
@@ -83,6 +100,43 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The directions of the fast sweeps.
+#if (NDIM == 2)
+static const int NUM_SWEEPS = 4;
+static const int SWEEP_DIRS[NUM_SWEEPS][NDIM] = { { 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 } };
+#endif
+#if (NDIM == 3)
+static const int NUM_SWEEPS = 8;
+static const int SWEEP_DIRS[NUM_SWEEPS][NDIM] = { { 1, 1, 1 },  { -1, 1, 1 },  { 1, -1, 1 },  { 1, 1, -1 },
+                                                  { -1, -1, 1 }, { -1, 1, -1 }, { 1, -1, -1 }, { -1, -1, -1 } };
+#endif
+
+// Orders boxes in the order in which a sweep in the specified direction visits
+// their cells, with the last coordinate direction varying slowest.  The boxes
+// are assumed to be aligned tiles, as determined by LSInitStrategy.
+struct SweepOrderComparator
+{
+    SweepOrderComparator(const int* sweep_dir) : d_sweep_dir(sweep_dir)
+    {
+        // intentionally blank
+        return;
+    } // SweepOrderComparator
+
+    bool operator()(const Box<NDIM>& lhs, const Box<NDIM>& rhs) const
+    {
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            if (lhs.lower(d) != rhs.lower(d)) return d_sweep_dir[d] * lhs.lower(d) < d_sweep_dir[d] * rhs.lower(d);
+        }
+        return false;
+    } // operator()
+
+    const int* d_sweep_dir;
+};
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(const std::string& object_name,
@@ -157,13 +211,34 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
 
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_idx);
         fill_op->fillData(time);
 
+        // After the first iteration, only the values within the narrow band are
+        // updated and used to check for convergence.  The band is redetermined
+        // every iteration from the current values, so that it can grow across
+        // patch boundaries.
+        if (d_use_narrow_band && outer_iter > 0) updateNarrowBand(D_idx, hierarchy);
+        const bool narrow_band = hasNarrowBand();
+        if (narrow_band)
+        {
+            copyNarrowBandData(D_iter_idx, D_idx, hierarchy);
+        }
+        else
+        {
+            hier_cc_data_ops.copyData(D_iter_idx, D_idx);
+        }
+
         fastSweep(hier_math_ops, D_idx);
 
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        if (narrow_band)
+        {
+            diff_L2_norm = computeNarrowBandDifferenceL2Norm(D_idx, D_iter_idx, cc_wgt_idx, hierarchy);
+        }
+        else
+        {
+            hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
+            diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        }
 
         outer_iter += 1;
 
@@ -191,6 +266,13 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
         }
     }
 
+    // Clamp the values outside of the narrow band.
+    if (d_use_narrow_band)
+    {
+        clampOutsideNarrowBand(D_idx, hierarchy);
+        deallocateNarrowBand();
+    }
+
     // Deallocate the temporary variable.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -218,11 +300,29 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
         TBOX_ASSERT(domain_boxes.size() == 1);
 #endif
 
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
-            fastSweep(dist_data, patch, domain_boxes[0]);
+            const BoxList<NDIM> active_boxes = getActiveBoxes(patch->getBox(), ln, local_patch_num);
+            std::vector<Box<NDIM> > sweep_boxes;
+            for (BoxList<NDIM>::Iterator bl(active_boxes); bl; bl++)
+            {
+                sweep_boxes.push_back(bl());
+            }
+
+            // Complete each directional sweep over all of the active boxes
+            // before starting the next one.
+            for (int sweep = 0; sweep < NUM_SWEEPS; ++sweep)
+            {
+                const int* const sweep_dir = SWEEP_DIRS[sweep];
+                std::sort(sweep_boxes.begin(), sweep_boxes.end(), SweepOrderComparator(sweep_dir));
+                for (std::vector<Box<NDIM> >::const_iterator it = sweep_boxes.begin(); it != sweep_boxes.end(); ++it)
+                {
+                    fastSweep(dist_data, patch, *it, domain_boxes[0], sweep_dir);
+                }
+            }
         }
     }
     return;
@@ -232,7 +332,9 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
 void
 FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
                                 const Pointer<Patch<NDIM> > patch,
-                                const Box<NDIM>& domain_box) const
+                                const Box<NDIM>& box,
+                                const Box<NDIM>& domain_box,
+                                const int* const sweep_dir) const
 {
     double* const D = dist_data->getPointer(0);
     const int D_ghosts = (dist_data->getGhostCellWidth()).max();
@@ -273,6 +375,19 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                 patch_box.lower(2),
                                 patch_box.upper(2),
+#endif
+                                box.lower(0),
+                                box.upper(0),
+                                box.lower(1),
+                                box.upper(1),
+#if (NDIM == 3)
+                                box.lower(2),
+                                box.upper(2),
+#endif
+                                sweep_dir[0],
+                                sweep_dir[1],
+#if (NDIM == 3)
+                                sweep_dir[2],
 #endif
                                 domain_box.lower(0),
                                 domain_box.upper(0),
@@ -319,6 +434,8 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
         d_wall_location_idx[wall_loc_idices[k]] = 1;
     }
 
+    getNarrowBandFromInput(input_db);
+
     return;
 } // getFromInput
 
@@ -32,9 +32,24 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <math.h>
+#include <algorithm>
+
 #include "ibamr/LSInitStrategy.h"
+#include "Box.h"
+#include "BoxList.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "ibamr/namespaces.h"
+#include "tbox/Database.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -42,10 +57,20 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Width of the tiles that comprise the narrow band.
+static const int NARROW_BAND_TILE_WIDTH = 4;
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 LSInitStrategy::LSInitStrategy(const std::string& object_name, bool register_for_restart)
-    : d_object_name(object_name), d_registered_for_restart(register_for_restart)
+    : d_object_name(object_name),
+      d_registered_for_restart(register_for_restart),
+      d_use_narrow_band(false),
+      d_narrow_band_width(6.0),
+      d_narrow_band_boxes()
 {
     // Some default values.
     d_ls_order = FIRST_ORDER_LS;
@@ -94,6 +119,189 @@ void LSInitStrategy::putToDatabase(Pointer<Database> /*db*/)
     return;
 } // putToDatabase
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+LSInitStrategy::getNarrowBandFromInput(Pointer<Database> input_db)
+{
+    d_use_narrow_band = input_db->getBoolWithDefault("use_narrow_band", d_use_narrow_band);
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+    if (d_use_narrow_band && d_narrow_band_width <= 1.0)
+    {
+        TBOX_ERROR(d_object_name << "::getNarrowBandFromInput():\n"
+                                 << "  narrow_band_width must be greater than one grid cell\n"
+                                 << "  narrow_band_width = "
+                                 << d_narrow_band_width
+                                 << std::endl);
+    }
+    return;
+} // getNarrowBandFromInput
+
+void
+LSInitStrategy::updateNarrowBand(const int D_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    const IntVector<NDIM> tile_width(NARROW_BAND_TILE_WIDTH);
+    int num_active_cells = 0, num_cells = 0;
+    d_narrow_band_boxes.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        d_narrow_band_boxes[ln].clear();
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            const Box<NDIM>& patch_box = patch->getBox();
+            const Box<NDIM>& ghost_box = D_data->getGhostBox();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double band_dist = d_narrow_band_width * *std::max_element(dx, dx + NDIM);
+
+            // Keep the tiles that contain or neighbor at least one cell within
+            // the band.  Neighboring cells include ghost cells, so that the band
+            // grows into the patch when the band of an adjacent patch reaches
+            // its boundary.
+            BoxList<NDIM> band_boxes;
+            const Box<NDIM> tile_index_box = Box<NDIM>::coarsen(patch_box, tile_width);
+            for (Box<NDIM>::Iterator t(tile_index_box); t; t++)
+            {
+                const Box<NDIM> tile_box = Box<NDIM>::refine(Box<NDIM>(t(), t()), tile_width) * patch_box;
+                const Box<NDIM> check_box = Box<NDIM>::grow(tile_box, IntVector<NDIM>(1)) * ghost_box;
+                bool tile_is_active = false;
+                for (Box<NDIM>::Iterator b(check_box); b && !tile_is_active; b++)
+                {
+                    tile_is_active = fabs((*D_data)(CellIndex<NDIM>(b()))) < band_dist;
+                }
+                if (tile_is_active)
+                {
+                    band_boxes.appendItem(tile_box);
+                    num_active_cells += tile_box.size();
+                }
+            }
+            d_narrow_band_boxes[ln].push_back(band_boxes);
+            num_cells += patch_box.size();
+        }
+    }
+
+    if (d_enable_logging)
+    {
+        num_active_cells = SAMRAI_MPI::sumReduction(num_active_cells);
+        num_cells = SAMRAI_MPI::sumReduction(num_cells);
+        plog << d_object_name << "::updateNarrowBand(): " << num_active_cells << " of " << num_cells
+             << " cells are in the narrow band" << std::endl;
+    }
+    return;
+} // updateNarrowBand
+
+void
+LSInitStrategy::clampOutsideNarrowBand(const int D_idx, Pointer<PatchHierarchy<NDIM> > hierarchy) const
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const dx = pgeom->getDx();
+            const double band_dist = d_narrow_band_width * *std::max_element(dx, dx + NDIM);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+            {
+                double& D = (*D_data)(CellIndex<NDIM>(b()));
+                if (fabs(D) > band_dist) D = (D > 0.0 ? band_dist : -band_dist);
+            }
+        }
+    }
+    return;
+} // clampOutsideNarrowBand
+
+void
+LSInitStrategy::deallocateNarrowBand()
+{
+    d_narrow_band_boxes.clear();
+    return;
+} // deallocateNarrowBand
+
+bool
+LSInitStrategy::hasNarrowBand() const
+{
+    return !d_narrow_band_boxes.empty();
+} // hasNarrowBand
+
+BoxList<NDIM>
+LSInitStrategy::getActiveBoxes(const Box<NDIM>& patch_box, const int ln, const int local_patch_num) const
+{
+    if (!hasNarrowBand()) return BoxList<NDIM>(patch_box);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(ln < static_cast<int>(d_narrow_band_boxes.size()));
+    TBOX_ASSERT(local_patch_num < static_cast<int>(d_narrow_band_boxes[ln].size()));
+#endif
+    return d_narrow_band_boxes[ln][local_patch_num];
+} // getActiveBoxes
+
+void
+LSInitStrategy::copyNarrowBandData(const int dst_idx, const int src_idx, Pointer<PatchHierarchy<NDIM> > hierarchy) const
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<CellData<NDIM, double> > src_data = patch->getPatchData(src_idx);
+            const BoxList<NDIM> active_boxes = getActiveBoxes(patch->getBox(), ln, local_patch_num);
+            for (BoxList<NDIM>::Iterator bl(active_boxes); bl; bl++)
+            {
+                dst_data->getArrayData().copy(src_data->getArrayData(), bl());
+            }
+        }
+    }
+    return;
+} // copyNarrowBandData
+
+double
+LSInitStrategy::computeNarrowBandDifferenceL2Norm(const int D_idx,
+                                                  const int D_iter_idx,
+                                                  const int wgt_idx,
+                                                  Pointer<PatchHierarchy<NDIM> > hierarchy) const
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    double diff_norm_sq = 0.0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            Pointer<CellData<NDIM, double> > D_iter_data = patch->getPatchData(D_iter_idx);
+            Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+            const BoxList<NDIM> active_boxes = getActiveBoxes(patch->getBox(), ln, local_patch_num);
+            for (BoxList<NDIM>::Iterator bl(active_boxes); bl; bl++)
+            {
+                for (Box<NDIM>::Iterator b(bl()); b; b++)
+                {
+                    const CellIndex<NDIM> i(b());
+                    const double diff = (*D_data)(i) - (*D_iter_data)(i);
+                    diff_norm_sq += (*wgt_data)(i) * diff * diff;
+                }
+            }
+        }
+    }
+    return sqrt(SAMRAI_MPI::sumReduction(diff_norm_sq));
+} // computeNarrowBandDifferenceL2Norm
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
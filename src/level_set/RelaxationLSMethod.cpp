@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibamr/RelaxationLSMethod.h"
+#include "BoxList.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IBAMR_config.h"
@@ -65,6 +66,14 @@ void RELAXATION_LS_1ST_ORDER_FC(double* U,
 #if (NDIM == 3)
                                 const int& ilower2,
                                 const int& iupper2,
+#endif
+                                const int& slower0,
+                                const int& supper0,
+                                const int& slower1,
+                                const int& supper1,
+#if (NDIM == 3)
+                                const int& slower2,
+                                const int& supper2,
 #endif
                                 const double* dx,
                                 const int& dir);
@@ -80,6 +89,14 @@ void RELAXATION_LS_3RD_ORDER_FC(double* U,
 #if (NDIM == 3)
                                 const int& ilower2,
                                 const int& iupper2,
+#endif
+                                const int& slower0,
+                                const int& supper0,
+                                const int& slower1,
+                                const int& supper1,
+#if (NDIM == 3)
+                                const int& slower2,
+                                const int& supper2,
 #endif
                                 const double* dx,
                                 const int& dir);
@@ -168,13 +185,34 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
     fill_op->resetTransactionComponent(D_transaction);
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_idx);
         fill_op->fillData(time);
+
+        // After the first iteration, only the values within the narrow band are
+        // updated and used to check for convergence.  The band is redetermined
+        // every iteration from the current values, so that it can grow across
+        // patch boundaries.
+        if (d_use_narrow_band && outer_iter > 0) updateNarrowBand(D_idx, hierarchy);
+        const bool narrow_band = hasNarrowBand();
+        if (narrow_band)
+        {
+            copyNarrowBandData(D_iter_idx, D_idx, hierarchy);
+        }
+        else
+        {
+            hier_cc_data_ops.copyData(D_iter_idx, D_idx);
+        }
         relax(hier_math_ops, D_idx, D_init_idx, outer_iter);
 
         // Compute error
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        if (narrow_band)
+        {
+            diff_L2_norm = computeNarrowBandDifferenceL2Norm(D_idx, D_iter_idx, cc_wgt_idx, hierarchy);
+        }
+        else
+        {
+            hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
+            diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        }
 
         outer_iter += 1;
 
@@ -201,6 +239,13 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
         }
     }
 
+    // Clamp the values outside of the narrow band.
+    if (d_use_narrow_band)
+    {
+        clampOutsideNarrowBand(D_idx, hierarchy);
+        deallocateNarrowBand();
+    }
+
     // Deallocate the temporary variable.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
@@ -228,12 +273,17 @@ RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        int local_patch_num = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
             const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
-            relax(dist_data, dist_init_data, patch, iter);
+            const BoxList<NDIM> active_boxes = getActiveBoxes(patch->getBox(), ln, local_patch_num);
+            for (BoxList<NDIM>::Iterator bl(active_boxes); bl; bl++)
+            {
+                relax(dist_data, dist_init_data, patch, bl(), iter);
+            }
         }
     }
     return;
@@ -244,6 +294,7 @@ void
 RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
                           const Pointer<CellData<NDIM, double> > dist_init_data,
                           const Pointer<Patch<NDIM> > patch,
+                          const Box<NDIM>& box,
                           const int iter) const
 {
     double* const D = dist_data->getPointer(0);
@@ -287,6 +338,14 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                    patch_box.lower(2),
                                    patch_box.upper(2),
+#endif
+                                   box.lower(0),
+                                   box.upper(0),
+                                   box.lower(1),
+                                   box.upper(1),
+#if (NDIM == 3)
+                                   box.lower(2),
+                                   box.upper(2),
 #endif
                                    dx,
                                    dir);
@@ -304,6 +363,14 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
 #if (NDIM == 3)
                                    patch_box.lower(2),
                                    patch_box.upper(2),
+#endif
+                                   box.lower(0),
+                                   box.upper(0),
+                                   box.lower(1),
+                                   box.upper(1),
+#if (NDIM == 3)
+                                   box.lower(2),
+                                   box.upper(2),
 #endif
                                    dx,
                                    dir);
@@ -330,6 +397,8 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
 
+    getNarrowBandFromInput(input_db);
+
     return;
 } // getFromInput
 
@@ -72,7 +72,11 @@ include(TOP_SRCDIR/src/fortran/const.i)dnl
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Carry out first-order accurate fast sweeping algorithm
+c     Carry out a single sweep of the first-order accurate fast
+c     sweeping algorithm in the direction specified by the signs of
+c     sweep0:sweep1 (each of which is +1 or -1)
+c
+c     Only the cells in the index box slower:supper are updated.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
@@ -80,6 +84,9 @@ c
      &     U,U_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     slower0,supper0,
+     &     slower1,supper1,
+     &     sweep0,sweep1,
      &     dlower0,dupper0,
      &     dlower1,dupper1,
      &     dx,
@@ -93,6 +100,9 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER slower0,supper0
+      INTEGER slower1,supper1
+      INTEGER sweep0,sweep1
       INTEGER dlower0,dupper0
       INTEGER dlower1,dupper1
       INTEGER U_gcw
@@ -108,53 +118,27 @@ c
 c     Local variables.
 c
       INTEGER i0,i1
+      INTEGER start0,end0,start1,end1
     
       
-c     Do the four sweeping directions.
-      do i1 = ilower1,iupper1
-         do i0 = ilower0,iupper0
-            call evalsweep1storder2d(U,U_gcw,
-     &                               ilower0,iupper0,
-     &                               ilower1,iupper1,
-     &                               i0,i1,
-     &                               dlower0,dupper0,
-     &                               dlower1,dupper1,
-     &                               dx,
-     &                               patch_touches_bdry,
-     &                               touches_wall_loc_idx)
-         enddo
-      enddo
-      
-      do i1 = ilower1,iupper1
-         do i0 = iupper0,ilower0,-1
-            call evalsweep1storder2d(U,U_gcw,
-     &                               ilower0,iupper0,
-     &                               ilower1,iupper1,
-     &                               i0,i1,
-     &                               dlower0,dupper0,
-     &                               dlower1,dupper1,
-     &                               dx,
-     &                               patch_touches_bdry,
-     &                               touches_wall_loc_idx)     
-         enddo
-      enddo
-      
-      do i1 = iupper1,ilower1,-1
-         do i0 = iupper0,ilower0,-1
-            call evalsweep1storder2d(U,U_gcw,
-     &                               ilower0,iupper0,
-     &                               ilower1,iupper1,
-     &                               i0,i1,
-     &                               dlower0,dupper0,
-     &                               dlower1,dupper1,
-     &                               dx,
-     &                               patch_touches_bdry,
-     &                               touches_wall_loc_idx)
-         enddo
-      enddo
-      
-      do i1 = iupper1,ilower1,-1
-         do i0 = ilower0,iupper0
+c     Do a single sweep in the specified direction.
+      if (sweep0 .gt. 0) then
+         start0 = slower0
+         end0 = supper0
+      else
+         start0 = supper0
+         end0 = slower0
+      endif
+      if (sweep1 .gt. 0) then
+         start1 = slower1
+         end1 = supper1
+      else
+         start1 = supper1
+         end1 = slower1
+      endif
+
+      do i1 = start1,end1,sweep1
+         do i0 = start0,end0,sweep0
             call evalsweep1storder2d(U,U_gcw,
      &                               ilower0,iupper0,
      &                               ilower1,iupper1,
@@ -287,6 +271,8 @@ ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out first order relaxation scheme using Gauss Seidel updates
 c
+c     Only the cells in the index box slower:supper are updated.
+c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
       subroutine relaxationls1storder2d(
@@ -294,6 +280,8 @@ c
      &     V,V_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     slower0,supper0,
+     &     slower1,supper1,
      &     dx,
      &     dir)
 c
@@ -305,6 +293,8 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER slower0,supper0
+      INTEGER slower1,supper1
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -320,8 +310,8 @@ c
       INTEGER i0,i1
 
       if (dir .eq. 0) then
-        do i1 = ilower1,iupper1
-          do i0 = ilower0,iupper0
+        do i1 = slower1,supper1
+          do i0 = slower0,supper0
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -329,8 +319,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i1 = ilower1,iupper1
-          do i0 = iupper0,ilower0,-1
+        do i1 = slower1,supper1
+          do i0 = supper0,slower0,-1
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -338,8 +328,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i1 = iupper1,ilower1,-1
-          do i0 = ilower0,iupper0
+        do i1 = supper1,slower1,-1
+          do i0 = slower0,supper0
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -347,8 +337,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 3 )then
-        do i1 = iupper1,ilower1,-1
-          do i0 = iupper0,ilower0,-1
+        do i1 = supper1,slower1,-1
+          do i0 = supper0,slower0,-1
               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -435,6 +425,8 @@ c
 c     Uses second order WENO for spatial discretization with a subcell
 c     fix near the interface
 c
+c     Only the cells in the index box slower:supper are updated.
+c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
       subroutine relaxationls3rdorder2d(
@@ -442,6 +434,8 @@ c
      &     V,V_gcw,
      &     ilower0,iupper0,
      &     ilower1,iupper1,
+     &     slower0,supper0,
+     &     slower1,supper1,
      &     dx,
      &     dir)
 c
@@ -453,6 +447,8 @@ c     Input.
 c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
+      INTEGER slower0,supper0
+      INTEGER slower1,supper1
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -468,8 +464,8 @@ c
       INTEGER i0,i1
 
       if (dir .eq. 0) then
-        do i1 = ilower1,iupper1
-          do i0 = ilower0,iupper0
+        do i1 = slower1,supper1
+          do i0 = slower0,supper0
               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -477,8 +473,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i1 = ilower1,iupper1
-          do i0 = iupper0,ilower0,-1
+        do i1 = slower1,supper1
+          do i0 = supper0,slower0,-1
               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -486,8 +482,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i1 = iupper1,ilower1,-1
-          do i0 = ilower0,iupper0
+        do i1 = supper1,slower1,-1
+          do i0 = slower0,supper0
               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
@@ -495,8 +491,8 @@ c
           enddo
         enddo
       elseif (dir .eq. 3 )then
-        do i1 = iupper1,ilower1,-1
-          do i0 = iupper0,ilower0,-1
+        do i1 = supper1,slower1,-1
+          do i0 = supper0,slower0,-1
               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
      &                                 ilower0,iupper0,
      &                                 ilower1,iupper1,
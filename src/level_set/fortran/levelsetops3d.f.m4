@@ -80,7 +80,11 @@ include(TOP_SRCDIR/src/fortran/const.i)dnl
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
-c     Carry out first-order accurate fast sweeping algorithm
+c     Carry out a single sweep of the first-order accurate fast
+c     sweeping algorithm in the direction specified by the signs of
+c     sweep0:sweep2 (each of which is +1 or -1)
+c
+c     Only the cells in the index box slower:supper are updated.
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
@@ -89,6 +93,10 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     slower0,supper0,
+     &     slower1,supper1,
+     &     slower2,supper2,
+     &     sweep0,sweep1,sweep2,
      &     dlower0,dupper0,
      &     dlower1,dupper1,
      &     dlower2,dupper2,
@@ -104,6 +112,10 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER slower0,supper0
+      INTEGER slower1,supper1
+      INTEGER slower2,supper2
+      INTEGER sweep0,sweep1,sweep2
       INTEGER dlower0,dupper0
       INTEGER dlower1,dupper1
       INTEGER dlower2,dupper2
@@ -120,149 +132,45 @@ c
 c     Local variables.
 c
       INTEGER i0,i1,i2
+      INTEGER start0,end0,start1,end1,start2,end2
       
-c     Do the eight sweeping directions.
-      do i2 = ilower2,iupper2
-         do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
-              call evalsweep1storder3d(U,U_gcw,
-     &                                 ilower0,iupper0,
-     &                                 ilower1,iupper1,
-     &                                 ilower2,iupper2,
-     &                                 i0,i1,i2,
-     &                                 dlower0,dupper0,
-     &                                 dlower1,dupper1,
-     &                                 dlower2,dupper2,
-     &                                 dx,
-     &                                 patch_touches_bdry,
-     &                                 touches_wall_loc_idx)
-
-            enddo
-         enddo
-      enddo
-      
-      do i2 = ilower2,iupper2
-         do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
-              call evalsweep1storder3d(U,U_gcw,
-     &                                 ilower0,iupper0,
-     &                                 ilower1,iupper1,
-     &                                 ilower2,iupper2,
-     &                                 i0,i1,i2,
-     &                                 dlower0,dupper0,
-     &                                 dlower1,dupper1,
-     &                                 dlower2,dupper2,
-     &                                 dx,
-     &                                 patch_touches_bdry,
-     &                                 touches_wall_loc_idx)
-            enddo
-         enddo
-      enddo
-
-      do i2 = ilower2,iupper2
-         do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
-              call evalsweep1storder3d(U,U_gcw,
-     &                                 ilower0,iupper0,
-     &                                 ilower1,iupper1,
-     &                                 ilower2,iupper2,
-     &                                 i0,i1,i2,
-     &                                 dlower0,dupper0,
-     &                                 dlower1,dupper1,
-     &                                 dlower2,dupper2,
-     &                                 dx,
-     &                                 patch_touches_bdry,
-     &                                 touches_wall_loc_idx)
-            enddo
-         enddo
-      enddo
-
-      do i2 = iupper2,ilower2,-1
-         do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
-              call evalsweep1storder3d(U,U_gcw,
-     &                                 ilower0,iupper0,
-     &                                 ilower1,iupper1,
-     &                                 ilower2,iupper2,
-     &                                 i0,i1,i2,
-     &                                 dlower0,dupper0,
-     &                                 dlower1,dupper1,
-     &                                 dlower2,dupper2,
-     &                                 dx,
-     &                                 patch_touches_bdry,
-     &                                 touches_wall_loc_idx)
-            enddo
-         enddo
-      enddo
-
-      do i2 = ilower2,iupper2
-         do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
-              call evalsweep1storder3d(U,U_gcw,
-     &                                 ilower0,iupper0,
-     &                                 ilower1,iupper1,
-     &                                 ilower2,iupper2,
-     &                                 i0,i1,i2,
-     &                                 dlower0,dupper0,
-     &                                 dlower1,dupper1,
-     &                                 dlower2,dupper2,
-     &                                 dx,
-     &                                 patch_touches_bdry,
-     &                                 touches_wall_loc_idx)
-            enddo
-         enddo
-      enddo
-
-      do i2 = iupper2,ilower2,-1
-         do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
-              call evalsweep1storder3d(U,U_gcw,
-     &                                 ilower0,iupper0,
-     &                                 ilower1,iupper1,
-     &                                 ilower2,iupper2,
-     &                                 i0,i1,i2,
-     &                                 dlower0,dupper0,
-     &                                 dlower1,dupper1,
-     &                                 dlower2,dupper2,
-     &                                 dx,
-     &                                 patch_touches_bdry,
-     &                                 touches_wall_loc_idx)
-            enddo
-         enddo
-      enddo
-
-      do i2 = iupper2,ilower2,-1
-         do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
-              call evalsweep1storder3d(U,U_gcw,
-     &                                 ilower0,iupper0,
-     &                                 ilower1,iupper1,
-     &                                 ilower2,iupper2,
-     &                                 i0,i1,i2,
-     &                                 dlower0,dupper0,
-     &                                 dlower1,dupper1,
-     &                                 dlower2,dupper2,
-     &                                 dx,
-     &                                 patch_touches_bdry,
-     &                                 touches_wall_loc_idx)
-            enddo
-         enddo
-      enddo
+c     Do a single sweep in the specified direction.
+      if (sweep0 .gt. 0) then
+         start0 = slower0
+         end0 = supper0
+      else
+         start0 = supper0
+         end0 = slower0
+      endif
+      if (sweep1 .gt. 0) then
+         start1 = slower1
+         end1 = supper1
+      else
+         start1 = supper1
+         end1 = slower1
+      endif
+      if (sweep2 .gt. 0) then
+         start2 = slower2
+         end2 = supper2
+      else
+         start2 = supper2
+         end2 = slower2
+      endif
 
-      do i2 = iupper2,ilower2,-1
-         do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
-              call evalsweep1storder3d(U,U_gcw,
-     &                                 ilower0,iupper0,
-     &                                 ilower1,iupper1,
-     &                                 ilower2,iupper2,
-     &                                 i0,i1,i2,
-     &                                 dlower0,dupper0,
-     &                                 dlower1,dupper1,
-     &                                 dlower2,dupper2,
-     &                                 dx,
-     &                                 patch_touches_bdry,
-     &                                 touches_wall_loc_idx)
+      do i2 = start2,end2,sweep2
+         do i1 = start1,end1,sweep1
+            do i0 = start0,end0,sweep0
+               call evalsweep1storder3d(U,U_gcw,
+     &                                  ilower0,iupper0,
+     &                                  ilower1,iupper1,
+     &                                  ilower2,iupper2,
+     &                                  i0,i1,i2,
+     &                                  dlower0,dupper0,
+     &                                  dlower1,dupper1,
+     &                                  dlower2,dupper2,
+     &                                  dx,
+     &                                  patch_touches_bdry,
+     &                                  touches_wall_loc_idx)
             enddo
          enddo
       enddo
@@ -453,6 +361,8 @@ ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Carry out first order relaxation scheme using Gauss Seidel updates
 c
+c     Only the cells in the index box slower:supper are updated.
+c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
       subroutine relaxationls1storder3d(
@@ -461,6 +371,9 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     slower0,supper0,
+     &     slower1,supper1,
+     &     slower2,supper2,
      &     dx,
      &     dir)
 c
@@ -473,6 +386,9 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER slower0,supper0
+      INTEGER slower1,supper1
+      INTEGER slower2,supper2
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -488,9 +404,9 @@ c
       INTEGER i0,i1,i2
 
       if (dir .eq. 0) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = slower2,supper2
+          do i1 = slower1,supper1
+            do i0 = slower0,supper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -500,9 +416,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = slower2,supper2
+          do i1 = slower1,supper1
+            do i0 = supper0,slower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -512,9 +428,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = slower2,supper2
+          do i1 = supper1,slower1,-1
+            do i0 = slower0,supper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -524,9 +440,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 3) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = supper2,slower2,-1
+          do i1 = slower1,supper1
+            do i0 = slower0,supper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -536,9 +452,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 4) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = slower2,supper2
+          do i1 = supper1,slower1,-1
+            do i0 = supper0,slower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -548,9 +464,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 5) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = supper2,slower2,-1
+          do i1 = slower1,supper1
+            do i0 = supper0,slower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -560,9 +476,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 6) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = supper2,slower2,-1
+          do i1 = supper1,slower1,-1
+            do i0 = slower0,supper0
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -572,9 +488,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 7) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = supper2,slower2,-1
+          do i1 = supper1,slower1,-1
+            do i0 = supper0,slower0,-1
                 call evalrelax1storder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -669,6 +585,8 @@ c
 c     Uses second order WENO for spatial discretization with a subcell
 c     fix near the interface
 c
+c     Only the cells in the index box slower:supper are updated.
+c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
       subroutine relaxationls3rdorder3d(
@@ -677,6 +595,9 @@ c
      &     ilower0,iupper0,
      &     ilower1,iupper1,
      &     ilower2,iupper2,
+     &     slower0,supper0,
+     &     slower1,supper1,
+     &     slower2,supper2,
      &     dx,
      &     dir)
 c
@@ -689,6 +610,9 @@ c
       INTEGER ilower0,iupper0
       INTEGER ilower1,iupper1
       INTEGER ilower2,iupper2
+      INTEGER slower0,supper0
+      INTEGER slower1,supper1
+      INTEGER slower2,supper2
       INTEGER U_gcw,V_gcw
       INTEGER dir
 
@@ -704,9 +628,9 @@ c
       INTEGER i0,i1,i2
 
       if (dir .eq. 0) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = slower2,supper2
+          do i1 = slower1,supper1
+            do i0 = slower0,supper0
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -716,9 +640,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 1) then
-        do i2 = ilower2,iupper2
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = slower2,supper2
+          do i1 = slower1,supper1
+            do i0 = supper0,slower0,-1
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -728,9 +652,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 2) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = slower2,supper2
+          do i1 = supper1,slower1,-1
+            do i0 = slower0,supper0
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -740,9 +664,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 3) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = ilower0,iupper0
+        do i2 = supper2,slower2,-1
+          do i1 = slower1,supper1
+            do i0 = slower0,supper0
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -752,9 +676,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 4) then
-        do i2 = ilower2,iupper2
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = slower2,supper2
+          do i1 = supper1,slower1,-1
+            do i0 = supper0,slower0,-1
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -764,9 +688,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 5) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = ilower1,iupper1
-            do i0 = iupper0,ilower0,-1
+        do i2 = supper2,slower2,-1
+          do i1 = slower1,supper1
+            do i0 = supper0,slower0,-1
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -776,9 +700,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 6) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = ilower0,iupper0
+        do i2 = supper2,slower2,-1
+          do i1 = supper1,slower1,-1
+            do i0 = slower0,supper0
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
@@ -788,9 +712,9 @@ c
           enddo
         enddo
       elseif (dir .eq. 7) then
-        do i2 = iupper2,ilower2,-1
-          do i1 = iupper1,ilower1,-1
-            do i0 = iupper0,ilower0,-1
+        do i2 = supper2,slower2,-1
+          do i1 = supper1,slower1,-1
+            do i0 = supper0,slower0,-1
                 call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
      &                                   ilower0,iupper0,
      &                                   ilower1,iupper1,
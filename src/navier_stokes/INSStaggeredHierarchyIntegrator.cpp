@@ -96,6 +96,7 @@
 #include "ibamr/INSStaggeredVelocityBcCoef.h"
 #include "ibamr/StaggeredStokesBlockPreconditioner.h"
 #include "ibamr/StaggeredStokesFACPreconditioner.h"
+#include "ibamr/StaggeredStokesInitialGuessAccelerator.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/StaggeredStokesSolver.h"
 #include "ibamr/StaggeredStokesSolverManager.h"
@@ -550,6 +551,18 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(const std::stri
     if (input_db->keyExists("explicitly_remove_nullspace"))
         d_explicitly_remove_nullspace = input_db->getBool("explicitly_remove_nullspace");
 
+    // Flag to determine whether we use the solutions of previous Stokes solves
+    // to compute initial guesses.
+    if (input_db->keyExists("use_stokes_initial_guess_accelerator") &&
+        input_db->getBool("use_stokes_initial_guess_accelerator"))
+    {
+        Pointer<Database> stokes_initial_guess_db;
+        if (input_db->keyExists("stokes_initial_guess_db"))
+            stokes_initial_guess_db = input_db->getDatabase("stokes_initial_guess_db");
+        d_stokes_initial_guess_accelerator = new StaggeredStokesInitialGuessAccelerator(
+            d_object_name + "::stokes_initial_guess_accelerator", stokes_initial_guess_db);
+    }
+
     // Setup physical boundary conditions objects.
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_U_bc_coefs.resize(NDIM);
@@ -1322,6 +1335,11 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     // Setup the solution and right-hand-side vectors.
     setupSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
+    // Use the solutions of previous time steps to improve the initial guess.
+    // Subsequent cycles already start from the solution of the previous cycle.
+    const bool use_initial_guess_accelerator = d_stokes_initial_guess_accelerator && cycle_num == 0;
+    if (use_initial_guess_accelerator) d_stokes_initial_guess_accelerator->computeInitialGuess(*d_sol_vec, *d_rhs_vec);
+
     // Solve for u(n+1), p(n+1/2).
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
     if (d_enable_logging)
@@ -1333,6 +1351,7 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
              << "::integrateHierarchy(): stokes solve residual norm        = " << d_stokes_solver->getResidualNorm()
              << "\n";
     if (d_explicitly_remove_nullspace) removeNullSpace(d_sol_vec);
+    if (use_initial_guess_accelerator) d_stokes_initial_guess_accelerator->recordSolution(*d_sol_vec);
 
     // Reset the solution and right-hand-side vectors.
     resetSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
@@ -2006,6 +2025,7 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_velocity_solver_needs_init = true;
     d_pressure_solver_needs_init = true;
     d_stokes_solver_needs_init = true;
+    if (d_stokes_initial_guess_accelerator) d_stokes_initial_guess_accelerator->deallocateAcceleratorState();
     return;
 } // resetHierarchyConfigurationSpecialized
 
@@ -2607,6 +2627,14 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
                 p_stokes_linear_solver->setNullspace(false, d_nul_vecs);
         }
         d_stokes_solver->initializeSolverState(*d_sol_vec, *d_rhs_vec);
+        if (d_stokes_initial_guess_accelerator)
+        {
+            // Previously computed solutions are not retained when the solver
+            // is reinitialized, since the operator may have changed.
+            d_stokes_initial_guess_accelerator->setStokesSolver(d_stokes_solver);
+            if (!d_stokes_initial_guess_accelerator->getIsInitialized())
+                d_stokes_initial_guess_accelerator->initializeAcceleratorState(*d_sol_vec, *d_rhs_vec);
+        }
         d_stokes_solver_needs_init = false;
     }
     return;
@@ -0,0 +1,308 @@
+// Filename: StaggeredStokesInitialGuessAccelerator.cpp
+// Created on 18 Oct 2026 by Boyce Griffith
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <math.h>
+#include <algorithm>
+#include <deque>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "SAMRAIVectorReal.h"
+#include "ibamr/StaggeredStokesInitialGuessAccelerator.h"
+#include "ibamr/StaggeredStokesSolver.h"
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/KrylovLinearSolver.h"
+#include "ibtk/LinearOperator.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+StaggeredStokesInitialGuessAccelerator::StaggeredStokesInitialGuessAccelerator(const std::string& object_name,
+                                                                               Pointer<Database> input_db)
+    : d_object_name(object_name),
+      d_max_history_size(4),
+      d_drop_tol(1.0e-8),
+      d_enable_logging(false),
+      d_stokes_solver(),
+      d_A(),
+      d_is_initialized(false),
+      d_x_vecs(),
+      d_b_vecs(),
+      d_history(),
+      d_b_hat(),
+      d_r(),
+      d_have_rhs(false)
+{
+    if (input_db)
+    {
+        if (input_db->keyExists("max_history_size")) d_max_history_size = input_db->getInteger("max_history_size");
+        if (input_db->keyExists("drop_tolerance")) d_drop_tol = input_db->getDouble("drop_tolerance");
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+    if (d_max_history_size < 1)
+    {
+        TBOX_ERROR(d_object_name << "::StaggeredStokesInitialGuessAccelerator():\n"
+                                 << "  max_history_size must be positive\n"
+                                 << "  max_history_size = "
+                                 << d_max_history_size
+                                 << std::endl);
+    }
+    return;
+} // StaggeredStokesInitialGuessAccelerator
+
+StaggeredStokesInitialGuessAccelerator::~StaggeredStokesInitialGuessAccelerator()
+{
+    deallocateAcceleratorState();
+    return;
+} // ~StaggeredStokesInitialGuessAccelerator
+
+void
+StaggeredStokesInitialGuessAccelerator::setStokesSolver(Pointer<StaggeredStokesSolver> stokes_solver)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(stokes_solver);
+#endif
+    d_stokes_solver = stokes_solver;
+    d_A.setNull();
+    Pointer<KrylovLinearSolver> p_stokes_krylov_solver = d_stokes_solver;
+    if (p_stokes_krylov_solver) d_A = p_stokes_krylov_solver->getOperator();
+    resetHistory();
+    return;
+} // setStokesSolver
+
+void
+StaggeredStokesInitialGuessAccelerator::initializeAcceleratorState(const SAMRAIVectorReal<NDIM, double>& x,
+                                                                   const SAMRAIVectorReal<NDIM, double>& b)
+{
+    if (d_is_initialized) deallocateAcceleratorState();
+
+    const int num_slots = d_max_history_size + 1;
+    d_x_vecs.resize(num_slots);
+    d_b_vecs.resize(num_slots);
+    for (int k = 0; k < num_slots; ++k)
+    {
+        std::ostringstream stream;
+        stream << k;
+        d_x_vecs[k] = x.cloneVector(d_object_name + "::x_" + stream.str());
+        d_x_vecs[k]->allocateVectorData();
+        d_b_vecs[k] = b.cloneVector(d_object_name + "::b_" + stream.str());
+        d_b_vecs[k]->allocateVectorData();
+    }
+    d_b_hat = b.cloneVector(d_object_name + "::b_hat");
+    d_b_hat->allocateVectorData();
+    d_r = b.cloneVector(d_object_name + "::r");
+    d_r->allocateVectorData();
+
+    d_history.clear();
+    d_have_rhs = false;
+    d_is_initialized = true;
+    return;
+} // initializeAcceleratorState
+
+void
+StaggeredStokesInitialGuessAccelerator::deallocateAcceleratorState()
+{
+    if (!d_is_initialized) return;
+
+    for (unsigned int k = 0; k < d_x_vecs.size(); ++k)
+    {
+        d_x_vecs[k]->deallocateVectorData();
+        d_x_vecs[k]->freeVectorComponents();
+        d_b_vecs[k]->deallocateVectorData();
+        d_b_vecs[k]->freeVectorComponents();
+    }
+    d_x_vecs.clear();
+    d_b_vecs.clear();
+    d_b_hat->deallocateVectorData();
+    d_b_hat->freeVectorComponents();
+    d_b_hat.setNull();
+    d_r->deallocateVectorData();
+    d_r->freeVectorComponents();
+    d_r.setNull();
+
+    d_history.clear();
+    d_have_rhs = false;
+    d_is_initialized = false;
+    return;
+} // deallocateAcceleratorState
+
+bool
+StaggeredStokesInitialGuessAccelerator::getIsInitialized() const
+{
+    return d_is_initialized;
+} // getIsInitialized
+
+void
+StaggeredStokesInitialGuessAccelerator::resetHistory()
+{
+    d_history.clear();
+    d_have_rhs = false;
+    return;
+} // resetHistory
+
+int
+StaggeredStokesInitialGuessAccelerator::getHistorySize() const
+{
+    return static_cast<int>(d_history.size());
+} // getHistorySize
+
+void
+StaggeredStokesInitialGuessAccelerator::computeInitialGuess(SAMRAIVectorReal<NDIM, double>& x,
+                                                            SAMRAIVectorReal<NDIM, double>& b)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+    TBOX_ASSERT(d_stokes_solver);
+#endif
+    setModifiedRhs(b);
+    d_have_rhs = true;
+    if (d_history.empty()) return;
+
+    // Determine the residual of the initial guess.  Without access to the
+    // operator, we project the right-hand side instead.
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_ptr(&x, false);
+    if (d_A)
+    {
+        d_A->setHomogeneousBc(true);
+        d_A->apply(x, *d_r);
+        d_A->setHomogeneousBc(d_stokes_solver->getHomogeneousBc());
+        d_r->subtract(d_b_hat, d_r);
+    }
+    else
+    {
+        d_r->copyVector(d_b_hat);
+        x.setToScalar(0.0);
+    }
+    const double r_norm = d_enable_logging ? d_r->L2Norm() : 0.0;
+
+    // Correct the initial guess using the retained solutions.  Because the
+    // retained right-hand sides are orthonormal, the coefficients are just the
+    // components of the residual in that basis.
+    double proj_norm_sq = 0.0;
+    for (std::deque<int>::const_iterator it = d_history.begin(); it != d_history.end(); ++it)
+    {
+        const double alpha = d_b_vecs[*it]->dot(d_r);
+        x.axpy(alpha, d_x_vecs[*it], x_ptr);
+        proj_norm_sq += alpha * alpha;
+    }
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::computeInitialGuess(): initial residual norm reduced from " << r_norm
+             << " to approximately " << sqrt(std::max(r_norm * r_norm - proj_norm_sq, 0.0)) << " using "
+             << d_history.size() << " previous solutions\n";
+    }
+    return;
+} // computeInitialGuess
+
+void
+StaggeredStokesInitialGuessAccelerator::recordSolution(SAMRAIVectorReal<NDIM, double>& x)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_is_initialized);
+#endif
+    if (!d_have_rhs)
+    {
+        TBOX_ERROR(d_object_name << "::recordSolution():\n"
+                                 << "  computeInitialGuess() must be called before recordSolution()"
+                                 << std::endl);
+    }
+    d_have_rhs = false;
+
+    // Find storage that is not in use by a retained pair.
+    int slot = 0;
+    while (std::find(d_history.begin(), d_history.end(), slot) != d_history.end()) ++slot;
+    Pointer<SAMRAIVectorReal<NDIM, double> > x_new = d_x_vecs[slot];
+    Pointer<SAMRAIVectorReal<NDIM, double> > b_new = d_b_vecs[slot];
+    x_new->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&x, false));
+    b_new->copyVector(d_b_hat);
+    const double b_norm = b_new->L2Norm();
+    if (b_norm == 0.0) return;
+
+    // Orthogonalize the new pair against the retained pairs using modified
+    // Gram-Schmidt with one step of reorthogonalization.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (std::deque<int>::const_iterator it = d_history.begin(); it != d_history.end(); ++it)
+        {
+            const double beta = d_b_vecs[*it]->dot(b_new);
+            b_new->axpy(-beta, d_b_vecs[*it], b_new);
+            x_new->axpy(-beta, d_x_vecs[*it], x_new);
+        }
+    }
+    const double b_new_norm = b_new->L2Norm();
+    if (b_new_norm <= d_drop_tol * b_norm)
+    {
+        if (d_enable_logging)
+            plog << d_object_name << "::recordSolution(): discarding linearly dependent solution\n";
+        return;
+    }
+    b_new->scale(1.0 / b_new_norm, b_new);
+    x_new->scale(1.0 / b_new_norm, x_new);
+
+    // Retain the new pair, discarding the oldest pair if necessary.
+    if (static_cast<int>(d_history.size()) == d_max_history_size) d_history.pop_front();
+    d_history.push_back(slot);
+    return;
+} // recordSolution
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+StaggeredStokesInitialGuessAccelerator::setModifiedRhs(SAMRAIVectorReal<NDIM, double>& b)
+{
+    d_b_hat->copyVector(Pointer<SAMRAIVectorReal<NDIM, double> >(&b, false));
+    if (d_A)
+    {
+        d_A->setHomogeneousBc(d_stokes_solver->getHomogeneousBc());
+        d_A->modifyRhsForBcs(*d_b_hat);
+    }
+    return;
+} // setModifiedRhs
+
+//////////////////////////////////////////////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
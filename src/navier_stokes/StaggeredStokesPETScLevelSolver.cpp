@@ -334,6 +334,7 @@ StaggeredStokesPETScLevelSolver::setupKSPVecs(Vec& petsc_x,
             PoissonUtilities::adjustRHSAtCoarseFineBoundary(
                 *f_adj_data, *u_data, patch, d_U_problem_coefs, type_1_cf_bdry);
         }
+        StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(d_U_bc_coefs, d_P_bc_coef);
     }
 
     StaggeredStokesPETScVecUtilities::copyToPatchLevelVec(
@@ -378,6 +378,7 @@ StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
                 }
                 u_bc_coefs[axis]->setBcCoefs(
                     acoef_data, bcoef_data, gcoef_data, NULL, *patch, trimmed_bdry_box, data_time);
+                if (extended_bc_coef) extended_bc_coef->setHomogeneousBc(false);
                 if (gcoef_data && homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
 
                 // Restore the original patch geometry object.
@@ -481,6 +482,7 @@ StaggeredStokesPETScMatUtilities::constructPatchLevelMACStokesOp(
                 }
                 u_bc_coefs[axis]->setBcCoefs(
                     acoef_data, bcoef_data, gcoef_data, NULL, *patch, trimmed_bdry_box, data_time);
+                if (extended_bc_coef) extended_bc_coef->setHomogeneousBc(false);
                 if (gcoef_data && homogeneous_bc && !extended_bc_coef) gcoef_data->fillAll(0.0);
 
                 // Modify the matrix coefficients to account for homogeneous
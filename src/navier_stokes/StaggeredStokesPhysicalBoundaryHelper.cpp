@@ -295,6 +295,8 @@ StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(const std::vector<Robi
 #endif
     for (unsigned int d = 0; d < NDIM; ++d)
     {
+        ExtendedRobinBcCoefStrategy* extended_u_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(u_bc_coefs[d]);
+        if (extended_u_bc_coef) extended_u_bc_coef->setHomogeneousBc(false);
         StokesBcCoefStrategy* stokes_u_bc_coef = dynamic_cast<StokesBcCoefStrategy*>(u_bc_coefs[d]);
         if (stokes_u_bc_coef)
         {
@@ -302,6 +304,8 @@ StaggeredStokesPhysicalBoundaryHelper::resetBcCoefObjects(const std::vector<Robi
             stokes_u_bc_coef->clearTargetPressurePatchDataIndex();
         }
     }
+    ExtendedRobinBcCoefStrategy* extended_p_bc_coef = dynamic_cast<ExtendedRobinBcCoefStrategy*>(p_bc_coef);
+    if (extended_p_bc_coef) extended_p_bc_coef->setHomogeneousBc(false);
     StokesBcCoefStrategy* stokes_p_bc_coef = dynamic_cast<StokesBcCoefStrategy*>(p_bc_coef);
     if (stokes_p_bc_coef)
     {
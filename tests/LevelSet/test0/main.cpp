@@ -0,0 +1,259 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/FastSweepingLSMethod.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+
+// The circular interface.
+struct CircularInterface
+{
+    IBTK::Vector X0;
+    double R;
+};
+
+// Initialize the level set in the neighborhood of a circular interface to the
+// exact signed distance, and elsewhere to large values of the correct sign.
+void
+circular_interface_neighborhood(int D_idx,
+                                Pointer<HierarchyMathOps> hier_math_ops,
+                                double /*time*/,
+                                bool /*initial_time*/,
+                                void* ctx)
+{
+    const CircularInterface* const circle = static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                IBTK::Vector X;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
+                }
+                const double dist = (X - circle->X0).norm() - circle->R;
+                if (std::abs(dist) < 1.5 * dx[0])
+                {
+                    (*D_data)(i) = dist;
+                }
+                else
+                {
+                    (*D_data)(i) = dist > 0.0 ? 1.0e8 : -1.0e8;
+                }
+            }
+        }
+    }
+    return;
+} // circular_interface_neighborhood
+
+/*******************************************************************************
+ * This test reinitializes the level set of a circle on a multi-patch, locally *
+ * refined grid with and without the narrow band, and checks that the results  *
+ * agree within the band and that the values outside of the band are clamped.  *
+ * The command line is:                                                        *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "LS.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double tol = input_db->getDoubleWithDefault("tolerance", 1.0e-8);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<CellVariable<NDIM, double> > D_var = new CellVariable<NDIM, double>("D");
+        const int D_full_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("full"), 1);
+        const int D_band_idx = var_db->registerVariableAndContext(D_var, var_db->getContext("band"), 1);
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(D_full_idx, 0.0);
+            level->allocatePatchData(D_band_idx, 0.0);
+        }
+        Pointer<HierarchyMathOps> hier_math_ops =
+            new HierarchyMathOps("HierarchyMathOps", patch_hierarchy, coarsest_ln, finest_ln);
+
+        // Reinitialize the level set with and without the narrow band.
+        CircularInterface circle;
+        circle.R = input_db->getDoubleWithDefault("R", 0.25);
+        for (unsigned int d = 0; d < NDIM; ++d) circle.X0[d] = 0.5;
+        Pointer<FastSweepingLSMethod> full_ls_ops =
+            new FastSweepingLSMethod("FullLevelSet", app_initializer->getComponentDatabase("FullLevelSet"), false);
+        full_ls_ops->registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, (void*)&circle);
+        full_ls_ops->initializeLSData(D_full_idx, hier_math_ops, 0.0, /*initial_time*/ true);
+        Pointer<FastSweepingLSMethod> band_ls_ops = new FastSweepingLSMethod(
+            "NarrowBandLevelSet", app_initializer->getComponentDatabase("NarrowBandLevelSet"), false);
+        band_ls_ops->registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, (void*)&circle);
+        band_ls_ops->initializeLSData(D_band_idx, hier_math_ops, 0.0, /*initial_time*/ true);
+
+        // Compare the results on the cells that are not covered by finer
+        // levels.  Inside the band, the two results should agree.  Outside the
+        // band, the values should be clamped to plus or minus the band width.
+        const double narrow_band_width = input_db->getDouble("NARROW_BAND_WIDTH");
+        double max_band_err = 0.0, max_clamp_err = 0.0;
+        int num_band_cells = 0, num_clamped_cells = 0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            BoxList<NDIM> covered_boxes;
+            if (ln < finest_ln)
+            {
+                Pointer<PatchLevel<NDIM> > finer_level = patch_hierarchy->getPatchLevel(ln + 1);
+                covered_boxes = BoxList<NDIM>(finer_level->getBoxes());
+                covered_boxes.coarsen(finer_level->getRatioToCoarserLevel());
+            }
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const dx = pgeom->getDx();
+                const double band_dist = narrow_band_width * *std::max_element(dx, dx + NDIM);
+                Pointer<CellData<NDIM, double> > D_full_data = patch->getPatchData(D_full_idx);
+                Pointer<CellData<NDIM, double> > D_band_data = patch->getPatchData(D_band_idx);
+                for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+                {
+                    const CellIndex<NDIM> i(b());
+                    bool is_covered = false;
+                    for (BoxList<NDIM>::Iterator bl(covered_boxes); bl && !is_covered; bl++)
+                    {
+                        is_covered = bl().contains(i);
+                    }
+                    if (is_covered) continue;
+                    const double D_full = (*D_full_data)(i);
+                    const double D_band = (*D_band_data)(i);
+                    if (std::abs(D_full) < band_dist)
+                    {
+                        max_band_err = std::max(max_band_err, std::abs(D_band - D_full));
+                        ++num_band_cells;
+                    }
+                    else
+                    {
+                        max_clamp_err =
+                            std::max(max_clamp_err, std::abs(D_band - (D_full > 0.0 ? band_dist : -band_dist)));
+                        ++num_clamped_cells;
+                    }
+                }
+            }
+        }
+        max_band_err = SAMRAI_MPI::maxReduction(max_band_err);
+        max_clamp_err = SAMRAI_MPI::maxReduction(max_clamp_err);
+        num_band_cells = SAMRAI_MPI::sumReduction(num_band_cells);
+        num_clamped_cells = SAMRAI_MPI::sumReduction(num_clamped_cells);
+        passed = max_band_err <= tol && max_clamp_err <= tol && num_band_cells > 0 && num_clamped_cells > 0;
+        pout << "cells inside the band:  " << num_band_cells << ", max |D_band - D_full| = " << max_band_err << "\n";
+        pout << "cells outside the band: " << num_clamped_cells << ", max clamping error = " << max_clamp_err
+             << "\n";
+        pout << (passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
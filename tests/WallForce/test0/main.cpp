@@ -0,0 +1,348 @@
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic C++ objects
+#include <algorithm>
+#include <cmath>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+#include <tbox/Array.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/WallForceEvaluator.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/IndexUtilities.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LInitStrategy.h>
+#include <ibtk/LNodeSetData.h>
+
+// The position of node k of a row of nodes parallel to the x axis.
+void
+node_posn(const int k, const double x_start, const double spacing, const double y, double* const X)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) X[d] = y;
+    X[0] = x_start + spacing * static_cast<double>(k);
+    return;
+} // node_posn
+
+// Initialize a row of Lagrangian nodes on the coarsest level.
+class RowInitializer : public LInitStrategy
+{
+public:
+    RowInitializer(const int num_nodes, const double x_start, const double spacing, const double y)
+        : d_num_nodes(num_nodes), d_x_start(x_start), d_spacing(spacing), d_y(y)
+    {
+        // intentionally blank
+        return;
+    } // RowInitializer
+
+    bool getLevelHasLagrangianData(const int level_number, const bool /*can_be_refined*/) const
+    {
+        return level_number == 0;
+    } // getLevelHasLagrangianData
+
+    unsigned int computeGlobalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                                    const int level_number,
+                                                    const double /*init_data_time*/,
+                                                    const bool /*can_be_refined*/,
+                                                    const bool /*initial_time*/)
+    {
+        return level_number == 0 ? d_num_nodes : 0;
+    } // computeGlobalNodeCountOnPatchLevel
+
+    unsigned int computeLocalNodeCountOnPatchLevel(Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                   const int level_number,
+                                                   const double /*init_data_time*/,
+                                                   const bool /*can_be_refined*/,
+                                                   const bool /*initial_time*/)
+    {
+        if (level_number != 0) return 0;
+        unsigned int local_node_count = 0;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            for (int k = 0; k < d_num_nodes; ++k)
+            {
+                double X[NDIM];
+                node_posn(k, d_x_start, d_spacing, d_y, X);
+                const Index<NDIM> idx =
+                    IndexUtilities::getCellIndex(X, hierarchy->getGridGeometry(), level->getRatio());
+                if (patch->getBox().contains(idx)) ++local_node_count;
+            }
+        }
+        return local_node_count;
+    } // computeLocalNodeCountOnPatchLevel
+
+    unsigned int initializeDataOnPatchLevel(const int lag_node_index_idx,
+                                            const unsigned int global_index_offset,
+                                            const unsigned int local_index_offset,
+                                            Pointer<LData> X_data,
+                                            Pointer<LData> /*U_data*/,
+                                            Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                            const int level_number,
+                                            const double /*init_data_time*/,
+                                            const bool /*can_be_refined*/,
+                                            const bool /*initial_time*/,
+                                            LDataManager* const /*l_data_manager*/)
+    {
+        boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+        int local_idx = -1;
+        int local_node_count = 0;
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LNodeSetData> index_data = patch->getPatchData(lag_node_index_idx);
+            for (int k = 0; k < d_num_nodes; ++k)
+            {
+                double X[NDIM];
+                node_posn(k, d_x_start, d_spacing, d_y, X);
+                const Index<NDIM> idx =
+                    IndexUtilities::getCellIndex(X, hierarchy->getGridGeometry(), level->getRatio());
+                if (!patch->getBox().contains(idx)) continue;
+                ++local_node_count;
+                const int lagrangian_idx = k + global_index_offset;
+                const int local_petsc_idx = ++local_idx + local_index_offset;
+                const int global_petsc_idx = local_petsc_idx + global_index_offset;
+                node_posn(k, d_x_start, d_spacing, d_y, &X_array[local_petsc_idx][0]);
+                if (!index_data->isElement(idx))
+                {
+                    index_data->appendItemPointer(idx, new LNodeSet());
+                }
+                index_data->getItem(idx)->push_back(new LNode(lagrangian_idx, global_petsc_idx, local_petsc_idx));
+            }
+        }
+        X_data->restoreArrays();
+        return local_node_count;
+    } // initializeDataOnPatchLevel
+
+private:
+    int d_num_nodes;
+    double d_x_start, d_spacing, d_y;
+};
+
+// The magnitude of the wall force at distance D from the wall.
+double
+wall_force(const double D, const SAMRAI::tbox::Array<double> params)
+{
+    return params[0] / D;
+} // wall_force
+
+// Compute the wall forces on the nodes and compare them to the forces
+// evaluated directly from the node positions.
+bool
+check_wall_forces(WallForceEvaluator& wall_force_evaluator,
+                  LDataManager* const l_data_manager,
+                  Pointer<PatchHierarchy<NDIM> > patch_hierarchy,
+                  const double wall_location,
+                  const double force_distance,
+                  const double force_scale,
+                  const double tol,
+                  const std::string& label)
+{
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, 0);
+    Pointer<LData> F_data = l_data_manager->getLData("F", 0);
+    int ierr = VecSet(F_data->getVec(), 0.0);
+    IBTK_CHKERRQ(ierr);
+    wall_force_evaluator.computeLagrangianForce(
+        F_data, X_data, Pointer<LData>(), patch_hierarchy, 0, 0.0, l_data_manager);
+
+    const boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    const boost::multi_array_ref<double, 2>& F_array = *F_data->getLocalFormVecArray();
+    double max_err = 0.0;
+    int num_forced_nodes = 0;
+    for (unsigned int k = 0; k < X_data->getLocalNodeCount(); ++k)
+    {
+        const double wall_distance = X_array[k][0] - wall_location;
+        double F_exact = 0.0;
+        if (std::abs(wall_distance) < force_distance)
+        {
+            F_exact = (wall_distance > 0.0 ? 1.0 : -1.0) * force_scale / std::abs(wall_distance);
+            ++num_forced_nodes;
+        }
+        max_err = std::max(max_err, std::abs(F_array[k][0] - F_exact));
+        for (unsigned int d = 1; d < NDIM; ++d) max_err = std::max(max_err, std::abs(F_array[k][d]));
+    }
+    X_data->restoreArrays();
+    F_data->restoreArrays();
+    max_err = SAMRAI_MPI::maxReduction(max_err);
+    num_forced_nodes = SAMRAI_MPI::sumReduction(num_forced_nodes);
+    const bool passed = max_err <= tol && num_forced_nodes > 0;
+    pout << label << ": forced nodes = " << num_forced_nodes << ", max |F - F_exact| = " << max_err
+         << (passed ? "" : " (FAILED)") << "\n";
+    return passed;
+} // check_wall_forces
+
+// Move the nodes in the x direction and redistribute them.
+void
+displace_and_redistribute(LDataManager* const l_data_manager, const double shift)
+{
+    Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, 0);
+    boost::multi_array_ref<double, 2>& X_array = *X_data->getLocalFormVecArray();
+    for (unsigned int k = 0; k < X_data->getLocalNodeCount(); ++k)
+    {
+        X_array[k][0] += shift;
+    }
+    X_data->restoreArrays();
+    l_data_manager->beginDataRedistribution();
+    l_data_manager->endDataRedistribution();
+    return;
+} // displace_and_redistribute
+
+/*******************************************************************************
+ * This test applies the force of a single wall to a row of Lagrangian nodes   *
+ * on a multi-patch grid and compares it to the force evaluated directly from  *
+ * the node positions.  The nodes are then moved and redistributed, and the    *
+ * comparison is repeated after the cached lists of nodes near the wall are    *
+ * reset and after they are rebuilt.  The command line is:                     *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = true;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "WallForce.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double tol = input_db->getDoubleWithDefault("tolerance", 1.0e-12);
+        const int num_nodes = input_db->getInteger("NUM_NODES");
+        const double shift = input_db->getDouble("SHIFT");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+
+        // Distribute a row of Lagrangian nodes that starts near the wall.
+        LDataManager* l_data_manager = LDataManager::getManager("LDataManager", "IB_4", "IB_4");
+        l_data_manager->registerLInitStrategy(new RowInitializer(num_nodes,
+                                                                 input_db->getDouble("X_START"),
+                                                                 input_db->getDouble("SPACING"),
+                                                                 input_db->getDouble("Y")));
+        l_data_manager->setPatchHierarchy(patch_hierarchy);
+        l_data_manager->setPatchLevels(0, 0);
+        l_data_manager->initializeLevelData(patch_hierarchy, 0, 0.0, false, true, NULL, true);
+        l_data_manager->resetHierarchyConfiguration(patch_hierarchy, 0, 0);
+        l_data_manager->freeLInitStrategy();
+        l_data_manager->createLData("F", 0, NDIM, /*maintain_data*/ true);
+
+        // Setup the wall.  With a grid spacing of one, the wall lies at
+        // x = location + 1 - side and acts on nodes closer than force_distance.
+        Pointer<Database> wall_force_db = app_initializer->getComponentDatabase("WallForceEvaluator");
+        WallForceEvaluator wall_force_evaluator(wall_force_db, grid_geometry);
+        wall_force_evaluator.registerWallForceFcn(&wall_force);
+        Pointer<Database> wall_db = wall_force_db->getDatabase("Wall_0");
+        const double wall_location = wall_db->getInteger("location") + 1 - wall_db->getInteger("side");
+        const double force_distance = wall_db->getDouble("force_distance");
+        const double force_scale = wall_db->getDoubleArray("parameters")[0];
+
+        // The node lists are built on first use.
+        passed = check_wall_forces(wall_force_evaluator,
+                                   l_data_manager,
+                                   patch_hierarchy,
+                                   wall_location,
+                                   force_distance,
+                                   force_scale,
+                                   tol,
+                                   "initial distribution") &&
+                 passed;
+
+        // After a redistribution, the node lists must be reset or rebuilt.
+        displace_and_redistribute(l_data_manager, shift);
+        wall_force_evaluator.resetLevelData(0);
+        passed = check_wall_forces(wall_force_evaluator,
+                                   l_data_manager,
+                                   patch_hierarchy,
+                                   wall_location,
+                                   force_distance,
+                                   force_scale,
+                                   tol,
+                                   "after resetLevelData()") &&
+                 passed;
+
+        displace_and_redistribute(l_data_manager, shift);
+        wall_force_evaluator.initializeLevelData(patch_hierarchy, 0, 0.0, false, l_data_manager);
+        passed = check_wall_forces(wall_force_evaluator,
+                                   l_data_manager,
+                                   patch_hierarchy,
+                                   wall_location,
+                                   force_distance,
+                                   force_scale,
+                                   tol,
+                                   "after initializeLevelData()") &&
+                 passed;
+        pout << (passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main